@@ -20,6 +20,7 @@
 #include <shogun/io/SerializableHdf5File.h>
 #include <shogun/io/SerializableJsonFile.h>
 #include <shogun/io/SerializableXmlFile.h>
+#include <shogun/io/SerializableBinaryFile.h>
 #include <shogun/io/SimpleFile.h>
 #include <shogun/io/MemoryMappedFile.h>
 %}
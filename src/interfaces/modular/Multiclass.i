@@ -13,6 +13,7 @@
 %rename(ConditionalProbabilityTree) CConditionalProbabilityTree;
 %rename(RandomConditionalProbabilityTree) CRandomConditionalProbabilityTree;
 %rename(RelaxedTree) CRelaxedTree;
+%rename(HistogramTreeEnsemble) CHistogramTreeEnsemble;
 %rename(RelaxedTreeNodeData) CRelaxedTreeNodeData;
 %rename(TreeMachineNode) CTreeMachineNode;
 %rename(VwConditionalProbabilityTree) VwConditionalProbabilityTree;
@@ -80,6 +81,7 @@ namespace shogun
 %include <shogun/multiclass/tree/BalancedConditionalProbabilityTree.h>
 %include <shogun/multiclass/tree/RandomConditionalProbabilityTree.h>
 %include <shogun/multiclass/tree/RelaxedTree.h>
+%include <shogun/multiclass/tree/HistogramTreeEnsemble.h>
 %include <shogun/multiclass/tree/TreeMachineNode.h>
 %include <shogun/multiclass/tree/VwConditionalProbabilityTree.h>
 
@@ -7,6 +7,7 @@
  #include <shogun/multiclass/tree/RandomConditionalProbabilityTree.h>
  #include <shogun/multiclass/tree/RelaxedTree.h>
  #include <shogun/multiclass/tree/RelaxedTreeUtil.h>
+ #include <shogun/multiclass/tree/HistogramTreeEnsemble.h>
  #include <shogun/multiclass/tree/TreeMachineNode.h>
  #include <shogun/multiclass/tree/VwConditionalProbabilityTree.h>
 
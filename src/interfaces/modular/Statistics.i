@@ -13,6 +13,7 @@
 %rename(KernelTwoSampleTestStatistic) CKernelTwoSampleTestStatistic;
 %rename(LinearTimeMMD) CLinearTimeMMD;
 %rename(QuadraticTimeMMD) CQuadraticTimeMMD;
+%rename(StreamingBlockMMD) CStreamingBlockMMD;
 %rename(KernelIndependenceTestStatistic) CKernelIndependenceTestStatistic;
 %rename(HSIC) CHSIC;
 %rename(KernelMeanMatching) CKernelMeanMatching;
@@ -31,6 +32,7 @@
 %include <shogun/statistics/KernelTwoSampleTestStatistic.h>
 %include <shogun/statistics/LinearTimeMMD.h>
 %include <shogun/statistics/QuadraticTimeMMD.h>
+%include <shogun/statistics/StreamingBlockMMD.h>
 %include <shogun/statistics/KernelIndependenceTestStatistic.h>
 %include <shogun/statistics/HSIC.h>
 %include <shogun/statistics/KernelMeanMatching.h>
@@ -4,6 +4,7 @@
  #include <shogun/statistics/KernelTwoSampleTestStatistic.h>
  #include <shogun/statistics/LinearTimeMMD.h>
  #include <shogun/statistics/QuadraticTimeMMD.h>
+ #include <shogun/statistics/StreamingBlockMMD.h>
  #include <shogun/statistics/KernelIndependenceTestStatistic.h>
  #include <shogun/statistics/HSIC.h>
  #include <shogun/statistics/KernelMeanMatching.h>
@@ -636,294 +636,294 @@ void Parameter::add(SGVector<bool>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_BOOL, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<char>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_CHAR, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<int8_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_INT8, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<uint8_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_UINT8, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<int16_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_INT16, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<uint16_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_UINT16, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<int32_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_INT32, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<uint32_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_UINT32, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<int64_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_INT64, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<uint64_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_UINT64, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<float32_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_FLOAT32, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<float64_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_FLOAT64, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<floatmax_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_FLOATMAX, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<complex128_t>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_COMPLEX128, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<CSGObject*>* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_NONE, PT_SGOBJECT, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<bool> >* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_BOOL, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<char> >* param, const char* name,
 		const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_CHAR, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<int8_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_INT8, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<uint8_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_UINT8, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<int16_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_INT16, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<uint16_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_UINT16, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<int32_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_INT32, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<uint32_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_UINT32, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<int64_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_INT64, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<uint64_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_UINT64, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<float32_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_FLOAT32, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<float64_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_FLOAT64, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGString<floatmax_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_STRING, PT_FLOATMAX, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<bool> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_BOOL, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<char> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_CHAR, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<int8_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_INT8, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<uint8_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_UINT8, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<int16_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_INT16, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<uint16_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_UINT16, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<int32_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_INT32, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<uint32_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_UINT32, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<int64_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_INT64, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<uint64_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_UINT64, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<float32_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_FLOAT32, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<float64_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_FLOAT64, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<floatmax_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_FLOATMAX, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 void Parameter::add(SGVector<SGSparseVector<complex128_t> >* param,
 		const char* name, const char* description)
 {
 	TSGDataType type(CT_SGVECTOR, ST_SPARSE, PT_COMPLEX128, &param->vlen);
-	add_type(&type, &param->vector, name, description);
+	add_referenced_type(&type, &param->vector, param, name, description);
 }
 
 /* **************************************************************** */
@@ -1315,7 +1315,7 @@ void Parameter::add(SGMatrix<bool>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_BOOL, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<char>* param, const char* name,
@@ -1323,7 +1323,7 @@ void Parameter::add(SGMatrix<char>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_CHAR, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<int8_t>* param, const char* name,
@@ -1331,7 +1331,7 @@ void Parameter::add(SGMatrix<int8_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_INT8, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<uint8_t>* param, const char* name,
@@ -1339,7 +1339,7 @@ void Parameter::add(SGMatrix<uint8_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_UINT8, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<int16_t>* param, const char* name,
@@ -1347,7 +1347,7 @@ void Parameter::add(SGMatrix<int16_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_INT16, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<uint16_t>* param, const char* name,
@@ -1355,7 +1355,7 @@ void Parameter::add(SGMatrix<uint16_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_UINT16, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<int32_t>* param, const char* name,
@@ -1363,7 +1363,7 @@ void Parameter::add(SGMatrix<int32_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_INT32, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<uint32_t>* param, const char* name,
@@ -1371,7 +1371,7 @@ void Parameter::add(SGMatrix<uint32_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_UINT32, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<int64_t>* param, const char* name,
@@ -1379,7 +1379,7 @@ void Parameter::add(SGMatrix<int64_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_INT64, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<uint64_t>* param, const char* name,
@@ -1387,7 +1387,7 @@ void Parameter::add(SGMatrix<uint64_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_UINT64, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<float32_t>* param, const char* name,
@@ -1395,7 +1395,7 @@ void Parameter::add(SGMatrix<float32_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_FLOAT32, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<float64_t>* param, const char* name,
@@ -1403,7 +1403,7 @@ void Parameter::add(SGMatrix<float64_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_FLOAT64, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<floatmax_t>* param, const char* name,
@@ -1411,7 +1411,7 @@ void Parameter::add(SGMatrix<floatmax_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_FLOATMAX, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<complex128_t>* param, const char* name,
@@ -1419,7 +1419,7 @@ void Parameter::add(SGMatrix<complex128_t>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_COMPLEX128, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<CSGObject*>* param, const char* name,
@@ -1427,7 +1427,7 @@ void Parameter::add(SGMatrix<CSGObject*>* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_SGOBJECT, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<bool> >* param, const char* name,
@@ -1435,7 +1435,7 @@ void Parameter::add(SGMatrix<SGString<bool> >* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_BOOL, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<char> >* param, const char* name,
@@ -1443,7 +1443,7 @@ void Parameter::add(SGMatrix<SGString<char> >* param, const char* name,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_CHAR, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<int8_t> >* param,
@@ -1451,7 +1451,7 @@ void Parameter::add(SGMatrix<SGString<int8_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_INT8, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<uint8_t> >* param,
@@ -1459,7 +1459,7 @@ void Parameter::add(SGMatrix<SGString<uint8_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_UINT8, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<int16_t> >* param,
@@ -1467,7 +1467,7 @@ void Parameter::add(SGMatrix<SGString<int16_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_INT16, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<uint16_t> >* param,
@@ -1475,7 +1475,7 @@ void Parameter::add(SGMatrix<SGString<uint16_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_UINT16, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<int32_t> >* param,
@@ -1483,7 +1483,7 @@ void Parameter::add(SGMatrix<SGString<int32_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_INT32, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<uint32_t> >* param,
@@ -1491,7 +1491,7 @@ void Parameter::add(SGMatrix<SGString<uint32_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_UINT32, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<int64_t> >* param,
@@ -1499,7 +1499,7 @@ void Parameter::add(SGMatrix<SGString<int64_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_INT64, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<uint64_t> >* param,
@@ -1507,7 +1507,7 @@ void Parameter::add(SGMatrix<SGString<uint64_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_UINT64, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<float32_t> >* param,
@@ -1515,7 +1515,7 @@ void Parameter::add(SGMatrix<SGString<float32_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_FLOAT32, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<float64_t> >* param,
@@ -1523,7 +1523,7 @@ void Parameter::add(SGMatrix<SGString<float64_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_FLOAT64, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGString<floatmax_t> >* param,
@@ -1531,7 +1531,7 @@ void Parameter::add(SGMatrix<SGString<floatmax_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_STRING, PT_FLOATMAX, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<bool> >* param,
@@ -1539,7 +1539,7 @@ void Parameter::add(SGMatrix<SGSparseVector<bool> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_BOOL, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<char> >* param,
@@ -1547,7 +1547,7 @@ void Parameter::add(SGMatrix<SGSparseVector<char> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_CHAR, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<int8_t> >* param,
@@ -1555,7 +1555,7 @@ void Parameter::add(SGMatrix<SGSparseVector<int8_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_INT8, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<uint8_t> >* param,
@@ -1563,7 +1563,7 @@ void Parameter::add(SGMatrix<SGSparseVector<uint8_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_UINT8, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<int16_t> >* param,
@@ -1571,7 +1571,7 @@ void Parameter::add(SGMatrix<SGSparseVector<int16_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_INT16, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<uint16_t> >* param,
@@ -1579,7 +1579,7 @@ void Parameter::add(SGMatrix<SGSparseVector<uint16_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_UINT16, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<int32_t> >* param,
@@ -1587,7 +1587,7 @@ void Parameter::add(SGMatrix<SGSparseVector<int32_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_INT32, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<uint32_t> >* param,
@@ -1595,7 +1595,7 @@ void Parameter::add(SGMatrix<SGSparseVector<uint32_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_UINT32, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<int64_t> >* param,
@@ -1603,7 +1603,7 @@ void Parameter::add(SGMatrix<SGSparseVector<int64_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_INT64, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<uint64_t> >* param,
@@ -1611,7 +1611,7 @@ void Parameter::add(SGMatrix<SGSparseVector<uint64_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_UINT64, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<float32_t> >* param,
@@ -1619,7 +1619,7 @@ void Parameter::add(SGMatrix<SGSparseVector<float32_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_FLOAT32, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<float64_t> >* param,
@@ -1627,7 +1627,7 @@ void Parameter::add(SGMatrix<SGSparseVector<float64_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_FLOAT64, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<floatmax_t> >* param,
@@ -1635,7 +1635,7 @@ void Parameter::add(SGMatrix<SGSparseVector<floatmax_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_FLOATMAX, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGMatrix<SGSparseVector<complex128_t> >* param,
@@ -1643,7 +1643,7 @@ void Parameter::add(SGMatrix<SGSparseVector<complex128_t> >* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_COMPLEX128, &param->num_rows,
 			&param->num_cols);
-	add_type(&type, &param->matrix, name, description);
+	add_referenced_type(&type, &param->matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<bool>* param,
@@ -1651,7 +1651,7 @@ void Parameter::add(SGSparseMatrix<bool>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_BOOL, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<char>* param,
@@ -1659,7 +1659,7 @@ void Parameter::add(SGSparseMatrix<char>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_CHAR, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<int8_t>* param,
@@ -1667,7 +1667,7 @@ void Parameter::add(SGSparseMatrix<int8_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_INT8, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<uint8_t>* param,
@@ -1675,7 +1675,7 @@ void Parameter::add(SGSparseMatrix<uint8_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_UINT8, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<int16_t>* param,
@@ -1683,7 +1683,7 @@ void Parameter::add(SGSparseMatrix<int16_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_INT16, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<uint16_t>* param,
@@ -1691,7 +1691,7 @@ void Parameter::add(SGSparseMatrix<uint16_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_UINT16, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<int32_t>* param,
@@ -1699,7 +1699,7 @@ void Parameter::add(SGSparseMatrix<int32_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_INT32, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<uint32_t>* param,
@@ -1707,7 +1707,7 @@ void Parameter::add(SGSparseMatrix<uint32_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_UINT32, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<int64_t>* param,
@@ -1715,7 +1715,7 @@ void Parameter::add(SGSparseMatrix<int64_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_INT64, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<uint64_t>* param,
@@ -1723,7 +1723,7 @@ void Parameter::add(SGSparseMatrix<uint64_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_UINT64, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<float32_t>* param,
@@ -1731,7 +1731,7 @@ void Parameter::add(SGSparseMatrix<float32_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_FLOAT32, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<float64_t>* param,
@@ -1739,7 +1739,7 @@ void Parameter::add(SGSparseMatrix<float64_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_FLOAT64, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<floatmax_t>* param,
@@ -1747,7 +1747,7 @@ void Parameter::add(SGSparseMatrix<floatmax_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_FLOATMAX, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<complex128_t>* param,
@@ -1755,7 +1755,7 @@ void Parameter::add(SGSparseMatrix<complex128_t>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_COMPLEX128, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 void Parameter::add(SGSparseMatrix<CSGObject*>* param,
@@ -1763,7 +1763,7 @@ void Parameter::add(SGSparseMatrix<CSGObject*>* param,
 {
 	TSGDataType type(CT_SGMATRIX, ST_SPARSE, PT_SGOBJECT, &param->num_vectors,
 			&param->num_features);
-	add_type(&type, &param->sparse_matrix, name, description);
+	add_referenced_type(&type, &param->sparse_matrix, param, name, description);
 }
 
 /* **************************************************************** */
@@ -1778,6 +1778,7 @@ TParameter::TParameter(const TSGDataType* datatype, void* parameter,
 	m_description = get_strdup(description);
 	m_delete_data=false;
 	m_was_allocated_from_scratch=false;
+	m_referenced_data=NULL;
 }
 
 TParameter::~TParameter()
@@ -2333,7 +2334,12 @@ TParameter::save_stype(CSerializableFile* file, const void* param,
 		}
 		if (!file->write_string_begin(
 				&m_datatype, m_name, prefix, len_real)) return false;
-		for (index_t i=0; i<len_real; i++) {
+		if (m_datatype.m_ptype != PT_SGOBJECT && file->has_block_io()) {
+			if (!file->write_block(
+					&m_datatype, m_name, prefix, str_ptr->string,
+					(int64_t) len_real*m_datatype.sizeof_ptype()))
+				return false;
+		} else for (index_t i=0; i<len_real; i++) {
 			if (!file->write_stringentry_begin(
 					&m_datatype, m_name, prefix, i)) return false;
 			if (!save_ptype(file, (char*) str_ptr->string
@@ -2356,7 +2362,13 @@ TParameter::save_stype(CSerializableFile* file, const void* param,
 		}
 		if (!file->write_sparse_begin(
 				&m_datatype, m_name, prefix, len_real)) return false;
-		for (index_t i=0; i<len_real; i++) {
+		if (m_datatype.m_ptype != PT_SGOBJECT && file->has_block_io()) {
+			if (!file->write_block(
+					&m_datatype, m_name, prefix, spr_ptr->features,
+					(int64_t) len_real*TSGDataType::sizeof_sparseentry(
+						m_datatype.m_ptype)))
+				return false;
+		} else for (index_t i=0; i<len_real; i++) {
 			SGSparseVectorEntry<char>* cur = (SGSparseVectorEntry<char>*)
 				((char*) spr_ptr->features + i *TSGDataType
 				 ::sizeof_sparseentry(m_datatype.m_ptype));
@@ -2399,7 +2411,12 @@ TParameter::load_stype(CSerializableFile* file, void* param,
 			return false;
 		str_ptr->string = len_real > 0
 			? SG_MALLOC(char, len_real*m_datatype.sizeof_ptype()): NULL;
-		for (index_t i=0; i<len_real; i++) {
+		if (m_datatype.m_ptype != PT_SGOBJECT && file->has_block_io()) {
+			if (!file->read_block(
+					&m_datatype, m_name, prefix, str_ptr->string,
+					(int64_t) len_real*m_datatype.sizeof_ptype()))
+				return false;
+		} else for (index_t i=0; i<len_real; i++) {
 			if (!file->read_stringentry_begin(
 					&m_datatype, m_name, prefix, i)) return false;
 			if (!load_ptype(file, (char*) str_ptr->string
@@ -2419,7 +2436,13 @@ TParameter::load_stype(CSerializableFile* file, void* param,
 		spr_ptr->features = len_real > 0? (SGSparseVectorEntry<char>*)
 			SG_MALLOC(char, len_real *TSGDataType::sizeof_sparseentry(
 				m_datatype.m_ptype)): NULL;
-		for (index_t i=0; i<len_real; i++) {
+		if (m_datatype.m_ptype != PT_SGOBJECT && file->has_block_io()) {
+			if (!file->read_block(
+					&m_datatype, m_name, prefix, spr_ptr->features,
+					(int64_t) len_real*TSGDataType::sizeof_sparseentry(
+						m_datatype.m_ptype)))
+				return false;
+		} else for (index_t i=0; i<len_real; i++) {
 			SGSparseVectorEntry<char>* cur = (SGSparseVectorEntry<char>*)
 				((char*) spr_ptr->features + i *TSGDataType
 				 ::sizeof_sparseentry(m_datatype.m_ptype));
@@ -2601,7 +2624,14 @@ TParameter::save(CSerializableFile* file, const char* prefix)
 
 		/* ******************************************************** */
 
-		for (index_t x=0; x<len_real_x; x++)
+		if (m_datatype.m_stype == ST_NONE
+			&& m_datatype.m_ptype != PT_SGOBJECT && file->has_block_io()) {
+			if (!file->write_block(
+					&m_datatype, m_name, prefix, *(char**) m_parameter,
+					(int64_t) len_real_x*len_real_y
+					*m_datatype.sizeof_stype()))
+				return false;
+		} else for (index_t x=0; x<len_real_x; x++)
 			for (index_t y=0; y<len_real_y; y++) {
 				if (!file->write_item_begin(
 						&m_datatype, m_name, prefix, y, x))
@@ -2685,7 +2715,18 @@ TParameter::load(CSerializableFile* file, const char* prefix)
 					break;
 			}
 
-			for (index_t x=0; x<dims[0]; x++)
+			if (m_datatype.m_stype == ST_NONE
+				&& m_datatype.m_ptype != PT_SGOBJECT
+				&& file->has_block_io())
+			{
+				if (!file->read_block(
+							&m_datatype, m_name, prefix,
+							*(char**) m_parameter,
+							(int64_t) dims[0]*dims[1]
+							*m_datatype.sizeof_stype()))
+					return false;
+			}
+			else for (index_t x=0; x<dims[0]; x++)
 			{
 				for (index_t y=0; y<dims[1]; y++)
 				{
@@ -2783,6 +2824,14 @@ Parameter::add_type(const TSGDataType* type, void* param,
 		);
 }
 
+void Parameter::add_referenced_type(const TSGDataType* type, void* param,
+		SGReferencedData* referenced, const char* name, const char* description)
+{
+	add_type(type, param, name, description);
+	m_params.get_element(m_params.get_num_elements()-1)->m_referenced_data=
+		referenced;
+}
+
 void
 Parameter::print(const char* prefix)
 {
@@ -2951,7 +3000,8 @@ void Parameter::add_parameters(Parameter* params)
 	for (index_t i=0; i<params->get_num_parameters(); ++i)
 	{
 		TParameter* current=params->get_parameter(i);
-		add_type(&(current->m_datatype), current->m_parameter, current->m_name,
+		add_referenced_type(&(current->m_datatype), current->m_parameter,
+				current->m_referenced_data, current->m_name,
 				current->m_description);
 	}
 }
@@ -3526,7 +3576,8 @@ bool TParameter::compare_ptype(EPrimitiveType ptype, void* data1, void* data2,
 	return true;
 }
 
-bool TParameter::copy_ptype(EPrimitiveType ptype, void* source, void* target)
+bool TParameter::copy_ptype(EPrimitiveType ptype, void* source, void* target,
+		bool share_data, int64_t* bytes_copied)
 {
 	SG_SDEBUG("entering TParameter::copy_ptype()\n");
 
@@ -3654,7 +3705,7 @@ bool TParameter::copy_ptype(EPrimitiveType ptype, void* source, void* target)
 		{
 			/* in case of overwriting old objects */
 			SG_UNREF(*((CSGObject**)target));
-			*((CSGObject**)target) = casted1->clone();
+			*((CSGObject**)target) = casted1->clone(share_data, bytes_copied);
 		}
 
 		break;
@@ -3666,6 +3717,9 @@ bool TParameter::copy_ptype(EPrimitiveType ptype, void* source, void* target)
 		break;
 	}
 
+	if (bytes_copied && ptype!=PT_SGOBJECT)
+		*bytes_copied+=TSGDataType::sizeof_ptype(ptype);
+
 	SG_SDEBUG("leaving TParameter::copy_ptype(): Copy successful\n");
 	return true;
 }
@@ -3799,7 +3853,7 @@ bool TParameter::compare_stype(EStructType stype, EPrimitiveType ptype,
 }
 
 bool TParameter::copy_stype(EStructType stype, EPrimitiveType ptype,
-		void* source, void* target)
+		void* source, void* target, bool share_data, int64_t* bytes_copied)
 {
 	SG_SDEBUG("entering TParameter::copy_stype()\n");
 	size_t size_ptype=TSGDataType::sizeof_ptype(ptype);
@@ -3820,7 +3874,8 @@ bool TParameter::copy_stype(EStructType stype, EPrimitiveType ptype,
 		case ST_NONE:
 		{
 			SG_SDEBUG("ST_NONE\n");
-			return TParameter::copy_ptype(ptype, source, target);
+			return TParameter::copy_ptype(ptype, source, target, share_data,
+					bytes_copied);
 			break;
 		}
 		case ST_STRING:
@@ -3859,7 +3914,8 @@ bool TParameter::copy_stype(EStructType stype, EPrimitiveType ptype,
 				void* pointer1=source_ptr->string+i*size_ptype;
 				void* pointer2=target_ptr->string+i*size_ptype;
 
-				if (!TParameter::copy_ptype(ptype, pointer1, pointer2))
+				if (!TParameter::copy_ptype(ptype, pointer1, pointer2,
+						share_data, bytes_copied))
 				{
 					SG_SDEBUG("leaving TParameter::copy_stype(): Copy of string"
 							" element failed.\n");
@@ -3919,7 +3975,8 @@ bool TParameter::copy_stype(EStructType stype, EPrimitiveType ptype,
 				void* pointer1=&(cur1->entry)-char_offset+ptype_offset;
 				void* pointer2=&(cur2->entry)-char_offset+ptype_offset;
 
-				if (!TParameter::copy_ptype(ptype, pointer1, pointer2))
+				if (!TParameter::copy_ptype(ptype, pointer1, pointer2,
+						share_data, bytes_copied))
 				{
 					SG_SDEBUG("leaving TParameter::copy_stype(): Copy of sparse"
 							" vector element failed\n");
@@ -3929,6 +3986,8 @@ bool TParameter::copy_stype(EStructType stype, EPrimitiveType ptype,
 				/* afterwards, copy feature indices, wich are the data before
 				 * the avove offeet */
 				cur2->feat_index=cur1->feat_index;
+				if (bytes_copied)
+					*bytes_copied+=sizeof(index_t);
 			}
 			break;
 		}
@@ -3944,7 +4003,26 @@ bool TParameter::copy_stype(EStructType stype, EPrimitiveType ptype,
 	return true;
 }
 
-bool TParameter::copy(TParameter* target)
+bool TParameter::share_referenced_data(TParameter* target)
+{
+	if (!m_referenced_data || !target->m_referenced_data)
+		return false;
+
+	/* SGObject pointers would be shared without being SG_REF'ed */
+	if (m_datatype.m_ptype==PT_SGOBJECT)
+		return false;
+
+	/* data without reference counting is not owned and cannot be shared */
+	if (m_referenced_data->ref_count()<0)
+		return false;
+
+	/* assignment unrefs the target's old data and refs the shared one */
+	*target->m_referenced_data=*m_referenced_data;
+	return true;
+}
+
+bool TParameter::copy(TParameter* target, bool share_data,
+		int64_t* bytes_copied)
 {
 	SG_SDEBUG("entering TParameter::copy()\n");
 
@@ -3989,7 +4067,7 @@ bool TParameter::copy(TParameter* target)
 			SG_SDEBUG("CT_SCALAR\n");
 			if (!TParameter::copy_stype(m_datatype.m_stype,
 					m_datatype.m_ptype, m_parameter,
-					target->m_parameter))
+					target->m_parameter, share_data, bytes_copied))
 			{
 				SG_SDEBUG("leaving TParameter::copy(): scalar data copy error\n");
 				return false;
@@ -4000,6 +4078,12 @@ bool TParameter::copy(TParameter* target)
 		{
 			SG_SDEBUG("CT_VECTOR or CT_SGVECTOR\n");
 
+			if (share_data && share_referenced_data(target))
+			{
+				SG_SDEBUG("sharing buffer of \"%s\"\n", m_name);
+				break;
+			}
+
 			/* if sizes are different or memory is not allocated, do that */
 			if (!m_datatype.equals(target->m_datatype))
 			{
@@ -4038,7 +4122,8 @@ bool TParameter::copy(TParameter* target)
 				void* pointer_b=&((*(char**)target->m_parameter)[x]);
 
 				if (!TParameter::copy_stype(m_datatype.m_stype,
-						m_datatype.m_ptype, pointer_a, pointer_b))
+						m_datatype.m_ptype, pointer_a, pointer_b, share_data,
+						bytes_copied))
 				{
 					SG_SDEBUG("leaving TParameter::copy(): vector element "
 							"copy error\n");
@@ -4054,6 +4139,12 @@ bool TParameter::copy(TParameter* target)
 		{
 			SG_SDEBUG("CT_MATRIX or CT_SGMATRIX\n");
 
+			if (share_data && share_referenced_data(target))
+			{
+				SG_SDEBUG("sharing buffer of \"%s\"\n", m_name);
+				break;
+			}
+
 			/* if sizes are different or memory is not allocated, do that */
 			if (!m_datatype.equals(target->m_datatype))
 			{
@@ -4073,7 +4164,7 @@ bool TParameter::copy(TParameter* target)
 					num_bytes=*m_datatype.m_length_y * m_datatype.sizeof_stype();
 				else
 					num_bytes=*m_datatype.m_length_y *
-						(*m_datatype.m_length_y) * m_datatype.sizeof_stype();
+						(*m_datatype.m_length_x) * m_datatype.sizeof_stype();
 				*(char**)target->m_parameter=SG_MALLOC(char, num_bytes);
 
 				/* use length of source */
@@ -4104,7 +4195,8 @@ bool TParameter::copy(TParameter* target)
 				void* pointer_b=&((*(char**)target->m_parameter)[x]);
 
 				if (!TParameter::copy_stype(m_datatype.m_stype,
-						m_datatype.m_ptype, pointer_a, pointer_b))
+						m_datatype.m_ptype, pointer_a, pointer_b, share_data,
+						bytes_copied))
 				{
 					SG_SDEBUG("leaving TParameter::copy(): vector element "
 							"differes\n");
@@ -122,8 +122,12 @@ struct TParameter
 	 * @param ptype the primitive type
 	 * @param source from where to copy
 	 * @param target where to copy to
+	 * @param share_data whether SGObjects are cloned in shared mode, see
+	 * CSGObject::clone(bool, int64_t*)
+	 * @param bytes_copied if non-NULL, number of copied bytes is added
 	 */
-	static bool copy_ptype(EPrimitiveType ptype, void* source, void* target);
+	static bool copy_ptype(EPrimitiveType ptype, void* source, void* target,
+			bool share_data=false, int64_t* bytes_copied=NULL);
 
 	/** copy structured type from source to target
 	 *
@@ -131,15 +135,35 @@ struct TParameter
 	 * @param ptype the primitive type that the structured objects use
 	 * @param source from where to copy
 	 * @param target where to copy to
+	 * @param share_data whether SGObjects are cloned in shared mode, see
+	 * CSGObject::clone(bool, int64_t*)
+	 * @param bytes_copied if non-NULL, number of copied bytes is added
 	 */
 	static bool copy_stype(EStructType stype, EPrimitiveType ptype,
-				void* source, void* target);
+				void* source, void* target, bool share_data=false,
+				int64_t* bytes_copied=NULL);
 
 	/** copy this to parameter target
+	 *
+	 * If share_data is set, SGVector, SGMatrix and SGSparseMatrix parameters
+	 * are not copied but the target is assigned the reference counted buffer
+	 * of this parameter, i.e. both share the same memory.
 	 *
 	 * @param target where this should be copied to
+	 * @param share_data whether reference counted buffers are shared
+	 * @param bytes_copied if non-NULL, number of copied bytes is added
 	 */
-	bool copy(TParameter* target);
+	bool copy(TParameter* target, bool share_data=false,
+			int64_t* bytes_copied=NULL);
+
+	/** assigns the reference counted data of this parameter to target, such
+	 * that both share the same buffer
+	 *
+	 * @param target where the data should be shared with
+	 * @return false if the data cannot be shared (not reference counted or
+	 * elements are SGObjects), true otherwise
+	 */
+	bool share_referenced_data(TParameter* target);
 
 
 
@@ -160,6 +184,9 @@ struct TParameter
 	char* m_name;
 	/** description of parameter */
 	char* m_description;
+	/** reference counted object (SGVector, SGMatrix, SGSparseMatrix) that
+	 * owns the data m_parameter points to, NULL for all other types */
+	SGReferencedData* m_referenced_data;
 
 	/** if this is set true, the data, m_parameter points to, m_parameter
 	 * itself, and possible lengths of the type will be deleted in destructor.
@@ -2071,6 +2098,17 @@ protected:
 	virtual void add_type(const TSGDataType* type, void* param,
 						  const char* name,
 						  const char* description);
+
+	/** add new type which data is owned by a reference counted object
+	 * @param type type to be added
+	 * @param param pointer to parameter
+	 * @param referenced object that owns the data
+	 * @param name name of parameter
+	 * @param description description of parameter
+	 */
+	void add_referenced_type(const TSGDataType* type, void* param,
+			SGReferencedData* referenced, const char* name,
+			const char* description);
 };
 }
 #endif //__PARAMETER_H__
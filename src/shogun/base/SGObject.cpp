@@ -1030,6 +1030,7 @@ void CSGObject::init()
 	m_generic = PT_NOT_GENERIC;
 	m_load_pre_called = false;
 	m_load_post_called = false;
+	m_shares_data = false;
 	m_hash = 0;
 }
 
@@ -1271,6 +1272,11 @@ bool CSGObject::equals(CSGObject* other, float64_t accuracy)
 }
 
 CSGObject* CSGObject::clone()
+{
+	return clone(false);
+}
+
+CSGObject* CSGObject::clone(bool share_data, int64_t* bytes_copied)
 {
 	SG_DEBUG("entering %s::clone()\n", get_name());
 
@@ -1289,7 +1295,8 @@ CSGObject* CSGObject::clone()
 		SG_DEBUG("cloning parameter \"%s\" at index %d\n",
 				m_parameters->get_parameter(i)->m_name, i);
 
-		if (!m_parameters->get_parameter(i)->copy(copy->m_parameters->get_parameter(i)))
+		if (!m_parameters->get_parameter(i)->copy(
+				copy->m_parameters->get_parameter(i), share_data, bytes_copied))
 		{
 			SG_DEBUG("leaving %s::clone(): Clone failed. Returning NULL\n",
 					get_name());
@@ -1297,6 +1304,12 @@ CSGObject* CSGObject::clone()
 		}
 	}
 
+	if (share_data)
+	{
+		m_shares_data=true;
+		copy->m_shares_data=true;
+	}
+
 	SG_DEBUG("leaving %s::clone(): Clone successful\n", get_name());
 	return copy;
 }
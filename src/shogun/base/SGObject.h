@@ -395,6 +395,19 @@ protected:
 	 */
 	virtual void save_serializable_post() throw (ShogunException);
 
+	/** Has to be called on a reference counted buffer (SGVector, SGMatrix)
+	 * of this object before it is written in place. If the buffer may be
+	 * shared with a clone, see clone(bool, int64_t*), it is replaced by a
+	 * private copy first.
+	 *
+	 * @param data buffer that is about to be modified
+	 */
+	template <class T> void copy_on_write(T& data)
+	{
+		if (m_shares_data && data.ref_count()>1)
+			data=data.clone();
+	}
+
 public:
 	/** Updates the hash of current parameter combination.
 	 *
@@ -426,6 +439,29 @@ public:
 	 */
 	virtual CSGObject* clone();
 
+	/** Creates a clone of the current object, optionally sharing memory.
+	 *
+	 * If share_data is true, reference counted parameters (SGVector,
+	 * SGMatrix, SGSparseMatrix) are not copied: the clone references the
+	 * very same buffers, which are kept alive by their reference counts.
+	 * SGObject parameters are recursively cloned in the same mode, all
+	 * other parameters are copied. This avoids duplicating e.g. feature
+	 * matrices when many models are derived from the same prototype.
+	 *
+	 * Both the clone and this object copy a shared buffer before writing
+	 * into it in place (see copy_on_write()), so they never see each
+	 * other's modifications. Assigning a new vector/matrix detaches a
+	 * shared buffer anyway. Buffers handed out by getters like
+	 * CDenseFeatures::get_feature_matrix() have to be treated read-only.
+	 *
+	 * @param share_data whether reference counted buffers are shared
+	 * @param bytes_copied if non-NULL, the number of bytes that were
+	 * actually copied is added to it
+	 * @return a copy of the given object, NULL if the clone fails. Note that
+	 * the returned object is SG_REF'ed
+	 */
+	virtual CSGObject* clone(bool share_data, int64_t* bytes_copied=NULL);
+
 private:
 	void set_global_objects();
 	void unset_global_objects();
@@ -500,6 +536,9 @@ private:
 	bool m_load_post_called;
 	bool m_save_pre_called;
 	bool m_save_post_called;
+
+	/** whether buffers may be shared with a clone, see copy_on_write() */
+	bool m_shares_data;
 };
 }
 #endif // __SGOBJECT_H__
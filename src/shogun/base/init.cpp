@@ -27,6 +27,7 @@ namespace shogun
 	Version* sg_version=NULL;
 	CMath* sg_math=NULL;
 	CRandom* sg_rand=NULL;
+	CRandom* sg_thread_rand=NULL;
 
 	/// function called to print normal messages
 	void (*sg_print_message)(FILE* target, const char* str) = NULL;
@@ -170,4 +171,11 @@ namespace shogun
 		SG_REF(sg_rand);
 		return sg_rand;
 	}
+
+	void set_thread_rand(CRandom* rand)
+	{
+		SG_REF(rand);
+		SG_UNREF(sg_thread_rand);
+		sg_thread_rand=rand;
+	}
 }
@@ -106,6 +106,13 @@ void set_global_rand(CRandom* rand);
  */
 CRandom* get_global_rand();
 
+/** set the random object of the calling thread, which CMath uses instead
+ * of the global one, e.g. to make parallel tasks reproducible
+ *
+ * @param rand random object to use, NULL for the global one
+ */
+void set_thread_rand(CRandom* rand);
+
 /// function called to print normal messages
 extern void (*sg_print_message)(FILE* target, const char* str);
 
@@ -1483,6 +1483,61 @@ void CMKL::compute_sum_beta(float64_t* sumw)
 
 	int32_t nsv=svm->get_num_support_vectors();
 	int32_t num_kernels = kernel->get_num_subkernels();
+
+	/* if the sub-kernels can be accessed directly, their terms are
+	 * independent of each other and can be computed in parallel without
+	 * modifying the combined kernel's weights */
+	if (kernel->get_kernel_type()==K_COMBINED &&
+			!((CCombinedKernel*) kernel)->get_append_subkernel_weights())
+	{
+		CCombinedKernel* comb_kernel=(CCombinedKernel*) kernel;
+		ASSERT(comb_kernel->get_num_kernels()==num_kernels)
+
+		SGVector<int32_t> sv_idx(nsv);
+		SGVector<float64_t> sv_alpha(nsv);
+		for (int32_t i=0; i<nsv; i++)
+		{
+			sv_idx[i]=svm->get_support_vector(i);
+			sv_alpha[i]=svm->get_alpha(i);
+		}
+
+		CKernel** subkernels=SG_MALLOC(CKernel*, num_kernels);
+		for (int32_t n=0; n<num_kernels; n++)
+			subkernels[n]=comb_kernel->get_kernel(n);
+
+		CKernelNormalizer* normalizer=kernel->get_normalizer();
+		bool use_cache=comb_kernel->has_subkernel_cache();
+
+		#pragma omp parallel for num_threads(parallel->get_num_threads())
+		for (int32_t n=0; n<num_kernels; n++)
+		{
+			float64_t sum=0;
+			for (int32_t i=0; i<nsv; i++)
+			{
+				int32_t ii=sv_idx[i];
+
+				for (int32_t j=0; j<nsv; j++)
+				{
+					int32_t jj=sv_idx[j];
+					float64_t k_val=use_cache ?
+						comb_kernel->get_cached_subkernel(n, ii, jj) :
+						subkernels[n]->kernel(ii, jj);
+
+					sum+=sv_alpha[i]*sv_alpha[j]*normalizer->normalize(k_val, ii, jj);
+				}
+			}
+			sumw[n]=0.5*sum;
+		}
+
+		SG_UNREF(normalizer);
+		for (int32_t n=0; n<num_kernels; n++)
+			SG_UNREF(subkernels[n]);
+		SG_FREE(subkernels);
+
+		mkl_iterations++;
+		return;
+	}
+
 	SGVector<float64_t> beta=SGVector<float64_t>(num_kernels);
 	int32_t nweights=0;
 	const float64_t* old_beta = kernel->get_subkernel_weights(nweights);
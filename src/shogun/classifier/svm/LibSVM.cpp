@@ -141,6 +141,9 @@ bool CLibSVM::train_machine(CFeatures* data)
 
 		create_new_model(num_sv);
 		CSVM::set_objective(model->objective);
+		CSVM::set_cache_statistics(model->cache_stats.hits,
+				model->cache_stats.misses, model->cache_stats.evaluations,
+				model->cache_stats.peak_memory);
 
 		float64_t sgn=model->label[0];
 
@@ -55,6 +55,14 @@ void CSVM::set_defaults(int32_t num_sv)
 			"Tube epsilon for support vector regression.", MS_AVAILABLE);
 	SG_ADD(&nu, "nu", "", MS_AVAILABLE);
 	SG_ADD(&objective, "objective", "", MS_NOT_AVAILABLE);
+	SG_ADD(&cache_hits, "cache_hits", "Kernel columns found in the cache.",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&cache_misses, "cache_misses", "Kernel columns computed.",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&cache_evaluations, "cache_evaluations",
+			"Kernel evaluations to fill the cache.", MS_NOT_AVAILABLE);
+	SG_ADD(&cache_memory, "cache_memory",
+			"Peak memory of the kernel cache in bytes.", MS_NOT_AVAILABLE);
 	SG_ADD(&qpsize, "qpsize", "", MS_NOT_AVAILABLE);
 	SG_ADD(&use_shrinking, "use_shrinking", "Shrinking shall be used.",
 			MS_NOT_AVAILABLE);
@@ -76,6 +84,7 @@ void CSVM::set_defaults(int32_t num_sv)
 	C2=1;
 
 	objective=0;
+	set_cache_statistics(0, 0, 0, 0);
 
 	qpsize=41;
 	use_bias=true;
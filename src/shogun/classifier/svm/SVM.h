@@ -218,6 +218,45 @@ class CSVM : public CKernelMachine
 			return objective;
 		}
 
+		/** set statistics of the kernel cache of the last training
+		 *
+		 * @param hits number of kernel columns found in the cache
+		 * @param misses number of kernel columns that had to be computed
+		 * @param evaluations number of kernel evaluations for the misses
+		 * @param memory peak memory of the cache in bytes
+		 */
+		inline void set_cache_statistics(int64_t hits, int64_t misses,
+				int64_t evaluations, int64_t memory)
+		{
+			cache_hits=hits;
+			cache_misses=misses;
+			cache_evaluations=evaluations;
+			cache_memory=memory;
+		}
+
+		/** get fraction of kernel columns found in the cache during the
+		 * last training (solvers that report cache statistics only)
+		 *
+		 * @return cache hit rate
+		 */
+		inline float64_t get_cache_hit_rate()
+		{
+			int64_t total=cache_hits+cache_misses;
+			return total>0 ? float64_t(cache_hits)/total : 0.0;
+		}
+
+		/** @return number of kernel columns found in the cache */
+		inline int64_t get_cache_hits() { return cache_hits; }
+
+		/** @return number of kernel columns that had to be computed */
+		inline int64_t get_cache_misses() { return cache_misses; }
+
+		/** @return number of kernel evaluations to fill the cache */
+		inline int64_t get_cache_evaluations() { return cache_evaluations; }
+
+		/** @return peak memory of the kernel cache in bytes */
+		inline int64_t get_cache_memory() { return cache_memory; }
+
 		/** set callback function svm optimizers may call when they have a new
 		 * (small) set of alphas
 		 *
@@ -257,6 +296,14 @@ class CSVM : public CKernelMachine
 		float64_t C2;
 		/** objective */
 		float64_t objective;
+		/** kernel columns found in the cache */
+		int64_t cache_hits;
+		/** kernel columns computed */
+		int64_t cache_misses;
+		/** kernel evaluations to fill the cache */
+		int64_t cache_evaluations;
+		/** peak memory of the kernel cache in bytes */
+		int64_t cache_memory;
 		/** qpsize */
 		int32_t qpsize;
 		/** if shrinking shall be used */
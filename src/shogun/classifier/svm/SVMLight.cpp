@@ -49,17 +49,6 @@
 using namespace shogun;
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
-struct S_THREAD_PARAM_REACTIVATE_LINADD
-{
-	CKernel* kernel;
-	float64_t* lin;
-	float64_t* last_lin;
-	int32_t* active;
-	int32_t* docs;
-	int32_t start;
-	int32_t end;
-};
-
 struct S_THREAD_PARAM_SVMLIGHT
 {
 	float64_t * lin ;
@@ -70,20 +59,6 @@ struct S_THREAD_PARAM_SVMLIGHT
 	CKernel* kernel ;
 };
 
-struct S_THREAD_PARAM_REACTIVATE_VANILLA
-{
-	CKernel* kernel;
-	float64_t* lin;
-	float64_t* aicache;
-	float64_t* a;
-	float64_t* a_old;
-	int32_t* changed2dnum;
-	int32_t* inactive2dnum;
-	int32_t* label;
-	int32_t start;
-	int32_t end;
-};
-
 struct S_THREAD_PARAM_KERNEL
 {
 	float64_t *Kval ;
@@ -94,18 +69,6 @@ struct S_THREAD_PARAM_KERNEL
 
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
-void* CSVMLight::update_linear_component_linadd_helper(void* p)
-{
-	S_THREAD_PARAM_SVMLIGHT* params = (S_THREAD_PARAM_SVMLIGHT*) p;
-
-	int32_t jj=0, j=0 ;
-
-	for (jj=params->start;(jj<params->end) && (j=params->active2dnum[jj])>=0;jj++)
-		params->lin[j]+=params->kernel->compute_optimized(params->docs[j]);
-
-	return NULL ;
-}
-
 void* CSVMLight::compute_kernel_helper(void* p)
 {
 	S_THREAD_PARAM_KERNEL* params = (S_THREAD_PARAM_KERNEL*) p;
@@ -150,6 +113,8 @@ void CSVMLight::init()
 	model->alpha=NULL;
 	model->index=NULL;
 
+	use_second_order_selection=false;
+
 	// MKL stuff
 	mymaxdiff=1 ;
 	mkl_converged=false;
@@ -577,6 +542,7 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
 
   float64_t *selcrit;  /* buffer for sorting */
   float64_t *aicache;  /* buffer to keep one row of hessian */
+  float64_t *kernel_diag=NULL; /* for second order selection */
   QP qp;            /* buffer for one quadratic program */
 
   epsilon_crit_org=learn_parm->epsilon_crit; /* save org */
@@ -605,6 +571,14 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
   qp.opt_low=SG_MALLOC(float64_t, learn_parm->svm_maxqpsize);
   qp.opt_up=SG_MALLOC(float64_t, learn_parm->svm_maxqpsize);
 
+  if (use_second_order_selection)
+  {
+	  kernel_diag=SG_MALLOC(float64_t, totdoc);
+	  #pragma omp parallel for num_threads(parallel->get_num_threads())
+	  for (int32_t k=0; k<totdoc; k++)
+		  kernel_diag[k]=compute_kernel(k, k);
+  }
+
   choosenum=0;
   inconsistentnum=0;
   if(!retrain) retrain=1;
@@ -721,13 +695,26 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
 					  key,chosen);
 				  choosenum+=already_chosen;
 			  }
-			  choosenum+=select_next_qp_subproblem_grad(
-				  label,a,lin,c,totdoc,
-				  CMath::min(learn_parm->svm_maxqpsize-choosenum,
-							 learn_parm->svm_newvarsinqp-already_chosen),
-				  inconsistent,active2dnum,
-				  working2dnum,selcrit,selexam,0,key,
-				  chosen);
+			  if (use_second_order_selection)
+			  {
+				  choosenum+=select_next_qp_subproblem_second_order(
+					  label,a,lin,c,totdoc,
+					  CMath::min(learn_parm->svm_maxqpsize-choosenum,
+								 learn_parm->svm_newvarsinqp-already_chosen),
+					  inconsistent,active2dnum,
+					  working2dnum,selcrit,selexam,key,
+					  chosen,kernel_diag,aicache);
+			  }
+			  else
+			  {
+				  choosenum+=select_next_qp_subproblem_grad(
+					  label,a,lin,c,totdoc,
+					  CMath::min(learn_parm->svm_maxqpsize-choosenum,
+								 learn_parm->svm_newvarsinqp-already_chosen),
+					  inconsistent,active2dnum,
+					  working2dnum,selcrit,selexam,0,key,
+					  chosen);
+			  }
 		  }
 		  else { /* once in a while, select a somewhat random working set
 					to get unlocked of infinite loops due to numerical
@@ -932,6 +919,7 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
   SG_FREE(selexam);
   SG_FREE(a_old);
   SG_FREE(aicache);
+  SG_FREE(kernel_diag);
   SG_FREE(working2dnum);
   SG_FREE(active2dnum);
   SG_FREE(qp.opt_ce);
@@ -1450,48 +1438,18 @@ void CSVMLight::update_linear_component(
 
 			if (num_working>0)
 			{
-				if (parallel->get_num_threads() < 2)
+				int32_t num_active=0;
+				while (active2dnum[num_active]>=0)
+					num_active++;
+
+				/* the thread team is kept alive by the OpenMP runtime
+				 * between working set iterations */
+				#pragma omp parallel for num_threads(parallel->get_num_threads()) schedule(dynamic, 256)
+				for (int32_t k=0; k<num_active; k++)
 				{
-					for (jj=0;(j=active2dnum[jj])>=0;jj++) {
-						lin[j]+=kernel->compute_optimized(docs[j]);
-					}
+					int32_t idx=active2dnum[k];
+					lin[idx]+=kernel->compute_optimized(docs[idx]);
 				}
-#ifdef HAVE_PTHREAD
-				else
-				{
-					int32_t num_elem = 0 ;
-					for (jj=0;(j=active2dnum[jj])>=0;jj++) num_elem++ ;
-
-					pthread_t* threads = SG_MALLOC(pthread_t, parallel->get_num_threads()-1);
-					S_THREAD_PARAM_SVMLIGHT* params = SG_MALLOC(S_THREAD_PARAM_SVMLIGHT, parallel->get_num_threads()-1);
-					int32_t start = 0 ;
-					int32_t step = num_elem/parallel->get_num_threads();
-					int32_t end = step ;
-
-					for (int32_t t=0; t<parallel->get_num_threads()-1; t++)
-					{
-						params[t].kernel = kernel ;
-						params[t].lin = lin ;
-						params[t].docs = docs ;
-						params[t].active2dnum=active2dnum ;
-						params[t].start = start ;
-						params[t].end = end ;
-						start=end ;
-						end+=step ;
-						pthread_create(&threads[t], NULL, update_linear_component_linadd_helper, (void*)&params[t]) ;
-					}
-
-					for (jj=params[parallel->get_num_threads()-2].end;(j=active2dnum[jj])>=0;jj++) {
-						lin[j]+=kernel->compute_optimized(docs[j]);
-					}
-					void* ret;
-					for (int32_t t=0; t<parallel->get_num_threads()-1; t++)
-						pthread_join(threads[t], &ret) ;
-
-					SG_FREE(params);
-					SG_FREE(threads);
-				}
-#endif
 			}
 		}
 	}
@@ -1829,6 +1787,107 @@ int32_t CSVMLight::select_next_qp_subproblem_grad(
 	return(choosenum);
 }
 
+int32_t CSVMLight::select_next_qp_subproblem_second_order(
+	int32_t* label, float64_t *a, float64_t *lin, float64_t *c, int32_t totdoc,
+	int32_t qp_size, int32_t *inconsistent, int32_t *active2dnum,
+	int32_t *working2dnum, float64_t *selcrit, int32_t *select, int32_t *key,
+	int32_t *chosen, float64_t* kernel_diag, float64_t* aicache)
+	/* Like select_next_qp_subproblem_grad, but the variables moving in
+	   the second direction are ranked by the gain in objective of a two
+	   variable step with the most violating one of the first direction
+	   (working set selection 2 of Fan, Chen and Lin, 2005). */
+{
+	int32_t choosenum,i,j,k,activedoc,inum,best=-1;
+	float64_t s,best_crit=0;
+
+	for (inum=0;working2dnum[inum]>=0;inum++); /* find end of index */
+	choosenum=0;
+	activedoc=0;
+	for (i=0;(j=active2dnum[i])>=0;i++) {
+		s=-label[j];
+		if((!((a[j]<=(0+learn_parm->epsilon_a)) && (s<0)))
+		   && (!((a[j]>=(learn_parm->svm_cost[j]-learn_parm->epsilon_a))
+				 && (s>0)))
+		   && (!chosen[j])
+		   && (label[j])
+		   && (!inconsistent[j]))
+		{
+			selcrit[activedoc]=(float64_t)label[j]*(learn_parm->eps[j]-(float64_t)label[j]*c[j]+(float64_t)label[j]*lin[j]);
+			key[activedoc]=j;
+			activedoc++;
+		}
+	}
+	select_top_n(selcrit,activedoc,select,(int32_t)(qp_size/2));
+	for (k=0;(choosenum<(qp_size/2)) && (k<(qp_size/2)) && (k<activedoc);k++) {
+		i=key[select[k]];
+		if (k==0) {
+			best=i;
+			best_crit=selcrit[select[k]];
+		}
+		chosen[i]=1;
+		working2dnum[inum+choosenum]=i;
+		choosenum+=1;
+		if (use_kernel_cache)
+			kernel->kernel_cache_touch(i);
+	}
+
+	activedoc=0;
+	for (i=0;(j=active2dnum[i])>=0;i++) {
+		s=label[j];
+		if((!((a[j]<=(0+learn_parm->epsilon_a)) && (s<0)))
+		   && (!((a[j]>=(learn_parm->svm_cost[j]-learn_parm->epsilon_a))
+				 && (s>0)))
+		   && (!chosen[j])
+		   && (label[j])
+		   && (!inconsistent[j]))
+		{
+			selcrit[activedoc]=-(float64_t)label[j]*(learn_parm->eps[j]-(float64_t)label[j]*c[j]+(float64_t)label[j]*lin[j]);
+			key[activedoc]=j;
+			activedoc++;
+		}
+	}
+
+	if (best>=0)
+	{
+		/* the row of the most violating example usually is cached, as
+		   it was in one of the last working sets */
+		if (use_kernel_cache)
+			kernel->get_kernel_row(best,active2dnum,aicache);
+
+		#pragma omp parallel for num_threads(parallel->get_num_threads())
+		for (int32_t l=0; l<activedoc; l++)
+		{
+			int32_t idx=key[l];
+			float64_t b=best_crit+selcrit[l];
+
+			/* pairs that are not violating stay behind the others */
+			if (b>0)
+			{
+				float64_t kij=use_kernel_cache ? aicache[idx] : compute_kernel(best, idx);
+				float64_t quad=kernel_diag[best]+kernel_diag[idx]-2*kij;
+				if (quad<=0)
+					quad=1e-12;
+				selcrit[l]=b*b/quad;
+			}
+			else
+				selcrit[l]=b;
+		}
+	}
+
+	select_top_n(selcrit,activedoc,select,(int32_t)(qp_size/2));
+	for (k=0;(choosenum<qp_size) && (k<(qp_size/2)) && (k<activedoc);k++) {
+		i=key[select[k]];
+		chosen[i]=1;
+		working2dnum[inum+choosenum]=i;
+		choosenum+=1;
+		if (use_kernel_cache)
+			kernel->kernel_cache_touch(i); /* make sure it does not get kicked */
+		/* out of cache */
+	}
+	working2dnum[inum+choosenum]=-1; /* complete index */
+	return(choosenum);
+}
+
 int32_t CSVMLight::select_next_qp_subproblem_rand(
 	int32_t* label, float64_t *a, float64_t *lin, float64_t *c, int32_t totdoc,
 	int32_t qp_size, int32_t *inconsistent, int32_t *active2dnum,
@@ -2028,66 +2087,6 @@ int32_t CSVMLight::shrink_problem(
   return(activenum);
 }
 
-void* CSVMLight::reactivate_inactive_examples_linadd_helper(void* p)
-{
-	S_THREAD_PARAM_REACTIVATE_LINADD* params = (S_THREAD_PARAM_REACTIVATE_LINADD*) p;
-
-	CKernel* k = params->kernel;
-	float64_t* lin = params->lin;
-	float64_t* last_lin = params->last_lin;
-	int32_t* active = params->active;
-	int32_t* docs = params->docs;
-	int32_t start = params->start;
-	int32_t end = params->end;
-
-	for (int32_t i=start;i<end;i++)
-	{
-		if (!active[i])
-			lin[i] = last_lin[i]+k->compute_optimized(docs[i]);
-
-		last_lin[i]=lin[i];
-	}
-
-	return NULL;
-}
-
-void* CSVMLight::reactivate_inactive_examples_vanilla_helper(void* p)
-{
-	S_THREAD_PARAM_REACTIVATE_VANILLA* params = (S_THREAD_PARAM_REACTIVATE_VANILLA*) p;
-	ASSERT(params)
-	ASSERT(params->kernel)
-	ASSERT(params->lin)
-	ASSERT(params->aicache)
-	ASSERT(params->a)
-	ASSERT(params->a_old)
-	ASSERT(params->changed2dnum)
-	ASSERT(params->inactive2dnum)
-	ASSERT(params->label)
-
-	CKernel* k = params->kernel;
-	float64_t* lin = params->lin;
-	float64_t* aicache = params->aicache;
-	float64_t* a= params->a;
-	float64_t* a_old = params->a_old;
-	int32_t* changed2dnum = params->changed2dnum;
-	int32_t* inactive2dnum = params->inactive2dnum;
-	int32_t* label = params->label;
-	int32_t start = params->start;
-	int32_t end = params->end;
-
-	for (int32_t ii=start;ii<end;ii++)
-	{
-		int32_t i=changed2dnum[ii];
-		int32_t j=0;
-		ASSERT(i>=0)
-
-		k->get_kernel_row(i,inactive2dnum,aicache);
-		for (int32_t jj=0;(j=inactive2dnum[jj])>=0;jj++)
-			lin[j]+=(a[i]-a_old[i])*aicache[j]*(float64_t)label[i];
-	}
-	return NULL;
-}
-
 void CSVMLight::reactivate_inactive_examples(
 	int32_t* label, float64_t *a, SHRINK_STATE *shrink_state, float64_t *lin,
 	float64_t *c, int32_t totdoc, int32_t iteration, int32_t *inconsistent,
@@ -2096,8 +2095,7 @@ void CSVMLight::reactivate_inactive_examples(
         shrinking. */
      /* Computes lin for those variables from scratch. */
 {
-  register int32_t i,j,ii,jj,t,*changed2dnum,*inactive2dnum;
-  int32_t *changed,*inactive;
+  register int32_t i,j,t,*changed2dnum,*inactive2dnum;
   register float64_t *a_old,dist;
   float64_t ex_c,target;
 
@@ -2120,56 +2118,17 @@ void CSVMLight::reactivate_inactive_examples(
 
 		  if (num_modified>0)
 		  {
-			  int32_t num_threads=parallel->get_num_threads();
-			  ASSERT(num_threads>0)
-			  if (num_threads < 2)
-			  {
-				  S_THREAD_PARAM_REACTIVATE_LINADD params;
-				  params.kernel=kernel;
-				  params.lin=lin;
-				  params.last_lin=shrink_state->last_lin;
-				  params.docs=docs;
-				  params.active=shrink_state->active;
-				  params.start=0;
-				  params.end=totdoc;
-				  reactivate_inactive_examples_linadd_helper((void*) &params);
-			  }
-#ifdef HAVE_PTHREAD
-			  else
-			  {
-				  pthread_t* threads = SG_MALLOC(pthread_t, num_threads-1);
-				  S_THREAD_PARAM_REACTIVATE_LINADD* params = SG_MALLOC(S_THREAD_PARAM_REACTIVATE_LINADD, num_threads);
-				  int32_t step= totdoc/num_threads;
-
-				  for (t=0; t<num_threads-1; t++)
-				  {
-					  params[t].kernel=kernel;
-					  params[t].lin=lin;
-					  params[t].last_lin=shrink_state->last_lin;
-					  params[t].docs=docs;
-					  params[t].active=shrink_state->active;
-					  params[t].start = t*step;
-					  params[t].end = (t+1)*step;
-					  pthread_create(&threads[t], NULL, CSVMLight::reactivate_inactive_examples_linadd_helper, (void*)&params[t]);
-				  }
-
-				  params[t].kernel=kernel;
-				  params[t].lin=lin;
-				  params[t].last_lin=shrink_state->last_lin;
-				  params[t].docs=docs;
-				  params[t].active=shrink_state->active;
-				  params[t].start = t*step;
-				  params[t].end = totdoc;
-				  reactivate_inactive_examples_linadd_helper((void*) &params[t]);
+			  float64_t* last_lin=shrink_state->last_lin;
+			  int32_t* active=shrink_state->active;
 
-				  for (t=0; t<num_threads-1; t++)
-					  pthread_join(threads[t], NULL);
+			  #pragma omp parallel for num_threads(parallel->get_num_threads()) schedule(dynamic, 256)
+			  for (int32_t k=0; k<totdoc; k++)
+			  {
+				  if (!active[k])
+					  lin[k]=last_lin[k]+kernel->compute_optimized(docs[k]);
 
-				  SG_FREE(threads);
-				  SG_FREE(params);
+				  last_lin[k]=lin[k];
 			  }
-#endif
-
 		  }
 	  }
 	  else
@@ -2236,108 +2195,78 @@ void CSVMLight::reactivate_inactive_examples(
   }
   else
   {
-	  changed=SG_MALLOC(int32_t, totdoc);
-	  changed2dnum=SG_MALLOC(int32_t, totdoc+11);
-	  inactive=SG_MALLOC(int32_t, totdoc);
-	  inactive2dnum=SG_MALLOC(int32_t, totdoc+11);
-	  for (t=shrink_state->deactnum-1;(t>=0) && shrink_state->a_history[t];t--)
+	  /* examples deactivated in the same shrinking step have their
+	   * gradient computed with the alphas in the history of this step,
+	   * the history is available down to first_step */
+	  int32_t first_step=shrink_state->deactnum;
+	  while (first_step>0 && shrink_state->a_history[first_step-1])
+		  first_step--;
+	  int32_t num_steps=shrink_state->deactnum-first_step;
+
+	  /* the changes of alpha since each step are stored one step after
+	   * the other, so that examples of all steps are updated at once */
+	  int64_t* step_start=SG_MALLOC(int64_t, num_steps+1);
+	  int64_t num_changed=0;
+	  for (t=0;t<num_steps;t++)
 	  {
-		  if(verbosity>=2) {
-			  SG_INFO("%ld..",t)
-		  }
-		  a_old=shrink_state->a_history[t];
-		  for (i=0;i<totdoc;i++) {
-			  inactive[i]=((!shrink_state->active[i])
-						   && (shrink_state->inactive_since[i] == t));
-			  changed[i]= (a[i] != a_old[i]);
-		  }
-		  compute_index(inactive,totdoc,inactive2dnum);
-		  compute_index(changed,totdoc,changed2dnum);
-
-
-		  //TODO: PUT THIS BACK IN!!!!!!!! int32_t num_threads=parallel->get_num_threads();
-		  int32_t num_threads=1;
-		  ASSERT(num_threads>0)
+		  a_old=shrink_state->a_history[first_step+t];
+		  step_start[t]=num_changed;
+		  for (i=0;i<totdoc;i++)
+			  num_changed+=(a[i] != a_old[i]);
+	  }
+	  step_start[num_steps]=num_changed;
 
-		  if (num_threads < 2)
-		  {
-			  for (ii=0;(i=changed2dnum[ii])>=0;ii++) {
-				  kernel->get_kernel_row(i,inactive2dnum,aicache);
-				  for (jj=0;(j=inactive2dnum[jj])>=0;jj++)
-					  lin[j]+=(a[i]-a_old[i])*aicache[j]*(float64_t)label[i];
+	  changed2dnum=SG_MALLOC(int32_t, num_changed);
+	  float64_t* delta=SG_MALLOC(float64_t, num_changed);
+	  for (t=0;t<num_steps;t++)
+	  {
+		  a_old=shrink_state->a_history[first_step+t];
+		  int64_t k=step_start[t];
+		  for (i=0;i<totdoc;i++) {
+			  if (a[i] != a_old[i]) {
+				  changed2dnum[k]=i;
+				  delta[k++]=(a[i]-a_old[i])*(float64_t)label[i];
 			  }
 		  }
-#ifdef HAVE_PTHREAD
-		  else
-		  {
-			  //find number of the changed ones
-			  int32_t num_changed=0;
-			  for (ii=0;changed2dnum[ii]>=0;ii++)
-				  num_changed++;
+	  }
 
-			  if (num_changed>0)
-			  {
-				  pthread_t* threads= SG_MALLOC(pthread_t, num_threads-1);
-				  S_THREAD_PARAM_REACTIVATE_VANILLA* params = SG_MALLOC(S_THREAD_PARAM_REACTIVATE_VANILLA, num_threads);
-				  int32_t step= num_changed/num_threads;
-
-				  // alloc num_threads many tmp buffers
-				  float64_t* tmp_lin=SG_MALLOC(float64_t, totdoc*num_threads);
-				  memset(tmp_lin, 0, sizeof(float64_t)*((size_t) totdoc)*num_threads);
-				  float64_t* tmp_aicache=SG_MALLOC(float64_t, totdoc*num_threads);
-				  memset(tmp_aicache, 0, sizeof(float64_t)*((size_t) totdoc)*num_threads);
-
-				  int32_t thr;
-				  for (thr=0; thr<num_threads-1; thr++)
-				  {
-					  params[thr].kernel=kernel;
-					  params[thr].lin=&tmp_lin[thr*totdoc];
-					  params[thr].aicache=&tmp_aicache[thr*totdoc];
-					  params[thr].a=a;
-					  params[thr].a_old=a_old;
-					  params[thr].changed2dnum=changed2dnum;
-					  params[thr].inactive2dnum=inactive2dnum;
-					  params[thr].label=label;
-					  params[thr].start = thr*step;
-					  params[thr].end = (thr+1)*step;
-					  pthread_create(&threads[thr], NULL, CSVMLight::reactivate_inactive_examples_vanilla_helper, (void*)&params[thr]);
-				  }
+	  inactive2dnum=SG_MALLOC(int32_t, totdoc);
+	  int32_t num_inactive=0;
+	  for (i=0;i<totdoc;i++) {
+		  if ((!shrink_state->active[i])
+				  && (shrink_state->inactive_since[i] >= first_step)
+				  && (shrink_state->inactive_since[i] < shrink_state->deactnum))
+			  inactive2dnum[num_inactive++]=i;
+	  }
 
-				  params[thr].kernel=kernel;
-				  params[thr].lin=&tmp_lin[thr*totdoc];
-				  params[thr].aicache=&tmp_aicache[thr*totdoc];
-				  params[thr].a=a;
-				  params[thr].a_old=a_old;
-				  params[thr].changed2dnum=changed2dnum;
-				  params[thr].inactive2dnum=inactive2dnum;
-				  params[thr].label=label;
-				  params[thr].start = thr*step;
-				  params[thr].end = num_changed;
-				  reactivate_inactive_examples_vanilla_helper((void*) &params[thr]);
-
-				  for (jj=0;(j=inactive2dnum[jj])>=0;jj++)
-					  lin[j]+=tmp_lin[totdoc*thr+j];
-
-				  for (thr=0; thr<num_threads-1; thr++)
-				  {
-					  pthread_join(threads[thr], NULL);
+	  if(verbosity>=2) {
+		  SG_INFO("reconstructing %d gradients from %d steps..", num_inactive, num_steps)
+	  }
 
-					  //add up results
-					  for (jj=0;(j=inactive2dnum[jj])>=0;jj++)
-						  lin[j]+=tmp_lin[totdoc*thr+j];
-				  }
+	  /* every inactive example only depends on the changes since its
+	   * own step, which spreads the kernel evaluations over the threads
+	   * without any locking. Kernel values are taken from cached rows,
+	   * which are only read here */
+	  int32_t* inactive_since=shrink_state->inactive_since;
+	  #pragma omp parallel for num_threads(parallel->get_num_threads()) schedule(dynamic, 16)
+	  for (int32_t k=0; k<num_inactive; k++)
+	  {
+		  int32_t idx=inactive2dnum[k];
+		  int32_t step=inactive_since[idx]-first_step;
+		  for (int64_t l=step_start[step]; l<step_start[step+1]; l++)
+		  {
+			  float64_t kij;
+			  if (!use_kernel_cache ||
+					  !kernel->kernel_cache_lookup(changed2dnum[l], idx, kij))
+				  kij=compute_kernel(changed2dnum[l], idx);
 
-				  SG_FREE(tmp_lin);
-				  SG_FREE(tmp_aicache);
-				  SG_FREE(threads);
-				  SG_FREE(params);
-			  }
+			  lin[idx]+=delta[l]*kij;
 		  }
-#endif
 	  }
-	  SG_FREE(changed);
+
+	  SG_FREE(step_start);
 	  SG_FREE(changed2dnum);
-	  SG_FREE(inactive);
+	  SG_FREE(delta);
 	  SG_FREE(inactive2dnum);
   }
 
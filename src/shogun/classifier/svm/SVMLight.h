@@ -258,6 +258,25 @@ class CSVMLight : public CSVM
    */
   int32_t   get_runtime();
 
+  /** set whether the working set is selected using second order
+   * information (like LibSVM) instead of the steepest feasible direction
+   *
+   * @param enable if true, half of each working set is chosen by the gain
+   * in objective of a pair with the most violating example
+   */
+  inline void set_second_order_selection(bool enable)
+  {
+	  use_second_order_selection=enable;
+  }
+
+  /** get whether second order working set selection is used
+   *
+   * @return if second order selection is enabled
+   */
+  inline bool get_second_order_selection()
+  {
+	  return use_second_order_selection;
+  }
 
   /** learn SVM */
   void   svm_learn();
@@ -512,6 +531,37 @@ class CSVMLight : public CSVM
 	int32_t* working2dnum, float64_t *selcrit, int32_t *select,
 	int32_t cache_only, int32_t *key, int32_t *chosen);
 
+  /** select next qp subproblem using second order information
+   *
+   * The first half of the variables is selected by steepest feasible
+   * direction, the second half by the decrease of the objective when
+   * optimizing it in a pair with the most violating variable, which is
+   * b^2/(K_ii+K_jj-2K_ij) for a violation b.
+   *
+   * @param label label
+   * @param a a
+   * @param lin lin
+   * @param c c
+   * @param totdoc totdoc
+   * @param qp_size size of qp
+   * @param inconsistent inconsistent
+   * @param active2dnum active 2D num
+   * @param working2dnum working 2D num
+   * @param selcrit selcrit
+   * @param select select
+   * @param key key
+   * @param chosen chosen
+   * @param kernel_diag diagonal of the kernel matrix
+   * @param aicache buffer for one kernel row
+   * @return number of selected variables
+   */
+  int32_t select_next_qp_subproblem_second_order(
+	int32_t *label, float64_t *a, float64_t* lin, float64_t* c, int32_t totdoc,
+	int32_t qp_size, int32_t *inconsistent, int32_t* active2dnum,
+	int32_t* working2dnum, float64_t *selcrit, int32_t *select,
+	int32_t *key, int32_t *chosen, float64_t* kernel_diag,
+	float64_t* aicache);
+
   /** select next qp subproblem rand
    *
    * @param label label
@@ -619,24 +669,6 @@ protected:
 	 */
 	static void* compute_kernel_helper(void* p);
 
-	/** helper for update linear component linadd
-	 *
-	 * @param p p
-	 */
-	static void* update_linear_component_linadd_helper(void* p);
-
-	/** helper for reactivate inactive examples vanilla
-	 *
-	 * @param p p
-	 */
-	static void* reactivate_inactive_examples_vanilla_helper(void* p);
-
-	/** helper for reactivate inactive examples linadd
-	 *
-	 * @param p p
-	 */
-	static void* reactivate_inactive_examples_linadd_helper(void* p);
-
 	/** @return object name */
 	virtual const char* get_name() const { return "SVMLight"; }
 
@@ -689,6 +721,8 @@ protected:
   float64_t mymaxdiff;
   /** if kernel cache is used */
   bool use_kernel_cache;
+  /** if working sets are selected using second order information */
+  bool use_second_order_selection;
   /** mkl converged */
   bool mkl_converged;
 };
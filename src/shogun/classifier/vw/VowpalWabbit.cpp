@@ -15,10 +15,38 @@
 
 #include <algorithm>
 #include <shogun/classifier/vw/VowpalWabbit.h>
+#include <shogun/base/Parallel.h>
 
 using namespace std;
 using namespace shogun;
 
+/* deep copy of an example, so that it outlives its slot in the parser */
+static void copy_example(VwExample* src, VwExample* dst)
+{
+	dst->reset_members();
+	*dst->ld = *src->ld;
+
+	if (src->tag.index() > 0)
+		dst->tag.push_many(src->tag.begin, src->tag.index());
+
+	for (vw_size_t* i = src->indices.begin; i != src->indices.end; i++)
+	{
+		dst->indices.push(*i);
+		if (src->atomics[*i].index() > 0)
+			dst->atomics[*i].push_many(src->atomics[*i].begin, src->atomics[*i].index());
+		dst->sum_feat_sq[*i] = src->sum_feat_sq[*i];
+	}
+
+	dst->num_features = src->num_features;
+	dst->pass = src->pass;
+	dst->eta_round = src->eta_round;
+	dst->global_weight = src->global_weight;
+	dst->example_t = src->example_t;
+	dst->total_sum_feat_sq = src->total_sum_feat_sq;
+	dst->example_counter = src->example_counter;
+	dst->sorted = src->sorted;
+}
+
 CVowpalWabbit::CVowpalWabbit()
 	: COnlineLinearMachine()
 {
@@ -52,6 +80,8 @@ CVowpalWabbit::CVowpalWabbit(CVowpalWabbit *vw)
 	reg_dump_text = vw->reg_dump_text;
 	save_predictions = vw->save_predictions;
 	prediction_fd = vw->prediction_fd;
+	threading_mode = vw->threading_mode;
+	averaging_interval = vw->averaging_interval;
 
 	w = reg->weight_vectors[0];
 	copy(vw->w, vw->w+vw->w_dim, w);
@@ -70,6 +100,7 @@ void CVowpalWabbit::reinitialize_weights()
 {
 	if (reg->weight_vectors)
 	{
+		reg->free_thread_weights();
 		if (reg->weight_vectors[0])
 			SG_FREE(reg->weight_vectors[0]);
 		SG_FREE(reg->weight_vectors);
@@ -129,6 +160,13 @@ void CVowpalWabbit::add_quadratic_pair(char* pair)
 	env->pairs.push_back(pair);
 }
 
+void CVowpalWabbit::set_averaging_interval(int32_t num_examples)
+{
+	REQUIRE(num_examples > 0, "%s::set_averaging_interval(): Number of "
+			"examples has to be positive!\n", get_name());
+	averaging_interval = num_examples;
+}
+
 bool CVowpalWabbit::train_machine(CFeatures* feat)
 {
 	ASSERT(features || feat)
@@ -154,38 +192,49 @@ bool CVowpalWabbit::train_machine(CFeatures* feat)
 			  "loss", "last", "counter", "weight", "label", "predict", "features");
 	}
 
+	vw_size_t num_threads = (no_training || threading_mode == VW_SEQUENTIAL) ?
+		1 : parallel->get_num_threads();
+	env->num_learning_threads = num_threads;
+	env->shard_weights = num_threads > 1 && threading_mode == VW_SHARD_WEIGHTS;
+	reg->init_thread_weights();
+
 	features->start_parser();
-	while (env->passes_complete < env->num_passes)
+	if (num_threads > 1 && !env->shard_weights)
+		learn_sharded_examples();
+	else
 	{
-		while (features->get_next_example())
+		while (env->passes_complete < env->num_passes)
 		{
-			example = features->get_example();
-
-			// Check if we shouldn't train (generally used for cache creation)
-			if (!no_training)
+			while (features->get_next_example())
 			{
-				if (example->pass != current_pass)
+				example = features->get_example();
+
+				// Check if we shouldn't train (generally used for cache creation)
+				if (!no_training)
 				{
-					env->eta *= env->eta_decay_rate;
-					current_pass = example->pass;
+					if (example->pass != current_pass)
+					{
+						env->eta *= env->eta_decay_rate;
+						current_pass = example->pass;
+					}
+
+					learn_example(example);
+					output_example(example);
 				}
 
-				predict_and_finalize(example);
-
-				learner->train(example, example->eta_round);
-				example->eta_round = 0.;
-
-				output_example(example);
+				features->release_example();
 			}
-
-			features->release_example();
+			env->passes_complete++;
+			if (env->passes_complete < env->num_passes)
+				features->reset_stream();
 		}
-		env->passes_complete++;
-		if (env->passes_complete < env->num_passes)
-			features->reset_stream();
 	}
 	features->end_parser();
 
+	reg->free_thread_weights();
+	env->num_learning_threads = 1;
+	env->shard_weights = false;
+
 	if (env->l1_regularization > 0.)
 	{
 		uint32_t length = 1 << env->num_bits;
@@ -201,14 +250,108 @@ bool CVowpalWabbit::train_machine(CFeatures* feat)
 	return true;
 }
 
+void CVowpalWabbit::learn_example(VwExample* ex)
+{
+	int32_t num_threads = env->num_learning_threads;
+	if (!env->shard_weights || num_threads < 2)
+	{
+		predict_and_finalize(ex);
+		learner->train(ex, ex->eta_round);
+		ex->eta_round = 0.;
+		return;
+	}
+
+	float32_t prediction = 0;
+#pragma omp parallel for num_threads(num_threads) reduction(+:prediction)
+	for (int32_t t = 0; t < num_threads; t++)
+		prediction += compute_prediction(ex, t);
+
+	finalize_example(ex, prediction, 0);
+
+#pragma omp parallel for num_threads(num_threads)
+	for (int32_t t = 0; t < num_threads; t++)
+		learner->train(ex, ex->eta_round, t);
+	ex->eta_round = 0.;
+}
+
+void CVowpalWabbit::learn_sharded_examples()
+{
+	int32_t num_threads = env->num_learning_threads;
+	int32_t batch_size = num_threads * averaging_interval;
+	VwExample** batch = SG_MALLOC(VwExample*, batch_size);
+	for (int32_t i = 0; i < batch_size; i++)
+		batch[i] = new VwExample();
+
+	vw_size_t current_pass = 0;
+	while (env->passes_complete < env->num_passes)
+	{
+		int32_t num_examples = batch_size;
+		while (num_examples == batch_size)
+		{
+			// Copy a batch of examples, so that the parser can go on
+			num_examples = 0;
+			while (num_examples < batch_size && features->get_next_example())
+			{
+				VwExample* example = features->get_example();
+				if (example->pass != current_pass)
+				{
+					env->eta *= env->eta_decay_rate;
+					current_pass = example->pass;
+				}
+
+				copy_example(example, batch[num_examples++]);
+				features->release_example();
+			}
+
+			// Every thread learns on its part of the batch with its own weights
+#pragma omp parallel for num_threads(num_threads)
+			for (int32_t t = 0; t < num_threads; t++)
+			{
+				int32_t start = (int64_t) t * num_examples / num_threads;
+				int32_t stop = (int64_t) (t+1) * num_examples / num_threads;
+				for (int32_t i = start; i < stop; i++)
+				{
+					VwExample* ex = batch[i];
+					finalize_example(ex, compute_prediction(ex, t), t);
+					learner->train(ex, ex->eta_round, t);
+					ex->eta_round = 0.;
+				}
+			}
+			reg->average_thread_weights();
+
+			for (int32_t i = 0; i < num_examples; i++)
+				output_example(batch[i]);
+		}
+
+		env->passes_complete++;
+		if (env->passes_complete < env->num_passes)
+			features->reset_stream();
+	}
+
+	for (int32_t i = 0; i < batch_size; i++)
+		delete batch[i];
+	SG_FREE(batch);
+}
+
 float32_t CVowpalWabbit::predict_and_finalize(VwExample* ex)
 {
-	float32_t prediction;
+	float32_t prediction = compute_prediction(ex, 0);
+	finalize_example(ex, prediction, 0);
+
+	return prediction;
+}
+
+float32_t CVowpalWabbit::compute_prediction(VwExample* ex, vw_size_t thread_num)
+{
 	if (env->l1_regularization != 0.)
-		prediction = inline_l1_predict(ex);
-	else
-		prediction = inline_predict(ex);
+		return inline_l1_predict(ex, thread_num);
 
+	return inline_predict(ex, thread_num);
+}
+
+void CVowpalWabbit::finalize_example(VwExample* ex, float32_t prediction,
+		vw_size_t thread_num)
+{
 	ex->final_prediction = 0;
 	ex->final_prediction += prediction;
 	ex->final_prediction = finalize_prediction(ex->final_prediction);
@@ -221,8 +364,9 @@ float32_t CVowpalWabbit::predict_and_finalize(VwExample* ex)
 		if (env->adaptive && env->exact_adaptive_norm)
 		{
 			float32_t sum_abs_x = 0.;
-			float32_t exact_norm = compute_exact_norm(ex, sum_abs_x);
+			float32_t exact_norm = compute_exact_norm(ex, sum_abs_x, thread_num);
 			update = (env->eta * exact_norm)/sum_abs_x;
+#pragma omp atomic
 			env->update_sum += update;
 			ex->eta_round = reg->get_update(ex->final_prediction, ex->ld->label, update, exact_norm);
 		}
@@ -231,10 +375,9 @@ float32_t CVowpalWabbit::predict_and_finalize(VwExample* ex)
 			update = (env->eta)/pow(t, env->power_t) * ex->ld->weight;
 			ex->eta_round = reg->get_update(ex->final_prediction, ex->ld->label, update, ex->total_sum_feat_sq);
 		}
+#pragma omp atomic
 		env->update_sum += update;
 	}
-
-	return prediction;
 }
 
 void CVowpalWabbit::init(CStreamingVwFeatures* feat)
@@ -260,6 +403,8 @@ void CVowpalWabbit::init(CStreamingVwFeatures* feat)
 	reg_dump_text = true;
 	save_predictions = false;
 	prediction_fd = -1;
+	threading_mode = VW_SEQUENTIAL;
+	averaging_interval = 1000;
 
 	w = reg->weight_vectors[0];
 	w_dim = 1 << env->num_bits;
@@ -268,6 +413,7 @@ void CVowpalWabbit::init(CStreamingVwFeatures* feat)
 
 void CVowpalWabbit::set_learner()
 {
+	SG_UNREF(learner);
 	if (env->adaptive)
 		learner = new CVwAdaptiveLearner(reg, env);
 	else
@@ -275,51 +421,77 @@ void CVowpalWabbit::set_learner()
 	SG_REF(learner);
 }
 
-float32_t CVowpalWabbit::inline_l1_predict(VwExample* &ex)
+float32_t CVowpalWabbit::inline_l1_predict(VwExample* &ex, vw_size_t thread_num)
 {
-	vw_size_t thread_num = 0;
+	// If the weights are sharded, every thread computes a part of the sum
+	vw_size_t num_parts = env->shard_weights ? env->num_learning_threads : 1;
+	vw_size_t part = env->shard_weights ? thread_num : 0;
 
-	float32_t prediction = ex->ld->get_initial();
+	float32_t prediction = part == 0 ? ex->ld->get_initial() : 0.;
 
-	float32_t* weights = reg->weight_vectors[thread_num];
+	float32_t* weights = reg->get_weights(thread_num);
 	vw_size_t thread_mask = env->thread_mask;
 
-	prediction += features->dense_dot_truncated(weights, ex, env->l1_regularization * env->update_sum);
+	/* other learning threads add to update_sum concurrently */
+	float32_t update_sum;
+#pragma omp atomic read
+	update_sum = env->update_sum;
+	float32_t gravity = env->l1_regularization * update_sum;
+
+	if (num_parts == 1)
+		prediction += features->dense_dot_truncated(weights, ex, gravity);
+	else
+	{
+		for (vw_size_t* i = ex->indices.begin; i != ex->indices.end; i++)
+		{
+			for (VwFeature* f = ex->atomics[*i].begin + part; f < ex->atomics[*i].end; f += num_parts)
+				prediction += real_weight(weights[f->weight_index & thread_mask], gravity) * f->x;
+		}
+	}
 
 	for (int32_t k = 0; k < env->pairs.get_num_elements(); k++)
 	{
 		char* i = env->pairs.get_element(k);
 
-		v_array<VwFeature> temp = ex->atomics[(int32_t)(i[0])];
-		temp.begin = ex->atomics[(int32_t)(i[0])].begin;
-		temp.end = ex->atomics[(int32_t)(i[0])].end;
-		for (; temp.begin != temp.end; temp.begin++)
-			prediction += one_pf_quad_predict_trunc(weights, *temp.begin,
+		v_array<VwFeature>& page = ex->atomics[(int32_t)(i[0])];
+		for (VwFeature* f = page.begin + part; f < page.end; f += num_parts)
+			prediction += one_pf_quad_predict_trunc(weights, *f,
 								ex->atomics[(int32_t)(i[1])], thread_mask,
-								env->l1_regularization * env->update_sum);
+								gravity);
 	}
 
 	return prediction;
 }
 
-float32_t CVowpalWabbit::inline_predict(VwExample* &ex)
+float32_t CVowpalWabbit::inline_predict(VwExample* &ex, vw_size_t thread_num)
 {
-	vw_size_t thread_num = 0;
-	float32_t prediction = ex->ld->initial;
+	// If the weights are sharded, every thread computes a part of the sum
+	vw_size_t num_parts = env->shard_weights ? env->num_learning_threads : 1;
+	vw_size_t part = env->shard_weights ? thread_num : 0;
+
+	float32_t prediction = part == 0 ? ex->ld->initial : 0.;
 
-	float32_t* weights = reg->weight_vectors[thread_num];
+	float32_t* weights = reg->get_weights(thread_num);
 	vw_size_t thread_mask = env->thread_mask;
-	prediction += features->dense_dot(weights, 0);
+
+	if (num_parts == 1)
+		prediction += features->dense_dot(ex, weights);
+	else
+	{
+		for (vw_size_t* i = ex->indices.begin; i != ex->indices.end; i++)
+		{
+			for (VwFeature* f = ex->atomics[*i].begin + part; f < ex->atomics[*i].end; f += num_parts)
+				prediction += weights[f->weight_index & thread_mask] * f->x;
+		}
+	}
 
 	for (int32_t k = 0; k < env->pairs.get_num_elements(); k++)
 	{
 		char* i = env->pairs.get_element(k);
 
-		v_array<VwFeature> temp = ex->atomics[(int32_t)(i[0])];
-		temp.begin = ex->atomics[(int32_t)(i[0])].begin;
-		temp.end = ex->atomics[(int32_t)(i[0])].end;
-		for (; temp.begin != temp.end; temp.begin++)
-			prediction += one_pf_quad_predict(weights, *temp.begin,
+		v_array<VwFeature>& page = ex->atomics[(int32_t)(i[0])];
+		for (VwFeature* f = page.begin + part; f < page.end; f += num_parts)
+			prediction += one_pf_quad_predict(weights, *f,
 							  ex->atomics[(int32_t)(i[1])],
 							  thread_mask);
 	}
@@ -412,18 +584,18 @@ void CVowpalWabbit::set_verbose(bool verbose)
 }
 
 
-float32_t CVowpalWabbit::compute_exact_norm(VwExample* &ex, float32_t& sum_abs_x)
+float32_t CVowpalWabbit::compute_exact_norm(VwExample* &ex, float32_t& sum_abs_x,
+		vw_size_t thread_num)
 {
 	// We must traverse the features in _precisely_ the same order as during training.
 	vw_size_t thread_mask = env->thread_mask;
-	vw_size_t thread_num = 0;
 
 	float32_t g = reg->loss->get_square_grad(ex->final_prediction, ex->ld->label) * ex->ld->weight;
 	if (g == 0) return 0.;
 
 	float32_t xGx = 0.;
 
-	float32_t* weights = reg->weight_vectors[thread_num];
+	float32_t* weights = reg->get_weights(thread_num);
 	for (vw_size_t* i = ex->indices.begin; i != ex->indices.end; i++)
 	{
 		for (VwFeature* f = ex->atomics[*i].begin; f != ex->atomics[*i].end; f++)
@@ -439,11 +611,9 @@ float32_t CVowpalWabbit::compute_exact_norm(VwExample* &ex, float32_t& sum_abs_x
 	{
 		char* i = env->pairs.get_element(k);
 
-		v_array<VwFeature> temp = ex->atomics[(int32_t)(i[0])];
-		temp.begin = ex->atomics[(int32_t)(i[0])].begin;
-		temp.end = ex->atomics[(int32_t)(i[0])].end;
-		for (; temp.begin != temp.end; temp.begin++)
-			xGx += compute_exact_norm_quad(weights, *temp.begin, ex->atomics[(int32_t)(i[1])], thread_mask, g, sum_abs_x);
+		v_array<VwFeature>& page = ex->atomics[(int32_t)(i[0])];
+		for (VwFeature* f = page.begin; f != page.end; f++)
+			xGx += compute_exact_norm_quad(weights, *f, ex->atomics[(int32_t)(i[1])], thread_mask, g, sum_abs_x);
 	}
 
 	return xGx;
@@ -26,6 +26,20 @@
 
 namespace shogun
 {
+/** threading mode of CVowpalWabbit */
+enum EVwThreadingMode
+{
+	/** one learning thread, regardless of the number of threads set */
+	VW_SEQUENTIAL = 0,
+	/** every thread learns on its share of the examples with its own copy
+	 * of the weights, the copies are averaged periodically */
+	VW_SHARD_EXAMPLES = 1,
+	/** all threads work on every example, the prediction (including the
+	 * quadratic features) is split over the threads and every thread
+	 * updates its own blocks of the shared weights */
+	VW_SHARD_WEIGHTS = 2
+};
+
 /** @brief Class CVowpalWabbit is the implementation of the
  * online learning algorithm used in Vowpal Wabbit.
  *
@@ -34,6 +48,15 @@ namespace shogun
  *
  * For more details, refer to the tutorial at
  * https://github.com/JohnLangford/vowpal_wabbit/wiki/v5.1_tutorial.pdf
+ *
+ * Training is sequential by default. With set_threading_mode() it uses as
+ * many threads as set in parallel, see EVwThreadingMode for how the work
+ * is distributed. Sharding the examples scales best but only approximates
+ * sequential learning, since the weights of the threads are averaged every
+ * get_averaging_interval() examples per thread, so the model depends on
+ * the number of threads. Sharding the weights gives the same model as
+ * sequential learning, but pays off only for examples with many (e.g.
+ * quadratic) features.
  */
 class CVowpalWabbit: public COnlineLinearMachine
 {
@@ -136,6 +159,36 @@ public:
 	 */
 	void add_quadratic_pair(char* pair);
 
+	/**
+	 * Set whether and how the work is distributed over the threads
+	 *
+	 * @param mode threading mode
+	 */
+	void set_threading_mode(EVwThreadingMode mode) { threading_mode = mode; }
+
+	/**
+	 * Get whether and how the work is distributed over the threads
+	 *
+	 * @return threading mode
+	 */
+	EVwThreadingMode get_threading_mode() { return threading_mode; }
+
+	/**
+	 * Set number of examples every thread learns on before the weights
+	 * of all threads are averaged (only used when sharding examples)
+	 *
+	 * @param num_examples number of examples per thread
+	 */
+	void set_averaging_interval(int32_t num_examples);
+
+	/**
+	 * Get number of examples every thread learns on before the weights
+	 * are averaged
+	 *
+	 * @return number of examples per thread
+	 */
+	int32_t get_averaging_interval() { return averaging_interval; }
+
 	/**
 	 * Train on a StreamingVwFeatures object
 	 *
@@ -157,10 +210,12 @@ public:
 	 *
 	 * @param ex example
 	 * @param sum_abs_x set by reference, sum of abs of features
+	 * @param thread_num learning thread whose weights are used
 	 *
 	 * @return norm
 	 */
-	float32_t compute_exact_norm(VwExample* &ex, float32_t& sum_abs_x);
+	float32_t compute_exact_norm(VwExample* &ex, float32_t& sum_abs_x,
+			vw_size_t thread_num = 0);
 
 	/**
 	 * Computes the exact norm for quadratic features during adaptive learning
@@ -214,23 +269,61 @@ private:
 	 */
 	virtual void init(CStreamingVwFeatures* feat = NULL);
 
+	/**
+	 * Train on one example, in parallel if the weights are sharded
+	 *
+	 * @param ex example
+	 */
+	void learn_example(VwExample* ex);
+
+	/**
+	 * Train on all examples of the stream by sharding them over the
+	 * learning threads, see EVwThreadingMode
+	 */
+	void learn_sharded_examples();
+
+	/**
+	 * Predict with or without l1 regularization
+	 *
+	 * @param ex example
+	 * @param thread_num learning thread, computes its part of the
+	 * prediction if the weights are sharded
+	 *
+	 * @return prediction
+	 */
+	float32_t compute_prediction(VwExample* ex, vw_size_t thread_num);
+
+	/**
+	 * Finalize the prediction of an example and compute the update
+	 *
+	 * @param ex example
+	 * @param prediction raw prediction
+	 * @param thread_num learning thread
+	 */
+	void finalize_example(VwExample* ex, float32_t prediction,
+			vw_size_t thread_num);
+
 	/**
 	 * Predict with l1 regularization
 	 *
 	 * @param ex example
+	 * @param thread_num learning thread
 	 *
 	 * @return prediction
 	 */
-	virtual float32_t inline_l1_predict(VwExample* &ex);
+	virtual float32_t inline_l1_predict(VwExample* &ex,
+			vw_size_t thread_num = 0);
 
 	/**
 	 * Predict with no regularization term
 	 *
 	 * @param ex example
+	 * @param thread_num learning thread
 	 *
 	 * @return prediction
 	 */
-	virtual float32_t inline_predict(VwExample* &ex);
+	virtual float32_t inline_predict(VwExample* &ex,
+			vw_size_t thread_num = 0);
 
 	/**
 	 * Reduce the prediction within limits
@@ -308,6 +401,11 @@ private:
 	bool save_predictions;
 	/// Descriptor of prediction file
 	int32_t prediction_fd;
+
+	/// How work is distributed over the learning threads
+	EVwThreadingMode threading_mode;
+	/// Number of examples per thread between averaging the weights
+	int32_t averaging_interval;
 };
 
 }
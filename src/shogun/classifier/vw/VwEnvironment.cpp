@@ -28,6 +28,8 @@ void CVwEnvironment::init()
 	thread_bits = 0;
 	mask = (1 << num_bits) - 1;
 	stride = 1;
+	num_learning_threads = 1;
+	shard_weights = false;
 
 	min_label = 0.;
 	max_label = 1.;
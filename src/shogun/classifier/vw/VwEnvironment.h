@@ -106,6 +106,22 @@ public:
 	 */
 	void set_stride(vw_size_t new_stride);
 
+	/**
+	 * Whether a weight is updated by a learning thread. If the weights
+	 * are sharded, blocks of 16 features are assigned to the learning
+	 * threads round robin, so that threads do not share cache lines.
+	 * Otherwise every thread updates all weights of its own copy.
+	 *
+	 * @param index position in the weight vector (after masking)
+	 * @param thread_num learning thread
+	 * @return whether the thread updates the weight
+	 */
+	inline bool is_owner(vw_size_t index, vw_size_t thread_num)
+	{
+		return !shard_weights ||
+			(index/(stride*16)) % num_learning_threads == thread_num;
+	}
+
 	/**
 	 * Return the name of the object
 	 *
@@ -130,6 +146,11 @@ public:
 	vw_size_t thread_mask;
 	/// Number of elements in weight vector per feature
 	vw_size_t stride;
+	/// Number of threads learning in parallel
+	vw_size_t num_learning_threads;
+	/// Whether learning threads share the weight vector and update
+	/// disjoint blocks of it, or learn on their own copy
+	bool shard_weights;
 
 	/// Smallest label seen
 	float64_t min_label;
@@ -83,8 +83,12 @@ public:
 	 *
 	 * @param ex example
 	 * @param update update
+	 * @param thread_num learning thread. If the environment shards the
+	 * weights, only the weights owned by the thread are updated (see
+	 * CVwEnvironment::is_owner), otherwise the thread's own weight vector.
 	 */
-	virtual void train(VwExample* &ex, float32_t update) = 0;
+	virtual void train(VwExample* &ex, float32_t update,
+			vw_size_t thread_num = 0) = 0;
 
 	/**
 	 * Return the name of the object
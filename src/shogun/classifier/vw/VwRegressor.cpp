@@ -22,6 +22,7 @@ CVwRegressor::CVwRegressor()
 	: CSGObject()
 {
 	weight_vectors = NULL;
+	num_weight_vectors = 0;
 	loss = new CSquaredLoss();
 	init(NULL);
 }
@@ -30,14 +31,16 @@ CVwRegressor::CVwRegressor(CVwEnvironment* env_to_use)
 	: CSGObject()
 {
 	weight_vectors = NULL;
+	num_weight_vectors = 0;
 	loss = new CSquaredLoss();
 	init(env_to_use);
 }
 
 CVwRegressor::~CVwRegressor()
 {
-	// TODO: the number of weight_vectors depends on num_threads
-	// this should be reimplemented using SGVector (for reference counting)
+	// the first weight vector is freed by the machine using it
+	if (weight_vectors)
+		free_thread_weights();
 	SG_FREE(weight_vectors);
 	SG_UNREF(loss);
 	SG_UNREF(env);
@@ -56,9 +59,10 @@ void CVwRegressor::init(CVwEnvironment* env_to_use)
 	vw_size_t length = ((vw_size_t) 1) << env->num_bits;
 	env->thread_mask = (env->stride * (length >> env->thread_bits)) - 1;
 
-	// Only one learning thread for now
+	// Copies for further learning threads are added by init_thread_weights()
 	vw_size_t num_threads = 1;
 	weight_vectors = SG_MALLOC(float32_t*, num_threads);
+	num_weight_vectors = num_threads;
 
 	for (vw_size_t i = 0; i < num_threads; i++)
 	{
@@ -80,6 +84,57 @@ void CVwRegressor::init(CVwEnvironment* env_to_use)
 	}
 }
 
+void CVwRegressor::init_thread_weights()
+{
+	vw_size_t num_threads = env->num_learning_threads;
+	free_thread_weights();
+
+	if (env->shard_weights || num_threads < 2)
+		return;
+
+	vw_size_t length = env->stride * env->length();
+	float32_t** vectors = SG_MALLOC(float32_t*, num_threads);
+	vectors[0] = weight_vectors[0];
+	for (vw_size_t i = 1; i < num_threads; i++)
+	{
+		vectors[i] = SG_MALLOC(float32_t, length);
+		memcpy(vectors[i], weight_vectors[0], sizeof(float32_t)*length);
+	}
+
+	SG_FREE(weight_vectors);
+	weight_vectors = vectors;
+	num_weight_vectors = num_threads;
+}
+
+void CVwRegressor::average_thread_weights()
+{
+	if (num_weight_vectors < 2)
+		return;
+
+	int64_t length = env->stride * env->length();
+	float32_t scale = 1.0/num_weight_vectors;
+
+#pragma omp parallel for num_threads(num_weight_vectors)
+	for (int64_t j = 0; j < length; j++)
+	{
+		float32_t sum = 0;
+		for (vw_size_t i = 0; i < num_weight_vectors; i++)
+			sum += weight_vectors[i][j];
+
+		sum *= scale;
+		for (vw_size_t i = 0; i < num_weight_vectors; i++)
+			weight_vectors[i][j] = sum;
+	}
+}
+
+void CVwRegressor::free_thread_weights()
+{
+	for (vw_size_t i = 1; i < num_weight_vectors; i++)
+		SG_FREE(weight_vectors[i]);
+
+	num_weight_vectors = 1;
+}
+
 void CVwRegressor::dump_regressor(char* reg_name, bool as_text)
 {
 	CIOBuffer io_temp;
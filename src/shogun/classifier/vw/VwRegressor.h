@@ -109,9 +109,40 @@ public:
 	 */
 	virtual void init(CVwEnvironment* env_to_use = NULL);
 
+	/**
+	 * Get the weight vector a learning thread works on
+	 *
+	 * @param thread_num learning thread
+	 *
+	 * @return weights of the thread
+	 */
+	inline float32_t* get_weights(vw_size_t thread_num)
+	{
+		return weight_vectors[env->shard_weights ? 0 : thread_num];
+	}
+
+	/**
+	 * Add copies of the first weight vector for the learning threads
+	 * of the environment, if they learn on their own copy
+	 */
+	void init_thread_weights();
+
+	/**
+	 * Replace the weight vectors of all learning threads by their average
+	 */
+	void average_thread_weights();
+
+	/**
+	 * Free the copies of the learning threads, only the first weight
+	 * vector is kept
+	 */
+	void free_thread_weights();
+
 public:
 	/// Weight vectors, one array for each thread
 	float32_t** weight_vectors;
+	/// Number of weight vectors
+	vw_size_t num_weight_vectors;
 	/// Loss function
 	CLossFunction* loss;
 
@@ -0,0 +1,253 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/classifier/vw/cache/VwBlockCacheReader.h>
+#include <shogun/classifier/vw/cache/VwBlockCacheWriter.h>
+#include <shogun/base/Parallel.h>
+
+using namespace shogun;
+
+CVwBlockCacheReader::CVwBlockCacheReader()
+	: CVwNativeCacheReader()
+{
+	init();
+}
+
+CVwBlockCacheReader::CVwBlockCacheReader(char * fname, CVwEnvironment* env_to_use)
+	: CVwNativeCacheReader(fname, env_to_use)
+{
+	init();
+	read_block_index();
+}
+
+CVwBlockCacheReader::CVwBlockCacheReader(int32_t f, CVwEnvironment* env_to_use)
+	: CVwNativeCacheReader(f, env_to_use)
+{
+	init();
+	read_block_index();
+}
+
+CVwBlockCacheReader::~CVwBlockCacheReader()
+{
+	free_batch();
+	SG_UNREF(m_compressor);
+
+	// Hand the file back to the buffer, which closes it
+	if (fd > 0)
+		buf.use_file(fd);
+}
+
+void CVwBlockCacheReader::init()
+{
+	m_compression = UNCOMPRESSED;
+	m_compressor = NULL;
+	m_shuffle = false;
+	m_next = 0;
+	m_batch = NULL;
+	m_batch_sizes = NULL;
+	m_batch_len = 0;
+	m_batch_pos = 0;
+}
+
+void CVwBlockCacheReader::set_file(int32_t f)
+{
+	if (fd > 0)
+		buf.use_file(fd);
+
+	CVwNativeCacheReader::set_file(f);
+	read_block_index();
+}
+
+void CVwBlockCacheReader::read_block_index()
+{
+	uint32_t magic = 0;
+	uint32_t cache_version = 0;
+	int32_t compression = 0;
+	if (buf.read_file(&magic, sizeof(magic)) != sizeof(magic) || magic != VW_BLOCK_CACHE_MAGIC)
+		SG_ERROR("Cache is not a block cache!\n")
+	if (buf.read_file(&cache_version, sizeof(cache_version)) != sizeof(cache_version) || cache_version != VW_BLOCK_CACHE_VERSION)
+		SG_ERROR("Unsupported block cache version %d!\n", cache_version)
+	if (buf.read_file(&compression, sizeof(compression)) != sizeof(compression))
+		SG_ERROR("Truncated block cache header!\n")
+
+	m_compression = (E_COMPRESSION_TYPE) compression;
+	SG_UNREF(m_compressor);
+	m_compressor = new CCompressor(m_compression);
+	SG_REF(m_compressor);
+
+	// Footer: offset of the index, number of blocks and magic number
+	uint64_t index_offset = 0;
+	uint64_t num_blocks = 0;
+	off_t footer = lseek(fd, 0, SEEK_END) - 2*sizeof(uint64_t) - sizeof(uint32_t);
+	if (footer < 0 ||
+		pread(fd, &index_offset, sizeof(index_offset), footer) != sizeof(index_offset) ||
+		pread(fd, &num_blocks, sizeof(num_blocks), footer + sizeof(index_offset)) != sizeof(num_blocks) ||
+		pread(fd, &magic, sizeof(magic), footer + 2*sizeof(uint64_t)) != sizeof(magic) ||
+		magic != VW_BLOCK_CACHE_MAGIC)
+	{
+		SG_ERROR("Block cache has no index, it is probably truncated!\n")
+	}
+
+	m_offsets = SGVector<uint64_t>(num_blocks);
+	m_compressed_sizes = SGVector<uint64_t>(num_blocks);
+	m_uncompressed_sizes = SGVector<uint64_t>(num_blocks);
+	m_num_examples = SGVector<uint64_t>(num_blocks);
+
+	SGVector<uint64_t> index[] = { m_offsets, m_compressed_sizes,
+		m_uncompressed_sizes, m_num_examples };
+	ssize_t size = num_blocks*sizeof(uint64_t);
+	for (index_t i = 0; i < 4; i++)
+	{
+		if (size > 0 && pread(fd, index[i].vector, size, index_offset + i*size) != size)
+			SG_ERROR("Truncated block cache index!\n")
+	}
+
+	// Blocks are read with pread, not through the buffer
+	buf.use_file(-1);
+	reset();
+}
+
+uint64_t CVwBlockCacheReader::get_num_examples() const
+{
+	uint64_t total = 0;
+	for (index_t i = 0; i < m_num_examples.vlen; i++)
+		total += m_num_examples[i];
+
+	return total;
+}
+
+void CVwBlockCacheReader::reset()
+{
+	m_order = SGVector<index_t>(m_offsets.vlen);
+	m_order.range_fill();
+	if (m_shuffle)
+		SGVector<index_t>::permute_vector(m_order);
+
+	set_block_order(m_order);
+}
+
+void CVwBlockCacheReader::seek_block(index_t block)
+{
+	REQUIRE(block >= 0 && block < m_offsets.vlen,
+		"Block index %d out of range [0, %d)!\n", block, m_offsets.vlen)
+
+	SGVector<index_t> order(m_offsets.vlen - block);
+	order.range_fill(block);
+	set_block_order(order);
+}
+
+void CVwBlockCacheReader::set_block_order(SGVector<index_t> order)
+{
+	for (index_t i = 0; i < order.vlen; i++)
+	{
+		REQUIRE(order[i] >= 0 && order[i] < m_offsets.vlen,
+			"Block index %d out of range [0, %d)!\n", order[i], m_offsets.vlen)
+	}
+
+	m_order = order;
+	m_next = 0;
+	free_batch();
+
+	// Drop the rest of the current block
+	buf.space.end = buf.space.begin;
+	buf.endloaded = buf.space.begin;
+}
+
+void CVwBlockCacheReader::free_batch()
+{
+	for (index_t i = m_batch_pos; i < m_batch_len; i++)
+		SG_FREE(m_batch[i]);
+
+	SG_FREE(m_batch);
+	SG_FREE(m_batch_sizes);
+	m_batch = NULL;
+	m_batch_sizes = NULL;
+	m_batch_len = 0;
+	m_batch_pos = 0;
+}
+
+bool CVwBlockCacheReader::decompress_batch()
+{
+	free_batch();
+
+	int32_t num_threads = parallel->get_num_threads();
+	// The LZO codec is not thread safe
+	if (m_compression == LZO)
+		num_threads = 1;
+
+	index_t num = CMath::min(num_threads, m_order.vlen - m_next);
+	if (num <= 0)
+		return false;
+
+	m_batch = SG_MALLOC(uint8_t*, num);
+	m_batch_sizes = SG_MALLOC(uint64_t, num);
+	bool truncated = false;
+
+	#pragma omp parallel for num_threads(num_threads)
+	for (index_t i = 0; i < num; i++)
+	{
+		index_t block = m_order[m_next + i];
+		uint64_t compressed_size = m_compressed_sizes[block];
+		uint64_t uncompressed_size = m_uncompressed_sizes[block];
+
+		uint8_t* compressed = SG_MALLOC(uint8_t, compressed_size);
+		m_batch[i] = SG_MALLOC(uint8_t, uncompressed_size);
+		m_batch_sizes[i] = 0;
+		if (pread(fd, compressed, compressed_size, m_offsets[block]) == (ssize_t) compressed_size)
+		{
+			m_batch_sizes[i] = uncompressed_size;
+			m_compressor->decompress(compressed, compressed_size,
+				m_batch[i], m_batch_sizes[i]);
+		}
+		else
+			truncated = true;
+
+		SG_FREE(compressed);
+	}
+
+	m_next += num;
+	m_batch_len = num;
+	m_batch_pos = 0;
+
+	if (truncated)
+		SG_ERROR("Truncated block in block cache!\n")
+
+	return true;
+}
+
+bool CVwBlockCacheReader::next_block()
+{
+	if (m_batch_pos >= m_batch_len && !decompress_batch())
+		return false;
+
+	uint64_t size = m_batch_sizes[m_batch_pos];
+	if ((uint64_t) (buf.space.end_array - buf.space.begin) < size)
+		buf.space.reserve(size);
+
+	memcpy(buf.space.begin, m_batch[m_batch_pos], size);
+	buf.space.end = buf.space.begin;
+	buf.endloaded = buf.space.begin + size;
+
+	SG_FREE(m_batch[m_batch_pos]);
+	m_batch_pos++;
+
+	return true;
+}
+
+bool CVwBlockCacheReader::read_cached_example(VwExample* const ae)
+{
+	while (buf.space.end == buf.endloaded ||
+		!CVwNativeCacheReader::read_cached_example(ae))
+	{
+		if (!next_block())
+			return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,216 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#ifndef _VW_BLOCKCACHE_READ_H__
+#define _VW_BLOCKCACHE_READ_H__
+
+#include <shogun/classifier/vw/cache/VwNativeCacheReader.h>
+#include <shogun/lib/Compressor.h>
+#include <shogun/lib/SGVector.h>
+
+namespace shogun
+{
+
+/** @brief Class CVwBlockCacheReader reads a cache written by
+ * CVwBlockCacheWriter.
+ *
+ * The block index is loaded when the file is opened. Blocks are read in
+ * the order given by the index, or in a random order that is drawn anew
+ * on every reset() if shuffling is enabled. Examples within a block keep
+ * their order. Random access is possible by seeking to a block or by
+ * setting an arbitrary order of blocks.
+ *
+ * Blocks are decompressed in batches, one block per thread in parallel,
+ * and then decoded like the native cache (see CVwNativeCacheReader).
+ */
+class CVwBlockCacheReader: public CVwNativeCacheReader
+{
+public:
+	/**
+	 * Default constructor
+	 */
+	CVwBlockCacheReader();
+
+	/**
+	 * Constructor, opens a file whose name is specified
+	 *
+	 * @param fname file name
+	 * @param env_to_use Environment to use
+	 */
+	CVwBlockCacheReader(char * fname, CVwEnvironment* env_to_use);
+
+	/**
+	 * Constructor, passed a file descriptor
+	 *
+	 * @param f descriptor of opened file
+	 * @param env_to_use Environment to use
+	 */
+	CVwBlockCacheReader(int32_t f, CVwEnvironment* env_to_use);
+
+	/**
+	 * Destructor
+	 */
+	virtual ~CVwBlockCacheReader();
+
+	/**
+	 * Set the file descriptor to use
+	 *
+	 * @param f descriptor of cache file
+	 */
+	virtual void set_file(int32_t f);
+
+	/**
+	 * Read one cached example
+	 *
+	 * @return whether an example was read
+	 */
+	virtual bool read_cached_example(VwExample* const ae);
+
+	/**
+	 * Start a new pass over all blocks, reshuffles the blocks if
+	 * shuffling is enabled
+	 */
+	void reset();
+
+	/**
+	 * Continue reading at the beginning of a block, followed by all
+	 * blocks after it
+	 *
+	 * @param block index of the block
+	 */
+	void seek_block(index_t block);
+
+	/**
+	 * Set the blocks to read until the next reset()
+	 *
+	 * @param order indices of the blocks, may contain a subset of blocks
+	 */
+	void set_block_order(SGVector<index_t> order);
+
+	/**
+	 * Set whether the blocks are shuffled on every reset()
+	 *
+	 * @param shuffle whether to shuffle
+	 */
+	void set_shuffle(bool shuffle) { m_shuffle = shuffle; }
+
+	/**
+	 * Get whether the blocks are shuffled on every reset()
+	 *
+	 * @return whether blocks are shuffled
+	 */
+	bool get_shuffle() const { return m_shuffle; }
+
+	/**
+	 * Get the number of blocks in the cache
+	 *
+	 * @return number of blocks
+	 */
+	index_t get_num_blocks() const { return m_offsets.vlen; }
+
+	/**
+	 * Get the number of examples in a block
+	 *
+	 * @param block index of the block
+	 *
+	 * @return number of examples
+	 */
+	uint64_t get_block_num_examples(index_t block) const
+	{
+		return m_num_examples[block];
+	}
+
+	/**
+	 * Get the number of examples in the cache
+	 *
+	 * @return number of examples
+	 */
+	uint64_t get_num_examples() const;
+
+	/**
+	 * Return the name of the object.
+	 *
+	 * @return VwBlockCacheReader
+	 */
+	virtual const char* get_name() const { return "VwBlockCacheReader"; }
+
+private:
+	/**
+	 * Initialize members
+	 */
+	void init();
+
+	/**
+	 * Read the block header and the index, detaches the buffer from the
+	 * file afterwards
+	 */
+	void read_block_index();
+
+	/**
+	 * Decompress the next blocks of the current order in parallel
+	 *
+	 * @return false if all blocks have been read
+	 */
+	bool decompress_batch();
+
+	/**
+	 * Load the next decompressed block into the buffer
+	 *
+	 * @return false if all blocks have been read
+	 */
+	bool next_block();
+
+	/**
+	 * Free the decompressed blocks of the current batch
+	 */
+	void free_batch();
+
+private:
+	/// Codec used for the blocks
+	E_COMPRESSION_TYPE m_compression;
+
+	/// Compressor
+	CCompressor* m_compressor;
+
+	/// Whether blocks are shuffled on every reset
+	bool m_shuffle;
+
+	/// Offsets of the blocks
+	SGVector<uint64_t> m_offsets;
+
+	/// Compressed sizes of the blocks
+	SGVector<uint64_t> m_compressed_sizes;
+
+	/// Uncompressed sizes of the blocks
+	SGVector<uint64_t> m_uncompressed_sizes;
+
+	/// Number of examples in the blocks
+	SGVector<uint64_t> m_num_examples;
+
+	/// Blocks to read in the current pass
+	SGVector<index_t> m_order;
+
+	/// Position of the next block to decompress in m_order
+	index_t m_next;
+
+	/// Decompressed blocks of the current batch
+	uint8_t** m_batch;
+
+	/// Sizes of the decompressed blocks of the current batch
+	uint64_t* m_batch_sizes;
+
+	/// Number of blocks in the current batch
+	index_t m_batch_len;
+
+	/// Position of the next block to load in the batch
+	index_t m_batch_pos;
+};
+
+}
+#endif // _VW_BLOCKCACHE_READ_H__
@@ -0,0 +1,173 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/classifier/vw/cache/VwBlockCacheWriter.h>
+
+using namespace shogun;
+
+CVwBlockCacheWriter::CVwBlockCacheWriter()
+	: CVwNativeCacheWriter()
+{
+	init(get_default_compression(), 1<<20);
+}
+
+CVwBlockCacheWriter::CVwBlockCacheWriter(char * fname, CVwEnvironment* env_to_use,
+		E_COMPRESSION_TYPE compression, int32_t block_size)
+	: CVwNativeCacheWriter(fname, env_to_use)
+{
+	init(compression, block_size);
+	write_block_header();
+}
+
+CVwBlockCacheWriter::~CVwBlockCacheWriter()
+{
+	if (fd > 0)
+		finish_file();
+
+	SG_UNREF(m_compressor);
+}
+
+E_COMPRESSION_TYPE CVwBlockCacheWriter::get_default_compression()
+{
+#if defined(USE_SNAPPY)
+	return SNAPPY;
+#elif defined(USE_LZO)
+	return LZO;
+#elif defined(USE_GZIP)
+	return GZIP;
+#else
+	return UNCOMPRESSED;
+#endif
+}
+
+void CVwBlockCacheWriter::init(E_COMPRESSION_TYPE compression, int32_t block_size)
+{
+	m_compression = compression;
+	m_compressor = new CCompressor(compression);
+	SG_REF(m_compressor);
+	m_block_examples = 0;
+	m_offset = 0;
+	set_block_size(block_size);
+}
+
+void CVwBlockCacheWriter::set_block_size(int32_t block_size)
+{
+	REQUIRE(block_size > 0, "Block size (%d) has to be positive!\n", block_size)
+	m_block_size = block_size;
+
+	// Keep the buffered block in memory instead of flushing it to the file
+	vw_size_t used = buf.space.index();
+	if ((vw_size_t) (buf.space.end_array - buf.space.begin) < used + block_size)
+	{
+		buf.space.reserve(used + block_size);
+		buf.space.end = buf.space.begin + used;
+	}
+}
+
+void CVwBlockCacheWriter::set_file(int32_t f)
+{
+	if (fd > 0)
+		finish_file();
+
+	CVwNativeCacheWriter::set_file(f);
+	write_block_header();
+}
+
+void CVwBlockCacheWriter::write_all(const void* data, uint64_t size)
+{
+	if (size > 0 && buf.write_file(data, size) != (ssize_t) size)
+		SG_ERROR("Error writing to the block cache!\n")
+
+	m_offset += size;
+}
+
+void CVwBlockCacheWriter::write_block_header()
+{
+	// Offset of the first block, after the native header
+	off_t pos = lseek(fd, 0, SEEK_CUR);
+	if (pos < 0)
+		SG_ERROR("Block cache needs a seekable file!\n")
+	m_offset = pos;
+
+	uint32_t magic = VW_BLOCK_CACHE_MAGIC;
+	uint32_t cache_version = VW_BLOCK_CACHE_VERSION;
+	int32_t compression = m_compression;
+	write_all(&magic, sizeof(magic));
+	write_all(&cache_version, sizeof(cache_version));
+	write_all(&compression, sizeof(compression));
+
+	m_block_examples = 0;
+	m_offsets.erase();
+	m_compressed_sizes.erase();
+	m_uncompressed_sizes.erase();
+	m_num_examples.erase();
+}
+
+void CVwBlockCacheWriter::cache_example(VwExample* &ex)
+{
+	// Upper bound of the encoded size, see CVwNativeCacheWriter
+	vw_size_t max_size = 3*sizeof(float32_t) + sizeof(vw_size_t) + ex->tag.index() + 1;
+	for (vw_size_t* b = ex->indices.begin; b != ex->indices.end; b++)
+		max_size += 1 + sizeof(vw_size_t) + ex->atomics[*b].index()*(6+sizeof(float32_t));
+
+	// Grow the buffer so that the native writer never flushes it
+	vw_size_t used = buf.space.index();
+	vw_size_t capacity = buf.space.end_array - buf.space.begin;
+	if (capacity - used < max_size)
+	{
+		buf.space.reserve(CMath::max(2*capacity, used + max_size));
+		buf.space.end = buf.space.begin + used;
+	}
+
+	CVwNativeCacheWriter::cache_example(ex);
+	m_block_examples++;
+
+	if (buf.space.index() >= (vw_size_t) m_block_size)
+		write_block();
+}
+
+void CVwBlockCacheWriter::write_block()
+{
+	uint64_t uncompressed_size = buf.space.index();
+	if (uncompressed_size == 0)
+		return;
+
+	uint8_t* compressed = NULL;
+	uint64_t compressed_size = 0;
+	m_compressor->compress((uint8_t*) buf.space.begin, uncompressed_size,
+			compressed, compressed_size);
+
+	m_offsets.push(m_offset);
+	m_compressed_sizes.push(compressed_size);
+	m_uncompressed_sizes.push(uncompressed_size);
+	m_num_examples.push(m_block_examples);
+
+	write_all(compressed, compressed_size);
+	SG_FREE(compressed);
+
+	buf.space.end = buf.space.begin;
+	m_block_examples = 0;
+}
+
+void CVwBlockCacheWriter::finish_file()
+{
+	write_block();
+
+	uint64_t index_offset = m_offset;
+	uint64_t num_blocks = m_offsets.index();
+	write_all(m_offsets.begin, num_blocks*sizeof(uint64_t));
+	write_all(m_compressed_sizes.begin, num_blocks*sizeof(uint64_t));
+	write_all(m_uncompressed_sizes.begin, num_blocks*sizeof(uint64_t));
+	write_all(m_num_examples.begin, num_blocks*sizeof(uint64_t));
+
+	uint32_t magic = VW_BLOCK_CACHE_MAGIC;
+	write_all(&index_offset, sizeof(index_offset));
+	write_all(&num_blocks, sizeof(num_blocks));
+	write_all(&magic, sizeof(magic));
+}
@@ -0,0 +1,173 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#ifndef _VW_BLOCKCACHE_WRITE_H__
+#define _VW_BLOCKCACHE_WRITE_H__
+
+#include <shogun/classifier/vw/cache/VwNativeCacheWriter.h>
+#include <shogun/lib/Compressor.h>
+
+namespace shogun
+{
+
+/// Magic number identifying the block cache format ("VWBC")
+#define VW_BLOCK_CACHE_MAGIC 0x43425756
+/// Version of the block cache format
+#define VW_BLOCK_CACHE_VERSION 1
+
+/** @brief Class CVwBlockCacheWriter writes a compressed,
+ * block-indexed cache.
+ *
+ * Examples are encoded exactly like in the native cache (see
+ * CVwNativeCacheWriter), but collected into blocks of about
+ * block_size bytes which are compressed separately with CCompressor.
+ * After the last block, an index with offset, compressed size,
+ * uncompressed size and number of examples of every block is written,
+ * followed by a footer pointing to the index.
+ *
+ * The index allows CVwBlockCacheReader to access blocks in any order,
+ * to shuffle them between passes and to decompress several blocks in
+ * parallel.
+ */
+class CVwBlockCacheWriter: public CVwNativeCacheWriter
+{
+public:
+	/**
+	 * Default constructor
+	 */
+	CVwBlockCacheWriter();
+
+	/**
+	 * Constructor, opens a file whose name is specified
+	 *
+	 * @param fname file name
+	 * @param env_to_use Environment to use
+	 * @param compression codec used for the blocks
+	 * @param block_size uncompressed size of a block in bytes
+	 */
+	CVwBlockCacheWriter(char * fname, CVwEnvironment* env_to_use,
+			E_COMPRESSION_TYPE compression=get_default_compression(),
+			int32_t block_size=1<<20);
+
+	/**
+	 * Destructor, writes the last block and the index
+	 */
+	virtual ~CVwBlockCacheWriter();
+
+	/**
+	 * Set the file descriptor to use, finishes the previous file
+	 *
+	 * @param f descriptor of cache file
+	 */
+	virtual void set_file(int32_t f);
+
+	/**
+	 * Cache one example
+	 *
+	 * @param ex example to write to cache
+	 */
+	virtual void cache_example(VwExample* &ex);
+
+	/**
+	 * Set the uncompressed size of the blocks, takes effect with the
+	 * next block
+	 *
+	 * @param block_size size of a block in bytes
+	 */
+	void set_block_size(int32_t block_size);
+
+	/**
+	 * Get the uncompressed size of the blocks
+	 *
+	 * @return size of a block in bytes
+	 */
+	int32_t get_block_size() const { return m_block_size; }
+
+	/**
+	 * Get the codec used for compressing the blocks
+	 *
+	 * @return compression type
+	 */
+	E_COMPRESSION_TYPE get_compression() const { return m_compression; }
+
+	/**
+	 * Get the fastest codec available in this build, SNAPPY or LZO
+	 * if possible, GZIP otherwise
+	 *
+	 * @return compression type
+	 */
+	static E_COMPRESSION_TYPE get_default_compression();
+
+	/**
+	 * Return the name of the object.
+	 *
+	 * @return VwBlockCacheWriter
+	 */
+	virtual const char* get_name() const { return "VwBlockCacheWriter"; }
+
+private:
+	/**
+	 * Initialize members
+	 */
+	void init(E_COMPRESSION_TYPE compression, int32_t block_size);
+
+	/**
+	 * Write the block cache header after the native header
+	 */
+	void write_block_header();
+
+	/**
+	 * Compress the buffered examples and write them as one block
+	 */
+	void write_block();
+
+	/**
+	 * Write the last block, the index and the footer
+	 */
+	void finish_file();
+
+	/**
+	 * Write bytes to the file, error on short writes
+	 *
+	 * @param data data to write
+	 * @param size number of bytes
+	 */
+	void write_all(const void* data, uint64_t size);
+
+private:
+	/// Codec used for the blocks
+	E_COMPRESSION_TYPE m_compression;
+
+	/// Compressor
+	CCompressor* m_compressor;
+
+	/// Uncompressed size of a block in bytes
+	int32_t m_block_size;
+
+	/// Number of examples in the current block
+	uint64_t m_block_examples;
+
+	/// Current offset in the file
+	uint64_t m_offset;
+
+	/// Offsets of the blocks written so far
+	v_array<uint64_t> m_offsets;
+
+	/// Compressed sizes of the blocks
+	v_array<uint64_t> m_compressed_sizes;
+
+	/// Uncompressed sizes of the blocks
+	v_array<uint64_t> m_uncompressed_sizes;
+
+	/// Number of examples in the blocks
+	v_array<uint64_t> m_num_examples;
+};
+
+}
+#endif // _VW_BLOCKCACHE_WRITE_H__
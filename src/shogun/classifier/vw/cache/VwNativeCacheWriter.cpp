@@ -101,7 +101,7 @@ void CVwNativeCacheWriter::cache_label(VwLabel* ld)
 	c = bufcache_label(ld,c);
 }
 
-void CVwNativeCacheWriter::cache_tag(v_array<char> tag)
+void CVwNativeCacheWriter::cache_tag(v_array<char>& tag)
 {
 	// Store the size of the tag and the tag itself
 	char *c;
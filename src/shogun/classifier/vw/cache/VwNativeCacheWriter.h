@@ -123,7 +123,7 @@ private:
 	 *
 	 * @param tag tag
 	 */
-	void cache_tag(v_array<char> tag);
+	void cache_tag(v_array<char>& tag);
 
 	/**
 	 * Write a byte into the buffer
@@ -31,15 +31,14 @@ CVwAdaptiveLearner::~CVwAdaptiveLearner()
 {
 }
 
-void CVwAdaptiveLearner::train(VwExample* &ex, float32_t update)
+void CVwAdaptiveLearner::train(VwExample* &ex, float32_t update,
+		vw_size_t thread_num)
 {
 	if (fabs(update) == 0.)
 		return;
 
-	vw_size_t thread_num = 0;
-
 	vw_size_t thread_mask = env->thread_mask;
-	float32_t* weights = reg->weight_vectors[thread_num];
+	float32_t* weights = reg->get_weights(thread_num);
 
 	float32_t g = reg->loss->get_square_grad(ex->final_prediction, ex->ld->label) * ex->ld->weight;
 	vw_size_t ctr = 0;
@@ -47,7 +46,11 @@ void CVwAdaptiveLearner::train(VwExample* &ex, float32_t update)
 	{
 		for (VwFeature *f = ex->atomics[*i].begin; f != ex->atomics[*i].end; f++)
 		{
-			float32_t* w = &weights[f->weight_index & thread_mask];
+			vw_size_t index = f->weight_index & thread_mask;
+			if (!env->is_owner(index, thread_num))
+				continue;
+
+			float32_t* w = &weights[index];
 			w[1] += g * f->x * f->x;
 			float32_t t = f->x * CMath::invsqrt(w[1]);
 			w[0] += update * t;
@@ -58,17 +61,16 @@ void CVwAdaptiveLearner::train(VwExample* &ex, float32_t update)
 	{
 		char* i = env->pairs.get_element(k);
 
-		v_array<VwFeature> temp = ex->atomics[(int32_t)(i[0])];
-		temp.begin = ex->atomics[(int32_t)(i[0])].begin;
-		temp.end = ex->atomics[(int32_t)(i[0])].end;
-		for (; temp.begin != temp.end; temp.begin++)
-			quad_update(weights, *temp.begin, ex->atomics[(int32_t)(i[1])], thread_mask, update, g, ex, ctr);
+		v_array<VwFeature>& page = ex->atomics[(int32_t)(i[0])];
+		for (VwFeature* f = page.begin; f != page.end; f++)
+			quad_update(weights, *f, ex->atomics[(int32_t)(i[1])], thread_mask, update, g, ex, ctr, thread_num);
 	}
 }
 
 void CVwAdaptiveLearner::quad_update(float32_t* weights, VwFeature& page_feature,
 				     v_array<VwFeature> &offer_features, vw_size_t mask,
-				     float32_t update, float32_t g, VwExample* ex, vw_size_t& ctr)
+				     float32_t update, float32_t g, VwExample* ex, vw_size_t& ctr,
+				     vw_size_t thread_num)
 {
 	vw_size_t halfhash = quadratic_constant * page_feature.weight_index;
 	update *= page_feature.x;
@@ -76,7 +78,11 @@ void CVwAdaptiveLearner::quad_update(float32_t* weights, VwFeature& page_feature
 
 	for (VwFeature* elem = offer_features.begin; elem != offer_features.end; elem++)
 	{
-		float32_t* w = &weights[(halfhash + elem->weight_index) & mask];
+		vw_size_t index = (halfhash + elem->weight_index) & mask;
+		if (!env->is_owner(index, thread_num))
+			continue;
+
+		float32_t* w = &weights[index];
 		w[1] += update2 * elem->x * elem->x;
 		float32_t t = elem->x * CMath::invsqrt(w[1]);
 		w[0] += update * t;
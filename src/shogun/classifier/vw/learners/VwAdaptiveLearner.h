@@ -54,8 +54,11 @@ public:
 	 *
 	 * @param ex example
 	 * @param update the update
+	 * @param thread_num learning thread, which updates its own weights
+	 * or its blocks of the shared weights
 	 */
-	virtual void train(VwExample* &ex, float32_t update);
+	virtual void train(VwExample* &ex, float32_t update,
+			vw_size_t thread_num = 0);
 
 	/**
 	 * Return the name of the object
@@ -76,10 +79,12 @@ private:
 	 * @param g square of gradient from the regressor
 	 * @param ex example (unused)
 	 * @param ctr counter (unused)
+	 * @param thread_num learning thread
 	 */
 	void quad_update(float32_t* weights, VwFeature& page_feature,
 			 v_array<VwFeature> &offer_features, vw_size_t mask,
-			 float32_t update, float32_t g, VwExample* ex, vw_size_t& ctr);
+			 float32_t update, float32_t g, VwExample* ex, vw_size_t& ctr,
+			 vw_size_t thread_num);
 };
 }
 
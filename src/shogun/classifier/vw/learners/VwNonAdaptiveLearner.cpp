@@ -31,37 +31,43 @@ CVwNonAdaptiveLearner::~CVwNonAdaptiveLearner()
 {
 }
 
-void CVwNonAdaptiveLearner::train(VwExample* &ex, float32_t update)
+void CVwNonAdaptiveLearner::train(VwExample* &ex, float32_t update,
+		vw_size_t thread_num)
 {
 	if (fabs(update) == 0.)
 		return;
 	vw_size_t thread_mask = env->thread_mask;
 
-	vw_size_t thread_num = 0;
-	float32_t* weights = reg->weight_vectors[thread_num];
+	float32_t* weights = reg->get_weights(thread_num);
 
 	for (vw_size_t* i = ex->indices.begin; i != ex->indices.end; i++)
 	{
 		for (VwFeature* f = ex->atomics[*i].begin; f != ex->atomics[*i].end; f++)
-			weights[f->weight_index & thread_mask] += update * f->x;
+		{
+			vw_size_t index = f->weight_index & thread_mask;
+			if (env->is_owner(index, thread_num))
+				weights[index] += update * f->x;
+		}
 	}
 
 	for (int32_t k = 0; k < env->pairs.get_num_elements(); k++)
 	{
 		char* i = env->pairs.get_element(k);
 
-		v_array<VwFeature> temp = ex->atomics[(int32_t)(i[0])];
-		temp.begin = ex->atomics[(int32_t)(i[0])].begin;
-		temp.end = ex->atomics[(int32_t)(i[0])].end;
-		for (; temp.begin != temp.end; temp.begin++)
-			quad_update(weights, *temp.begin, ex->atomics[(int32_t)(i[1])], thread_mask, update);
+		v_array<VwFeature>& page = ex->atomics[(int32_t)(i[0])];
+		for (VwFeature* f = page.begin; f != page.end; f++)
+			quad_update(weights, *f, ex->atomics[(int32_t)(i[1])], thread_mask, update, thread_num);
 	}
 }
 
-void CVwNonAdaptiveLearner::quad_update(float32_t* weights, VwFeature& page_feature, v_array<VwFeature> &offer_features, vw_size_t mask, float32_t update)
+void CVwNonAdaptiveLearner::quad_update(float32_t* weights, VwFeature& page_feature, v_array<VwFeature> &offer_features, vw_size_t mask, float32_t update, vw_size_t thread_num)
 {
 	vw_size_t halfhash = quadratic_constant * page_feature.weight_index;
 	update *= page_feature.x;
 	for (VwFeature* elem = offer_features.begin; elem != offer_features.end; elem++)
-		weights[(halfhash + elem->weight_index) & mask] += update * elem->x;
+	{
+		vw_size_t index = (halfhash + elem->weight_index) & mask;
+		if (env->is_owner(index, thread_num))
+			weights[index] += update * elem->x;
+	}
 }
@@ -53,8 +53,11 @@ public:
 	 *
 	 * @param ex example
 	 * @param update the update
+	 * @param thread_num learning thread, which updates its own weights
+	 * or its blocks of the shared weights
 	 */
-	virtual void train(VwExample* &ex, float32_t update);
+	virtual void train(VwExample* &ex, float32_t update,
+			vw_size_t thread_num = 0);
 
 	/**
 	 * Return the name of the object
@@ -72,10 +75,11 @@ private:
 	 * @param offer_features features belonging to paired namespace
 	 * @param mask mask
 	 * @param update update
+	 * @param thread_num learning thread
 	 */
 	void quad_update(float32_t* weights, VwFeature& page_feature,
 			 v_array<VwFeature> &offer_features, vw_size_t mask,
-			 float32_t update);
+			 float32_t update, vw_size_t thread_num);
 };
 }
 #endif // _VW_NONADAPTIVE_H__
@@ -15,6 +15,7 @@
 #include <shogun/features/StringFeatures.h>
 #include <shogun/features/HashedDocDotFeatures.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/base/Parallel.h>
 
 using namespace shogun;
 
@@ -87,51 +88,76 @@ CFeatures* CHashedDocConverter::apply(CFeatures* features)
 	CStringFeatures<char>* s_features = (CStringFeatures<char>*) features;
 
 	int32_t dim = CMath::pow(2, num_bits);
-	SGSparseMatrix<float64_t> matrix(dim,features->get_num_vectors());
-	for (index_t vec_idx=0; vec_idx<s_features->get_num_vectors(); vec_idx++)
+	int32_t num_vectors = s_features->get_num_vectors();
+	SGSparseMatrix<float64_t> matrix(dim, num_vectors);
+
+	/** documents are hashed in parallel, every thread has its own tokenizer
+	 * and buffers which are reused for all of its documents */
+	#pragma omp parallel num_threads(parallel->get_num_threads())
 	{
-		SGVector<char> doc = s_features->get_feature_vector(vec_idx);
-		matrix[vec_idx] = apply(doc);
-		s_features->free_feature_vector(doc, vec_idx);
+		CTokenizer* local_tzer = tokenizer->get_copy();
+		SGVector<uint32_t> cached_hashes(ngrams+tokens_to_skip);
+		SGVector<index_t> ngram_indices((ngrams-1)*(tokens_to_skip+1) + 1);
+		SGVector<uint32_t> hashed_indices(1024);
+
+		#pragma omp for schedule(dynamic, 64)
+		for (index_t vec_idx=0; vec_idx<num_vectors; vec_idx++)
+		{
+			SGVector<char> doc = s_features->get_feature_vector(vec_idx);
+			matrix[vec_idx] = apply(doc, local_tzer, cached_hashes, ngram_indices,
+					hashed_indices);
+			s_features->free_feature_vector(doc, vec_idx);
+		}
+
+		SG_UNREF(local_tzer);
 	}
 
 	return (CFeatures*) new CSparseFeatures<float64_t>(matrix);
 }
 
 SGSparseVector<float64_t> CHashedDocConverter::apply(SGVector<char> document)
+{
+	SGVector<uint32_t> cached_hashes(ngrams+tokens_to_skip);
+	SGVector<index_t> ngram_indices((ngrams-1)*(tokens_to_skip+1) + 1);
+	SGVector<uint32_t> hashed_indices(1024);
+
+	return apply(document, tokenizer, cached_hashes, ngram_indices, hashed_indices);
+}
+
+SGSparseVector<float64_t> CHashedDocConverter::apply(SGVector<char> document,
+	CTokenizer* tzer, SGVector<uint32_t>& cached_hashes,
+	SGVector<index_t>& ngram_indices, SGVector<uint32_t>& hashed_indices)
 {
 	ASSERT(document.size()>0)
-	const int32_t array_size = 1024*1024;
-	/** the array will contain all the hashes generated from the tokens */
-	CDynamicArray<uint32_t> hashed_indices(array_size);
+	ASSERT(cached_hashes.vlen==ngrams+tokens_to_skip)
+	ASSERT(ngram_indices.vlen==(ngrams-1)*(tokens_to_skip+1) + 1)
 
-	/** this vector will maintain the current n+k active tokens
-	 * in a circular manner */
-	SGVector<uint32_t> cached_hashes(ngrams+tokens_to_skip);
+	/** hashed_indices will contain all the hashes generated from the tokens,
+	 * it is only grown if needed */
+	index_t num_hashed = 0;
+
+	/** cached_hashes maintains the current n+k active tokens in a circular
+	 * manner */
 	index_t hashes_start = 0;
 	index_t hashes_end = 0;
 	int32_t len = cached_hashes.vlen - 1;
 
-	/** the combinations generated from the current active tokens will be
-	 * stored here to avoid creating new objects */
-	SGVector<index_t> ngram_indices((ngrams-1)*(tokens_to_skip+1) + 1);
-
 	/** Reading n+s-1 tokens */
 	const int32_t seed = 0xdeadbeaf;
-	tokenizer->set_text(document);
+	tzer->set_text(document);
 	index_t token_start = 0;
-	while (hashes_end<ngrams-1+tokens_to_skip && tokenizer->has_next())
+	while (hashes_end<ngrams-1+tokens_to_skip && tzer->has_next())
 	{
-		index_t end = tokenizer->next_token_idx(token_start);
+		index_t end = tzer->next_token_idx(token_start);
 		uint32_t token_hash = CHash::MurmurHash3((uint8_t* ) &document.vector[token_start],
 				end-token_start, seed);
 		cached_hashes[hashes_end++] = token_hash;
 	}
 
-	/** Reading token and storing index to hashed_indices */
-	while (tokenizer->has_next())
+	/** Reading token and storing its n-gram indices to hashed_indices */
+	while (tzer->has_next())
 	{
-		index_t end = tokenizer->next_token_idx(token_start);
+		index_t end = tzer->next_token_idx(token_start);
 		uint32_t token_hash = CHash::MurmurHash3((uint8_t* ) &document.vector[token_start],
 				end-token_start, seed);
 		cached_hashes[hashes_end] = token_hash;
@@ -139,8 +165,10 @@ SGSparseVector<float64_t> CHashedDocConverter::apply(SGVector<char> document)
 		CHashedDocConverter::generate_ngram_hashes(cached_hashes, hashes_start, len,
 				ngram_indices, num_bits, ngrams, tokens_to_skip);
 
+		if (num_hashed+ngram_indices.vlen>hashed_indices.vlen)
+			hashed_indices.resize_vector(2*hashed_indices.vlen+ngram_indices.vlen);
 		for (index_t i=0; i<ngram_indices.vlen; i++)
-			hashed_indices.append_element(ngram_indices[i]);
+			hashed_indices[num_hashed++] = ngram_indices[i];
 
 		hashes_start++;
 		hashes_end++;
@@ -159,8 +187,10 @@ SGSparseVector<float64_t> CHashedDocConverter::apply(SGVector<char> document)
 			index_t max_idx = CHashedDocConverter::generate_ngram_hashes(cached_hashes, hashes_start,
 					len, ngram_indices, num_bits, ngrams, tokens_to_skip);
 
+			if (num_hashed+max_idx>hashed_indices.vlen)
+				hashed_indices.resize_vector(2*hashed_indices.vlen+max_idx);
 			for (index_t i=0; i<max_idx; i++)
-				hashed_indices.append_element(ngram_indices[i]);
+				hashed_indices[num_hashed++] = ngram_indices[i];
 
 			hashes_start++;
 			if (hashes_start==cached_hashes.vlen)
@@ -168,7 +198,8 @@ SGSparseVector<float64_t> CHashedDocConverter::apply(SGVector<char> document)
 		}
 	}
 
-	SGSparseVector<float64_t> sparse_doc_rep = create_hashed_representation(hashed_indices);
+	SGSparseVector<float64_t> sparse_doc_rep = create_hashed_representation(
+			hashed_indices.vector, num_hashed);
 
 	/** Normalizing vector */
 	if (should_normalize)
@@ -183,15 +214,22 @@ SGSparseVector<float64_t> CHashedDocConverter::apply(SGVector<char> document)
 
 SGSparseVector<float64_t> CHashedDocConverter::create_hashed_representation(CDynamicArray<uint32_t>& hashed_indices)
 {
-	int32_t num_nnz_features = count_distinct_indices(hashed_indices);
+	return create_hashed_representation(hashed_indices.get_array(),
+			hashed_indices.get_num_elements());
+}
+
+SGSparseVector<float64_t> CHashedDocConverter::create_hashed_representation(
+	uint32_t* hashed_indices, int32_t num_indices)
+{
+	int32_t num_nnz_features = count_distinct_indices(hashed_indices, num_indices);
 
 	SGSparseVector<float64_t> sparse_doc_rep(num_nnz_features);
 	index_t sparse_idx = 0;
-	for (index_t i=0; i<hashed_indices.get_num_elements(); i++)
+	for (index_t i=0; i<num_indices; i++)
 	{
 		sparse_doc_rep.features[sparse_idx].feat_index = hashed_indices[i];
 		sparse_doc_rep.features[sparse_idx].entry = 1;
-		while ( (i+1<hashed_indices.get_num_elements()) &&
+		while ( (i+1<num_indices) &&
 				(hashed_indices[i+1]==hashed_indices[i]) )
 		{
 			sparse_doc_rep.features[sparse_idx].entry++;
@@ -227,14 +265,21 @@ index_t CHashedDocConverter::generate_ngram_hashes(SGVector<uint32_t>& hashes, i
 
 int32_t CHashedDocConverter::count_distinct_indices(CDynamicArray<uint32_t>& hashed_indices)
 {
-	CMath::qsort(hashed_indices.get_array(), hashed_indices.get_num_elements());
+	return count_distinct_indices(hashed_indices.get_array(),
+			hashed_indices.get_num_elements());
+}
+
+int32_t CHashedDocConverter::count_distinct_indices(uint32_t* hashed_indices,
+	int32_t num_indices)
+{
+	CMath::qsort(hashed_indices, num_indices);
 
 	/** Counting nnz features */
 	int32_t num_nnz_features = 0;
-	for (index_t i=0; i<hashed_indices.get_num_elements(); i++)
+	for (index_t i=0; i<num_indices; i++)
 	{
 		num_nnz_features++;
-		while ( (i+1<hashed_indices.get_num_elements()) &&
+		while ( (i+1<num_indices) &&
 				(hashed_indices[i+1]==hashed_indices[i]) )
 		{
 			i++;
@@ -78,6 +78,23 @@ public:
 	 */
 	SGSparseVector<float64_t> apply(SGVector<char> document);
 
+	/** Hashes the tokens contained in document using the given tokenizer and
+	 * buffers, such that no memory needs to be allocated apart from the
+	 * result. Used to hash several documents concurrently.
+	 *
+	 * @param document the char vector to tokenize and hash
+	 * @param tzer tokenizer to use
+	 * @param cached_hashes buffer for the active tokens, of size n+k
+	 * @param ngram_indices buffer for the n-grams of a token, of size
+	 * (n-1)(k+1)+1
+	 * @param hashed_indices buffer for all hashes of the document, grown if
+	 * necessary
+	 * @return a SGSparseVector with the hashed representation of the document
+	 */
+	SGSparseVector<float64_t> apply(SGVector<char> document, CTokenizer* tzer,
+			SGVector<uint32_t>& cached_hashes, SGVector<index_t>& ngram_indices,
+			SGVector<uint32_t>& hashed_indices);
+
 	/** Generates all the k-skip n-grams combinations for the pre-hashed tokens in hashes,
 	 * starting from hashes[hashes_start] and going up to hashes[1+len] in a circular manner.
 	 * The generated tokens (maximun (n-1)(k+1)+1) are stored in ngram_hashes. The number of
@@ -129,6 +146,14 @@ protected:
 	 */
 	int32_t count_distinct_indices(CDynamicArray<uint32_t>& hashed_indices);
 
+	/** sorts the given indices and returns the number of distinct ones
+	 *
+	 * @param hashed_indices the indices to sort and count
+	 * @param num_indices number of indices
+	 * @return the number of distinct elements
+	 */
+	int32_t count_distinct_indices(uint32_t* hashed_indices, int32_t num_indices);
+
 	/** This method takes the dynamic array containing all the hashed indices of a document and returns a compact
 	 * sparse representation with each index found and with the count of such index
 	 *
@@ -137,6 +162,16 @@ protected:
 	 */
 	SGSparseVector<float64_t> create_hashed_representation(CDynamicArray<uint32_t>& hashed_indices);
 
+	/** returns the compact sparse representation of the given hashed
+	 * indices of a document (which are sorted in place)
+	 *
+	 * @param hashed_indices the hashed indices
+	 * @param num_indices number of indices
+	 * @return the compact hashed document representation
+	 */
+	SGSparseVector<float64_t> create_hashed_representation(uint32_t* hashed_indices,
+			int32_t num_indices);
+
 protected:
 
 	/** the number of bits of the hash */
@@ -44,15 +44,16 @@ public:
 	 */
 	virtual CFeatures* apply(CFeatures* features);
 
-	/** setter for the learning rate
+	/** setter for the Barnes-Hut approximation threshold, larger values
+	 * trade accuracy of the repulsive forces for speed, 0 gives exact t-SNE
 	 *
-	 * @param theta the learning rate
+	 * @param theta the Barnes-Hut threshold
 	 */
 	void set_theta(const float64_t theta);
 
-	/** getter for the learning rate
+	/** getter for the Barnes-Hut approximation threshold
 	 *
-	 * @return the learning rate theta
+	 * @return the Barnes-Hut threshold theta
 	 */
 	float64_t get_theta() const;
 
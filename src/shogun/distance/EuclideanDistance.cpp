@@ -12,8 +12,50 @@
 #include <shogun/io/SGIO.h>
 #include <shogun/distance/EuclideanDistance.h>
 
+#ifdef HAVE_EIGEN3
+#include <shogun/mathematics/eigen3.h>
+#endif
+
 using namespace shogun;
 
+/* squared distance of single precision vectors, accumulated in the
+ * precision chosen on the left hand side features */
+static float64_t squared_distance(CDenseFeatures<float32_t>* lhs,
+		CDenseFeatures<float32_t>* rhs, int32_t idx_a, int32_t idx_b)
+{
+	int32_t alen, blen;
+	bool afree, bfree;
+	float64_t result=0;
+
+	float32_t* avec=lhs->get_feature_vector(idx_a, alen, afree);
+	float32_t* bvec=rhs->get_feature_vector(idx_b, blen, bfree);
+	ASSERT(alen==blen)
+
+	if (lhs->get_accumulation_precision()==AP_DOUBLE)
+	{
+		for (int32_t i=0; i<alen; i++)
+			result+=CMath::sq((float64_t) avec[i]-bvec[i]);
+	}
+	else
+	{
+#ifdef HAVE_EIGEN3
+		Eigen::Map<const Eigen::VectorXf> a(avec, alen);
+		Eigen::Map<const Eigen::VectorXf> b(bvec, blen);
+		result=(a-b).squaredNorm();
+#else
+		float32_t sum=0;
+		for (int32_t i=0; i<alen; i++)
+			sum+=CMath::sq(avec[i]-bvec[i]);
+		result=sum;
+#endif
+	}
+
+	lhs->free_feature_vector(avec, idx_a, afree);
+	rhs->free_feature_vector(bvec, idx_b, bfree);
+
+	return result;
+}
+
 CEuclideanDistance::CEuclideanDistance() : CRealDistance()
 {
 	init();
@@ -33,6 +75,22 @@ CEuclideanDistance::~CEuclideanDistance()
 
 bool CEuclideanDistance::init(CFeatures* l, CFeatures* r)
 {
+	if (l && l->get_feature_type()==F_SHORTREAL)
+	{
+		CDistance::init(l, r);
+
+		REQUIRE(l->get_feature_class()==C_DENSE,
+				"%s::init(): Single precision features have to be dense!\n",
+				get_name());
+
+		int32_t num_feat_l=((CDenseFeatures<float32_t>*) l)->get_num_features();
+		int32_t num_feat_r=((CDenseFeatures<float32_t>*) r)->get_num_features();
+		REQUIRE(num_feat_l==num_feat_r, "%s::init(): Dimension mismatch "
+				"(l:%d vs. r:%d)\n", get_name(), num_feat_l, num_feat_r);
+
+		return true;
+	}
+
 	CRealDistance::init(l, r);
 
 	return true;
@@ -42,12 +100,31 @@ void CEuclideanDistance::cleanup()
 {
 }
 
+EFeatureType CEuclideanDistance::get_feature_type()
+{
+	if (lhs && lhs->get_feature_type()==F_SHORTREAL)
+		return F_SHORTREAL;
+
+	return F_DREAL;
+}
+
 float64_t CEuclideanDistance::compute(int32_t idx_a, int32_t idx_b)
 {
 	int32_t alen, blen;
 	bool afree, bfree;
 	float64_t result=0;
 
+	if (lhs->get_feature_type()==F_SHORTREAL)
+	{
+		result=squared_distance((CDenseFeatures<float32_t>*) lhs,
+				(CDenseFeatures<float32_t>*) rhs, idx_a, idx_b);
+
+		if (disable_sqrt)
+			return result;
+
+		return CMath::sqrt(result);
+	}
+
 	float64_t* avec=((CDenseFeatures<float64_t>*) lhs)->
 		get_feature_vector(idx_a, alen, afree);
 	float64_t* bvec=((CDenseFeatures<float64_t>*) rhs)->
@@ -79,6 +156,9 @@ float64_t CEuclideanDistance::distance_upper_bounded(int32_t idx_a, int32_t idx_
 	bool afree, bfree;
 	float64_t result=0;
 
+	if (lhs->get_feature_type()==F_SHORTREAL)
+		return compute(idx_a, idx_b);
+
 	upper_bound *= upper_bound;
 
 	float64_t* avec=((CDenseFeatures<float64_t>*) lhs)->
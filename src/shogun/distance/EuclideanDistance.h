@@ -36,6 +36,10 @@ namespace shogun
  *  d({\bf x},{\bf x'})= \sum_{i=0}^{n}|{\bf x_i}-{\bf x'_i}|^2
  * \f]
  *
+ * Besides CDenseFeatures<float64_t>, single precision CDenseFeatures<float32_t>
+ * are accepted. Their distances are accumulated in the precision set by
+ * CDenseFeatures::set_accumulation_precision() on the left hand side.
+ *
  * @see CMinkowskiMetric
  * @see <a href="http://en.wikipedia.org/wiki/Distance#Distance_in_Euclidean_space">
  * Wikipedia: Distance in Euclidean space</a>
@@ -73,9 +77,10 @@ class CEuclideanDistance: public CRealDistance
 
 		/** get feature type the distance can deal with
 		 *
-		 * @return feature type DREAL
+		 * @return feature type SHORTREAL if initialized with single precision
+		 * features, DREAL otherwise
 		 */
-		virtual EFeatureType get_feature_type() { return F_DREAL; }
+		virtual EFeatureType get_feature_type();
 
 		/** get name of the distance
 		 *
@@ -0,0 +1,41 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/evaluation/BinaryClassEvaluation.h>
+#include <shogun/labels/Labels.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/base/Parallel.h>
+
+using namespace shogun;
+
+void CBinaryClassEvaluation::sort_by_score(CLabels* predicted,
+		CLabels* ground_truth, SGVector<float64_t>& scores,
+		SGVector<bool>& positive)
+{
+	int32_t length=predicted->get_num_labels();
+
+	/* ascending sort of negated scores gives the descending order */
+	scores=SGVector<float64_t>(length);
+	SGVector<int32_t> idxs(length);
+	for (int32_t i=0; i<length; i++)
+	{
+		scores[i]=-predicted->get_value(i);
+		idxs[i]=i;
+	}
+
+	CMath::parallel_qsort_index(scores.vector, idxs.vector, length,
+			parallel->get_num_threads());
+
+	positive=SGVector<bool>(length);
+	for (int32_t i=0; i<length; i++)
+	{
+		scores[i]=-scores[i];
+		positive[i]=ground_truth->get_value(idxs[i])>0;
+	}
+}
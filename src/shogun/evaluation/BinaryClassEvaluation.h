@@ -41,6 +41,19 @@ public:
 	 * @return evaluation result
 	 */
 	virtual float64_t evaluate(CLabels* predicted, CLabels* ground_truth) = 0;
+
+protected:
+	/** sorts predictions by their scores in descending order, the sort
+	 * runs in parallel (see CMath::parallel_qsort_index) for large inputs
+	 *
+	 * @param predicted predicted labels
+	 * @param ground_truth labels assumed to be correct
+	 * @param scores return parameter for sorted scores
+	 * @param positive return parameter, whether the example of the
+	 * corresponding sorted score is a positive one
+	 */
+	void sort_by_score(CLabels* predicted, CLabels* ground_truth,
+			SGVector<float64_t>& scores, SGVector<bool>& positive);
 };
 
 }
@@ -0,0 +1,190 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/evaluation/HistogramROCEvaluation.h>
+#include <shogun/labels/Labels.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/base/Parallel.h>
+
+using namespace shogun;
+
+CHistogramROCEvaluation::CHistogramROCEvaluation() : CROCEvaluation()
+{
+	init();
+}
+
+CHistogramROCEvaluation::CHistogramROCEvaluation(int32_t num_bins,
+		float64_t lower, float64_t upper) : CROCEvaluation()
+{
+	init();
+
+	REQUIRE(num_bins>0, "%s(): Number of bins (%d) has to be positive\n",
+			get_name(), num_bins);
+	REQUIRE(lower<upper, "%s(): Lower bound (%f) has to be smaller than "
+			"upper bound (%f)\n", get_name(), lower, upper);
+
+	m_num_bins=num_bins;
+	m_lower=lower;
+	m_upper=upper;
+	reset();
+}
+
+CHistogramROCEvaluation::~CHistogramROCEvaluation()
+{
+}
+
+void CHistogramROCEvaluation::init()
+{
+	m_num_bins=1000;
+	m_lower=-1.0;
+	m_upper=1.0;
+	reset();
+
+	SG_ADD(&m_num_bins, "num_bins", "Number of bins", MS_NOT_AVAILABLE);
+	SG_ADD(&m_lower, "lower", "Lower bound of scores", MS_NOT_AVAILABLE);
+	SG_ADD(&m_upper, "upper", "Upper bound of scores", MS_NOT_AVAILABLE);
+	SG_ADD(&m_pos_counts, "pos_counts", "Counts of positive examples",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_neg_counts, "neg_counts", "Counts of negative examples",
+			MS_NOT_AVAILABLE);
+}
+
+void CHistogramROCEvaluation::reset()
+{
+	m_pos_counts=SGVector<float64_t>(m_num_bins);
+	m_neg_counts=SGVector<float64_t>(m_num_bins);
+	m_pos_counts.zero();
+	m_neg_counts.zero();
+	m_computed=false;
+}
+
+float64_t CHistogramROCEvaluation::evaluate(CLabels* predicted,
+		CLabels* ground_truth)
+{
+	reset();
+	return add_batch(predicted, ground_truth);
+}
+
+float64_t CHistogramROCEvaluation::add_batch(CLabels* predicted,
+		CLabels* ground_truth)
+{
+	ASSERT(predicted && ground_truth)
+	ASSERT(predicted->get_num_labels()==ground_truth->get_num_labels())
+	ASSERT(predicted->get_label_type()==LT_BINARY)
+	ASSERT(ground_truth->get_label_type()==LT_BINARY)
+	ground_truth->ensure_valid();
+
+	int32_t length=predicted->get_num_labels();
+
+	/* every thread counts into its own histograms which are merged */
+	#pragma omp parallel num_threads(parallel->get_num_threads())
+	{
+		SGVector<float64_t> pos_counts(m_num_bins);
+		SGVector<float64_t> neg_counts(m_num_bins);
+		pos_counts.zero();
+		neg_counts.zero();
+
+		#pragma omp for
+		for (int32_t i=0; i<length; i++)
+		{
+			int32_t bin=get_bin(predicted->get_value(i));
+			if (ground_truth->get_value(i)>0)
+				pos_counts[bin]+=1.0;
+			else
+				neg_counts[bin]+=1.0;
+		}
+
+		#pragma omp critical
+		{
+			for (int32_t i=0; i<m_num_bins; i++)
+			{
+				m_pos_counts[i]+=pos_counts[i];
+				m_neg_counts[i]+=neg_counts[i];
+			}
+		}
+	}
+
+	compute_roc();
+	return m_auROC;
+}
+
+float64_t CHistogramROCEvaluation::get_num_positive() const
+{
+	return SGVector<float64_t>::sum(m_pos_counts);
+}
+
+float64_t CHistogramROCEvaluation::get_num_negative() const
+{
+	return SGVector<float64_t>::sum(m_neg_counts);
+}
+
+void CHistogramROCEvaluation::compute_roc()
+{
+	float64_t pos_count=get_num_positive();
+	float64_t neg_count=get_num_negative();
+
+	// assure both number of positive and negative examples is >0
+	REQUIRE(pos_count>0, "%s::compute_roc(): Number of positive labels is "
+			"zero, ROC fails!\n", get_name());
+	REQUIRE(neg_count>0, "%s::compute_roc(): Number of negative labels is "
+			"zero, ROC fails!\n", get_name());
+
+	// number of non-empty bins, each gives a point on the graph
+	int32_t diff_count=0;
+	for (int32_t i=0; i<m_num_bins; i++)
+	{
+		if (m_pos_counts[i]>0 || m_neg_counts[i]>0)
+			diff_count++;
+	}
+
+	if (m_auc_only)
+	{
+		m_ROC_graph=SGMatrix<float64_t>();
+		m_thresholds=SGVector<float64_t>();
+	}
+	else
+	{
+		m_ROC_graph=SGMatrix<float64_t>(2,diff_count+1);
+		m_thresholds=SGVector<float64_t>(diff_count+1);
+		m_ROC_graph[0]=0.0;
+		m_ROC_graph[1]=0.0;
+		m_thresholds[0]=CMath::INFTY;
+	}
+
+	// walk from highest to lowest scores, examples in one bin are tied
+	float64_t tp=0.0;
+	float64_t fp=0.0;
+	int32_t j=1;
+	m_auROC=0.0;
+	for (int32_t i=m_num_bins-1; i>=0; i--)
+	{
+		if (m_pos_counts[i]==0 && m_neg_counts[i]==0)
+			continue;
+
+		float64_t last_x=fp/neg_count;
+		float64_t last_y=tp/pos_count;
+		tp+=m_pos_counts[i];
+		fp+=m_neg_counts[i];
+		float64_t x=fp/neg_count;
+		float64_t y=tp/pos_count;
+		m_auROC+=0.5*(x-last_x)*(y+last_y);
+
+		if (!m_auc_only)
+		{
+			m_ROC_graph[2*j]=x;
+			m_ROC_graph[2*j+1]=y;
+			// all scores in this and higher bins are predicted positive
+			m_thresholds[j]=i==0 ? -CMath::INFTY :
+					m_lower+i*(m_upper-m_lower)/m_num_bins;
+		}
+		j++;
+	}
+
+	m_computed=true;
+}
@@ -0,0 +1,128 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#ifndef HISTOGRAMROCEVALUATION_H_
+#define HISTOGRAMROCEVALUATION_H_
+
+#include <shogun/evaluation/ROCEvaluation.h>
+
+namespace shogun
+{
+
+class CLabels;
+
+/** @brief Class HistogramROCEvaluation approximates ROC and auROC with
+ * histograms of the scores of positive and negative examples.
+ *
+ * Scores are counted in num_bins equally sized bins between a lower and an
+ * upper bound, scores outside are counted in the first or the last bin. All
+ * examples in the same bin are treated as having the same score, so the
+ * auROC is exact if no two examples of different classes share a bin, and
+ * otherwise off by at most half of the fraction of such pairs.
+ *
+ * Memory does not depend on the number of examples, as predictions can be
+ * added in batches with add_batch(). ROC graph and auROC (see CROCEvaluation)
+ * are always updated for all examples added since the last reset(). As
+ * evaluate() resets before adding its labels, the class can be used as a
+ * drop-in replacement for CROCEvaluation, e.g. in CCrossValidation or
+ * CMulticlassOVREvaluation.
+ */
+class CHistogramROCEvaluation: public CROCEvaluation
+{
+public:
+	/** constructor */
+	CHistogramROCEvaluation();
+
+	/** constructor
+	 *
+	 * @param num_bins number of bins of the histograms
+	 * @param lower lower bound of the scores
+	 * @param upper upper bound of the scores
+	 */
+	CHistogramROCEvaluation(int32_t num_bins, float64_t lower=-1.0,
+			float64_t upper=1.0);
+
+	/** destructor */
+	virtual ~CHistogramROCEvaluation();
+
+	/** get name */
+	virtual const char* get_name() const { return "HistogramROCEvaluation"; }
+
+	/** evaluate approximate ROC and auROC of the given labels only
+	 *
+	 * @param predicted labels
+	 * @param ground_truth labels assumed to be correct
+	 * @return approximate auROC
+	 */
+	virtual float64_t evaluate(CLabels* predicted, CLabels* ground_truth);
+
+	/** removes all examples from the histograms */
+	void reset();
+
+	/** adds a batch of examples to the histograms and updates ROC and auROC
+	 *
+	 * @param predicted labels
+	 * @param ground_truth labels assumed to be correct
+	 * @return approximate auROC of all examples added since last reset
+	 */
+	float64_t add_batch(CLabels* predicted, CLabels* ground_truth);
+
+	/** @return number of bins */
+	int32_t get_num_bins() const { return m_num_bins; }
+
+	/** @return lower bound of the scores */
+	float64_t get_lower() const { return m_lower; }
+
+	/** @return upper bound of the scores */
+	float64_t get_upper() const { return m_upper; }
+
+	/** @return number of positive examples added since last reset */
+	float64_t get_num_positive() const;
+
+	/** @return number of negative examples added since last reset */
+	float64_t get_num_negative() const;
+
+protected:
+	/** @return bin of a score */
+	inline int32_t get_bin(float64_t score) const
+	{
+		float64_t pos=(score-m_lower)/(m_upper-m_lower)*m_num_bins;
+		if (!(pos>0))
+			return 0;
+		if (pos>=m_num_bins)
+			return m_num_bins-1;
+		return (int32_t) pos;
+	}
+
+	/** computes ROC graph, thresholds and auROC from the histograms */
+	void compute_roc();
+
+private:
+	void init();
+
+protected:
+	/** number of bins */
+	int32_t m_num_bins;
+
+	/** lower bound of the scores */
+	float64_t m_lower;
+
+	/** upper bound of the scores */
+	float64_t m_upper;
+
+	/** counts of positive examples per bin */
+	SGVector<float64_t> m_pos_counts;
+
+	/** counts of negative examples per bin */
+	SGVector<float64_t> m_neg_counts;
+};
+
+}
+
+#endif /* HISTOGRAMROCEVALUATION_H_ */
@@ -59,7 +59,15 @@ float64_t CMulticlassOVREvaluation::evaluate(CLabels* predicted, CLabels* ground
 			all(i,j) = confs[j];
 		}
 	}
-	if (dynamic_cast<CROCEvaluation*>(m_binary_evaluation) || dynamic_cast<CPRCEvaluation*>(m_binary_evaluation))
+	CROCEvaluation* roc_evaluation=dynamic_cast<CROCEvaluation*>(m_binary_evaluation);
+	CPRCEvaluation* prc_evaluation=dynamic_cast<CPRCEvaluation*>(m_binary_evaluation);
+	// graphs are not available if only the areas are computed
+	if (roc_evaluation && roc_evaluation->get_auc_only())
+		roc_evaluation=NULL;
+	if (prc_evaluation && prc_evaluation->get_auc_only())
+		prc_evaluation=NULL;
+
+	if (roc_evaluation || prc_evaluation)
 	{
 		for (int32_t i=0; i<m_num_graph_results; i++)
 			m_graph_results[i].~SGMatrix<float64_t>();
@@ -81,15 +89,15 @@ float64_t CMulticlassOVREvaluation::evaluate(CLabels* predicted, CLabels* ground
 		CLabels* gt = new CBinaryLabels(gt_vec);
 		m_last_results[c] = m_binary_evaluation->evaluate(pred, gt);
 
-		if (dynamic_cast<CROCEvaluation*>(m_binary_evaluation))
+		if (roc_evaluation)
 		{
 			new (&m_graph_results[c]) SGMatrix<float64_t>();
-			m_graph_results[c] = ((CROCEvaluation*)m_binary_evaluation)->get_ROC();
+			m_graph_results[c] = roc_evaluation->get_ROC();
 		}
-		if (dynamic_cast<CPRCEvaluation*>(m_binary_evaluation))
+		if (prc_evaluation)
 		{
 			new (&m_graph_results[c]) SGMatrix<float64_t>();
-			m_graph_results[c] = ((CPRCEvaluation*)m_binary_evaluation)->get_PRC();
+			m_graph_results[c] = prc_evaluation->get_PRC();
 		}
 	}
 	return CStatistics::mean(m_last_results);
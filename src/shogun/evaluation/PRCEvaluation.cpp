@@ -27,64 +27,73 @@ float64_t CPRCEvaluation::evaluate(CLabels* predicted, CLabels* ground_truth)
 	ASSERT(ground_truth->get_label_type()==LT_BINARY)
 	ground_truth->ensure_valid();
 
+	// scores sorted descending and whether they belong to positive examples
+	SGVector<float64_t> scores;
+	SGVector<bool> positive;
+	sort_by_score(predicted, ground_truth, scores, positive);
+	int32_t length=scores.vlen;
+
 	// number of true positive examples
 	float64_t tp = 0.0;
 	int32_t i;
 
-	// total number of positive labels in predicted
+	// total number of positive labels
 	int32_t pos_count=0;
-
-	// initialize number of labels and labels
-	SGVector<float64_t> orig_labels = predicted->get_values();
-	int32_t length = orig_labels.vlen;
-	float64_t* labels = SGVector<float64_t>::clone_vector(orig_labels.vector, length);
-
-	// get indexes for sort
-	int32_t* idxs = SG_MALLOC(int32_t, length);
-	for(i=0; i<length; i++)
-		idxs[i] = i;
-
-	// sort indexes by labels ascending
-	CMath::qsort_backward_index(labels,idxs,length);
-
-	// clean and initialize graph and auPRC
-	SG_FREE(labels);
-	m_PRC_graph = SGMatrix<float64_t>(2,length);
-	m_thresholds = SGVector<float64_t>(length);
-	m_auPRC = 0.0;
-
-	// get total numbers of positive and negative labels
 	for (i=0; i<length; i++)
 	{
-		if (ground_truth->get_value(i) > 0)
+		if (positive[i])
 			pos_count++;
 	}
 
 	// assure number of positive examples is >0
 	ASSERT(pos_count>0)
 
-	// create PRC curve
+	// clean and initialize graph and auPRC, the graph is not stored if
+	// only the area is requested
+	if (m_auc_only)
+	{
+		m_PRC_graph = SGMatrix<float64_t>();
+		m_thresholds = SGVector<float64_t>();
+	}
+	else
+	{
+		m_PRC_graph = SGMatrix<float64_t>(2,length);
+		m_thresholds = SGVector<float64_t>(length);
+	}
+	m_auPRC = 0.0;
+
+	// previous point on the curve
+	float64_t last_precision=0.0;
+	float64_t last_recall=0.0;
+
+	// create PRC curve and calc auPRC using the trapezoidal rule
 	for (i=0; i<length; i++)
 	{
 		// update number of true positive examples
-		if (ground_truth->get_value(idxs[i]) > 0)
+		if (positive[i])
 			tp += 1.0;
 
-		// precision (x)
-		m_PRC_graph[2*i] = tp/float64_t(i+1);
-		// recall (y)
-		m_PRC_graph[2*i+1] = tp/float64_t(pos_count);
-
-		m_thresholds[i]= predicted->get_value(idxs[i]);
+		float64_t precision = tp/float64_t(i+1);
+		float64_t recall = tp/float64_t(pos_count);
+		if (i>0)
+			m_auPRC += 0.5*(recall-last_recall)*(precision+last_precision);
+		last_precision = precision;
+		last_recall = recall;
+
+		if (!m_auc_only)
+		{
+			// precision (x)
+			m_PRC_graph[2*i] = precision;
+			// recall (y)
+			m_PRC_graph[2*i+1] = recall;
+
+			m_thresholds[i] = scores[i];
+		}
 	}
 
-	// calc auRPC using area under curve
-	m_auPRC = CMath::area_under_curve(m_PRC_graph.matrix,length,true);
-
 	// set computed indicator
 	m_computed = true;
 
-	SG_FREE(idxs);
 	return m_auPRC;
 }
 
@@ -93,6 +102,9 @@ SGMatrix<float64_t> CPRCEvaluation::get_PRC()
 	if (!m_computed)
 		SG_ERROR("Uninitialized, please call evaluate first")
 
+	REQUIRE(!m_auc_only, "%s::get_PRC(): Graph is not computed if only the area "
+			"is requested\n", get_name());
+
 	return m_PRC_graph;
 }
 
@@ -101,6 +113,9 @@ SGVector<float64_t> CPRCEvaluation::get_thresholds()
 	if (!m_computed)
 		SG_ERROR("Uninitialized, please call evaluate first")
 
+	REQUIRE(!m_auc_only, "%s::get_thresholds(): Thresholds are not computed if only the area "
+			"is requested\n", get_name());
+
 	return m_thresholds;
 }
 
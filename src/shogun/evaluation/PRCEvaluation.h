@@ -27,7 +27,7 @@ class CPRCEvaluation: public CBinaryClassEvaluation
 public:
 	/** constructor */
 	CPRCEvaluation() :
-		CBinaryClassEvaluation(), m_computed(false)
+		CBinaryClassEvaluation(), m_computed(false), m_auc_only(false)
 	{
 		m_PRC_graph = SGMatrix<float64_t>();
 		m_thresholds = SGVector<float64_t>();
@@ -67,6 +67,16 @@ public:
 	 */
 	SGVector<float64_t> get_thresholds();
 
+	/** if set, evaluate only computes the auPRC but neither stores the PRC
+	 * graph nor the thresholds, which saves memory for many labels
+	 *
+	 * @param auc_only whether only the area is computed
+	 */
+	void set_auc_only(bool auc_only) { m_auc_only=auc_only; }
+
+	/** @return whether only the area is computed */
+	bool get_auc_only() const { return m_auc_only; }
+
 protected:
 
 	/** 2-d array used to store PRC graph */
@@ -80,6 +90,9 @@ protected:
 
 	/** indicator of PRC and auPRC being computed already */
 	bool m_computed;
+
+	/** whether only auPRC is computed */
+	bool m_auc_only;
 };
 
 }
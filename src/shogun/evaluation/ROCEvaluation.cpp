@@ -30,53 +30,19 @@ float64_t CROCEvaluation::evaluate_roc(CLabels* predicted, CLabels* ground_truth
 	ASSERT(ground_truth->get_label_type()==LT_BINARY)
 	ground_truth->ensure_valid();
 
-	// assume threshold as negative infinity
-	float64_t threshold = CMath::ALMOST_NEG_INFTY;
-	// false positive rate
-	float64_t fp = 0.0;
-	// true positive rate
-	float64_t tp=0.0;
+	// scores sorted descending and whether they belong to positive examples
+	SGVector<float64_t> scores;
+	SGVector<bool> positive;
+	sort_by_score(predicted, ground_truth, scores, positive);
+	int32_t length=scores.vlen;
 
 	int32_t i;
-	// total number of positive labels in predicted
+	// total number of positive and negative labels
 	int32_t pos_count=0;
 	int32_t neg_count=0;
-
-	// initialize number of labels and labels
-	SGVector<float64_t> orig_labels(predicted->get_num_labels());
-	int32_t length = orig_labels.vlen;
 	for (i=0; i<length; i++)
-		orig_labels[i] = predicted->get_value(i);
-	float64_t* labels = SGVector<float64_t>::clone_vector(orig_labels.vector, length);
-
-	// get sorted indexes
-	SGVector<int32_t> idxs(length);
-	for(i=0; i<length; i++)
-		idxs[i] = i;
-
-	CMath::qsort_backward_index(labels,idxs.vector,idxs.vlen);
-
-	// number of different predicted labels
-	int32_t diff_count=1;
-
-	// get number of different labels
-	for (i=0; i<length-1; i++)
 	{
-		if (labels[i] != labels[i+1])
-			diff_count++;
-	}
-
-	SG_FREE(labels);
-
-	// initialize graph and auROC
-	m_ROC_graph = SGMatrix<float64_t>(2,diff_count+1);
-	m_thresholds = SGVector<float64_t>(length);
-	m_auROC = 0.0;
-
-	// get total numbers of positive and negative labels
-	for(i=0; i<length; i++)
-	{
-		if (ground_truth->get_value(i) >= 0)
+		if (positive[i])
 			pos_count++;
 		else
 			neg_count++;
@@ -88,38 +54,77 @@ float64_t CROCEvaluation::evaluate_roc(CLabels* predicted, CLabels* ground_truth
 	REQUIRE(neg_count>0, "%s::evaluate_roc(): Number of negative labels is "
 			"zero, ROC fails!\n", get_name());
 
-	int32_t j = 0;
-	float64_t label;
+	// number of different predicted labels
+	int32_t diff_count=1;
+	for (i=0; i<length-1; i++)
+	{
+		if (scores[i] != scores[i+1])
+			diff_count++;
+	}
 
-	// create ROC curve and calculate auROC
-	for(i=0; i<length; i++)
+	// initialize graph and auROC, the graph is not stored if only the
+	// area is requested
+	if (m_auc_only)
 	{
-		label = predicted->get_value(idxs[i]);
+		m_ROC_graph=SGMatrix<float64_t>();
+		m_thresholds=SGVector<float64_t>();
+	}
+	else
+	{
+		m_ROC_graph=SGMatrix<float64_t>(2,diff_count+1);
+		m_thresholds=SGVector<float64_t>(length);
+	}
+	m_auROC=0.0;
 
-		if (label != threshold)
+	// assume threshold as negative infinity
+	float64_t threshold=CMath::ALMOST_NEG_INFTY;
+	// false and true positives
+	float64_t fp=0.0;
+	float64_t tp=0.0;
+	// previous point on the curve
+	float64_t last_x=0.0;
+	float64_t last_y=0.0;
+	int32_t j=0;
+
+	// create ROC curve and calculate auROC using the trapezoidal rule
+	for (i=0; i<length; i++)
+	{
+		if (scores[i] != threshold)
 		{
-			threshold = label;
-			m_ROC_graph[2*j] = fp/neg_count;
-			m_ROC_graph[2*j+1] = tp/pos_count;
+			threshold=scores[i];
+			float64_t x=fp/neg_count;
+			float64_t y=tp/pos_count;
+			if (j>0)
+				m_auROC+=0.5*(x-last_x)*(y+last_y);
+			last_x=x;
+			last_y=y;
+
+			if (!m_auc_only)
+			{
+				m_ROC_graph[2*j]=x;
+				m_ROC_graph[2*j+1]=y;
+			}
 			j++;
 		}
 
-		m_thresholds[i]=threshold;
+		if (!m_auc_only)
+			m_thresholds[i]=threshold;
 
-		if (ground_truth->get_value(idxs[i]) > 0)
+		if (positive[i])
 			tp+=1.0;
 		else
 			fp+=1.0;
 	}
 
 	// add (1,1) to ROC curve
-	m_ROC_graph[2*diff_count] = 1.0;
-	m_ROC_graph[2*diff_count+1] = 1.0;
-
-	// calc auROC using area under curve
-	m_auROC = CMath::area_under_curve(m_ROC_graph.matrix,diff_count+1,false);
+	m_auROC+=0.5*(1.0-last_x)*(1.0+last_y);
+	if (!m_auc_only)
+	{
+		m_ROC_graph[2*diff_count]=1.0;
+		m_ROC_graph[2*diff_count+1]=1.0;
+	}
 
-	m_computed = true;
+	m_computed=true;
 
 	return m_auROC;
 }
@@ -129,6 +134,9 @@ SGMatrix<float64_t> CROCEvaluation::get_ROC()
 	if (!m_computed)
 		SG_ERROR("Uninitialized, please call evaluate first")
 
+	REQUIRE(!m_auc_only, "%s::get_ROC(): Graph is not computed if only the "
+			"area is requested\n", get_name());
+
 	return m_ROC_graph;
 }
 
@@ -137,6 +145,9 @@ SGVector<float64_t> CROCEvaluation::get_thresholds()
 	if (!m_computed)
 		SG_ERROR("Uninitialized, please call evaluate first")
 
+	REQUIRE(!m_auc_only, "%s::get_thresholds(): Thresholds are not computed "
+			"if only the area is requested\n", get_name());
+
 	return m_thresholds;
 }
 
@@ -32,7 +32,8 @@ class CROCEvaluation: public CBinaryClassEvaluation
 public:
 	/** constructor */
 	CROCEvaluation() :
-		CBinaryClassEvaluation(), m_computed(false)
+		CBinaryClassEvaluation(), m_auROC(0.0), m_computed(false),
+		m_auc_only(false)
 	{
 		m_ROC_graph = SGMatrix<float64_t>();
 		m_thresholds = SGVector<float64_t>();
@@ -71,6 +72,16 @@ public:
 	 */
 	SGVector<float64_t> get_thresholds();
 
+	/** if set, evaluate only computes the auROC but neither stores the ROC
+	 * graph nor the thresholds, which saves memory for many labels
+	 *
+	 * @param auc_only whether only the area is computed
+	 */
+	void set_auc_only(bool auc_only) { m_auc_only=auc_only; }
+
+	/** @return whether only the area is computed */
+	bool get_auc_only() const { return m_auc_only; }
+
 protected:
 
 	/** evaluate ROC and auROC
@@ -93,6 +104,9 @@ protected:
 
 	/** indicator of ROC and auROC being computed already */
 	bool m_computed;
+
+	/** whether only auROC is computed */
+	bool m_auc_only;
 };
 
 }
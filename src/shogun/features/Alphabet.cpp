@@ -759,76 +759,38 @@ namespace shogun
 template <class ST>
 void CAlphabet::translate_from_single_order(ST* obs, int32_t sequence_length, int32_t start, int32_t p_order, int32_t max_val)
 {
-	int32_t i,j;
-	ST value=0;
-
-	for (i=sequence_length-1; i>= p_order-1; i--) //convert interval of size T
-	{
-		value=0;
-		for (j=i; j>=i-p_order+1; j--)
-			value= (value >> max_val) | (obs[j] << (max_val * (p_order-1)));
-
-		obs[i]= (ST) value;
-	}
-
-	for (i=p_order-2;i>=0;i--)
+	/* the k-mer ending at position i holds obs[j] at bit max_val*(i-j), so
+	 * it is obtained from the previous one by a single shift. Symbols that
+	 * are read have been consumed already, the results can thus be written
+	 * shifted by start in the same pass */
+	const int32_t num_bits=max_val*p_order;
+	const uint64_t mask=num_bits>=64 ? ~((uint64_t) 0) :
+			(((uint64_t) 1) << num_bits)-1;
+
+	uint64_t value=0;
+	for (int32_t i=0; i<sequence_length; i++)
 	{
-		if (i>=sequence_length)
-			continue;
-
-		value=0;
-		for (j=i; j>=i-p_order+1; j--)
-		{
-			value= (value >> max_val);
-			if (j>=0 && j<sequence_length)
-				value|=obs[j] << (max_val * (p_order-1));
-		}
-		obs[i]=value;
-	}
+		value=((value << max_val) | (uint64_t) obs[i]) & mask;
 
-	// TODO we should get rid of this loop!
-	if (start>0)
-	{
-		for (i=start; i<sequence_length; i++)
-			obs[i-start]=obs[i];
+		if (i>=start)
+			obs[i-start]=(ST) value;
 	}
 }
 
 template <class ST>
 void CAlphabet::translate_from_single_order_reversed(ST* obs, int32_t sequence_length, int32_t start, int32_t p_order, int32_t max_val)
 {
-	int32_t i,j;
-	ST value=0;
+	/* the k-mer ending at position i holds obs[j] at bit
+	 * max_val*(j-i+p_order-1), see translate_from_single_order */
+	const int32_t shift=max_val*(p_order-1);
 
-	for (i=sequence_length-1; i>= p_order-1; i--) //convert interval of size T
+	uint64_t value=0;
+	for (int32_t i=0; i<sequence_length; i++)
 	{
-		value=0;
-		for (j=i; j>=i-p_order+1; j--)
-			value= (value << max_val) | obs[j];
-
-		obs[i]= (ST) value;
-	}
-
-	for (i=p_order-2;i>=0;i--)
-	{
-		if (i>=sequence_length)
-			continue;
+		value=(value >> max_val) | (((uint64_t) obs[i]) << shift);
 
-		value=0;
-		for (j=i; j>=i-p_order+1; j--)
-		{
-			value= (value << max_val);
-			if (j>=0 && j<sequence_length)
-				value|=obs[j];
-		}
-		obs[i]=value;
-	}
-
-	// TODO we should get rid of this loop!
-	if (start>0)
-	{
-		for (i=start; i<sequence_length; i++)
-			obs[i-start]=obs[i];
+		if (i>=start)
+			obs[i-start]=(ST) value;
 	}
 }
 
@@ -837,6 +799,12 @@ void CAlphabet::translate_from_single_order(ST* obs, int32_t sequence_length, in
 {
 	ASSERT(gap>=0)
 
+	if (gap==0)
+	{
+		translate_from_single_order(obs, sequence_length, start, p_order, max_val);
+		return;
+	}
+
 	const int32_t start_gap=(p_order-gap)/2;
 	const int32_t end_gap=start_gap+gap;
 
@@ -899,6 +867,12 @@ void CAlphabet::translate_from_single_order_reversed(ST* obs, int32_t sequence_l
 {
 	ASSERT(gap>=0)
 
+	if (gap==0)
+	{
+		translate_from_single_order_reversed(obs, sequence_length, start, p_order, max_val);
+		return;
+	}
+
 	const int32_t start_gap=(p_order-gap)/2;
 	const int32_t end_gap=start_gap+gap;
 
@@ -15,6 +15,7 @@
 #include <shogun/preprocessor/DensePreprocessor.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/base/Parameter.h>
+#include <shogun/base/Parallel.h>
 #include <shogun/mathematics/Math.h>
 
 #include <string.h>
@@ -32,12 +33,14 @@ template<class ST> CDenseFeatures<ST>::CDenseFeatures(const CDenseFeatures & ori
 	init();
 	set_feature_matrix(orig.feature_matrix);
 	initialize_cache();
+	m_accumulation_precision=orig.m_accumulation_precision;
 
 	if (orig.m_subset_stack != NULL)
 	{
 		SG_UNREF(m_subset_stack);
 		m_subset_stack=new CSubsetStack(*orig.m_subset_stack);
 		SG_REF(m_subset_stack);
+		subset_changed_post();
 	}
 }
 
@@ -81,6 +84,7 @@ template<class ST> void CDenseFeatures<ST>::free_features()
 template<class ST> void CDenseFeatures<ST>::free_feature_matrix()
 {
 	m_subset_stack->remove_all_subsets();
+	subset_changed_post();
 	feature_matrix=SGMatrix<ST>();
 	num_vectors = 0;
 	num_features = 0;
@@ -96,6 +100,10 @@ template<class ST> ST* CDenseFeatures<ST>::get_feature_vector(int32_t num, int32
 	if (feature_matrix.matrix)
 	{
 		dofree = false;
+
+		if (m_subset_matrix.matrix)
+			return &m_subset_matrix.matrix[num * int64_t(num_features)];
+
 		return &feature_matrix.matrix[real_num * int64_t(num_features)];
 	}
 
@@ -167,8 +175,24 @@ template<class ST> void CDenseFeatures<ST>::set_feature_vector(SGVector<ST> vect
 		SG_ERROR(
 				"Vector not of length %d (has %d)\n", num_features, vector.vlen);
 
+	copy_on_write(feature_matrix);
 	memcpy(&feature_matrix.matrix[real_num * int64_t(num_features)], vector.vector,
 			int64_t(num_features) * sizeof(ST));
+
+	/* keep the copies of all materialized subsets consistent */
+	for (size_t k=0; k<m_subset_matrices.size(); ++k)
+	{
+		SGMatrix<ST> copy=m_subset_matrices[k];
+		SGVector<index_t> idx=m_subset_indices[k];
+		for (index_t i=0; copy.matrix && i<idx.vlen; ++i)
+		{
+			if (idx[i]==real_num)
+			{
+				memcpy(&copy.matrix[i * int64_t(num_features)], vector.vector,
+						int64_t(num_features) * sizeof(ST));
+			}
+		}
+	}
 }
 
 template<class ST> SGVector<ST> CDenseFeatures<ST>::get_feature_vector(int32_t num)
@@ -210,6 +234,7 @@ template<class ST> void CDenseFeatures<ST>::vector_subset(int32_t* idx, int32_t
 
 	ASSERT(feature_matrix.matrix)
 	ASSERT(idx_len<=num_vectors)
+	copy_on_write(feature_matrix);
 
 	int32_t num_vec = num_vectors;
 	num_vectors = idx_len;
@@ -241,6 +266,7 @@ template<class ST> void CDenseFeatures<ST>::feature_subset(int32_t* idx, int32_t
 
 	ASSERT(feature_matrix.matrix)
 	ASSERT(idx_len<=num_features)
+	copy_on_write(feature_matrix);
 	int32_t num_feat = num_features;
 	num_features = idx_len;
 
@@ -269,18 +295,74 @@ template<class ST> SGMatrix<ST> CDenseFeatures<ST>::get_feature_matrix()
 	if (!m_subset_stack->has_subsets())
 		return feature_matrix;
 
-	SGMatrix<ST> submatrix(num_features, get_num_vectors());
+	if (m_subset_matrix.matrix)
+		return m_subset_matrix.clone();
 
-	/* copy a subset vector wise */
-	for (int32_t i=0; i<submatrix.num_cols; ++i)
+	SGVector<index_t> indices(get_num_vectors());
+	indices.range_fill();
+	return gather_feature_vectors(indices);
+}
+
+template<class ST> SGMatrix<ST> CDenseFeatures<ST>::gather_feature_vectors(
+		SGVector<index_t> indices)
+{
+	SGMatrix<ST> result(num_features, indices.vlen);
+
+	if (!feature_matrix.matrix)
 	{
-		int32_t real_i = m_subset_stack->subset_idx_conversion(i);
-		memcpy(&submatrix.matrix[i*int64_t(num_features)],
-				&feature_matrix.matrix[real_i * int64_t(num_features)],
-				num_features * sizeof(ST));
+		for (index_t i=0; i<indices.vlen; ++i)
+		{
+			SGVector<ST> vec=get_feature_vector(indices[i]);
+			memcpy(&result.matrix[i*int64_t(num_features)], vec.vector,
+					num_features*sizeof(ST));
+			free_feature_vector(vec, indices[i]);
+		}
+		return result;
+	}
+
+	/* copy vector wise */
+	#pragma omp parallel for num_threads(parallel->get_num_threads())
+	for (index_t i=0; i<indices.vlen; ++i)
+	{
+		index_t real_i=m_subset_stack->subset_idx_conversion(indices[i]);
+		memcpy(&result.matrix[i*int64_t(num_features)],
+				&feature_matrix.matrix[real_i*int64_t(num_features)],
+				num_features*sizeof(ST));
 	}
 
-	return submatrix;
+	return result;
+}
+
+template<class ST> void CDenseFeatures<ST>::materialize_subset()
+{
+	if (!m_subset_stack->has_subsets() || !feature_matrix.matrix ||
+			m_subset_matrix.matrix)
+		return;
+
+	SG_DEBUG("materializing subset of %d vectors\n", get_num_vectors())
+
+	SGVector<index_t> indices(get_num_vectors());
+	indices.range_fill();
+	m_subset_matrix=gather_feature_vectors(indices);
+
+	index_t num_subsets=m_subset_stack->get_num_subsets();
+	m_subset_matrices.resize(num_subsets);
+	m_subset_indices.resize(num_subsets);
+	m_subset_matrices.back()=m_subset_matrix;
+	m_subset_indices.back()=m_subset_stack->get_last_subset()->get_subset_idx();
+}
+
+template<class ST> void CDenseFeatures<ST>::subset_changed_post()
+{
+	/* copies of removed subsets are released, the ones of the remaining
+	 * subsets are kept such that vectors obtained through them stay valid */
+	index_t num_subsets=m_subset_stack->get_num_subsets();
+	m_subset_matrices.resize(num_subsets);
+	m_subset_indices.resize(num_subsets);
+	m_subset_matrix=num_subsets ? m_subset_matrices.back() : SGMatrix<ST>();
+
+	if (m_subset_stack->get_materialize_subsets())
+		materialize_subset();
 }
 
 template<class ST> SGMatrix<ST> CDenseFeatures<ST>::steal_feature_matrix()
@@ -385,6 +467,8 @@ template<class ST> bool CDenseFeatures<ST>::apply_preprocessor(bool force_prepro
 
 	if (feature_matrix.matrix && get_num_preprocessors())
 	{
+		/* preprocessors work on the feature matrix in place */
+		copy_on_write(feature_matrix);
 		for (int32_t i = 0; i < get_num_preprocessors(); i++)
 		{
 			if ((!is_preprocessed(i) || force_preprocessing))
@@ -495,6 +579,78 @@ template<class ST> float64_t CDenseFeatures<ST>::dot(int32_t vec_idx1, CDotFeatu
 	return result;
 }
 
+template<> float64_t CDenseFeatures<float32_t>::dot(int32_t vec_idx1,
+		CDotFeatures* df, int32_t vec_idx2)
+{
+	ASSERT(df)
+	ASSERT(df->get_feature_type() == F_SHORTREAL)
+	ASSERT(df->get_feature_class() == C_DENSE)
+	CDenseFeatures<float32_t>* sf = (CDenseFeatures<float32_t>*) df;
+
+	int32_t len1, len2;
+	bool free1, free2;
+
+	float32_t* vec1 = get_feature_vector(vec_idx1, len1, free1);
+	float32_t* vec2 = sf->get_feature_vector(vec_idx2, len2, free2);
+
+	float64_t result = 0;
+	if (m_accumulation_precision == AP_DOUBLE)
+	{
+		for (int32_t i = 0; i < len1; i++)
+			result += (float64_t) vec1[i] * vec2[i];
+	}
+	else
+		result = SGVector<float32_t>::dot(vec1, vec2, len1);
+
+	free_feature_vector(vec1, vec_idx1, free1);
+	sf->free_feature_vector(vec2, vec_idx2, free2);
+
+	return result;
+}
+
+template<class ST> void CDenseFeatures<ST>::dense_dot_range(float64_t* output,
+		int32_t start, int32_t stop, float64_t* alphas, float64_t* vec,
+		int32_t dim, float64_t b)
+{
+	CDotFeatures::dense_dot_range(output, start, stop, alphas, vec, dim, b);
+}
+
+template<> void CDenseFeatures<float32_t>::dense_dot_range(float64_t* output,
+		int32_t start, int32_t stop, float64_t* alphas, float64_t* vec,
+		int32_t dim, float64_t b)
+{
+	if (m_accumulation_precision != AP_SINGLE)
+	{
+		CDotFeatures::dense_dot_range(output, start, stop, alphas, vec, dim, b);
+		return;
+	}
+
+	ASSERT(output)
+	ASSERT(start>=0)
+	ASSERT(start<stop)
+	ASSERT(stop<=get_num_vectors())
+	ASSERT(dim==num_features)
+
+	/* convert the dense vector (e.g. the weights of a linear machine) once */
+	SGVector<float32_t> w(dim);
+	for (int32_t i=0; i<dim; i++)
+		w[i]=(float32_t) vec[i];
+
+#pragma omp parallel for num_threads(parallel->get_num_threads())
+	for (int32_t i=start; i<stop; i++)
+	{
+		int32_t vlen;
+		bool vfree;
+		float32_t* v=get_feature_vector(i, vlen, vfree);
+		float64_t result=SGVector<float32_t>::dot(v, w.vector, vlen);
+		free_feature_vector(v, i, vfree);
+
+		if (alphas)
+			result*=alphas[i];
+		output[i-start]=result+b;
+	}
+}
+
 template<class ST> void CDenseFeatures<ST>::add_to_dense_vec(float64_t alpha, int32_t vec_idx1,
 		float64_t* vec2, int32_t vec2_len, bool abs_val)
 {
@@ -591,17 +747,7 @@ template<class ST> void CDenseFeatures<ST>::free_feature_iterator(void* iterator
 
 template<class ST> CFeatures* CDenseFeatures<ST>::copy_subset(SGVector<index_t> indices)
 {
-	SGMatrix<ST> feature_matrix_copy(num_features, indices.vlen);
-
-	for (index_t i=0; i<indices.vlen; ++i)
-	{
-		index_t real_idx=m_subset_stack->subset_idx_conversion(indices.vector[i]);
-		memcpy(&feature_matrix_copy.matrix[i*num_features],
-				&feature_matrix.matrix[real_idx*num_features],
-				num_features*sizeof(ST));
-	}
-
-	CFeatures* result=new CDenseFeatures(feature_matrix_copy);
+	CFeatures* result=new CDenseFeatures(gather_feature_vectors(indices));
 	SG_REF(result);
 	return result;
 }
@@ -629,6 +775,10 @@ template<class ST> void CDenseFeatures<ST>::init()
 	SG_ADD(&num_features, "num_features", "Number of features.", MS_NOT_AVAILABLE);
 	SG_ADD(&feature_matrix, "feature_matrix",
 			"Matrix of feature vectors / 1 vector per column.", MS_NOT_AVAILABLE);
+
+	m_accumulation_precision=AP_NATIVE;
+	SG_ADD((machine_int_t*) &m_accumulation_precision, "accumulation_precision",
+			"Precision in which dot products are accumulated.", MS_NOT_AVAILABLE);
 }
 
 #define GET_FEATURE_TYPE(f_type, sg_type)	\
@@ -21,12 +21,29 @@
 #include <shogun/features/StringFeatures.h>
 #include <shogun/lib/DataType.h>
 
+#include <vector>
+
 namespace shogun {
 template<class ST> class CStringFeatures;
 template<class ST> class CDenseFeatures;
 template<class ST> class SGMatrix;
 class CDotFeatures;
 
+/** precision in which dot products and distances of dense features are
+ * accumulated */
+enum EAccumulationPrecision
+{
+	/** dot products of two vectors in the storage type (single precision
+	 * for float32_t), products with dense float64_t vectors in double
+	 * precision */
+	AP_NATIVE = 0,
+	/** accumulate all products in double precision */
+	AP_DOUBLE = 1,
+	/** like AP_NATIVE, but products with dense float64_t vectors are
+	 * computed in single precision as well */
+	AP_SINGLE = 2
+};
+
 /** @brief The class DenseFeatures implements dense feature matrices.
  *
  * The feature matrices are stored en-block in memory in fortran order, i.e.
@@ -56,6 +73,14 @@ class CDotFeatures;
  * \li 64bit Fisher Kernel (FK) features from HMM - CTOPFeatures
  * \li 96bit Float matrix - CDenseFeatures<floatmax_t>
  *
+ * For CDenseFeatures<float32_t>, the accumulation precision of dot products
+ * (and of the distances computed on them) can be chosen with
+ * set_accumulation_precision(). The default AP_NATIVE computes dot products
+ * with the single precision SGVector<float32_t>::dot(). AP_DOUBLE
+ * accumulates in double precision instead, which is more accurate but not
+ * vectorized. AP_SINGLE additionally runs dense_dot_range() (i.e. the
+ * outputs of linear machines) in single precision.
+ *
  * Partly) subset access is supported for this feature type.
  * Dense use the (inherited) add_subset(), remove_subset() functions.
  * If done, all calls that work with features are translated to the subset.
@@ -203,6 +228,32 @@ public:
 	 */
 	SGMatrix<ST> get_feature_matrix();
 
+	/** copies the given feature vectors into a new contiguous matrix
+	 * (in parallel if the features are in memory)
+	 *
+	 * possible with subset
+	 *
+	 * @param indices indices of the vectors to copy
+	 * @return matrix with one column per index
+	 */
+	SGMatrix<ST> gather_feature_vectors(SGVector<index_t> indices);
+
+	/** copies the vectors of the active subset into a contiguous matrix,
+	 * which is used by all following vector accesses until the subset is
+	 * removed. This is done automatically whenever a subset is added if
+	 * CSubsetStack::set_materialize_subsets() is enabled.
+	 *
+	 * Only possible for in-memory feature matrices, does nothing without
+	 * subset. Must not be called while vectors are accessed concurrently,
+	 * e.g. inside a parallel region. Vectors obtained through a materialized
+	 * subset stay valid until that subset is removed. Vectors set by
+	 * set_feature_vector are written to all copies.
+	 */
+	void materialize_subset();
+
+	/** @return whether the active subset is materialized */
+	bool is_subset_materialized() const { return m_subset_matrix.matrix!=NULL; }
+
 	/** steals feature matrix, i.e. returns matrix and
 	 * forget about it
 	 * subset is ignored
@@ -386,6 +437,35 @@ public:
 	virtual void add_to_dense_vec(float64_t alpha, int32_t vec_idx1,
 			float64_t* vec2, int32_t vec2_len, bool abs_val = false);
 
+	/** compute dot products of a range of vectors with a dense vector, see
+	 * CDotFeatures::dense_dot_range. For float32_t features with AP_SINGLE
+	 * accumulation, the dense vector is converted to single precision once
+	 * and all products are computed in single precision.
+	 *
+	 * @param output result for the given vector range
+	 * @param start start vector range from this idx
+	 * @param stop stop vector range at this idx
+	 * @param alphas scalars to multiply with, may be NULL
+	 * @param vec dense vector to compute dot product with
+	 * @param dim length of the dense vector
+	 * @param b bias to add to all dot products
+	 */
+	virtual void dense_dot_range(float64_t* output, int32_t start,
+			int32_t stop, float64_t* alphas, float64_t* vec, int32_t dim,
+			float64_t b);
+
+	/** @param precision precision in which dot products are accumulated */
+	void set_accumulation_precision(EAccumulationPrecision precision)
+	{
+		m_accumulation_precision=precision;
+	}
+
+	/** @return precision in which dot products are accumulated */
+	EAccumulationPrecision get_accumulation_precision() const
+	{
+		return m_accumulation_precision;
+	}
+
 	/** get number of non-zero features in vector
 	 *
 	 * @param num which vector
@@ -468,6 +548,10 @@ public:
 	 */
 	virtual CFeatures* copy_subset(SGVector<index_t> indices);
 
+	/** releases the copies of removed subsets and materializes added
+	 * subsets if enabled */
+	virtual void subset_changed_post();
+
 	/** checks if the contents of this CDenseFeatures object are the same to
 	 * the contents of rhs
 	 *
@@ -535,6 +619,19 @@ protected:
 
 	/** feature cache */
 	CCache<ST>* feature_cache;
+
+	/** contiguous copy of the vectors of the active subset */
+	SGMatrix<ST> m_subset_matrix;
+
+	/** copies of the subsets on the subset stack, empty if not
+	 * materialized. The last one is m_subset_matrix */
+	std::vector<SGMatrix<ST> > m_subset_matrices;
+
+	/** indices into the feature matrix of the vectors of each copy */
+	std::vector<SGVector<index_t> > m_subset_indices;
+
+	/** precision in which dot products are accumulated */
+	EAccumulationPrecision m_accumulation_precision;
 };
 }
 #endif // _DENSEFEATURES__H__
@@ -11,7 +11,9 @@
 #include <shogun/features/HashedDocDotFeatures.h>
 #include <shogun/lib/DelimiterTokenizer.h>
 #include <shogun/lib/Hash.h>
+#include <shogun/features/SparseFeatures.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/base/Parallel.h>
 
 namespace shogun
 {
@@ -32,6 +34,7 @@ CHashedDocDotFeatures::CHashedDocDotFeatures(const CHashedDocDotFeatures& orig)
 {
 	init(orig.num_bits, orig.doc_collection, orig.tokenizer, orig.should_normalize,
 			orig.ngrams, orig.tokens_to_skip);
+	set_cache_hashed_documents(orig.m_cache_hashed_docs);
 }
 
 CHashedDocDotFeatures::CHashedDocDotFeatures(CFile* loader)
@@ -48,6 +51,7 @@ void CHashedDocDotFeatures::init(int32_t hash_bits, CStringFeatures<char>* docs,
 	doc_collection = docs;
 	tokenizer = tzer;
 	should_normalize = normalize;
+	m_cache_hashed_docs = false;
 
 	if (!tokenizer)
 	{
@@ -66,6 +70,8 @@ void CHashedDocDotFeatures::init(int32_t hash_bits, CStringFeatures<char>* docs,
 			MS_NOT_AVAILABLE);
 	SG_ADD(&should_normalize, "should_normalize", "Normalize or not the dot products",
 			MS_NOT_AVAILABLE);
+	SG_ADD(&m_cache_hashed_docs, "cache_hashed_documents",
+			"Whether the hashed documents are cached", MS_NOT_AVAILABLE);
 
 	SG_REF(doc_collection);
 	SG_REF(tokenizer);
@@ -89,6 +95,12 @@ float64_t CHashedDocDotFeatures::dot(int32_t vec_idx1, CDotFeatures* df, int32_t
 
 	CHashedDocDotFeatures* hddf = (CHashedDocDotFeatures*) df;
 
+	if (m_hashed_docs.sparse_matrix && hddf->m_hashed_docs.sparse_matrix)
+	{
+		return SGSparseVector<float64_t>::sparse_dot(m_hashed_docs[vec_idx1],
+				hddf->m_hashed_docs[vec_idx2]);
+	}
+
 	SGVector<char> sv1 = doc_collection->get_feature_vector(vec_idx1);
 	SGVector<char> sv2 = hddf->doc_collection->get_feature_vector(vec_idx2);
 
@@ -114,6 +126,15 @@ float64_t CHashedDocDotFeatures::dense_dot(int32_t vec_idx1, const float64_t* ve
 {
 	ASSERT(vec2_len == CMath::pow(2,num_bits))
 
+	if (m_hashed_docs.sparse_matrix)
+	{
+		const SGSparseVector<float64_t>& hv = m_hashed_docs[vec_idx1];
+		float64_t result = 0;
+		for (index_t i=0; i<hv.num_feat_entries; i++)
+			result += hv.features[i].entry * vec2[hv.features[i].feat_index];
+		return result;
+	}
+
 	SGVector<char> sv = doc_collection->get_feature_vector(vec_idx1);
 
 	/** this vector will maintain the current n+k active tokens
@@ -191,6 +212,14 @@ void CHashedDocDotFeatures::add_to_dense_vec(float64_t alpha, int32_t vec_idx1,
 	if (abs_val)
 		alpha = CMath::abs(alpha);
 
+	if (m_hashed_docs.sparse_matrix)
+	{
+		const SGSparseVector<float64_t>& hv = m_hashed_docs[vec_idx1];
+		for (index_t i=0; i<hv.num_feat_entries; i++)
+			vec2[hv.features[i].feat_index] += alpha * hv.features[i].entry;
+		return;
+	}
+
 	SGVector<char> sv = doc_collection->get_feature_vector(vec_idx1);
 	const float64_t value = should_normalize ? alpha / CMath::sqrt((float64_t) sv.size()) : alpha;
 
@@ -268,8 +297,30 @@ uint32_t CHashedDocDotFeatures::calculate_token_hash(char* token,
 
 void CHashedDocDotFeatures::set_doc_collection(CStringFeatures<char>* docs)
 {
+	SG_REF(docs);
 	SG_UNREF(doc_collection);
 	doc_collection = docs;
+
+	set_cache_hashed_documents(m_cache_hashed_docs);
+}
+
+void CHashedDocDotFeatures::set_cache_hashed_documents(bool cache)
+{
+	m_cache_hashed_docs = cache;
+	m_hashed_docs = SGSparseMatrix<float64_t>();
+	if (!cache || !doc_collection)
+		return;
+
+	CHashedDocConverter* converter = new CHashedDocConverter(tokenizer, num_bits,
+			should_normalize, ngrams, tokens_to_skip);
+
+	CSparseFeatures<float64_t>* hashed =
+		(CSparseFeatures<float64_t>*) converter->apply(doc_collection);
+	SG_REF(hashed);
+	m_hashed_docs = hashed->get_sparse_feature_matrix();
+
+	SG_UNREF(hashed);
+	SG_UNREF(converter);
 }
 
 int32_t CHashedDocDotFeatures::get_nnz_features_for_vector(int32_t num)
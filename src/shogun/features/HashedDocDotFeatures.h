@@ -153,6 +153,23 @@ public:
 	 */
 	void set_doc_collection(CStringFeatures<char>* docs);
 
+	/** specify whether the hashed representation of all documents should be
+	 * computed once and kept. The documents are then hashed in parallel and
+	 * dot products work on the cached sparse vectors instead of tokenizing
+	 * and hashing the documents on every call. While enabled, the cache is
+	 * recomputed whenever the document collection is changed; enabling it
+	 * before a collection is set hashes the collection once it is set.
+	 *
+	 * @param cache whether to cache the hashed documents
+	 */
+	void set_cache_hashed_documents(bool cache);
+
+	/** @return whether the hashed documents are cached */
+	bool get_cache_hashed_documents() const
+	{
+		return m_cache_hashed_docs;
+	}
+
 	virtual const char* get_name() const;
 
 	/** duplicate feature object
@@ -212,6 +229,12 @@ protected:
 
 	/** tokens to skip when combining tokens */
 	int32_t tokens_to_skip;
+
+	/** whether the hashed representation of the documents is cached */
+	bool m_cache_hashed_docs;
+
+	/** cached hashed representation of the documents */
+	SGSparseMatrix<float64_t> m_hashed_docs;
 };
 }
 
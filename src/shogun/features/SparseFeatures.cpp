@@ -5,6 +5,7 @@
 #include <shogun/lib/DataType.h>
 #include <shogun/labels/RegressionLabels.h>
 #include <shogun/io/SGIO.h>
+#include <shogun/base/Parallel.h>
 
 #include <string.h>
 #include <stdlib.h>
@@ -40,8 +41,13 @@ template<class ST> CSparseFeatures<ST>::CSparseFeatures(const CSparseFeatures &
 {
 	init();
 
-	m_subset_stack=orig.m_subset_stack;
-	SG_REF(m_subset_stack);
+	if (orig.m_subset_stack != NULL)
+	{
+		SG_UNREF(m_subset_stack);
+		m_subset_stack=new CSubsetStack(*orig.m_subset_stack);
+		SG_REF(m_subset_stack);
+		subset_changed_post();
+	}
 }
 template<class ST> CSparseFeatures<ST>::CSparseFeatures(CFile* loader)
 : CDotFeatures(), feature_cache(NULL)
@@ -99,6 +105,9 @@ template<class ST> SGSparseVector<ST> CSparseFeatures<ST>::get_sparse_feature_ve
 
 	if (sparse_feature_matrix.sparse_matrix)
 	{
+		if (m_subset_matrix.sparse_matrix)
+			return m_subset_matrix[num];
+
 		return sparse_feature_matrix[real_num];
 	}
 	else
@@ -273,6 +282,9 @@ template<class ST> void CSparseFeatures<ST>::free_sparse_features()
 
 template<class ST> void CSparseFeatures<ST>::free_sparse_feature_matrix()
 {
+	m_subset_matrices.clear();
+	m_subset_entries.clear();
+	m_subset_matrix=SGSparseMatrix<ST>();
 	sparse_feature_matrix=SGSparseMatrix<ST>();
 }
 
@@ -596,6 +608,67 @@ template<class ST> SGSparseVectorEntry<ST>* CSparseFeatures<ST>::compute_sparse_
 template<class ST> void CSparseFeatures<ST>::sort_features()
 {
 	sparse_feature_matrix.sort_features();
+
+	/* copies are sorted in place, such that their vectors stay valid */
+	for (size_t k=0; k<m_subset_matrices.size(); ++k)
+	{
+		if (m_subset_matrices[k].sparse_matrix)
+			m_subset_matrices[k].sort_features();
+	}
+}
+
+template<class ST> void CSparseFeatures<ST>::materialize_subset()
+{
+	if (!m_subset_stack->has_subsets() || !sparse_feature_matrix.sparse_matrix ||
+			m_subset_matrix.sparse_matrix)
+		return;
+
+	index_t num_vectors=get_num_vectors();
+	SG_DEBUG("materializing subset of %d vectors\n", num_vectors)
+
+	SGVector<index_t> offsets(num_vectors+1);
+	offsets[0]=0;
+	for (index_t i=0; i<num_vectors; ++i)
+	{
+		index_t real_i=m_subset_stack->subset_idx_conversion(i);
+		offsets[i+1]=offsets[i]+sparse_feature_matrix[real_i].num_feat_entries;
+	}
+
+	SGSparseVector<ST> entries(offsets[num_vectors]);
+	SGSparseMatrix<ST> matrix(sparse_feature_matrix.num_features, num_vectors);
+
+	#pragma omp parallel for num_threads(parallel->get_num_threads())
+	for (index_t i=0; i<num_vectors; ++i)
+	{
+		index_t real_i=m_subset_stack->subset_idx_conversion(i);
+		const SGSparseVector<ST>& current=sparse_feature_matrix[real_i];
+
+		matrix.sparse_matrix[i]=SGSparseVector<ST>(
+				&entries.features[offsets[i]], current.num_feat_entries, false);
+		memcpy(&entries.features[offsets[i]], current.features,
+				sizeof(SGSparseVectorEntry<ST>)*current.num_feat_entries);
+	}
+
+	m_subset_matrix=matrix;
+
+	index_t num_subsets=m_subset_stack->get_num_subsets();
+	m_subset_matrices.resize(num_subsets);
+	m_subset_entries.resize(num_subsets);
+	m_subset_matrices.back()=matrix;
+	m_subset_entries.back()=entries;
+}
+
+template<class ST> void CSparseFeatures<ST>::subset_changed_post()
+{
+	/* copies of removed subsets are released, the ones of the remaining
+	 * subsets are kept such that vectors obtained through them stay valid */
+	index_t num_subsets=m_subset_stack->get_num_subsets();
+	m_subset_matrices.resize(num_subsets);
+	m_subset_entries.resize(num_subsets);
+	m_subset_matrix=num_subsets ? m_subset_matrices.back() : SGSparseMatrix<ST>();
+
+	if (m_subset_stack->get_materialize_subsets())
+		materialize_subset();
 }
 
 template<class ST> void CSparseFeatures<ST>::init()
@@ -26,6 +26,8 @@
 #include <shogun/features/DotFeatures.h>
 #include <shogun/features/DenseFeatures.h>
 
+#include <vector>
+
 namespace shogun
 {
 
@@ -478,6 +480,30 @@ template <class ST> class CSparseFeatures : public CDotFeatures
 		 */
 		virtual CFeatures* copy_subset(SGVector<index_t> indices);
 
+		/** copies the vectors of the active subset into one contiguous
+		 * block of entries, which is used by all following vector accesses
+		 * until the subset is removed. This is done automatically whenever
+		 * a subset is added if CSubsetStack::set_materialize_subsets() is
+		 * enabled.
+		 *
+		 * Only possible for in-memory feature matrices, does nothing without
+		 * subset. Must not be called while vectors are accessed
+		 * concurrently, e.g. inside a parallel region. The returned vectors
+		 * are then views into the block, are not reference counted and stay
+		 * valid until the subset is removed.
+		 */
+		void materialize_subset();
+
+		/** @return whether the active subset is materialized */
+		bool is_subset_materialized() const
+		{
+			return m_subset_matrix.sparse_matrix!=NULL;
+		}
+
+		/** releases the copies of removed subsets and materializes added
+		 * subsets if enabled */
+		virtual void subset_changed_post();
+
 		/** @return object name */
 		virtual const char* get_name() const { return "SparseFeatures"; }
 
@@ -505,6 +531,17 @@ template <class ST> class CSparseFeatures : public CDotFeatures
 
 		/** feature cache */
 		CCache< SGSparseVectorEntry<ST> >* feature_cache;
+
+		/** vectors of the active subset, views into the last element of
+		 * m_subset_entries */
+		SGSparseMatrix<ST> m_subset_matrix;
+
+		/** copies of the subsets on the subset stack, empty if not
+		 * materialized. The last one is m_subset_matrix */
+		std::vector<SGSparseMatrix<ST> > m_subset_matrices;
+
+		/** contiguous entries of the copies of the subsets */
+		std::vector<SGSparseVector<ST> > m_subset_entries;
 };
 }
 #endif /* _SPARSEFEATURES__H__ */
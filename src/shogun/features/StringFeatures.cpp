@@ -1982,31 +1982,13 @@ bool CStringFeatures<ST>::obtain_from_char_features(CStringFeatures<CT>* sf, int
 	num_vectors=sf->get_num_vectors();
 	ASSERT(num_vectors>0)
 	max_string_length=sf->get_max_vector_length()-start;
-	features=SG_MALLOC(SGString<ST>, num_vectors);
 
 	SG_DEBUG("%1.0llf symbols in StringFeatures<*> %d symbols in histogram\n", sf->get_num_symbols(),
 			alpha->get_num_symbols_in_histogram());
 
-	for (int32_t i=0; i<num_vectors; i++)
-	{
-		int32_t len=-1;
-		bool vfree;
-		CT* c=sf->get_feature_vector(i, len, vfree);
-		ASSERT(!vfree) // won't work when preprocessors are attached
-
-		features[i].string=SG_MALLOC(ST, len);
-		features[i].slen=len;
-
-		ST* str=features[i].string;
-		for (int32_t j=0; j<len; j++)
-			str[j]=(ST) alpha->remap_to_bin(c[j]);
-	}
-
 	original_num_symbols=alpha->get_num_symbols();
 	int32_t max_val=alpha->get_num_bits();
 
-	SG_UNREF(alpha);
-
 	if (p_order>1)
 		num_symbols=CMath::powl((floatmax_t) 2, (floatmax_t) max_val*p_order);
 	else
@@ -2015,22 +1997,45 @@ bool CStringFeatures<ST>::obtain_from_char_features(CStringFeatures<CT>* sf, int
 
 	if ( ((floatmax_t) num_symbols) > CMath::powl(((floatmax_t) 2),((floatmax_t) sizeof(ST)*8)) )
 	{
+		SG_UNREF(alpha);
+		num_vectors=0;
 		SG_ERROR("symbol does not fit into datatype \"%c\" (%d)\n", (char) max_val, (int) max_val)
 		return false;
 	}
 
+	features=SG_MALLOC(SGString<ST>, num_vectors);
+
 	SG_DEBUG("translate: start=%i order=%i gap=%i(size:%i)\n", start, p_order, gap, sizeof(ST))
+
+	/* strings are remapped and translated independently */
+	bool vfree_any=false;
+	#pragma omp parallel for schedule(dynamic, 16) num_threads(parallel->get_num_threads())
 	for (int32_t line=0; line<num_vectors; line++)
 	{
-		int32_t len=0;
+		int32_t len=-1;
 		bool vfree;
-		ST* fv=get_feature_vector(line, len, vfree);
-		ASSERT(!vfree) // won't work when preprocessors are attached
+		CT* c=sf->get_feature_vector(line, len, vfree);
+		if (vfree)
+		{
+			/* won't work when preprocessors are attached */
+			vfree_any=true;
+			sf->free_feature_vector(c, line, vfree);
+			features[line].string=NULL;
+			features[line].slen=0;
+			continue;
+		}
+
+		features[line].string=SG_MALLOC(ST, len);
+		features[line].slen=len;
+
+		ST* str=features[line].string;
+		for (int32_t j=0; j<len; j++)
+			str[j]=(ST) alpha->remap_to_bin(c[j]);
 
 		if (rev)
-			CAlphabet::translate_from_single_order_reversed(fv, len, start+gap, p_order+gap, max_val, gap);
+			CAlphabet::translate_from_single_order_reversed(str, len, start+gap, p_order+gap, max_val, gap);
 		else
-			CAlphabet::translate_from_single_order(fv, len, start+gap, p_order+gap, max_val, gap);
+			CAlphabet::translate_from_single_order(str, len, start+gap, p_order+gap, max_val, gap);
 
 		/* fix the length of the string -- hacky */
 		features[line].slen-=start+gap ;
@@ -2038,6 +2043,9 @@ bool CStringFeatures<ST>::obtain_from_char_features(CStringFeatures<CT>* sf, int
 			features[line].slen=0 ;
 	}
 
+	SG_UNREF(alpha);
+	ASSERT(!vfree_any)
+
 	compute_symbol_mask_table(max_val);
 
 	return true;
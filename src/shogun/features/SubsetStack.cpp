@@ -21,6 +21,7 @@ CSubsetStack::CSubsetStack()
 CSubsetStack::CSubsetStack(const CSubsetStack& other)
 {
 	init();
+	m_materialize_subsets=other.m_materialize_subsets;
 
 	for (int32_t i=0; i < other.m_active_subsets_stack->get_num_elements(); ++i)
 	{
@@ -50,8 +51,11 @@ void CSubsetStack::init()
 			"Currently active subset", MS_NOT_AVAILABLE);
 	SG_ADD((CSGObject**)&m_active_subsets_stack, "active_subsets_stack",
 			"Stack of active subsets", MS_NOT_AVAILABLE);
+	SG_ADD(&m_materialize_subsets, "materialize_subsets",
+			"Whether subsets are materialized when added", MS_NOT_AVAILABLE);
 
 	m_active_subset=NULL;
+	m_materialize_subsets=false;
 	m_active_subsets_stack=new CDynamicObjectArray();
 	SG_REF(m_active_subsets_stack);
 }
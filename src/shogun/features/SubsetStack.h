@@ -31,6 +31,11 @@ namespace shogun
  * added, a new element will be put on stack, using the old element to get
  * mappig. On  removal, the last element on stack will be removed. This is done
  * for computational convenience.
+ *
+ * Since the subsets are composed on insertion, an index conversion is a
+ * single lookup regardless of the stack depth. Features that are accessed
+ * very often through a subset may additionally copy the subset's vectors
+ * into contiguous memory, see set_materialize_subsets().
  */
 class CSubsetStack: public CSGObject
 {
@@ -91,6 +96,30 @@ public:
 		return m_active_subset ? m_active_subset->m_subset_idx.vector[idx] : idx;
 	}
 
+	/** @return number of subsets on the stack */
+	inline index_t get_num_subsets() const
+	{
+		return m_active_subsets_stack->get_num_elements();
+	}
+
+	/** sets whether features copy the vectors of every subset that is
+	 * added into contiguous memory. The copy is made when the subset is
+	 * added, i.e. before any access through it, and released when the
+	 * subset is removed.
+	 *
+	 * @param materialize whether to materialize subsets
+	 */
+	void set_materialize_subsets(bool materialize)
+	{
+		m_materialize_subsets=materialize;
+	}
+
+	/** @return whether subsets are materialized when added */
+	bool get_materialize_subsets() const
+	{
+		return m_materialize_subsets;
+	}
+
 private:
 	/** registers and initializes parameters */
 	void init();
@@ -104,6 +133,9 @@ private:
 
 	/** active index subset. Last element on stack for quick access */
 	CSubset* m_active_subset;
+
+	/** whether subsets are materialized when added */
+	bool m_materialize_subsets;
 };
 
 }
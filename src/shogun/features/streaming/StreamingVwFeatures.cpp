@@ -43,6 +43,7 @@ CStreamingVwFeatures::~CStreamingVwFeatures()
 {
 	if (parser.is_running())
 		parser.end_parser();
+	free_examples();
 	SG_UNREF(env);
 }
 
@@ -67,8 +68,11 @@ void CStreamingVwFeatures::reset_stream()
 	{
 		working_file->reset_stream();
 		parser.exit_parser();
+		parser.end_parser();
+		free_examples();
 		parser.init(working_file, has_labels, parser.get_ring_size());
 		parser.set_free_vector_after_release(false);
+		parser.set_free_vectors_on_destruct(false);
 		parser.start_parser();
 	}
 	else
@@ -153,6 +157,7 @@ void CStreamingVwFeatures::init(CStreamingVwFile* file, bool is_labelled, int32_
 	working_file = file;
 	parser.init(file, is_labelled, size);
 	parser.set_free_vector_after_release(false);
+	parser.set_free_vectors_on_destruct(false);
 	seekable=false;
 
 	// Get environment from the StreamingVwFile
@@ -167,6 +172,7 @@ void CStreamingVwFeatures::init(CStreamingVwCacheFile* file, bool is_labelled, i
 	working_file = file;
 	parser.init(file, is_labelled, size);
 	parser.set_free_vector_after_release(false);
+	parser.set_free_vectors_on_destruct(false);
 	seekable=true;
 
 	// Get environment from the StreamingVwFile
@@ -174,6 +180,13 @@ void CStreamingVwFeatures::init(CStreamingVwCacheFile* file, bool is_labelled, i
 	SG_REF(env);
 }
 
+void CStreamingVwFeatures::free_examples()
+{
+	/* the streaming files allocate the examples of the ring with new */
+	for (int32_t i=0; i<parser.get_ring_size(); i++)
+		delete parser.get_ring_vector(i);
+}
+
 void CStreamingVwFeatures::setup_example(VwExample* ae)
 {
 	ae->pass = env->passes_complete;
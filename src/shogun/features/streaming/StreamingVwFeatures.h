@@ -368,6 +368,12 @@ private:
 	 */
 	virtual void setup_example(VwExample* ae);
 
+	/**
+	 * Deletes the examples in the parser's ring, which are not
+	 * freed by the ring itself.
+	 */
+	void free_examples();
+
 protected:
 
 	/// The parser object, which reads from input and returns parsed example objects.
@@ -8,6 +8,7 @@
  */
 
 #include <shogun/io/CSVFile.h>
+#include <shogun/io/ChunkedTextParser.h>
 
 #include <shogun/lib/SGVector.h>
 #include <shogun/lib/SGMatrix.h>
@@ -138,9 +139,6 @@ void CCSVFile::skip_lines(int32_t num_lines)
 #define GET_VECTOR(read_func, sg_type) \
 void CCSVFile::get_vector(sg_type*& vector, int32_t& len) \
 { \
-	if (!m_line_reader->has_next()) \
-		return; \
-	\
 	int32_t num_feat=0; \
 	int32_t num_vec=0; \
 	get_matrix(vector, num_feat, num_vec); \
@@ -178,36 +176,18 @@ GET_VECTOR(read_ulong, uint64_t)
 void CCSVFile::get_matrix(sg_type*& matrix, int32_t& num_feat, int32_t& num_vec) \
 { \
 	int32_t num_lines=0; \
-	int32_t num_tokens=-1; \
-	int32_t current_line_idx=0; \
-	SGVector<char> line; \
-	\
-	skip_lines(m_num_to_skip); \
-	num_lines=get_stats(num_tokens); \
-	\
-	SG_SET_LOCALE_C; \
+	int32_t num_tokens=0; \
 	\
-	matrix=SG_MALLOC(sg_type, num_lines*num_tokens); \
-	skip_lines(m_num_to_skip); \
-	while (m_line_reader->has_next()) \
-	{ \
-		line=m_line_reader->read_line(); \
-		m_parser->set_text(line); \
-		\
-		for (int32_t i=0; i<num_tokens; i++) \
-		{ \
-			if (!m_parser->has_next()) \
-				return; \
-			\
-			if (!is_data_transposed) \
-				matrix[i+current_line_idx*num_tokens]=m_parser->read_func(); \
-			else \
-				matrix[current_line_idx+i*num_tokens]=m_parser->read_func(); \
-		} \
-		current_line_idx++; \
-	} \
+	CChunkedTextParser* parser=new CChunkedTextParser(file); \
+	SG_REF(parser); \
+	parser->skip_lines(m_num_to_skip); \
+	int32_t bad_line=parser->parse_dense(matrix, num_tokens, num_lines, \
+			m_delimiter, is_data_transposed); \
+	SG_UNREF(parser); \
 	\
-	SG_RESET_LOCALE; \
+	if (bad_line) \
+		SG_ERROR("Line %d does not have %d values like the first line\n", \
+				bad_line, num_tokens) \
 	\
 	if (!is_data_transposed) \
 	{ \
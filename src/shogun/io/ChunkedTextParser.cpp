@@ -0,0 +1,602 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/io/ChunkedTextParser.h>
+#include <shogun/io/SGIO.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/mathematics/Math.h>
+
+#include <string.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <vector>
+
+using namespace shogun;
+
+/** chunks are not made smaller than this many bytes */
+#define MIN_CHUNK_SIZE 65536
+/** tokens longer than this are not converted */
+#define MAX_TOKEN_LENGTH 128
+
+namespace
+{
+/** exactly representable powers of ten */
+const float64_t pow10_table[]=
+{
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+inline bool is_space(char c)
+{
+	return c==' ' || c=='\t' || c=='\r';
+}
+
+inline bool is_separator(char c, char delimiter)
+{
+	return c==delimiter || is_space(c);
+}
+
+inline bool is_digit(char c)
+{
+	return c>='0' && c<='9';
+}
+
+inline const char* skip_spaces(const char* p, const char* end)
+{
+	while (p<end && is_space(*p))
+		p++;
+	return p;
+}
+
+inline const char* skip_separators(const char* p, const char* end, char delimiter)
+{
+	while (p<end && is_separator(*p, delimiter))
+		p++;
+	return p;
+}
+
+/** end of the line starting at p, i.e. position of its newline or end */
+inline const char* line_end(const char* p, const char* end)
+{
+	const char* nl=(const char*) memchr(p, '\n', end-p);
+	return nl ? nl : end;
+}
+
+/** copy the token at ptr into a terminated buffer for the libc converters */
+inline const char* copy_token(const char* ptr, const char* end, char* buf)
+{
+	const char* p=ptr;
+	int32_t len=0;
+	while (p<end && len<MAX_TOKEN_LENGTH-1 && (is_digit(*p) || *p=='+' ||
+			*p=='-' || *p=='.' || (*p>='a' && *p<='z') || (*p>='A' && *p<='Z')))
+		buf[len++]=*p++;
+	buf[len]='\0';
+	return p;
+}
+
+template <class T>
+inline T convert(const char*& ptr, const char* end)
+{
+	return (T) CChunkedTextParser::parse_real(ptr, end);
+}
+
+template <>
+inline int64_t convert<int64_t>(const char*& ptr, const char* end)
+{
+	return CChunkedTextParser::parse_int(ptr, end);
+}
+
+template <>
+inline uint64_t convert<uint64_t>(const char*& ptr, const char* end)
+{
+	char buf[MAX_TOKEN_LENGTH];
+	const char* p=copy_token(ptr, end, buf);
+	char* stop=NULL;
+	uint64_t result=strtoull(buf, &stop, 10);
+	ptr=stop>buf ? ptr+(stop-buf) : p;
+	return result;
+}
+
+template <>
+inline floatmax_t convert<floatmax_t>(const char*& ptr, const char* end)
+{
+	char buf[MAX_TOKEN_LENGTH];
+	const char* p=copy_token(ptr, end, buf);
+	char* stop=NULL;
+	floatmax_t result=strtold(buf, &stop);
+	ptr=stop>buf ? ptr+(stop-buf) : p;
+	return result;
+}
+}
+
+CChunkedTextParser::CChunkedTextParser() : CSGObject()
+{
+	init();
+}
+
+CChunkedTextParser::CChunkedTextParser(FILE* f) : CSGObject()
+{
+	init();
+	set_file(f);
+}
+
+CChunkedTextParser::~CChunkedTextParser()
+{
+	unmap();
+}
+
+void CChunkedTextParser::init()
+{
+	m_map=NULL;
+	m_map_size=0;
+	m_begin=NULL;
+	m_end=NULL;
+}
+
+void CChunkedTextParser::unmap()
+{
+	if (m_map)
+		munmap(m_map, m_map_size);
+
+	m_map=NULL;
+	m_map_size=0;
+}
+
+void CChunkedTextParser::set_file(FILE* f)
+{
+	REQUIRE(f, "No file given\n")
+
+	unmap();
+	m_buffer=SGVector<char>();
+
+	int64_t offset=ftell(f);
+	struct stat st;
+	if (offset>=0 && fstat(fileno(f), &st)==0 && S_ISREG(st.st_mode)
+			&& st.st_size>offset)
+	{
+		void* map=mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+		if (map!=MAP_FAILED)
+		{
+#ifdef MADV_SEQUENTIAL
+			madvise(map, st.st_size, MADV_SEQUENTIAL);
+#endif
+			m_map=(char*) map;
+			m_map_size=st.st_size;
+			m_begin=m_map+offset;
+			m_end=m_map+m_map_size;
+			fseek(f, 0, SEEK_END);
+			return;
+		}
+	}
+
+	/* pipes, empty files or failing mmap: read the remaining content */
+	int64_t len=0;
+	SGVector<char> buffer(MIN_CHUNK_SIZE);
+	while (true)
+	{
+		len+=fread(buffer.vector+len, sizeof(char), buffer.vlen-len, f);
+		if (len<buffer.vlen)
+			break;
+		buffer.resize_vector(2*buffer.vlen);
+	}
+
+	m_buffer=buffer;
+	m_begin=m_buffer.vector;
+	m_end=m_buffer.vector+len;
+}
+
+void CChunkedTextParser::set_text(SGVector<char> text)
+{
+	unmap();
+	m_buffer=text;
+	m_begin=m_buffer.vector;
+	m_end=m_buffer.vector+m_buffer.vlen;
+}
+
+void CChunkedTextParser::skip_lines(int32_t num_lines)
+{
+	for (int32_t i=0; i<num_lines && m_begin<m_end; )
+	{
+		const char* le=line_end(m_begin, m_end);
+		if (skip_spaces(m_begin, le)<le)
+			i++;
+
+		m_begin=CMath::min(le+1, m_end);
+	}
+}
+
+SGVector<index_t> CChunkedTextParser::get_chunks()
+{
+	int64_t len=m_end-m_begin;
+	int32_t num_threads=parallel->get_num_threads();
+	int64_t chunk_size=CMath::max((int64_t) MIN_CHUNK_SIZE, len/(4*num_threads)+1);
+
+	std::vector<index_t> bounds;
+	bounds.push_back(0);
+	for (int64_t pos=chunk_size; pos<len; )
+	{
+		/* extend to the end of the line */
+		const char* le=line_end(m_begin+pos, m_end);
+		if (le>=m_end)
+			break;
+
+		bounds.push_back(le+1-m_begin);
+		pos=le+1-m_begin+chunk_size;
+	}
+	if (bounds.back()<len)
+		bounds.push_back(len);
+
+	SGVector<index_t> chunks(bounds.size());
+	for (index_t i=0; i<chunks.vlen; i++)
+		chunks[i]=bounds[i];
+
+	return chunks;
+}
+
+float64_t CChunkedTextParser::parse_real(const char*& ptr, const char* end)
+{
+	const char* p=ptr;
+	bool negative=false;
+	if (p<end && (*p=='-' || *p=='+'))
+		negative=*p++=='-';
+
+	uint64_t mantissa=0;
+	int32_t num_digits=0;
+	int32_t exponent=0;
+	bool any_digit=false;
+
+	while (p<end && is_digit(*p))
+	{
+		any_digit=true;
+		if (mantissa || *p!='0')
+		{
+			if (num_digits<19)
+				mantissa=mantissa*10+(*p-'0');
+			else
+				exponent++;
+			num_digits++;
+		}
+		p++;
+	}
+	if (p<end && *p=='.')
+	{
+		p++;
+		while (p<end && is_digit(*p))
+		{
+			any_digit=true;
+			if (mantissa || *p!='0')
+			{
+				if (num_digits<19)
+				{
+					mantissa=mantissa*10+(*p-'0');
+					exponent--;
+				}
+				num_digits++;
+			}
+			else
+				exponent--;
+			p++;
+		}
+	}
+	if (any_digit && p<end && (*p=='e' || *p=='E'))
+	{
+		const char* q=p+1;
+		bool exp_negative=false;
+		if (q<end && (*q=='-' || *q=='+'))
+			exp_negative=*q++=='-';
+
+		if (q<end && is_digit(*q))
+		{
+			int32_t e=0;
+			while (q<end && is_digit(*q))
+			{
+				if (e<100000)
+					e=e*10+(*q-'0');
+				q++;
+			}
+			exponent+=exp_negative ? -e : e;
+			p=q;
+		}
+	}
+
+	/* fast path: mantissa and power of ten are exact doubles, so a single
+	 * multiplication or division is correctly rounded */
+	if (any_digit && num_digits<=15 && exponent>=-22 && exponent<=22)
+	{
+		float64_t result=(float64_t) mantissa;
+		if (exponent<0)
+			result/=pow10_table[-exponent];
+		else
+			result*=pow10_table[exponent];
+
+		ptr=p;
+		return negative ? -result : result;
+	}
+
+	/* many digits, large exponents, inf or nan */
+	char buf[MAX_TOKEN_LENGTH];
+	const char* token_end=copy_token(ptr, end, buf);
+	char* stop=NULL;
+	float64_t result=strtod(buf, &stop);
+	ptr=stop>buf ? ptr+(stop-buf) : token_end;
+
+	return result;
+}
+
+int64_t CChunkedTextParser::parse_int(const char*& ptr, const char* end)
+{
+	const char* p=ptr;
+	bool negative=false;
+	if (p<end && (*p=='-' || *p=='+'))
+		negative=*p++=='-';
+
+	if (p>=end || !is_digit(*p))
+	{
+		/* not an integer, e.g. written in exponent notation */
+		return (int64_t) parse_real(ptr, end);
+	}
+
+	uint64_t result=0;
+	while (p<end && is_digit(*p))
+		result=result*10+(*p++-'0');
+
+	/* fraction or exponent, take the integral part like strtod */
+	if (p<end && (*p=='.' || *p=='e' || *p=='E'))
+		return (int64_t) parse_real(ptr, end);
+
+	ptr=p;
+	return negative ? -(int64_t) result : (int64_t) result;
+}
+
+template <class T>
+void CChunkedTextParser::parse_sparse(SGSparseVector<T>*& matrix,
+		int32_t& num_feat, int32_t& num_vec, float64_t*& labels,
+		bool load_labels, char delimiter)
+{
+	SGVector<index_t> chunks=get_chunks();
+	int32_t num_chunks=chunks.vlen-1;
+
+	std::vector<std::vector<SGSparseVector<T> > > chunk_vectors(num_chunks);
+	std::vector<std::vector<float64_t> > chunk_labels(num_chunks);
+	SGVector<int32_t> chunk_num_feat(num_chunks);
+	chunk_num_feat.zero();
+
+	SG_SET_LOCALE_C;
+
+	#pragma omp parallel for schedule(dynamic) num_threads(parallel->get_num_threads())
+	for (int32_t c=0; c<num_chunks; c++)
+	{
+		const char* p=m_begin+chunks[c];
+		const char* chunk_end=m_begin+chunks[c+1];
+		std::vector<SGSparseVectorEntry<T> > entries;
+
+		while (p<chunk_end)
+		{
+			const char* le=line_end(p, chunk_end);
+			p=skip_spaces(p, le);
+			if (p==le)
+			{
+				p=le+1;
+				continue;
+			}
+
+			if (load_labels)
+			{
+				chunk_labels[c].push_back(parse_real(p, le));
+				p=skip_spaces(p, le);
+			}
+
+			entries.clear();
+			while (p<le)
+			{
+				SGSparseVectorEntry<T> entry;
+				int64_t feat_index=parse_int(p, le);
+				entry.feat_index=feat_index-1;
+				entry.entry=0;
+
+				if (p<le && *p==delimiter)
+				{
+					p++;
+					entry.entry=convert<T>(p, le);
+				}
+
+				/* skip anything unparsed up to the next entry */
+				while (p<le && !is_space(*p))
+					p++;
+				p=skip_spaces(p, le);
+
+				if (feat_index>chunk_num_feat[c])
+					chunk_num_feat[c]=feat_index;
+
+				entries.push_back(entry);
+			}
+
+			SGSparseVector<T> vec(entries.size());
+			if (!entries.empty())
+			{
+				memcpy(vec.features, &entries[0],
+						sizeof(SGSparseVectorEntry<T>)*entries.size());
+			}
+			chunk_vectors[c].push_back(vec);
+
+			p=le+1;
+		}
+	}
+
+	SG_RESET_LOCALE;
+
+	num_vec=0;
+	num_feat=0;
+	for (int32_t c=0; c<num_chunks; c++)
+	{
+		num_vec+=chunk_vectors[c].size();
+		num_feat=CMath::max(num_feat, chunk_num_feat[c]);
+	}
+
+	matrix=SG_MALLOC(SGSparseVector<T>, num_vec);
+	if (load_labels)
+		labels=SG_MALLOC(float64_t, num_vec);
+
+	for (int32_t c=0, i=0; c<num_chunks; c++)
+	{
+		for (size_t j=0; j<chunk_vectors[c].size(); j++, i++)
+		{
+			matrix[i]=chunk_vectors[c][j];
+			if (load_labels)
+				labels[i]=chunk_labels[c][j];
+		}
+	}
+}
+
+template <class T>
+int32_t CChunkedTextParser::parse_dense(T*& matrix, int32_t& num_tokens,
+		int32_t& num_lines, char delimiter, bool transposed)
+{
+	num_tokens=0;
+	num_lines=0;
+	matrix=NULL;
+
+	/* number of tokens of the first non-empty line */
+	for (const char* p=m_begin; p<m_end && !num_tokens; )
+	{
+		const char* le=line_end(p, m_end);
+		for (p=skip_separators(p, le, delimiter); p<le; )
+		{
+			num_tokens++;
+			while (p<le && !is_separator(*p, delimiter))
+				p++;
+			p=skip_separators(p, le, delimiter);
+		}
+		p=le+1;
+	}
+
+	if (!num_tokens)
+		return 0;
+
+	SGVector<index_t> chunks=get_chunks();
+	int32_t num_chunks=chunks.vlen-1;
+
+	/* first pass: number of non-empty lines per chunk */
+	SGVector<index_t> chunk_offsets(num_chunks+1);
+	chunk_offsets.zero();
+
+	#pragma omp parallel for schedule(dynamic) num_threads(parallel->get_num_threads())
+	for (int32_t c=0; c<num_chunks; c++)
+	{
+		const char* p=m_begin+chunks[c];
+		const char* chunk_end=m_begin+chunks[c+1];
+		index_t count=0;
+		while (p<chunk_end)
+		{
+			const char* le=line_end(p, chunk_end);
+			if (skip_separators(p, le, delimiter)<le)
+				count++;
+			p=le+1;
+		}
+		chunk_offsets[c+1]=count;
+	}
+
+	for (int32_t c=0; c<num_chunks; c++)
+		chunk_offsets[c+1]+=chunk_offsets[c];
+	num_lines=chunk_offsets[num_chunks];
+
+	matrix=SG_MALLOC(T, int64_t(num_lines)*num_tokens);
+
+	/* second pass: parse every chunk into its part of the matrix */
+	index_t bad_line=-1;
+
+	SG_SET_LOCALE_C;
+
+	#pragma omp parallel for schedule(dynamic) num_threads(parallel->get_num_threads())
+	for (int32_t c=0; c<num_chunks; c++)
+	{
+		const char* p=m_begin+chunks[c];
+		const char* chunk_end=m_begin+chunks[c+1];
+		index_t line=chunk_offsets[c];
+
+		while (p<chunk_end)
+		{
+			const char* le=line_end(p, chunk_end);
+			p=skip_separators(p, le, delimiter);
+			if (p==le)
+			{
+				p=le+1;
+				continue;
+			}
+
+			int32_t i=0;
+			for (; i<num_tokens && p<le; i++)
+			{
+				T value=convert<T>(p, le);
+				if (!transposed)
+					matrix[i+int64_t(line)*num_tokens]=value;
+				else
+					matrix[line+int64_t(i)*num_lines]=value;
+
+				/* skip anything unparsed up to the next token */
+				while (p<le && !is_separator(*p, delimiter))
+					p++;
+				p=skip_separators(p, le, delimiter);
+			}
+
+			if (i<num_tokens || p<le)
+			{
+				#pragma omp critical
+				{
+					if (bad_line<0 || line<bad_line)
+						bad_line=line;
+				}
+				p=le;
+			}
+
+			line++;
+			p=le+1;
+		}
+	}
+
+	SG_RESET_LOCALE;
+
+	if (bad_line>=0)
+	{
+		SG_FREE(matrix);
+		matrix=NULL;
+		return bad_line+1;
+	}
+
+	return 0;
+}
+
+#define INSTANTIATE(sg_type) \
+template void CChunkedTextParser::parse_sparse<sg_type>( \
+		SGSparseVector<sg_type>*& matrix, int32_t& num_feat, \
+		int32_t& num_vec, float64_t*& labels, bool load_labels, \
+		char delimiter); \
+template int32_t CChunkedTextParser::parse_dense<sg_type>(sg_type*& matrix, \
+		int32_t& num_tokens, int32_t& num_lines, char delimiter, \
+		bool transposed);
+
+INSTANTIATE(bool)
+INSTANTIATE(char)
+INSTANTIATE(int8_t)
+INSTANTIATE(uint8_t)
+INSTANTIATE(int16_t)
+INSTANTIATE(uint16_t)
+INSTANTIATE(int32_t)
+INSTANTIATE(uint32_t)
+INSTANTIATE(int64_t)
+INSTANTIATE(uint64_t)
+INSTANTIATE(float32_t)
+INSTANTIATE(float64_t)
+INSTANTIATE(floatmax_t)
+#undef INSTANTIATE
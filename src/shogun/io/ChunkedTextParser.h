@@ -0,0 +1,149 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#ifndef __CHUNKEDTEXTPARSER_H__
+#define __CHUNKEDTEXTPARSER_H__
+
+#include <shogun/lib/config.h>
+#include <shogun/base/SGObject.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/SGSparseVector.h>
+
+#include <stdio.h>
+
+namespace shogun
+{
+
+/** @brief Parser for whole text files of numbers (CSV or LibSVM format)
+ * that works on line aligned chunks in parallel.
+ *
+ * The remaining content of a file is memory mapped (or read into memory if
+ * the file cannot be mapped) and split into chunks which end at line
+ * boundaries. The chunks are parsed concurrently: line ends are found with
+ * memchr and numbers are converted directly from the text with a fast path
+ * that is exact for up to 15 significant digits and falls back to strtod
+ * otherwise. Lines that consist of whitespace only are skipped.
+ *
+ * Dense matrices are written in place: a first pass counts the lines of
+ * each chunk, the second pass parses every chunk directly into its part of
+ * the final matrix. Sparse vectors are created by the thread that parses
+ * them and are only handed over (reference counted) to the resulting array.
+ */
+class CChunkedTextParser : public CSGObject
+{
+public:
+	/** default constructor */
+	CChunkedTextParser();
+
+	/** constructor
+	 *
+	 * @param f file, its content from the current position on is parsed
+	 */
+	CChunkedTextParser(FILE* f);
+
+	/** destructor */
+	virtual ~CChunkedTextParser();
+
+	/** use the remaining content of a file. The file position is moved to
+	 * its end.
+	 *
+	 * @param f file
+	 */
+	void set_file(FILE* f);
+
+	/** use a text in memory (not copied)
+	 *
+	 * @param text text to parse
+	 */
+	void set_text(SGVector<char> text);
+
+	/** skip non-empty lines at the current start of the text
+	 *
+	 * @param num_lines number of lines to skip
+	 */
+	void skip_lines(int32_t num_lines);
+
+	/** parse sparse vectors in LibSVM format, i.e. lines like
+	 * "label idx:value idx:value ..." with one-based indices
+	 *
+	 * @param matrix parsed vectors (allocated)
+	 * @param num_feat largest feature index
+	 * @param num_vec number of vectors
+	 * @param labels parsed labels (allocated if load_labels is set)
+	 * @param load_labels whether the first token of a line is a label
+	 * @param delimiter delimiter between index and value
+	 */
+	template <class T>
+	void parse_sparse(SGSparseVector<T>*& matrix, int32_t& num_feat,
+			int32_t& num_vec, float64_t*& labels, bool load_labels=true,
+			char delimiter=':');
+
+	/** parse a dense matrix, one line per row with values separated by a
+	 * delimiter (and/or spaces). All lines need the same number of values
+	 * as the first one.
+	 *
+	 * @param matrix parsed matrix (allocated), num_tokens x num_lines
+	 * (column-major) or num_lines x num_tokens if transposed
+	 * @param num_tokens number of values per line
+	 * @param num_lines number of lines
+	 * @param delimiter delimiter between values
+	 * @param transposed whether lines are stored as rows of the matrix
+	 * @return 0 on success, otherwise the first line (counted from 1) with
+	 * a different number of values, in which case matrix is NULL
+	 */
+	template <class T>
+	int32_t parse_dense(T*& matrix, int32_t& num_tokens, int32_t& num_lines,
+			char delimiter=',', bool transposed=false);
+
+	/** convert a floating point number at ptr, advances ptr behind it
+	 *
+	 * @param ptr start of the number
+	 * @param end end of the text
+	 * @return number
+	 */
+	static float64_t parse_real(const char*& ptr, const char* end);
+
+	/** convert an integer at ptr, advances ptr behind it
+	 *
+	 * @param ptr start of the number
+	 * @param end end of the text
+	 * @return number
+	 */
+	static int64_t parse_int(const char*& ptr, const char* end);
+
+	/** @return object name */
+	virtual const char* get_name() const { return "ChunkedTextParser"; }
+
+protected:
+	/** split the text into line aligned chunks
+	 *
+	 * @return num_chunks+1 chunk boundaries
+	 */
+	SGVector<index_t> get_chunks();
+
+	/** release mapped memory */
+	void unmap();
+
+private:
+	void init();
+
+protected:
+	/** memory mapped file content */
+	char* m_map;
+	/** size of the memory mapping */
+	int64_t m_map_size;
+	/** file content if it could not be mapped */
+	SGVector<char> m_buffer;
+	/** start of the text to parse */
+	const char* m_begin;
+	/** end of the text to parse */
+	const char* m_end;
+};
+}
+#endif /* __CHUNKEDTEXTPARSER_H__ */
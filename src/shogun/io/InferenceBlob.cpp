@@ -0,0 +1,677 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/io/InferenceBlob.h>
+#include <shogun/io/SGIO.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/lapack.h>
+#include <shogun/base/DynArray.h>
+#include <shogun/lib/DynamicObjectArray.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/PolyKernel.h>
+#include <shogun/kernel/normalizer/KernelNormalizer.h>
+#include <shogun/machine/LinearMachine.h>
+#include <shogun/machine/KernelMachine.h>
+#include <shogun/machine/LinearMulticlassMachine.h>
+#include <shogun/machine/KernelMulticlassMachine.h>
+#include <shogun/multiclass/MulticlassOneVsRestStrategy.h>
+#include <shogun/multiclass/MulticlassOneVsOneStrategy.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+using namespace shogun;
+
+#define INFERENCE_BLOB_MAGIC "SGINFBLB"
+#define INFERENCE_BLOB_VERSION 1
+#define INFERENCE_BLOB_BYTE_ORDER 0x01020304
+#define INFERENCE_BLOB_ALIGNMENT 64
+
+/* number of vectors of which the inner products are computed at once */
+#define INFERENCE_BLOB_BLOCK_SIZE 64
+
+static uint64_t aligned(uint64_t len)
+{
+	return (len+INFERENCE_BLOB_ALIGNMENT-1)/INFERENCE_BLOB_ALIGNMENT*
+		INFERENCE_BLOB_ALIGNMENT;
+}
+
+static bool in_blob(uint64_t offset, uint64_t len, uint64_t size)
+{
+	return offset%INFERENCE_BLOB_ALIGNMENT==0 && offset<=size &&
+		len<=size-offset;
+}
+
+InferenceBlob::InferenceBlob()
+{
+	m_map=NULL;
+	m_map_size=0;
+	m_header=NULL;
+	m_machines=NULL;
+}
+
+InferenceBlob::InferenceBlob(const char* filename)
+{
+	m_map=NULL;
+	m_map_size=0;
+	m_header=NULL;
+	m_machines=NULL;
+	load(filename);
+}
+
+InferenceBlob::~InferenceBlob()
+{
+	unload();
+}
+
+void InferenceBlob::export_machine(CMachine* machine, const char* filename)
+{
+	REQUIRE(machine, "No machine given\n")
+	REQUIRE(filename, "No file name given\n")
+
+	InferenceBlobHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, INFERENCE_BLOB_MAGIC, sizeof(header.magic));
+	header.version=INFERENCE_BLOB_VERSION;
+	header.byte_order=INFERENCE_BLOB_BYTE_ORDER;
+	header.strategy=IB_BINARY;
+	header.kernel_type=IB_LINEAR;
+
+	/* binary machines and the classes they decide between */
+	CDynamicObjectArray* machines=new CDynamicObjectArray();
+	SG_REF(machines);
+	SGVector<int32_t> positive_class;
+	SGVector<int32_t> negative_class;
+	CKernel* kernel=NULL;
+	CFeatures* lhs=NULL;
+
+	/* the vectors are the normal vectors of linear machines or the union of
+	 * the support vectors of kernel machines, the expansions refer to them
+	 * by index. Machine i uses the entries sv_start[i] up to
+	 * sv_start[i+1] of svs and alphas */
+	SGMatrix<float64_t> vectors;
+	DynArray<int32_t> svs;
+	DynArray<float64_t> alphas;
+	SGVector<int32_t> sv_start;
+	SGVector<float64_t> biases;
+	int32_t num_machines=0;
+
+	/* the machines, kernel and features are released before passing on the
+	 * error when a machine cannot be exported */
+	try
+	{
+		CMulticlassMachine* mc_machine=dynamic_cast<CMulticlassMachine*>(machine);
+		if (mc_machine)
+		{
+			CMulticlassStrategy* strategy=mc_machine->get_multiclass_strategy();
+			int32_t num_classes=strategy->get_num_classes();
+			bool ovr=dynamic_cast<CMulticlassOneVsRestStrategy*>(strategy)!=NULL;
+			bool ovo=dynamic_cast<CMulticlassOneVsOneStrategy*>(strategy)!=NULL;
+			bool plain=strategy->get_prob_heuris_type()==PROB_HEURIS_NONE &&
+				!strategy->get_rejection_strategy();
+			SG_UNREF(strategy);
+
+			REQUIRE(ovr || ovo, "Only one vs rest and one vs one strategies can be "
+					"exported\n")
+			REQUIRE(plain, "Probability heuristics and rejection strategies cannot "
+					"be exported\n")
+
+			header.strategy=ovr ? IB_ONE_VS_REST : IB_ONE_VS_ONE;
+			header.num_classes=num_classes;
+
+			num_machines=mc_machine->get_num_machines();
+			REQUIRE(num_machines>0, "Machine %s is not trained\n",
+					machine->get_name())
+			positive_class=SGVector<int32_t>(num_machines);
+			negative_class=SGVector<int32_t>(num_machines);
+
+			/* pairs are ordered as in CMulticlassOneVsOneStrategy */
+			int32_t m=0;
+			for (int32_t i=0; i<num_classes && m<num_machines; i++)
+			{
+				if (ovr)
+				{
+					positive_class[m]=i;
+					negative_class[m++]=-1;
+					continue;
+				}
+
+				for (int32_t j=i+1; j<num_classes && m<num_machines; j++)
+				{
+					positive_class[m]=i;
+					negative_class[m++]=j;
+				}
+			}
+			REQUIRE(m==num_machines, "Expected %d machines for %d classes, got "
+					"%d\n", m, num_classes, num_machines)
+
+			for (int32_t i=0; i<num_machines; i++)
+			{
+				CMachine* sub=mc_machine->get_machine(i);
+				REQUIRE(sub, "Machine %d of %s is missing\n", i,
+						machine->get_name())
+				machines->append_element(sub);
+				SG_UNREF(sub);
+			}
+
+			CKernelMulticlassMachine* kmc=
+				dynamic_cast<CKernelMulticlassMachine*>(machine);
+			if (kmc)
+				kernel=kmc->get_kernel();
+		}
+		else
+		{
+			positive_class=SGVector<int32_t>(1);
+			negative_class=SGVector<int32_t>(1);
+			positive_class[0]=-1;
+			negative_class[0]=-1;
+			machines->append_element(machine);
+
+			CKernelMachine* km=dynamic_cast<CKernelMachine*>(machine);
+			if (km)
+				kernel=km->get_kernel();
+		}
+
+		num_machines=machines->get_num_elements();
+		header.num_machines=num_machines;
+		sv_start=SGVector<int32_t>(num_machines+1);
+		sv_start[0]=0;
+		biases=SGVector<float64_t>(num_machines);
+
+		CMachine* first=(CMachine*) machines->get_element(0);
+		bool is_linear=dynamic_cast<CLinearMachine*>(first)!=NULL;
+		SG_UNREF(first);
+
+		if (is_linear)
+		{
+			for (int32_t i=0; i<num_machines; i++)
+			{
+				CMachine* sub=(CMachine*) machines->get_element(i);
+				CLinearMachine* lm=dynamic_cast<CLinearMachine*>(sub);
+				SGVector<float64_t> w;
+				if (lm)
+				{
+					w=lm->get_w();
+					biases[i]=lm->get_bias();
+				}
+				SG_UNREF(sub);
+				REQUIRE(lm, "All machines need to be linear machines\n")
+
+				if (!i)
+					vectors=SGMatrix<float64_t>(w.vlen, num_machines);
+				REQUIRE(w.vlen>0 && w.vlen==vectors.num_rows, "Machine %d has %d "
+						"weights, expected %d\n", i, w.vlen, vectors.num_rows)
+
+				memcpy(vectors.get_column_vector(i), w.vector,
+						sizeof(float64_t)*w.vlen);
+				svs.push_back(i);
+				alphas.push_back(1);
+				sv_start[i+1]=i+1;
+			}
+		}
+		else
+		{
+			REQUIRE(kernel, "Only linear and kernel machines can be exported\n")
+
+			switch (kernel->get_kernel_type())
+			{
+				case K_LINEAR:
+					header.kernel_type=IB_LINEAR;
+					break;
+				case K_GAUSSIAN:
+					REQUIRE(!((CGaussianKernel*) kernel)->get_compact_enabled(),
+							"Compact gaussian kernels cannot be exported\n")
+					header.kernel_type=IB_GAUSSIAN;
+					header.width=((CGaussianKernel*) kernel)->get_width();
+					break;
+				case K_POLY:
+					header.kernel_type=IB_POLY;
+					header.degree=((CPolyKernel*) kernel)->get_degree();
+					header.offset=((CPolyKernel*) kernel)->get_inhomogene() ? 1 : 0;
+					break;
+				default:
+					SG_SERROR("Kernel %s cannot be exported\n", kernel->get_name())
+			}
+
+			CKernelNormalizer* normalizer=kernel->get_normalizer();
+			const char* normalizer_name=normalizer ? normalizer->get_name() : NULL;
+			bool identity=!normalizer_name ||
+				!strcmp(normalizer_name, "IdentityKernelNormalizer");
+			header.normalize=normalizer_name &&
+				!strcmp(normalizer_name, "SqrtDiagKernelNormalizer");
+			SG_UNREF(normalizer);
+			REQUIRE(identity || header.normalize, "Kernel normalizer %s cannot be "
+					"exported\n", normalizer_name)
+
+			lhs=kernel->get_lhs();
+			REQUIRE(lhs && lhs->get_feature_class()==C_DENSE &&
+					lhs->get_feature_type()==F_DREAL, "Kernel needs dense real "
+					"valued features on the left hand side\n")
+			CDenseFeatures<float64_t>* features=(CDenseFeatures<float64_t>*) lhs;
+
+			/* columns of the support vectors in the blob */
+			SGVector<int32_t> column(features->get_num_vectors());
+			column.set_const(-1);
+			SGVector<int32_t> sv_index(features->get_num_vectors());
+			int32_t num_vectors=0;
+
+			for (int32_t i=0; i<num_machines; i++)
+			{
+				CMachine* sub=(CMachine*) machines->get_element(i);
+				CKernelMachine* km=dynamic_cast<CKernelMachine*>(sub);
+				SGVector<int32_t> machine_svs;
+				SGVector<float64_t> machine_alphas;
+				if (km)
+				{
+					machine_svs=km->get_support_vectors();
+					machine_alphas=km->get_alphas();
+					biases[i]=km->get_bias();
+				}
+				SG_UNREF(sub);
+				REQUIRE(km, "All machines need to be kernel machines\n")
+				REQUIRE(machine_alphas.vlen==machine_svs.vlen, "Machine %d has %d "
+						"alphas for %d support vectors\n", i, machine_alphas.vlen,
+						machine_svs.vlen)
+
+				for (int32_t j=0; j<machine_svs.vlen; j++)
+				{
+					int32_t sv=machine_svs[j];
+					REQUIRE(sv>=0 && sv<column.vlen, "Support vector %d of machine "
+							"%d out of range\n", sv, i)
+					if (column[sv]<0)
+					{
+						sv_index[num_vectors]=sv;
+						column[sv]=num_vectors++;
+					}
+
+					svs.push_back(column[sv]);
+					alphas.push_back(machine_alphas[j]);
+				}
+				sv_start[i+1]=svs.get_num_elements();
+			}
+
+			vectors=SGMatrix<float64_t>(features->get_num_features(), num_vectors);
+			for (int32_t i=0; i<num_vectors; i++)
+			{
+				SGVector<float64_t> vec=features->get_feature_vector(sv_index[i]);
+				memcpy(vectors.get_column_vector(i), vec.vector,
+						sizeof(float64_t)*vec.vlen);
+				features->free_feature_vector(vec, sv_index[i]);
+			}
+		}
+	}
+	catch (...)
+	{
+		SG_UNREF(lhs);
+		SG_UNREF(kernel);
+		SG_UNREF(machines);
+		throw;
+	}
+	SG_UNREF(lhs);
+	SG_UNREF(kernel);
+	SG_UNREF(machines);
+
+	header.dim=vectors.num_rows;
+	header.num_vectors=vectors.num_cols;
+
+	/* layout */
+	uint64_t size=aligned(sizeof(InferenceBlobHeader));
+	header.vectors_offset=size;
+	size+=aligned(sizeof(float64_t)*uint64_t(header.dim)*header.num_vectors);
+	header.sq_norms_offset=size;
+	size+=aligned(sizeof(float64_t)*header.num_vectors);
+	header.sqrt_diag_offset=size;
+	if (header.normalize)
+		size+=aligned(sizeof(float64_t)*header.num_vectors);
+	header.machines_offset=size;
+	size+=aligned(sizeof(InferenceBlobMachine)*num_machines);
+
+	InferenceBlobMachine* blob_machines=SG_CALLOC(InferenceBlobMachine, num_machines);
+	for (int32_t i=0; i<num_machines; i++)
+	{
+		blob_machines[i].bias=biases[i];
+		blob_machines[i].num_svs=sv_start[i+1]-sv_start[i];
+		blob_machines[i].positive_class=positive_class[i];
+		blob_machines[i].negative_class=negative_class[i];
+		blob_machines[i].svs_offset=size;
+		size+=aligned(sizeof(int32_t)*blob_machines[i].num_svs);
+		blob_machines[i].alphas_offset=size;
+		size+=aligned(sizeof(float64_t)*blob_machines[i].num_svs);
+	}
+	header.size=size;
+
+	/* contents */
+	char* blob=SG_CALLOC(char, size);
+	memcpy(blob, &header, sizeof(header));
+	memcpy(blob+header.machines_offset, blob_machines,
+			sizeof(InferenceBlobMachine)*num_machines);
+	memcpy(blob+header.vectors_offset, vectors.matrix,
+			sizeof(float64_t)*uint64_t(header.dim)*header.num_vectors);
+
+	float64_t* sq_norms=(float64_t*) (blob+header.sq_norms_offset);
+	float64_t* diag=(float64_t*) (blob+header.sqrt_diag_offset);
+	for (int32_t i=0; i<header.num_vectors; i++)
+	{
+		float64_t* vec=vectors.get_column_vector(i);
+		sq_norms[i]=SGVector<float64_t>::dot(vec, vec, header.dim);
+		if (header.normalize)
+			diag[i]=sqrt_diag(&header, sq_norms[i]);
+	}
+
+	for (int32_t i=0; i<num_machines; i++)
+	{
+		memcpy(blob+blob_machines[i].svs_offset,
+				svs.get_array()+sv_start[i],
+				sizeof(int32_t)*blob_machines[i].num_svs);
+		memcpy(blob+blob_machines[i].alphas_offset,
+				alphas.get_array()+sv_start[i],
+				sizeof(float64_t)*blob_machines[i].num_svs);
+	}
+	SG_FREE(blob_machines);
+
+	FILE* f=fopen(filename, "wb");
+	bool written=f && fwrite(blob, 1, size, f)==size;
+	if (f)
+		written=(fclose(f)==0) && written;
+	SG_FREE(blob);
+
+	REQUIRE(written, "Could not write inference blob to %s\n", filename)
+}
+
+void InferenceBlob::load(const char* filename)
+{
+	REQUIRE(filename, "No file name given\n")
+	unload();
+
+	int fd=open(filename, O_RDONLY);
+	REQUIRE(fd>=0, "Could not open %s\n", filename)
+
+	struct stat st;
+	void* map=MAP_FAILED;
+	if (fstat(fd, &st)==0 && st.st_size>=(off_t) sizeof(InferenceBlobHeader))
+		map=mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	REQUIRE(map!=MAP_FAILED, "Could not map %s\n", filename)
+
+	m_map=(char*) map;
+	m_map_size=st.st_size;
+
+	/* validate everything that is accessed later on, such that prediction
+	 * does not need any checks */
+	const InferenceBlobHeader* h=(const InferenceBlobHeader*) m_map;
+	uint64_t size=m_map_size;
+	bool valid=!memcmp(h->magic, INFERENCE_BLOB_MAGIC, sizeof(h->magic)) &&
+		h->version==INFERENCE_BLOB_VERSION &&
+		h->byte_order==INFERENCE_BLOB_BYTE_ORDER && h->size==size &&
+		h->strategy>=IB_BINARY && h->strategy<=IB_ONE_VS_ONE &&
+		h->kernel_type>=IB_LINEAR && h->kernel_type<=IB_POLY &&
+		h->dim>0 && h->num_vectors>=0 && h->num_machines>0 &&
+		(h->strategy==IB_BINARY ? h->num_machines==1 : h->num_classes>0) &&
+		in_blob(h->vectors_offset,
+				sizeof(float64_t)*uint64_t(h->dim)*h->num_vectors, size) &&
+		in_blob(h->sq_norms_offset, sizeof(float64_t)*h->num_vectors, size) &&
+		(!h->normalize || in_blob(h->sqrt_diag_offset,
+				sizeof(float64_t)*h->num_vectors, size)) &&
+		in_blob(h->machines_offset,
+				sizeof(InferenceBlobMachine)*uint64_t(h->num_machines), size);
+
+	const InferenceBlobMachine* machines=valid ?
+		at<InferenceBlobMachine>(h->machines_offset) : NULL;
+	for (int32_t i=0; valid && i<h->num_machines; i++)
+	{
+		const InferenceBlobMachine* m=&machines[i];
+		valid=m->num_svs>=0 &&
+			m->positive_class<h->num_classes &&
+			m->negative_class<h->num_classes &&
+			(h->strategy==IB_BINARY || m->positive_class>=0) &&
+			(h->strategy!=IB_ONE_VS_ONE || m->negative_class>=0) &&
+			in_blob(m->svs_offset, sizeof(int32_t)*m->num_svs, size) &&
+			in_blob(m->alphas_offset, sizeof(float64_t)*m->num_svs, size);
+
+		const int32_t* svs=valid ? at<int32_t>(m->svs_offset) : NULL;
+		for (int32_t j=0; valid && j<m->num_svs; j++)
+			valid=svs[j]>=0 && svs[j]<h->num_vectors;
+	}
+
+	if (!valid)
+	{
+		unload();
+		SG_SERROR("%s is not a valid inference blob\n", filename)
+	}
+
+	m_header=h;
+	m_machines=machines;
+}
+
+void InferenceBlob::unload()
+{
+	if (m_map)
+		munmap(m_map, m_map_size);
+
+	m_map=NULL;
+	m_map_size=0;
+	m_header=NULL;
+	m_machines=NULL;
+}
+
+SGMatrix<float64_t> InferenceBlob::apply_outputs(SGMatrix<float64_t> data) const
+{
+	REQUIRE(is_loaded(), "No inference blob loaded\n")
+	REQUIRE(data.num_rows==m_header->dim, "Vectors have dimension %d, blob "
+			"expects %d\n", data.num_rows, m_header->dim)
+
+	int32_t dim=m_header->dim;
+	int32_t num_vectors=m_header->num_vectors;
+	int32_t num_machines=m_header->num_machines;
+	int32_t num_data=data.num_cols;
+	const float64_t* vectors=at<float64_t>(m_header->vectors_offset);
+	const float64_t* sq_norms=at<float64_t>(m_header->sq_norms_offset);
+	const float64_t* diag=m_header->normalize ?
+		at<float64_t>(m_header->sqrt_diag_offset) : NULL;
+
+	SGMatrix<float64_t> outputs(num_machines, num_data);
+
+	/* keep the kernel block of a thread at about 8MB */
+	int32_t block=CMath::max(1, CMath::min(INFERENCE_BLOB_BLOCK_SIZE,
+				(1<<20)/CMath::max(num_vectors, 1)));
+	int32_t num_blocks=(num_data+block-1)/block;
+
+	Parallel* parallel=get_global_parallel();
+	int32_t num_threads=parallel->get_num_threads();
+	SG_UNREF(parallel);
+
+	#pragma omp parallel num_threads(num_threads)
+	{
+		float64_t* kernel_block=SG_MALLOC(float64_t, int64_t(num_vectors)*block);
+
+		#pragma omp for schedule(dynamic)
+		for (int32_t b=0; b<num_blocks; b++)
+		{
+			int32_t start=b*block;
+			int32_t len=CMath::min(block, num_data-start);
+			const float64_t* x=data.matrix+int64_t(start)*dim;
+
+			/* inner products of the block with all vectors */
+#ifdef HAVE_LAPACK
+			if (num_vectors>0)
+			{
+				cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans, num_vectors,
+						len, dim, 1.0, vectors, dim, x, dim, 0.0, kernel_block,
+						num_vectors);
+			}
+#else
+			for (int32_t j=0; j<len; j++)
+			{
+				for (int32_t i=0; i<num_vectors; i++)
+				{
+					kernel_block[int64_t(j)*num_vectors+i]=SGVector<float64_t>::dot(
+							vectors+int64_t(i)*dim, x+int64_t(j)*dim, dim);
+				}
+			}
+#endif
+
+			for (int32_t j=0; j<len; j++)
+			{
+				const float64_t* vec=x+int64_t(j)*dim;
+				float64_t sq_x=SGVector<float64_t>::dot(vec, vec, dim);
+				float64_t diag_x=diag ? sqrt_diag(m_header, sq_x) : 1;
+				float64_t* k=kernel_block+int64_t(j)*num_vectors;
+
+				for (int32_t i=0; i<num_vectors; i++)
+				{
+					k[i]=kernel(m_header, k[i], sq_x, sq_norms[i]);
+					if (diag)
+						k[i]/=diag_x*diag[i];
+				}
+
+				/* summed up in the same order as CKernelMachine::apply_one */
+				for (int32_t m=0; m<num_machines; m++)
+				{
+					const InferenceBlobMachine* machine=&m_machines[m];
+					const int32_t* svs=at<int32_t>(machine->svs_offset);
+					const float64_t* alphas=at<float64_t>(machine->alphas_offset);
+
+					float64_t score=0;
+					for (int32_t s=0; s<machine->num_svs; s++)
+						score+=k[svs[s]]*alphas[s];
+
+					outputs(m, start+j)=score+machine->bias;
+				}
+			}
+		}
+
+		SG_FREE(kernel_block);
+	}
+
+	return outputs;
+}
+
+SGVector<float64_t> InferenceBlob::apply(SGMatrix<float64_t> data) const
+{
+	SGMatrix<float64_t> outputs=apply_outputs(data);
+
+	if (m_header->strategy==IB_BINARY)
+	{
+		SGVector<float64_t> result(data.num_cols);
+		memcpy(result.vector, outputs.matrix, sizeof(float64_t)*data.num_cols);
+		return result;
+	}
+
+	SGVector<float64_t> labels(data.num_cols);
+	int32_t num_classes=m_header->num_classes;
+	SGVector<int32_t> votes(num_classes);
+	SGVector<int32_t> dec_vals(num_classes);
+	for (int32_t i=0; i<data.num_cols; i++)
+	{
+		labels[i]=decide_label(outputs.get_column_vector(i), votes.vector,
+				dec_vals.vector);
+	}
+
+	return labels;
+}
+
+int32_t InferenceBlob::decide_label(const float64_t* outputs, int32_t* votes,
+		int32_t* dec_vals) const
+{
+	int32_t num_machines=m_header->num_machines;
+	int32_t num_classes=m_header->num_classes;
+
+	/* same decisions as CMulticlassOneVsRestStrategy and
+	 * CMulticlassOneVsOneStrategy, including that one vs one outputs of
+	 * num_classes machines are taken as probabilities and that ties in the
+	 * votes are broken by decision values summed up as integers */
+	if (m_header->strategy==IB_ONE_VS_REST || num_machines==num_classes)
+	{
+		int32_t best=0;
+		for (int32_t m=1; m<num_machines; m++)
+		{
+			if (outputs[m]>outputs[best])
+				best=m;
+		}
+
+		return m_header->strategy==IB_ONE_VS_REST ?
+			m_machines[best].positive_class : best;
+	}
+
+	for (int32_t c=0; c<num_classes; c++)
+	{
+		votes[c]=0;
+		dec_vals[c]=0;
+	}
+
+	for (int32_t m=0; m<num_machines; m++)
+	{
+		int32_t c=outputs[m]>0 ? m_machines[m].positive_class :
+			m_machines[m].negative_class;
+		votes[c]++;
+		dec_vals[c]+=CMath::abs(outputs[m]);
+	}
+
+	int32_t best=0;
+	for (int32_t c=1; c<num_classes; c++)
+	{
+		if (votes[c]>votes[best] ||
+				(votes[c]==votes[best] && dec_vals[c]>dec_vals[best]))
+			best=c;
+	}
+
+	return best;
+}
+
+float64_t InferenceBlob::kernel(const InferenceBlobHeader* header,
+		float64_t dot, float64_t sq_x, float64_t sq_y)
+{
+	switch (header->kernel_type)
+	{
+		case IB_GAUSSIAN:
+			return CMath::exp(-(sq_y+sq_x-2*dot)/header->width);
+		case IB_POLY:
+			return CMath::pow(dot+header->offset, (int32_t) header->degree);
+		default:
+			return dot;
+	}
+}
+
+float64_t InferenceBlob::sqrt_diag(const InferenceBlobHeader* header,
+		float64_t sq_x)
+{
+	float64_t diag=CMath::sqrt(kernel(header, sq_x, sq_x, sq_x));
+	return diag==0.0 ? 1e-16 : diag;
+}
+
+int32_t InferenceBlob::get_dim() const
+{
+	REQUIRE(is_loaded(), "No inference blob loaded\n")
+	return m_header->dim;
+}
+
+int32_t InferenceBlob::get_num_machines() const
+{
+	REQUIRE(is_loaded(), "No inference blob loaded\n")
+	return m_header->num_machines;
+}
+
+int32_t InferenceBlob::get_num_classes() const
+{
+	REQUIRE(is_loaded(), "No inference blob loaded\n")
+	return m_header->num_classes;
+}
+
+EInferenceBlobStrategy InferenceBlob::get_strategy() const
+{
+	REQUIRE(is_loaded(), "No inference blob loaded\n")
+	return (EInferenceBlobStrategy) m_header->strategy;
+}
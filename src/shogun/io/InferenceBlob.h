@@ -0,0 +1,240 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#ifndef __INFERENCEBLOB_H__
+#define __INFERENCEBLOB_H__
+
+#include <shogun/lib/config.h>
+#include <shogun/lib/common.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/SGMatrix.h>
+
+namespace shogun
+{
+class CMachine;
+
+/** how the outputs of the machines of an inference blob are combined */
+enum EInferenceBlobStrategy
+{
+	/** one machine, outputs are returned as they are */
+	IB_BINARY=0,
+	/** label is the machine with the largest output */
+	IB_ONE_VS_REST=1,
+	/** label is the class with most votes of the pairwise machines */
+	IB_ONE_VS_ONE=2
+};
+
+/** kernel of the expansions of an inference blob */
+enum EInferenceBlobKernel
+{
+	/** \f$k(x,y)=x^\top y\f$ */
+	IB_LINEAR=0,
+	/** \f$k(x,y)=\exp(-\|x-y\|^2/\tau)\f$ */
+	IB_GAUSSIAN=1,
+	/** \f$k(x,y)=(x^\top y+c)^d\f$ */
+	IB_POLY=2
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/** header at the start of an inference blob, all offsets are in bytes from
+ * the start of the blob and aligned to INFERENCE_BLOB_ALIGNMENT */
+struct InferenceBlobHeader
+{
+	/** "SGINFBLB" */
+	char magic[8];
+	/** format version */
+	uint32_t version;
+	/** 0x01020304 in the byte order of the writer */
+	uint32_t byte_order;
+	/** size of the blob */
+	uint64_t size;
+	/** EInferenceBlobStrategy */
+	int32_t strategy;
+	/** EInferenceBlobKernel */
+	int32_t kernel_type;
+	/** whether kernel values are normalised by sqrt(k(x,x)k(y,y)) */
+	int32_t normalize;
+	/** dimension of the vectors */
+	int32_t dim;
+	/** number of vectors shared by all expansions */
+	int32_t num_vectors;
+	/** number of machines */
+	int32_t num_machines;
+	/** number of classes */
+	int32_t num_classes;
+	/** unused */
+	int32_t reserved;
+	/** width of the gaussian kernel */
+	float64_t width;
+	/** degree of the polynomial kernel */
+	float64_t degree;
+	/** constant of the polynomial kernel */
+	float64_t offset;
+	/** dim x num_vectors matrix of the vectors, column-major */
+	uint64_t vectors_offset;
+	/** squared norms of the vectors */
+	uint64_t sq_norms_offset;
+	/** sqrt(k(v,v)) of the vectors if kernel values are normalised */
+	uint64_t sqrt_diag_offset;
+	/** num_machines InferenceBlobMachine */
+	uint64_t machines_offset;
+};
+
+/** expansion \f$f(x)=\sum_i \alpha_i k(x, v_{s_i})+b\f$ of one machine */
+struct InferenceBlobMachine
+{
+	/** bias b */
+	float64_t bias;
+	/** number of terms */
+	int32_t num_svs;
+	/** class of positive outputs, -1 if none */
+	int32_t positive_class;
+	/** class of negative outputs, -1 if none */
+	int32_t negative_class;
+	/** unused */
+	int32_t reserved;
+	/** num_svs int32 indices s_i of the shared vectors */
+	uint64_t svs_offset;
+	/** num_svs float64 coefficients alpha_i */
+	uint64_t alphas_offset;
+};
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief Flat, versioned model format for serving trained linear, kernel
+ * and multiclass machines, together with a loader that memory maps it.
+ *
+ * export_machine() writes the inference relevant part of a trained
+ * CLinearMachine, CKernelMachine, CLinearMulticlassMachine or
+ * CKernelMulticlassMachine (one vs rest or one vs one) into a single file:
+ * a fixed header, the vectors (support vectors or normal vectors) shared by
+ * all machines, the kernel parameters and, per machine, bias, coefficients
+ * and the classes it decides between. All arrays are aligned such that the
+ * loader uses them directly from the mapping.
+ *
+ * Loading validates the header and offsets only, no CSGObject is created,
+ * which makes it suitable for fast starting prediction services. Outputs
+ * are computed for blocks of vectors at once: the inner products with all
+ * shared vectors are a matrix product, from which the kernel values and
+ * the expansions of all machines follow. Linear machines are stored as a
+ * linear kernel expansion of their normal vector.
+ *
+ * Dense real valued features are required, supported kernels are the
+ * linear, gaussian and polynomial kernel, without normalisation or with
+ * the sqrt-diagonal normaliser.
+ */
+class InferenceBlob
+{
+public:
+	/** default constructor */
+	InferenceBlob();
+
+	/** constructor
+	 *
+	 * @param filename blob to load
+	 */
+	InferenceBlob(const char* filename);
+
+	/** destructor */
+	~InferenceBlob();
+
+	/** write a trained machine as inference blob
+	 *
+	 * @param machine trained machine
+	 * @param filename file to write
+	 */
+	static void export_machine(CMachine* machine, const char* filename);
+
+	/** memory map a blob, a previously loaded blob is released
+	 *
+	 * @param filename blob to load
+	 */
+	void load(const char* filename);
+
+	/** release the mapping */
+	void unload();
+
+	/** outputs of all machines
+	 *
+	 * @param data vectors to apply to, one per column
+	 * @return num_machines x num_vectors outputs
+	 */
+	SGMatrix<float64_t> apply_outputs(SGMatrix<float64_t> data) const;
+
+	/** apply to vectors
+	 *
+	 * @param data vectors to apply to, one per column
+	 * @return outputs of binary blobs, labels of multiclass ones
+	 */
+	SGVector<float64_t> apply(SGMatrix<float64_t> data) const;
+
+	/** @return whether a blob is loaded */
+	bool is_loaded() const { return m_header!=NULL; }
+
+	/** @return dimension of the vectors */
+	int32_t get_dim() const;
+
+	/** @return number of machines */
+	int32_t get_num_machines() const;
+
+	/** @return number of classes, 0 for binary blobs */
+	int32_t get_num_classes() const;
+
+	/** @return strategy to combine the machines */
+	EInferenceBlobStrategy get_strategy() const;
+
+private:
+	/** unnormalised kernel value from the inner product
+	 *
+	 * @param header header with the kernel parameters
+	 * @param dot inner product of the two vectors
+	 * @param sq_x squared norm of the first vector
+	 * @param sq_y squared norm of the second vector
+	 * @return kernel value
+	 */
+	static float64_t kernel(const InferenceBlobHeader* header, float64_t dot,
+			float64_t sq_x, float64_t sq_y);
+
+	/** sqrt(k(x,x)) as used by the sqrt-diagonal normaliser
+	 *
+	 * @param header header with the kernel parameters
+	 * @param sq_x squared norm of the vector
+	 * @return sqrt(k(x,x)), but not zero
+	 */
+	static float64_t sqrt_diag(const InferenceBlobHeader* header,
+			float64_t sq_x);
+
+	/** label from the outputs of all machines
+	 *
+	 * @param outputs outputs of the machines
+	 * @param votes buffer of num_classes entries
+	 * @param dec_vals buffer of num_classes entries
+	 * @return label
+	 */
+	int32_t decide_label(const float64_t* outputs, int32_t* votes,
+			int32_t* dec_vals) const;
+
+	/** @return pointer at offset into the blob */
+	template <class T>
+	const T* at(uint64_t offset) const
+	{
+		return (const T*) (m_map+offset);
+	}
+
+private:
+	/** mapped blob */
+	char* m_map;
+	/** size of the mapping */
+	int64_t m_map_size;
+	/** header of the blob */
+	const InferenceBlobHeader* m_header;
+	/** machines of the blob */
+	const InferenceBlobMachine* m_machines;
+};
+}
+#endif /* __INFERENCEBLOB_H__ */
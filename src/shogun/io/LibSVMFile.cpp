@@ -8,6 +8,7 @@
  */
 
 #include <shogun/io/LibSVMFile.h>
+#include <shogun/io/ChunkedTextParser.h>
 
 #include <shogun/lib/SGVector.h>
 #include <shogun/lib/SGSparseVector.h>
@@ -100,67 +101,13 @@ GET_SPARSE_MATRIX(read_ulong, uint64_t)
 void CLibSVMFile::get_sparse_matrix(SGSparseVector<sg_type>*& matrix, int32_t& num_feat, int32_t& num_vec, \
 					float64_t*& labels, bool load_labels) \
 { \
-	num_feat=0; \
+	SG_INFO("reading file %s\n", filename) \
 	\
-	SG_INFO("counting line numbers in file %s\n", filename) \
-	num_vec=get_num_lines(); \
-	\
-	int32_t current_line_ind=0; \
-	SGVector<char> line; \
-	\
-	int32_t num_entries=0; \
-	DynArray<SGVector<char> > entries; \
-	\
-	matrix=SG_MALLOC(SGSparseVector<sg_type>, num_vec); \
-	if (load_labels) \
-		labels=SG_MALLOC(float64_t, num_vec); \
-	\
-	SG_SET_LOCALE_C; \
-	\
-	while (m_line_reader->has_next()) \
-	{ \
-		num_entries=0; \
-		entries.reset(SGVector<char>(false)); \
-		line=m_line_reader->read_line(); \
-		\
-		m_parser->set_tokenizer(m_whitespace_tokenizer); \
-		m_parser->set_text(line); \
-		\
-		if (load_labels && m_parser->has_next()) \
-			labels[current_line_ind]=m_parser->read_real(); \
-		\
-		while (m_parser->has_next()) \
-		{ \
-			entries.push_back(m_parser->read_string()); \
-			num_entries++; \
-		} \
-		\
-		matrix[current_line_ind]=SGSparseVector<sg_type>(num_entries); \
-		for (int32_t i=0; i<num_entries; i++) \
-		{ \
-			m_parser->set_tokenizer(m_delimiter_tokenizer); \
-			m_parser->set_text(entries[i]); \
-			\
-			int32_t feat_index=0; \
-			if (m_parser->has_next()) \
-				feat_index=m_parser->read_int(); \
-			\
-			sg_type entry=0; \
-			if (m_parser->has_next()) \
-				entry=m_parser->read_func(); \
-			\
-			if (feat_index>num_feat) \
-				num_feat=feat_index; \
-			\
-			matrix[current_line_ind].features[i].feat_index=feat_index-1; \
-			matrix[current_line_ind].features[i].entry=entry; \
-		} \
-		\
-		current_line_ind++; \
-		SG_PROGRESS(current_line_ind, 0, num_vec, 1, "LOADING:\t") \
-	} \
-	\
-	SG_RESET_LOCALE; \
+	CChunkedTextParser* parser=new CChunkedTextParser(file); \
+	SG_REF(parser); \
+	parser->parse_sparse(matrix, num_feat, num_vec, labels, load_labels, \
+			m_delimiter); \
+	SG_UNREF(parser); \
 	\
 	SG_INFO("file successfully read\n") \
 }
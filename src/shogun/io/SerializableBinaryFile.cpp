@@ -0,0 +1,299 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/io/SerializableBinaryFile.h>
+#include <shogun/io/SerializableBinaryReader00.h>
+
+#define STR_HEADER_00                 \
+	"<<_SHOGUN_SERIALIZABLE_BINARY_FILE_V_00_>>"
+
+using namespace shogun;
+
+CSerializableBinaryFile::CSerializableBinaryFile()
+	:CSerializableFile() { init(UNCOMPRESSED); }
+
+CSerializableBinaryFile::CSerializableBinaryFile(FILE* fstream, char rw,
+		E_COMPRESSION_TYPE compression)
+	:CSerializableFile(fstream, rw) { init(compression); }
+
+CSerializableBinaryFile::CSerializableBinaryFile(
+	const char* fname, char rw, E_COMPRESSION_TYPE compression)
+	:CSerializableFile(fname, rw) { init(compression); }
+
+CSerializableBinaryFile::~CSerializableBinaryFile() {}
+
+CSerializableFile::TSerializableReader*
+CSerializableBinaryFile::new_reader(char* dest_version, size_t n)
+{
+	string_t buf;
+	if (fgets(buf, STRING_LEN, m_fstream) == NULL)
+		return NULL;
+
+	size_t len = strlen(buf);
+	if (len > 0 && buf[len-1] == '\n')
+		buf[len-1] = '\0';
+
+	strncpy(dest_version, buf, n < STRING_LEN? n: STRING_LEN);
+	m_stack_fpos.push_back(ftell(m_fstream));
+
+	if (strcmp(STR_HEADER_00, dest_version) == 0)
+		return new SerializableBinaryReader00(this);
+
+	return NULL;
+}
+
+void
+CSerializableBinaryFile::init(E_COMPRESSION_TYPE compression)
+{
+	m_compression = compression;
+
+	if (m_fstream == NULL) return;
+
+	switch (m_task) {
+	case 'w':
+		if (fprintf(m_fstream, STR_HEADER_00"\n") <= 0) {
+			close(); return;
+		}
+		break;
+	case 'r': break;
+	default:
+		SG_WARNING("Could not open file `%s', unknown mode!\n",
+				   m_filename);
+		close(); return;
+	}
+}
+
+bool
+CSerializableBinaryFile::write_string(const char* str)
+{
+	uint32_t len = strlen(str);
+
+	if (fwrite(&len, sizeof(len), 1, m_fstream) != 1) return false;
+	if (len > 0 && fwrite(str, 1, len, m_fstream) != len) return false;
+
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_scalar_wrapped(
+	const TSGDataType* type, const void* param)
+{
+	switch (type->m_ptype) {
+	case PT_SGOBJECT: case PT_UNDEFINED:
+		SG_ERROR("write_scalar_wrapped(): Implementation error during"
+				 " writing BinaryFile!");
+		return false;
+	default:
+		break;
+	}
+
+	return fwrite(param, type->sizeof_ptype(), 1, m_fstream) == 1;
+}
+
+bool
+CSerializableBinaryFile::write_cont_begin_wrapped(
+	const TSGDataType* type, index_t len_real_y, index_t len_real_x)
+{
+	if (fwrite(&len_real_y, sizeof(index_t), 1, m_fstream) != 1)
+		return false;
+	if (fwrite(&len_real_x, sizeof(index_t), 1, m_fstream) != 1)
+		return false;
+
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_cont_end_wrapped(
+	const TSGDataType* type, index_t len_real_y, index_t len_real_x)
+{
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_string_begin_wrapped(
+	const TSGDataType* type, index_t length)
+{
+	return fwrite(&length, sizeof(index_t), 1, m_fstream) == 1;
+}
+
+bool
+CSerializableBinaryFile::write_string_end_wrapped(
+	const TSGDataType* type, index_t length)
+{
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_stringentry_begin_wrapped(
+	const TSGDataType* type, index_t y)
+{
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_stringentry_end_wrapped(
+	const TSGDataType* type, index_t y)
+{
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_sparse_begin_wrapped(
+	const TSGDataType* type, index_t length)
+{
+	return fwrite(&length, sizeof(index_t), 1, m_fstream) == 1;
+}
+
+bool
+CSerializableBinaryFile::write_sparse_end_wrapped(
+	const TSGDataType* type, index_t length)
+{
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_sparseentry_begin_wrapped(
+	const TSGDataType* type, const SGSparseVectorEntry<char>* first_entry,
+	index_t feat_index, index_t y)
+{
+	return fwrite(&feat_index, sizeof(index_t), 1, m_fstream) == 1;
+}
+
+bool
+CSerializableBinaryFile::write_sparseentry_end_wrapped(
+	const TSGDataType* type, const SGSparseVectorEntry<char>* first_entry,
+	index_t feat_index, index_t y)
+{
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_item_begin_wrapped(
+	const TSGDataType* type, index_t y, index_t x)
+{
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_item_end_wrapped(
+	const TSGDataType* type, index_t y, index_t x)
+{
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_sgserializable_begin_wrapped(
+	const TSGDataType* type, const char* sgserializable_name,
+	EPrimitiveType generic)
+{
+	if (!write_string(sgserializable_name)) return false;
+
+	if (*sgserializable_name != '\0') {
+		int32_t g = generic;
+		if (fwrite(&g, sizeof(g), 1, m_fstream) != 1) return false;
+	}
+
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_sgserializable_end_wrapped(
+	const TSGDataType* type, const char* sgserializable_name,
+	EPrimitiveType generic)
+{
+	/* an empty name terminates the list of parameters of an object */
+	if (*sgserializable_name != '\0')
+		return write_string("");
+
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_type_begin_wrapped(
+	const TSGDataType* type, const char* name, const char* prefix)
+{
+	string_t buf;
+	type->to_string(buf, STRING_LEN);
+
+	if (!write_string(name)) return false;
+	if (!write_string(buf)) return false;
+
+	/* length of the payload, filled in by write_type_end_wrapped() */
+	int64_t len = 0;
+	if (fwrite(&len, sizeof(len), 1, m_fstream) != 1) return false;
+
+	m_stack_type.push_back(ftell(m_fstream));
+
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_type_end_wrapped(
+	const TSGDataType* type, const char* name, const char* prefix)
+{
+	long end = ftell(m_fstream);
+	long begin = m_stack_type.back();
+	m_stack_type.pop_back();
+
+	int64_t len = end - begin;
+	if (fseek(m_fstream, begin - sizeof(len), SEEK_SET) != 0) return false;
+	if (fwrite(&len, sizeof(len), 1, m_fstream) != 1) return false;
+	if (fseek(m_fstream, end, SEEK_SET) != 0) return false;
+
+	return true;
+}
+
+bool
+CSerializableBinaryFile::write_block_wrapped(
+	const TSGDataType* type, const void* data, int64_t num_bytes)
+{
+	uint8_t codec = UNCOMPRESSED;
+	const uint8_t* payload = (const uint8_t*) data;
+	int64_t stored_bytes = num_bytes;
+	uint8_t* compressed = NULL;
+
+	if (m_compression != UNCOMPRESSED
+		&& num_bytes >= BINARY_MIN_COMPRESS_SIZE) {
+		CCompressor compressor(m_compression);
+		uint64_t compressed_size = 0;
+		compressor.compress((uint8_t*) data, num_bytes, compressed,
+							compressed_size);
+
+		/* keep incompressible blocks as they are */
+		if ((int64_t) compressed_size < num_bytes) {
+			codec = m_compression;
+			payload = compressed;
+			stored_bytes = compressed_size;
+		}
+	}
+
+	bool result = fwrite(&codec, sizeof(codec), 1, m_fstream) == 1
+		&& fwrite(&num_bytes, sizeof(num_bytes), 1, m_fstream) == 1
+		&& fwrite(&stored_bytes, sizeof(stored_bytes), 1, m_fstream) == 1;
+
+	/* pad such that the payload starts at an aligned file position */
+	if (result) {
+		static const char zeros[BINARY_BLOCK_ALIGNMENT] = {0};
+		long pos = ftell(m_fstream) + 1;
+		uint8_t padding = (BINARY_BLOCK_ALIGNMENT
+						   - pos%BINARY_BLOCK_ALIGNMENT)
+			%BINARY_BLOCK_ALIGNMENT;
+
+		result = fwrite(&padding, sizeof(padding), 1, m_fstream) == 1
+			&& fwrite(zeros, 1, padding, m_fstream) == padding;
+	}
+
+	if (result && stored_bytes > 0)
+		result = fwrite(payload, 1, stored_bytes, m_fstream)
+			== (size_t) stored_bytes;
+
+	SG_FREE(compressed);
+
+	return result;
+}
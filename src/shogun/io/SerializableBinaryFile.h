@@ -0,0 +1,158 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+#ifndef __SERIALIZABLE_BINARY_FILE_H__
+#define __SERIALIZABLE_BINARY_FILE_H__
+
+#include <shogun/io/SerializableFile.h>
+#include <shogun/base/DynArray.h>
+#include <shogun/lib/Compressor.h>
+
+/** blocks smaller than this are never compressed */
+#define BINARY_MIN_COMPRESS_SIZE   4096
+/** alignment of block payloads within the file */
+#define BINARY_BLOCK_ALIGNMENT     64
+
+namespace shogun
+{
+/** @brief Serializable binary file.
+ *
+ * Compact binary serialization backend. Every parameter is stored as a
+ * record consisting of its name, its type and the length of its payload,
+ * such that records can be looked up by name and skipped when reading.
+ *
+ * Containers of non-object types (e.g. the buffers of SGVector, SGMatrix,
+ * SGString or SGSparseVector) are not written element by element but as a
+ * single contiguous block which is read back directly into the destination
+ * buffer. Blocks of at least BINARY_MIN_COMPRESS_SIZE bytes can optionally
+ * be compressed using any of the CCompressor codecs (e.g. SNAPPY or LZO if
+ * available). Uncompressed payloads start at BINARY_BLOCK_ALIGNMENT byte
+ * boundaries of the file so that they can be memory mapped.
+ *
+ * Data is stored in native byte order, files are thus not portable between
+ * architectures of different endianness.
+ */
+class CSerializableBinaryFile :public CSerializableFile
+{
+	friend class SerializableBinaryReader00;
+
+	/** file positions of the first records of the currently read objects */
+	DynArray<long> m_stack_fpos;
+	/** file positions where the currently written/read types end */
+	DynArray<long> m_stack_type;
+
+	/** compression used for blocks */
+	E_COMPRESSION_TYPE m_compression;
+
+	void init(E_COMPRESSION_TYPE compression);
+
+	bool write_string(const char* str);
+
+protected:
+
+	/** new reader
+	 * @param dest_version
+	 * @param n
+	 */
+	virtual TSerializableReader* new_reader(
+		char* dest_version, size_t n);
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+	virtual bool write_scalar_wrapped(
+		const TSGDataType* type, const void* param);
+
+	virtual bool write_cont_begin_wrapped(
+		const TSGDataType* type, index_t len_real_y,
+		index_t len_real_x);
+	virtual bool write_cont_end_wrapped(
+		const TSGDataType* type, index_t len_real_y,
+		index_t len_real_x);
+
+	virtual bool write_string_begin_wrapped(
+		const TSGDataType* type, index_t length);
+	virtual bool write_string_end_wrapped(
+		const TSGDataType* type, index_t length);
+
+	virtual bool write_stringentry_begin_wrapped(
+		const TSGDataType* type, index_t y);
+	virtual bool write_stringentry_end_wrapped(
+		const TSGDataType* type, index_t y);
+
+	virtual bool write_sparse_begin_wrapped(
+		const TSGDataType* type, index_t length);
+	virtual bool write_sparse_end_wrapped(
+		const TSGDataType* type, index_t length);
+
+	virtual bool write_sparseentry_begin_wrapped(
+		const TSGDataType* type, const SGSparseVectorEntry<char>* first_entry,
+		index_t feat_index, index_t y);
+	virtual bool write_sparseentry_end_wrapped(
+		const TSGDataType* type, const SGSparseVectorEntry<char>* first_entry,
+		index_t feat_index, index_t y);
+
+	virtual bool write_item_begin_wrapped(
+		const TSGDataType* type, index_t y, index_t x);
+	virtual bool write_item_end_wrapped(
+		const TSGDataType* type, index_t y, index_t x);
+
+	virtual bool write_sgserializable_begin_wrapped(
+		const TSGDataType* type, const char* sgserializable_name,
+		EPrimitiveType generic);
+	virtual bool write_sgserializable_end_wrapped(
+		const TSGDataType* type, const char* sgserializable_name,
+		EPrimitiveType generic);
+
+	virtual bool write_type_begin_wrapped(
+		const TSGDataType* type, const char* name,
+		const char* prefix);
+	virtual bool write_type_end_wrapped(
+		const TSGDataType* type, const char* name,
+		const char* prefix);
+
+	virtual bool write_block_wrapped(
+		const TSGDataType* type, const void* data, int64_t num_bytes);
+#endif
+public:
+	/** default constructor */
+	explicit CSerializableBinaryFile();
+
+	/** constructor
+	 *
+	 * @param fstream already opened file (must be seekable)
+	 * @param rw
+	 * @param compression compression used for blocks when writing
+	 */
+	explicit CSerializableBinaryFile(FILE* fstream, char rw,
+			E_COMPRESSION_TYPE compression=UNCOMPRESSED);
+
+	/** constructor
+	 *
+	 * @param fname filename to open
+	 * @param rw mode, 'r' or 'w'
+	 * @param compression compression used for blocks when writing
+	 */
+	explicit CSerializableBinaryFile(const char* fname, char rw='r',
+			E_COMPRESSION_TYPE compression=UNCOMPRESSED);
+
+	/** default destructor */
+	virtual ~CSerializableBinaryFile();
+
+	/** @return true, containers are written as contiguous blocks */
+	virtual bool has_block_io() { return true; }
+
+	/** @return compression used for blocks when writing */
+	E_COMPRESSION_TYPE get_compression_type() { return m_compression; }
+
+	/** @return object name */
+	virtual const char* get_name() const {
+		return "SerializableBinaryFile";
+	}
+};
+}
+
+#endif /* __SERIALIZABLE_BINARY_FILE_H__  */
@@ -0,0 +1,259 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/io/SerializableBinaryReader00.h>
+#include <shogun/lib/common.h>
+
+using namespace shogun;
+
+SerializableBinaryReader00::SerializableBinaryReader00(
+	CSerializableBinaryFile* file) { m_file = file; }
+
+SerializableBinaryReader00::~SerializableBinaryReader00() {}
+
+bool
+SerializableBinaryReader00::read_string(char* str)
+{
+	uint32_t len = 0;
+
+	if (fread(&len, sizeof(len), 1, m_file->m_fstream) != 1) return false;
+	if (len >= STRING_LEN) return false;
+	if (len > 0 && fread(str, 1, len, m_file->m_fstream) != len)
+		return false;
+
+	str[len] = '\0';
+
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_scalar_wrapped(
+	const TSGDataType* type, void* param)
+{
+	switch (type->m_ptype) {
+	case PT_SGOBJECT: case PT_UNDEFINED:
+		SG_ERROR("read_scalar_wrapped(): Implementation error during"
+				 " reading BinaryFile!");
+		return false;
+	default:
+		break;
+	}
+
+	return fread(param, type->sizeof_ptype(), 1, m_file->m_fstream) == 1;
+}
+
+bool
+SerializableBinaryReader00::read_cont_begin_wrapped(
+	const TSGDataType* type, index_t* len_read_y, index_t* len_read_x)
+{
+	if (fread(len_read_y, sizeof(index_t), 1, m_file->m_fstream) != 1)
+		return false;
+	if (fread(len_read_x, sizeof(index_t), 1, m_file->m_fstream) != 1)
+		return false;
+
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_cont_end_wrapped(
+	const TSGDataType* type, index_t len_read_y, index_t len_read_x)
+{
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_string_begin_wrapped(
+	const TSGDataType* type, index_t* length)
+{
+	return fread(length, sizeof(index_t), 1, m_file->m_fstream) == 1;
+}
+
+bool
+SerializableBinaryReader00::read_string_end_wrapped(
+	const TSGDataType* type, index_t length)
+{
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_stringentry_begin_wrapped(
+	const TSGDataType* type, index_t y)
+{
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_stringentry_end_wrapped(
+	const TSGDataType* type, index_t y)
+{
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_sparse_begin_wrapped(
+	const TSGDataType* type, index_t* length)
+{
+	return fread(length, sizeof(index_t), 1, m_file->m_fstream) == 1;
+}
+
+bool
+SerializableBinaryReader00::read_sparse_end_wrapped(
+	const TSGDataType* type, index_t length)
+{
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_sparseentry_begin_wrapped(
+	const TSGDataType* type, SGSparseVectorEntry<char>* first_entry,
+	index_t* feat_index, index_t y)
+{
+	return fread(feat_index, sizeof(index_t), 1, m_file->m_fstream) == 1;
+}
+
+bool
+SerializableBinaryReader00::read_sparseentry_end_wrapped(
+	const TSGDataType* type, SGSparseVectorEntry<char>* first_entry,
+	index_t* feat_index, index_t y)
+{
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_item_begin_wrapped(
+	const TSGDataType* type, index_t y, index_t x)
+{
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_item_end_wrapped(
+	const TSGDataType* type, index_t y, index_t x)
+{
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_sgserializable_begin_wrapped(
+	const TSGDataType* type, char* sgserializable_name,
+	EPrimitiveType* generic)
+{
+	if (!read_string(sgserializable_name)) return false;
+
+	if (*sgserializable_name != '\0') {
+		int32_t g = PT_NOT_GENERIC;
+		if (fread(&g, sizeof(g), 1, m_file->m_fstream) != 1)
+			return false;
+		*generic = (EPrimitiveType) g;
+	}
+
+	m_file->m_stack_fpos.push_back(ftell(m_file->m_fstream));
+
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_sgserializable_end_wrapped(
+	const TSGDataType* type, const char* sgserializable_name,
+	EPrimitiveType generic)
+{
+	/* the enclosing type is skipped as a whole by read_type_end_wrapped() */
+	m_file->m_stack_fpos.pop_back();
+
+	return true;
+}
+
+bool
+SerializableBinaryReader00::read_type_begin_wrapped(
+	const TSGDataType* type, const char* name, const char* prefix)
+{
+	if (fseek(m_file->m_fstream, m_file->m_stack_fpos.back(), SEEK_SET
+			) != 0) return false;
+
+	string_t type_str;
+	type->to_string(type_str, STRING_LEN);
+
+	string_t r_name, r_type;
+	while (true) {
+		int64_t len = 0;
+
+		/* an empty name marks the end of the current object */
+		if (!read_string(r_name) || *r_name == '\0') return false;
+		if (!read_string(r_type)) return false;
+		if (fread(&len, sizeof(len), 1, m_file->m_fstream) != 1)
+			return false;
+
+		if (strcmp(r_name, name) == 0
+			&& strcmp(r_type, type_str) == 0) {
+			m_file->m_stack_type.push_back(
+				ftell(m_file->m_fstream) + len);
+			return true;
+		}
+
+		if (fseek(m_file->m_fstream, len, SEEK_CUR) != 0) return false;
+	}
+
+	return false;
+}
+
+bool
+SerializableBinaryReader00::read_type_end_wrapped(
+	const TSGDataType* type, const char* name, const char* prefix)
+{
+	long end = m_file->m_stack_type.back();
+	m_file->m_stack_type.pop_back();
+
+	return fseek(m_file->m_fstream, end, SEEK_SET) == 0;
+}
+
+bool
+SerializableBinaryReader00::read_block_wrapped(
+	const TSGDataType* type, void* data, int64_t num_bytes)
+{
+	uint8_t codec = UNCOMPRESSED, padding = 0;
+	int64_t raw_bytes = 0, stored_bytes = 0;
+
+	if (fread(&codec, sizeof(codec), 1, m_file->m_fstream) != 1
+		|| fread(&raw_bytes, sizeof(raw_bytes), 1, m_file->m_fstream) != 1
+		|| fread(&stored_bytes, sizeof(stored_bytes), 1,
+				 m_file->m_fstream) != 1
+		|| fread(&padding, sizeof(padding), 1, m_file->m_fstream) != 1)
+		return false;
+
+	if (raw_bytes != num_bytes) {
+		SG_WARNING("Size of block (%ld bytes) does not match size of "
+				   "container (%ld bytes)!\n", raw_bytes, num_bytes);
+		return false;
+	}
+
+	if (fseek(m_file->m_fstream, padding, SEEK_CUR) != 0) return false;
+
+	if (stored_bytes == 0) return true;
+
+	/* uncompressed blocks are streamed directly into the destination */
+	if (codec == UNCOMPRESSED)
+		return fread(data, 1, stored_bytes, m_file->m_fstream)
+			== (size_t) stored_bytes;
+
+	uint8_t* compressed = SG_MALLOC(uint8_t, stored_bytes);
+	bool result = fread(compressed, 1, stored_bytes, m_file->m_fstream)
+		== (size_t) stored_bytes;
+
+	if (result) {
+		CCompressor compressor((E_COMPRESSION_TYPE) codec);
+		uint64_t uncompressed_size = raw_bytes;
+		compressor.decompress(compressed, stored_bytes, (uint8_t*) data,
+							  uncompressed_size);
+		result = (int64_t) uncompressed_size == raw_bytes;
+	}
+
+	SG_FREE(compressed);
+
+	return result;
+}
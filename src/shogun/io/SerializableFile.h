@@ -83,6 +83,12 @@ public:
 			const TSGDataType* type, const char* name,
 			const char* prefix) = 0;
 
+		virtual bool read_block_wrapped(
+			const TSGDataType* type, void* data, int64_t num_bytes)
+		{
+			return false;
+		}
+
 #endif
 		/* End of abstract write methods  */
 		/* ******************************************************** */
@@ -168,6 +174,12 @@ protected:
 	virtual bool write_type_end_wrapped(
 		const TSGDataType* type, const char* name,
 		const char* prefix) = 0;
+
+	virtual bool write_block_wrapped(
+		const TSGDataType* type, const void* data, int64_t num_bytes)
+	{
+		return false;
+	}
 #endif
 
 	/* End of abstract write methods  */
@@ -200,6 +212,14 @@ public:
 	/** is opened */
 	virtual bool is_opened();
 
+	/** whether this file supports reading and writing contiguous blocks of
+	 * scalars as a whole via write_block()/read_block(). If so, containers
+	 * of non-object types are not written element by element.
+	 *
+	 * @return false by default
+	 */
+	virtual bool has_block_io() { return false; }
+
 	/* ************************************************************ */
 	/* Begin of public wrappers  */
 
@@ -322,6 +342,13 @@ public:
 		const TSGDataType* type, const char* name, const char* prefix);
 	virtual bool read_type_end(
 		const TSGDataType* type, const char* name, const char* prefix);
+
+	virtual bool write_block(
+		const TSGDataType* type, const char* name, const char* prefix,
+		const void* data, int64_t num_bytes);
+	virtual bool read_block(
+		const TSGDataType* type, const char* name, const char* prefix,
+		void* data, int64_t num_bytes);
 #endif
 	/* End of public wrappers  */
 	/* ************************************************************ */
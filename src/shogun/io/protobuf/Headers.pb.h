@@ -0,0 +1,1230 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Headers.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_Headers_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_Headers_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_Headers_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_Headers_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Headers_2eproto;
+namespace shogun {
+class MatrixHeader;
+struct MatrixHeaderDefaultTypeInternal;
+extern MatrixHeaderDefaultTypeInternal _MatrixHeader_default_instance_;
+class SparseMatrixHeader;
+struct SparseMatrixHeaderDefaultTypeInternal;
+extern SparseMatrixHeaderDefaultTypeInternal _SparseMatrixHeader_default_instance_;
+class StringListHeader;
+struct StringListHeaderDefaultTypeInternal;
+extern StringListHeaderDefaultTypeInternal _StringListHeader_default_instance_;
+class VectorHeader;
+struct VectorHeaderDefaultTypeInternal;
+extern VectorHeaderDefaultTypeInternal _VectorHeader_default_instance_;
+}  // namespace shogun
+PROTOBUF_NAMESPACE_OPEN
+template<> ::shogun::MatrixHeader* Arena::CreateMaybeMessage<::shogun::MatrixHeader>(Arena*);
+template<> ::shogun::SparseMatrixHeader* Arena::CreateMaybeMessage<::shogun::SparseMatrixHeader>(Arena*);
+template<> ::shogun::StringListHeader* Arena::CreateMaybeMessage<::shogun::StringListHeader>(Arena*);
+template<> ::shogun::VectorHeader* Arena::CreateMaybeMessage<::shogun::VectorHeader>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace shogun {
+
+// ===================================================================
+
+class VectorHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.VectorHeader) */ {
+ public:
+  inline VectorHeader() : VectorHeader(nullptr) {}
+  ~VectorHeader() override;
+  explicit PROTOBUF_CONSTEXPR VectorHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VectorHeader(const VectorHeader& from);
+  VectorHeader(VectorHeader&& from) noexcept
+    : VectorHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline VectorHeader& operator=(const VectorHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VectorHeader& operator=(VectorHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VectorHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VectorHeader* internal_default_instance() {
+    return reinterpret_cast<const VectorHeader*>(
+               &_VectorHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(VectorHeader& a, VectorHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VectorHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VectorHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VectorHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VectorHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VectorHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VectorHeader& from) {
+    VectorHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VectorHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.VectorHeader";
+  }
+  protected:
+  explicit VectorHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLenFieldNumber = 1,
+    kNumMessagesFieldNumber = 2,
+  };
+  // required uint64 len = 1;
+  bool has_len() const;
+  private:
+  bool _internal_has_len() const;
+  public:
+  void clear_len();
+  uint64_t len() const;
+  void set_len(uint64_t value);
+  private:
+  uint64_t _internal_len() const;
+  void _internal_set_len(uint64_t value);
+  public:
+
+  // required uint32 num_messages = 2;
+  bool has_num_messages() const;
+  private:
+  bool _internal_has_num_messages() const;
+  public:
+  void clear_num_messages();
+  uint32_t num_messages() const;
+  void set_num_messages(uint32_t value);
+  private:
+  uint32_t _internal_num_messages() const;
+  void _internal_set_num_messages(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:shogun.VectorHeader)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t len_;
+    uint32_t num_messages_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Headers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MatrixHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.MatrixHeader) */ {
+ public:
+  inline MatrixHeader() : MatrixHeader(nullptr) {}
+  ~MatrixHeader() override;
+  explicit PROTOBUF_CONSTEXPR MatrixHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MatrixHeader(const MatrixHeader& from);
+  MatrixHeader(MatrixHeader&& from) noexcept
+    : MatrixHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline MatrixHeader& operator=(const MatrixHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MatrixHeader& operator=(MatrixHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MatrixHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MatrixHeader* internal_default_instance() {
+    return reinterpret_cast<const MatrixHeader*>(
+               &_MatrixHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(MatrixHeader& a, MatrixHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MatrixHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MatrixHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MatrixHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MatrixHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MatrixHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MatrixHeader& from) {
+    MatrixHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MatrixHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.MatrixHeader";
+  }
+  protected:
+  explicit MatrixHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNumColsFieldNumber = 1,
+    kNumRowsFieldNumber = 2,
+    kNumMessagesFieldNumber = 3,
+  };
+  // required uint64 num_cols = 1;
+  bool has_num_cols() const;
+  private:
+  bool _internal_has_num_cols() const;
+  public:
+  void clear_num_cols();
+  uint64_t num_cols() const;
+  void set_num_cols(uint64_t value);
+  private:
+  uint64_t _internal_num_cols() const;
+  void _internal_set_num_cols(uint64_t value);
+  public:
+
+  // required uint64 num_rows = 2;
+  bool has_num_rows() const;
+  private:
+  bool _internal_has_num_rows() const;
+  public:
+  void clear_num_rows();
+  uint64_t num_rows() const;
+  void set_num_rows(uint64_t value);
+  private:
+  uint64_t _internal_num_rows() const;
+  void _internal_set_num_rows(uint64_t value);
+  public:
+
+  // required uint32 num_messages = 3;
+  bool has_num_messages() const;
+  private:
+  bool _internal_has_num_messages() const;
+  public:
+  void clear_num_messages();
+  uint32_t num_messages() const;
+  void set_num_messages(uint32_t value);
+  private:
+  uint32_t _internal_num_messages() const;
+  void _internal_set_num_messages(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:shogun.MatrixHeader)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t num_cols_;
+    uint64_t num_rows_;
+    uint32_t num_messages_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Headers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SparseMatrixHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.SparseMatrixHeader) */ {
+ public:
+  inline SparseMatrixHeader() : SparseMatrixHeader(nullptr) {}
+  ~SparseMatrixHeader() override;
+  explicit PROTOBUF_CONSTEXPR SparseMatrixHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SparseMatrixHeader(const SparseMatrixHeader& from);
+  SparseMatrixHeader(SparseMatrixHeader&& from) noexcept
+    : SparseMatrixHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline SparseMatrixHeader& operator=(const SparseMatrixHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SparseMatrixHeader& operator=(SparseMatrixHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SparseMatrixHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SparseMatrixHeader* internal_default_instance() {
+    return reinterpret_cast<const SparseMatrixHeader*>(
+               &_SparseMatrixHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SparseMatrixHeader& a, SparseMatrixHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SparseMatrixHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SparseMatrixHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SparseMatrixHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SparseMatrixHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SparseMatrixHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SparseMatrixHeader& from) {
+    SparseMatrixHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SparseMatrixHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.SparseMatrixHeader";
+  }
+  protected:
+  explicit SparseMatrixHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNumFeatEntriesFieldNumber = 3,
+    kNumVectorsFieldNumber = 1,
+    kNumFeaturesFieldNumber = 2,
+  };
+  // repeated uint64 num_feat_entries = 3;
+  int num_feat_entries_size() const;
+  private:
+  int _internal_num_feat_entries_size() const;
+  public:
+  void clear_num_feat_entries();
+  private:
+  uint64_t _internal_num_feat_entries(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_num_feat_entries() const;
+  void _internal_add_num_feat_entries(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_num_feat_entries();
+  public:
+  uint64_t num_feat_entries(int index) const;
+  void set_num_feat_entries(int index, uint64_t value);
+  void add_num_feat_entries(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      num_feat_entries() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_num_feat_entries();
+
+  // required uint64 num_vectors = 1;
+  bool has_num_vectors() const;
+  private:
+  bool _internal_has_num_vectors() const;
+  public:
+  void clear_num_vectors();
+  uint64_t num_vectors() const;
+  void set_num_vectors(uint64_t value);
+  private:
+  uint64_t _internal_num_vectors() const;
+  void _internal_set_num_vectors(uint64_t value);
+  public:
+
+  // required uint64 num_features = 2;
+  bool has_num_features() const;
+  private:
+  bool _internal_has_num_features() const;
+  public:
+  void clear_num_features();
+  uint64_t num_features() const;
+  void set_num_features(uint64_t value);
+  private:
+  uint64_t _internal_num_features() const;
+  void _internal_set_num_features(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:shogun.SparseMatrixHeader)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > num_feat_entries_;
+    uint64_t num_vectors_;
+    uint64_t num_features_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Headers_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StringListHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.StringListHeader) */ {
+ public:
+  inline StringListHeader() : StringListHeader(nullptr) {}
+  ~StringListHeader() override;
+  explicit PROTOBUF_CONSTEXPR StringListHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StringListHeader(const StringListHeader& from);
+  StringListHeader(StringListHeader&& from) noexcept
+    : StringListHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline StringListHeader& operator=(const StringListHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StringListHeader& operator=(StringListHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StringListHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StringListHeader* internal_default_instance() {
+    return reinterpret_cast<const StringListHeader*>(
+               &_StringListHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(StringListHeader& a, StringListHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StringListHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StringListHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StringListHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StringListHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StringListHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StringListHeader& from) {
+    StringListHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StringListHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.StringListHeader";
+  }
+  protected:
+  explicit StringListHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStrLenFieldNumber = 3,
+    kNumStrFieldNumber = 1,
+    kMaxStringLenFieldNumber = 2,
+  };
+  // repeated uint64 str_len = 3;
+  int str_len_size() const;
+  private:
+  int _internal_str_len_size() const;
+  public:
+  void clear_str_len();
+  private:
+  uint64_t _internal_str_len(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_str_len() const;
+  void _internal_add_str_len(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_str_len();
+  public:
+  uint64_t str_len(int index) const;
+  void set_str_len(int index, uint64_t value);
+  void add_str_len(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      str_len() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_str_len();
+
+  // required uint64 num_str = 1;
+  bool has_num_str() const;
+  private:
+  bool _internal_has_num_str() const;
+  public:
+  void clear_num_str();
+  uint64_t num_str() const;
+  void set_num_str(uint64_t value);
+  private:
+  uint64_t _internal_num_str() const;
+  void _internal_set_num_str(uint64_t value);
+  public:
+
+  // required uint64 max_string_len = 2;
+  bool has_max_string_len() const;
+  private:
+  bool _internal_has_max_string_len() const;
+  public:
+  void clear_max_string_len();
+  uint64_t max_string_len() const;
+  void set_max_string_len(uint64_t value);
+  private:
+  uint64_t _internal_max_string_len() const;
+  void _internal_set_max_string_len(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:shogun.StringListHeader)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > str_len_;
+    uint64_t num_str_;
+    uint64_t max_string_len_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Headers_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// VectorHeader
+
+// required uint64 len = 1;
+inline bool VectorHeader::_internal_has_len() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool VectorHeader::has_len() const {
+  return _internal_has_len();
+}
+inline void VectorHeader::clear_len() {
+  _impl_.len_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t VectorHeader::_internal_len() const {
+  return _impl_.len_;
+}
+inline uint64_t VectorHeader::len() const {
+  // @@protoc_insertion_point(field_get:shogun.VectorHeader.len)
+  return _internal_len();
+}
+inline void VectorHeader::_internal_set_len(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.len_ = value;
+}
+inline void VectorHeader::set_len(uint64_t value) {
+  _internal_set_len(value);
+  // @@protoc_insertion_point(field_set:shogun.VectorHeader.len)
+}
+
+// required uint32 num_messages = 2;
+inline bool VectorHeader::_internal_has_num_messages() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool VectorHeader::has_num_messages() const {
+  return _internal_has_num_messages();
+}
+inline void VectorHeader::clear_num_messages() {
+  _impl_.num_messages_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t VectorHeader::_internal_num_messages() const {
+  return _impl_.num_messages_;
+}
+inline uint32_t VectorHeader::num_messages() const {
+  // @@protoc_insertion_point(field_get:shogun.VectorHeader.num_messages)
+  return _internal_num_messages();
+}
+inline void VectorHeader::_internal_set_num_messages(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.num_messages_ = value;
+}
+inline void VectorHeader::set_num_messages(uint32_t value) {
+  _internal_set_num_messages(value);
+  // @@protoc_insertion_point(field_set:shogun.VectorHeader.num_messages)
+}
+
+// -------------------------------------------------------------------
+
+// MatrixHeader
+
+// required uint64 num_cols = 1;
+inline bool MatrixHeader::_internal_has_num_cols() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MatrixHeader::has_num_cols() const {
+  return _internal_has_num_cols();
+}
+inline void MatrixHeader::clear_num_cols() {
+  _impl_.num_cols_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t MatrixHeader::_internal_num_cols() const {
+  return _impl_.num_cols_;
+}
+inline uint64_t MatrixHeader::num_cols() const {
+  // @@protoc_insertion_point(field_get:shogun.MatrixHeader.num_cols)
+  return _internal_num_cols();
+}
+inline void MatrixHeader::_internal_set_num_cols(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.num_cols_ = value;
+}
+inline void MatrixHeader::set_num_cols(uint64_t value) {
+  _internal_set_num_cols(value);
+  // @@protoc_insertion_point(field_set:shogun.MatrixHeader.num_cols)
+}
+
+// required uint64 num_rows = 2;
+inline bool MatrixHeader::_internal_has_num_rows() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MatrixHeader::has_num_rows() const {
+  return _internal_has_num_rows();
+}
+inline void MatrixHeader::clear_num_rows() {
+  _impl_.num_rows_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t MatrixHeader::_internal_num_rows() const {
+  return _impl_.num_rows_;
+}
+inline uint64_t MatrixHeader::num_rows() const {
+  // @@protoc_insertion_point(field_get:shogun.MatrixHeader.num_rows)
+  return _internal_num_rows();
+}
+inline void MatrixHeader::_internal_set_num_rows(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.num_rows_ = value;
+}
+inline void MatrixHeader::set_num_rows(uint64_t value) {
+  _internal_set_num_rows(value);
+  // @@protoc_insertion_point(field_set:shogun.MatrixHeader.num_rows)
+}
+
+// required uint32 num_messages = 3;
+inline bool MatrixHeader::_internal_has_num_messages() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool MatrixHeader::has_num_messages() const {
+  return _internal_has_num_messages();
+}
+inline void MatrixHeader::clear_num_messages() {
+  _impl_.num_messages_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t MatrixHeader::_internal_num_messages() const {
+  return _impl_.num_messages_;
+}
+inline uint32_t MatrixHeader::num_messages() const {
+  // @@protoc_insertion_point(field_get:shogun.MatrixHeader.num_messages)
+  return _internal_num_messages();
+}
+inline void MatrixHeader::_internal_set_num_messages(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.num_messages_ = value;
+}
+inline void MatrixHeader::set_num_messages(uint32_t value) {
+  _internal_set_num_messages(value);
+  // @@protoc_insertion_point(field_set:shogun.MatrixHeader.num_messages)
+}
+
+// -------------------------------------------------------------------
+
+// SparseMatrixHeader
+
+// required uint64 num_vectors = 1;
+inline bool SparseMatrixHeader::_internal_has_num_vectors() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SparseMatrixHeader::has_num_vectors() const {
+  return _internal_has_num_vectors();
+}
+inline void SparseMatrixHeader::clear_num_vectors() {
+  _impl_.num_vectors_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t SparseMatrixHeader::_internal_num_vectors() const {
+  return _impl_.num_vectors_;
+}
+inline uint64_t SparseMatrixHeader::num_vectors() const {
+  // @@protoc_insertion_point(field_get:shogun.SparseMatrixHeader.num_vectors)
+  return _internal_num_vectors();
+}
+inline void SparseMatrixHeader::_internal_set_num_vectors(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.num_vectors_ = value;
+}
+inline void SparseMatrixHeader::set_num_vectors(uint64_t value) {
+  _internal_set_num_vectors(value);
+  // @@protoc_insertion_point(field_set:shogun.SparseMatrixHeader.num_vectors)
+}
+
+// required uint64 num_features = 2;
+inline bool SparseMatrixHeader::_internal_has_num_features() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SparseMatrixHeader::has_num_features() const {
+  return _internal_has_num_features();
+}
+inline void SparseMatrixHeader::clear_num_features() {
+  _impl_.num_features_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SparseMatrixHeader::_internal_num_features() const {
+  return _impl_.num_features_;
+}
+inline uint64_t SparseMatrixHeader::num_features() const {
+  // @@protoc_insertion_point(field_get:shogun.SparseMatrixHeader.num_features)
+  return _internal_num_features();
+}
+inline void SparseMatrixHeader::_internal_set_num_features(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.num_features_ = value;
+}
+inline void SparseMatrixHeader::set_num_features(uint64_t value) {
+  _internal_set_num_features(value);
+  // @@protoc_insertion_point(field_set:shogun.SparseMatrixHeader.num_features)
+}
+
+// repeated uint64 num_feat_entries = 3;
+inline int SparseMatrixHeader::_internal_num_feat_entries_size() const {
+  return _impl_.num_feat_entries_.size();
+}
+inline int SparseMatrixHeader::num_feat_entries_size() const {
+  return _internal_num_feat_entries_size();
+}
+inline void SparseMatrixHeader::clear_num_feat_entries() {
+  _impl_.num_feat_entries_.Clear();
+}
+inline uint64_t SparseMatrixHeader::_internal_num_feat_entries(int index) const {
+  return _impl_.num_feat_entries_.Get(index);
+}
+inline uint64_t SparseMatrixHeader::num_feat_entries(int index) const {
+  // @@protoc_insertion_point(field_get:shogun.SparseMatrixHeader.num_feat_entries)
+  return _internal_num_feat_entries(index);
+}
+inline void SparseMatrixHeader::set_num_feat_entries(int index, uint64_t value) {
+  _impl_.num_feat_entries_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shogun.SparseMatrixHeader.num_feat_entries)
+}
+inline void SparseMatrixHeader::_internal_add_num_feat_entries(uint64_t value) {
+  _impl_.num_feat_entries_.Add(value);
+}
+inline void SparseMatrixHeader::add_num_feat_entries(uint64_t value) {
+  _internal_add_num_feat_entries(value);
+  // @@protoc_insertion_point(field_add:shogun.SparseMatrixHeader.num_feat_entries)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SparseMatrixHeader::_internal_num_feat_entries() const {
+  return _impl_.num_feat_entries_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SparseMatrixHeader::num_feat_entries() const {
+  // @@protoc_insertion_point(field_list:shogun.SparseMatrixHeader.num_feat_entries)
+  return _internal_num_feat_entries();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SparseMatrixHeader::_internal_mutable_num_feat_entries() {
+  return &_impl_.num_feat_entries_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SparseMatrixHeader::mutable_num_feat_entries() {
+  // @@protoc_insertion_point(field_mutable_list:shogun.SparseMatrixHeader.num_feat_entries)
+  return _internal_mutable_num_feat_entries();
+}
+
+// -------------------------------------------------------------------
+
+// StringListHeader
+
+// required uint64 num_str = 1;
+inline bool StringListHeader::_internal_has_num_str() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool StringListHeader::has_num_str() const {
+  return _internal_has_num_str();
+}
+inline void StringListHeader::clear_num_str() {
+  _impl_.num_str_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t StringListHeader::_internal_num_str() const {
+  return _impl_.num_str_;
+}
+inline uint64_t StringListHeader::num_str() const {
+  // @@protoc_insertion_point(field_get:shogun.StringListHeader.num_str)
+  return _internal_num_str();
+}
+inline void StringListHeader::_internal_set_num_str(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.num_str_ = value;
+}
+inline void StringListHeader::set_num_str(uint64_t value) {
+  _internal_set_num_str(value);
+  // @@protoc_insertion_point(field_set:shogun.StringListHeader.num_str)
+}
+
+// required uint64 max_string_len = 2;
+inline bool StringListHeader::_internal_has_max_string_len() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool StringListHeader::has_max_string_len() const {
+  return _internal_has_max_string_len();
+}
+inline void StringListHeader::clear_max_string_len() {
+  _impl_.max_string_len_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t StringListHeader::_internal_max_string_len() const {
+  return _impl_.max_string_len_;
+}
+inline uint64_t StringListHeader::max_string_len() const {
+  // @@protoc_insertion_point(field_get:shogun.StringListHeader.max_string_len)
+  return _internal_max_string_len();
+}
+inline void StringListHeader::_internal_set_max_string_len(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.max_string_len_ = value;
+}
+inline void StringListHeader::set_max_string_len(uint64_t value) {
+  _internal_set_max_string_len(value);
+  // @@protoc_insertion_point(field_set:shogun.StringListHeader.max_string_len)
+}
+
+// repeated uint64 str_len = 3;
+inline int StringListHeader::_internal_str_len_size() const {
+  return _impl_.str_len_.size();
+}
+inline int StringListHeader::str_len_size() const {
+  return _internal_str_len_size();
+}
+inline void StringListHeader::clear_str_len() {
+  _impl_.str_len_.Clear();
+}
+inline uint64_t StringListHeader::_internal_str_len(int index) const {
+  return _impl_.str_len_.Get(index);
+}
+inline uint64_t StringListHeader::str_len(int index) const {
+  // @@protoc_insertion_point(field_get:shogun.StringListHeader.str_len)
+  return _internal_str_len(index);
+}
+inline void StringListHeader::set_str_len(int index, uint64_t value) {
+  _impl_.str_len_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shogun.StringListHeader.str_len)
+}
+inline void StringListHeader::_internal_add_str_len(uint64_t value) {
+  _impl_.str_len_.Add(value);
+}
+inline void StringListHeader::add_str_len(uint64_t value) {
+  _internal_add_str_len(value);
+  // @@protoc_insertion_point(field_add:shogun.StringListHeader.str_len)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+StringListHeader::_internal_str_len() const {
+  return _impl_.str_len_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+StringListHeader::str_len() const {
+  // @@protoc_insertion_point(field_list:shogun.StringListHeader.str_len)
+  return _internal_str_len();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+StringListHeader::_internal_mutable_str_len() {
+  return &_impl_.str_len_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+StringListHeader::mutable_str_len() {
+  // @@protoc_insertion_point(field_mutable_list:shogun.StringListHeader.str_len)
+  return _internal_mutable_str_len();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace shogun
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_Headers_2eproto
@@ -278,6 +278,18 @@ public:
      */
     int32_t get_ring_size() { return ring_size; }
 
+    /**
+     * Returns the vector of an example in the ring, e.g. to free
+     * it manually if set_free_vectors_on_destruct(false) was used
+     *
+     * @param index position in the ring
+     * @return vector, NULL if none was allocated
+     */
+    T* get_ring_vector(int32_t index)
+    {
+        return examples_ring ? examples_ring->get_ring_vector(index) : NULL;
+    }
+
 private:
     /**
      * Entry point for the parse thread.
@@ -378,6 +390,7 @@ template <class T>
 	pthread_mutex_init(&examples_state_lock, NULL);
 	pthread_cond_init(&examples_state_changed, NULL);
 	examples_ring=NULL;
+	ring_size=0;
 	parsing_done=true;
 	reading_done=true;
 }
@@ -401,6 +414,7 @@ template <class T>
     else
         example_type = E_UNLABELLED;
 
+    SG_UNREF(examples_ring);
     examples_ring = new CParseBuffer<T>(size);
     SG_REF(examples_ring);
 
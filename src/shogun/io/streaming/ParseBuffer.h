@@ -165,6 +165,18 @@ public:
 		return free_vectors_on_destruct;
 	}
 
+	/**
+	 * Return the vector of an example in the ring, e.g. to
+	 * free it manually.
+	 *
+	 * @param index position in the ring
+	 * @return vector, NULL if none was allocated
+	 */
+	T* get_ring_vector(int32_t index)
+	{
+		return ex_ring[index].fv;
+	}
+
 	/**
 	 * Return the name of the object
 	 *
@@ -38,6 +38,10 @@ CStreamingVwCacheFile::~CStreamingVwCacheFile()
 
 void CStreamingVwCacheFile::get_vector(VwExample* &ex, int32_t& len)
 {
+	// slots of the parser's ring buffer start out empty
+	if (!ex)
+		ex = new VwExample();
+
 	if (cache_reader->read_cached_example(ex))
 		len = 1;
 	else
@@ -46,6 +50,10 @@ void CStreamingVwCacheFile::get_vector(VwExample* &ex, int32_t& len)
 
 void CStreamingVwCacheFile::get_vector_and_label(VwExample* &ex, int32_t &len, float64_t &label)
 {
+	// slots of the parser's ring buffer start out empty
+	if (!ex)
+		ex = new VwExample();
+
 	if (cache_reader->read_cached_example(ex))
 		len = 1;
 	else
@@ -65,6 +73,11 @@ void CStreamingVwCacheFile::set_env(CVwEnvironment* env_to_use)
 	case C_NATIVE:
 		cache_reader = new CVwNativeCacheReader(buf->working_file, env);
 		return;
+	case C_BLOCK:
+		cache_reader = new CVwBlockCacheReader(buf->working_file, env);
+		((CVwBlockCacheReader*) cache_reader)->set_shuffle(shuffle_blocks);
+		((CVwBlockCacheReader*) cache_reader)->reset();
+		return;
 	case C_PROTOBUF:
 		SG_ERROR("Protocol buffers cache support is not implemented yet!\n")
 	}
@@ -79,11 +92,22 @@ void CStreamingVwCacheFile::reset_stream()
 	// Recheck the cache so the parser can directly proceed with the examples
 	if (cache_format == C_NATIVE)
 		((CVwNativeCacheReader*) cache_reader)->check_cache_metadata();
+	else if (cache_format == C_BLOCK)
+		((CVwBlockCacheReader*) cache_reader)->reset();
+}
+
+void CStreamingVwCacheFile::set_shuffle_blocks(bool shuffle)
+{
+	shuffle_blocks = shuffle;
+
+	if (cache_format == C_BLOCK && cache_reader)
+		((CVwBlockCacheReader*) cache_reader)->set_shuffle(shuffle);
 }
 
 void CStreamingVwCacheFile::init(EVwCacheType cache_type)
 {
 	cache_format = cache_type;
+	shuffle_blocks = false;
 	env = new CVwEnvironment();
 
 	switch (cache_type)
@@ -94,6 +118,12 @@ void CStreamingVwCacheFile::init(EVwCacheType cache_type)
 		else
 			cache_reader=NULL;
 		return;
+	case C_BLOCK:
+		if (buf)
+			cache_reader = new CVwBlockCacheReader(buf->working_file, env);
+		else
+			cache_reader=NULL;
+		return;
 	case C_PROTOBUF:
 		SG_ERROR("Protocol buffers cache support is not implemented yet!\n")
 	}
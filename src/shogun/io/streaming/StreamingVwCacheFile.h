@@ -14,6 +14,7 @@
 #include <shogun/classifier/vw/vw_common.h>
 #include <shogun/classifier/vw/cache/VwCacheReader.h>
 #include <shogun/classifier/vw/cache/VwNativeCacheReader.h>
+#include <shogun/classifier/vw/cache/VwBlockCacheReader.h>
 
 namespace shogun
 {
@@ -40,7 +41,7 @@ public:
 	 * Constructor taking cache type
 	 * as an argument.
 	 *
-	 * @param cache_type cache type - C_NATIVE or C_PROTOBUF
+	 * @param cache_type cache type - C_NATIVE, C_PROTOBUF or C_BLOCK
 	 */
 	CStreamingVwCacheFile(EVwCacheType cache_type);
 
@@ -49,7 +50,7 @@ public:
 	 *
 	 * @param fname file name
 	 * @param rw read/write mode
-	 * @param cache_type type of cache - C_NATIVE or C_PROTOBUF
+	 * @param cache_type type of cache - C_NATIVE, C_PROTOBUF or C_BLOCK
 	 */
 	CStreamingVwCacheFile(char* fname, char rw='r', EVwCacheType cache_type = C_NATIVE);
 
@@ -119,6 +120,21 @@ public:
 	 */
 	void reset_stream();
 
+	/**
+	 * Set whether the blocks of a C_BLOCK cache are read
+	 * in a new random order on every pass
+	 *
+	 * @param shuffle whether to shuffle blocks
+	 */
+	void set_shuffle_blocks(bool shuffle);
+
+	/**
+	 * Get whether the blocks of a C_BLOCK cache are shuffled
+	 *
+	 * @return whether blocks are shuffled
+	 */
+	bool get_shuffle_blocks() { return shuffle_blocks; }
+
 private:
 	/**
 	 * Initialize members
@@ -136,6 +152,9 @@ protected:
 
 	/// Cache type
 	EVwCacheType cache_format;
+
+	/// Whether blocks of a C_BLOCK cache are shuffled on every pass
+	bool shuffle_blocks;
 };
 }
 #endif //__STREAMING_VWCACHEFILE_H__
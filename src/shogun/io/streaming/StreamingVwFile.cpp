@@ -53,6 +53,10 @@ void CStreamingVwFile::set_parser_type(E_VW_PARSER_TYPE type)
 
 void CStreamingVwFile::get_vector(VwExample* &ex, int32_t &len)
 {
+	// slots of the parser's ring buffer start out empty
+	if (!ex)
+		ex = new VwExample();
+
 	len = (parser->*parse_example)(buf, ex);
 	if (len == 0)
 		len = -1;	// indicates failure
@@ -60,6 +64,10 @@ void CStreamingVwFile::get_vector(VwExample* &ex, int32_t &len)
 
 void CStreamingVwFile::get_vector_and_label(VwExample* &ex, int32_t &len, float64_t &label)
 {
+	// slots of the parser's ring buffer start out empty
+	if (!ex)
+		ex = new VwExample();
+
 	len = (parser->*parse_example)(buf, ex);
 	if (len == 0)
 		len = -1;	// indicates failure
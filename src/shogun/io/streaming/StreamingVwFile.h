@@ -108,6 +108,18 @@ public:
 		parser->set_write_cache(write_cache);
 	}
 
+	/**
+	 * Write the parsed examples to a cache of the given type
+	 *
+	 * @param fname name of the cache file
+	 * @param type type of cache as one in EVwCacheType
+	 */
+	void set_cache_parameters(char* fname, EVwCacheType type = C_NATIVE)
+	{
+		write_to_cache = true;
+		parser->set_cache_parameters(fname, type);
+	}
+
 	/**
 	 * Get whether cache will be written
 	 *
@@ -166,11 +166,17 @@ bool CCombinedKernel::init(CFeatures* l, CFeatures* r)
 
 	init_normalizer();
 	initialized=true;
+
+	invalidate_subkernel_cache();
+	if (enable_subkernel_cache)
+		precompute_subkernel_cache();
+
 	return true;
 }
 
 void CCombinedKernel::remove_lhs()
 {
+	invalidate_subkernel_cache();
 	delete_optimization();
 
 	for (index_t k_idx=0; k_idx<get_num_kernels(); k_idx++)
@@ -188,6 +194,7 @@ void CCombinedKernel::remove_lhs()
 
 void CCombinedKernel::remove_rhs()
 {
+	invalidate_subkernel_cache();
 	delete_optimization();
 
 	for (index_t k_idx=0; k_idx<get_num_kernels(); k_idx++)
@@ -205,6 +212,7 @@ void CCombinedKernel::remove_rhs()
 
 void CCombinedKernel::remove_lhs_and_rhs()
 {
+	invalidate_subkernel_cache();
 	delete_optimization();
 
 	for (index_t k_idx=0; k_idx<get_num_kernels(); k_idx++)
@@ -224,6 +232,7 @@ void CCombinedKernel::remove_lhs_and_rhs()
 
 void CCombinedKernel::cleanup()
 {
+	invalidate_subkernel_cache();
 	for (index_t k_idx=0; k_idx<get_num_kernels(); k_idx++)
 	{
 		CKernel* k = get_kernel(k_idx);
@@ -256,6 +265,19 @@ void CCombinedKernel::list_kernels()
 float64_t CCombinedKernel::compute(int32_t x, int32_t y)
 {
 	float64_t result=0;
+
+	if (subkernel_cache.vector)
+	{
+		const int32_t num_kernels=subkernel_cache_weights.vlen;
+		const float32_t* values=&subkernel_cache.vector[
+			(int64_t(y)*num_lhs+x)*num_kernels];
+
+		for (index_t k_idx=0; k_idx<num_kernels; k_idx++)
+			result+=subkernel_cache_weights[k_idx]*values[k_idx];
+
+		return result;
+	}
+
 	for (index_t k_idx=0; k_idx<get_num_kernels(); k_idx++)
 	{
 		CKernel* k = get_kernel(k_idx);
@@ -716,6 +738,9 @@ void CCombinedKernel::set_subkernel_weights(SGVector<float64_t> weights)
 			ASSERT(i<weights.vlen)
 			k->set_combined_kernel_weight(weights.vector[i]);
 
+			if (subkernel_cache_weights.vector)
+				subkernel_cache_weights[i]=weights.vector[i];
+
 			SG_UNREF(k);
 			i++ ;
 		}
@@ -753,6 +778,62 @@ bool CCombinedKernel::precompute_subkernels()
 	SG_UNREF(kernel_array);
 	kernel_array=new_kernel_array;
 	SG_REF(kernel_array);
+	invalidate_subkernel_cache();
+
+	return true;
+}
+
+void CCombinedKernel::set_subkernel_cache_enabled(bool enable)
+{
+	enable_subkernel_cache=enable;
+	invalidate_subkernel_cache();
+
+	if (enable_subkernel_cache && initialized && num_lhs && num_rhs)
+		precompute_subkernel_cache();
+}
+
+bool CCombinedKernel::precompute_subkernel_cache()
+{
+	invalidate_subkernel_cache();
+
+	if (append_subkernel_weights)
+	{
+		SG_WARNING("%s::precompute_subkernel_cache(): Sub-kernel weights are "
+				"appended, not caching sub-kernels\n", get_name());
+		return false;
+	}
+
+	const int32_t num_kernels=get_num_kernels();
+	if (!num_kernels || !num_lhs || !num_rhs)
+		return false;
+
+	const int64_t num_entries=int64_t(num_lhs)*num_rhs;
+	SG_DEBUG("caching %d sub-kernel matrices of size %dx%d (%ld bytes)\n",
+			num_kernels, num_lhs, num_rhs,
+			(int64_t) (num_entries*num_kernels*sizeof(float32_t)));
+
+	SGVector<float32_t> cache(num_entries*num_kernels);
+	SGVector<float64_t> weights(num_kernels);
+
+	for (index_t k_idx=0; k_idx<num_kernels; k_idx++)
+	{
+		CKernel* k=get_kernel(k_idx);
+		weights[k_idx]=k->get_combined_kernel_weight();
+
+		/* get_kernel_matrix() is parallelized over the threads of the
+		 * sub-kernel, interleave its columns into the cache afterwards */
+		SGMatrix<float32_t> km=k->get_kernel_matrix<float32_t>();
+		ASSERT(km.num_rows==num_lhs && km.num_cols==num_rhs)
+
+		#pragma omp parallel for num_threads(parallel->get_num_threads())
+		for (int64_t i=0; i<num_entries; i++)
+			cache.vector[i*num_kernels+k_idx]=km.matrix[i];
+
+		SG_UNREF(k);
+	}
+
+	subkernel_cache=cache;
+	subkernel_cache_weights=weights;
 
 	return true;
 }
@@ -764,6 +845,7 @@ void CCombinedKernel::init()
 	sv_weight=NULL;
 	subkernel_weights_buffer=NULL;
 	initialized=false;
+	enable_subkernel_cache=false;
 
 	properties |= KP_LINADD | KP_KERNCOMBINATION | KP_BATCHEVALUATION;
 	kernel_array=new CDynamicObjectArray();
@@ -779,6 +861,8 @@ void CCombinedKernel::init()
 	    "If subkernel weights are appended.", MS_AVAILABLE);
 	SG_ADD(&initialized, "initialized", "Whether kernel is ready to be used.",
 	    MS_NOT_AVAILABLE);
+	SG_ADD(&enable_subkernel_cache, "enable_subkernel_cache",
+	    "Whether sub-kernel matrices are cached.", MS_NOT_AVAILABLE);
 }
 
 SGMatrix<float64_t> CCombinedKernel::get_parameter_gradient(
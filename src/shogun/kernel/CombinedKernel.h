@@ -149,6 +149,7 @@ class CCombinedKernel : public CKernel
 			if (!(k->has_property(KP_LINADD)))
 				unset_property(KP_LINADD);
 
+			invalidate_subkernel_cache();
 			return kernel_array->insert_element(k, idx);
 		}
 
@@ -165,6 +166,7 @@ class CCombinedKernel : public CKernel
 			if (!(k->has_property(KP_LINADD)))
 				unset_property(KP_LINADD);
 
+			invalidate_subkernel_cache();
 			int n = get_num_kernels();
 			kernel_array->push_back(k);
 			return n+1==get_num_kernels();
@@ -178,6 +180,7 @@ class CCombinedKernel : public CKernel
 		 */
 		inline bool delete_kernel(int32_t idx)
 		{
+			invalidate_subkernel_cache();
 			bool succesful_deletion = kernel_array->delete_element(idx);
 
 			if (get_num_kernels()==0)
@@ -356,6 +359,48 @@ class CCombinedKernel : public CKernel
 		/** precompute all sub-kernels */
 		bool precompute_subkernels();
 
+		/** enable/disable caching of all sub-kernel matrices in float32.
+		 *
+		 * When enabled, every sub-kernel matrix is computed once when lhs and
+		 * rhs are set and the combined kernel is afterwards evaluated as a
+		 * weighted sum over the cached values, i.e. changing the sub-kernel
+		 * weights (e.g. within MKL) does not trigger any sub-kernel
+		 * re-evaluation. Requires num_lhs*num_rhs*num_kernels*4 bytes and is
+		 * not available when sub-kernel weights are appended.
+		 *
+		 * Note that while the cache is active, sub-kernel weights have to be
+		 * changed through set_subkernel_weights().
+		 *
+		 * @param enable whether sub-kernel matrices shall be cached
+		 */
+		void set_subkernel_cache_enabled(bool enable);
+
+		/** @return whether caching of sub-kernel matrices is enabled */
+		inline bool get_subkernel_cache_enabled()
+		{
+			return enable_subkernel_cache;
+		}
+
+		/** @return whether the sub-kernel matrices are currently cached */
+		inline bool has_subkernel_cache()
+		{
+			return subkernel_cache.vector!=NULL;
+		}
+
+		/** get cached value of a sub-kernel (has_subkernel_cache() must be
+		 * true)
+		 *
+		 * @param k_idx index of sub-kernel
+		 * @param x index of lhs feature vector
+		 * @param y index of rhs feature vector
+		 * @return cached value of sub-kernel k_idx
+		 */
+		inline float64_t get_cached_subkernel(int32_t k_idx, int32_t x, int32_t y)
+		{
+			return subkernel_cache.vector[
+				(int64_t(y)*num_lhs+x)*subkernel_cache_weights.vlen+k_idx];
+		}
+
 		/** Returns a  casted version of the given kernel. Throws an error
 		 * if parameter is not of class CombinedKernel. SG_REF's the returned
 		 * kernel
@@ -449,6 +494,19 @@ class CCombinedKernel : public CKernel
 				initialized=false;
 		}
 
+		/** compute and store all sub-kernel matrices in the float32 cache
+		 *
+		 * @return if caching was successful
+		 */
+		bool precompute_subkernel_cache();
+
+		/** free the sub-kernel cache */
+		inline void invalidate_subkernel_cache()
+		{
+			subkernel_cache=SGVector<float32_t>();
+			subkernel_cache_weights=SGVector<float64_t>();
+		}
+
 	private:
 		void init();
 
@@ -467,6 +525,14 @@ class CCombinedKernel : public CKernel
 		bool append_subkernel_weights;
 		/** whether kernel is ready to be used */
 		bool initialized;
+		/** whether sub-kernel matrices shall be cached */
+		bool enable_subkernel_cache;
+		/** cached sub-kernel matrices; the values of all sub-kernels for the
+		 * pair (x,y) are stored contiguously starting at
+		 * (y*num_lhs+x)*num_kernels */
+		SGVector<float32_t> subkernel_cache;
+		/** sub-kernel weights used together with the sub-kernel cache */
+		SGVector<float64_t> subkernel_cache_weights;
 };
 }
 #endif /* _COMBINEDKERNEL_H__ */
@@ -533,6 +533,36 @@ class CKernel : public CSGObject
 			return(kernel_cache.index[cacheidx] >= 0);
 		}
 
+		/** look up a kernel value in the cached row of either vector. The
+		 * lru times are not updated, so concurrent lookups are safe as long
+		 * as the cache is not modified
+		 *
+		 * @param x index of the first vector
+		 * @param y index of the second vector
+		 * @param value set to k(x,y) if it is cached
+		 * @return if k(x,y) is cached
+		 */
+		inline bool kernel_cache_lookup(int32_t x, int32_t y, float64_t& value)
+		{
+			int32_t num_vectors=get_num_vec_lhs();
+			for (int32_t k=0; k<2; k++)
+			{
+				int32_t row=k ? y : x;
+				int32_t col=k ? x : y;
+				if (row>=num_vectors)
+					row=2*num_vectors-1-row;
+
+				if (kernel_cache.index[row]>=0 && kernel_cache.totdoc2active[col]>=0)
+				{
+					value=kernel_cache.buffer[((KERNELCACHE_IDX) kernel_cache.activenum)*
+						kernel_cache.index[row]+kernel_cache.totdoc2active[col]];
+					return true;
+				}
+			}
+
+			return false;
+		}
+
 		/** check if there is room for one more row in kernel cache
 		 *
 		 * @return if there is room for one more row in kernel cache
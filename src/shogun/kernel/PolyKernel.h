@@ -86,6 +86,9 @@ class CPolyKernel: public CDotKernel
 		/** @return degree of kernel */
 		virtual int32_t get_degree() { return degree; }
 
+		/** @return whether kernel is inhomogeneous */
+		virtual bool get_inhomogene() { return inhomogene; }
+
 	protected:
 		/** compute kernel function for features a and b
 		 * idx_{a,b} denote the index of the feature vectors
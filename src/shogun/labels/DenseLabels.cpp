@@ -63,6 +63,7 @@ void CDenseLabels::zero()
 void CDenseLabels::set_to_const(float64_t c)
 {
 	ASSERT(m_labels.vector)
+	copy_on_write(m_labels);
 	index_t subset_size=get_num_labels();
 	for (int32_t i=0; i<subset_size; i++)
 	{
@@ -162,6 +163,7 @@ bool CDenseLabels::set_label(int32_t idx, float64_t label)
 	int32_t real_num=m_subset_stack->subset_idx_conversion(idx);
 	if (m_labels.vector && real_num<get_num_labels())
 	{
+		copy_on_write(m_labels);
 		m_labels.vector[real_num]=label;
 		return true;
 	}
@@ -174,6 +176,7 @@ bool CDenseLabels::set_int_label(int32_t idx, int32_t label)
 	int32_t real_num=m_subset_stack->subset_idx_conversion(idx);
 	if (m_labels.vector && real_num<get_num_labels())
 	{
+		copy_on_write(m_labels);
 		m_labels.vector[real_num] = (float64_t)label;
 		return true;
 	}
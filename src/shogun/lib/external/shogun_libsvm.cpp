@@ -50,10 +50,6 @@
 #include <string.h>
 #include <stdarg.h>
 
-#ifdef HAVE_PTHREAD
-#include <pthread.h>
-#endif
-
 namespace shogun
 {
 
@@ -67,6 +63,8 @@ template <class S, class T> inline void clone(T*& dst, S* src, int32_t n)
 }
 #define INF HUGE_VAL
 #define TAU 1e-12
+// number of entries of a kernel column computed by one thread at once
+#define Q_BLOCK_SIZE 256
 
 class QMatrix;
 class SVC_QMC;
@@ -89,9 +87,17 @@ public:
 	int32_t get_data(const int32_t index, Qfloat **data, int32_t len);
 	void swap_index(int32_t i, int32_t j);	// future_option
 
+	// add hit, miss and memory counts to stats
+	void add_statistics(svm_cache_stats* stats) const;
+
 private:
 	int32_t l;
 	int64_t size;
+	int64_t max_size;	// size of the empty cache
+	int64_t peak_used;
+	int64_t hits;
+	int64_t misses;
+	int64_t evaluations;
 	struct head_t
 	{
 		head_t *prev, *next;	// a circular list
@@ -112,6 +118,11 @@ Cache::Cache(int32_t l_, int64_t size_):l(l_),size(size_)
 	size -= l * sizeof(head_t) / sizeof(Qfloat);
 	size = CMath::max(size, (int64_t) 2*l);	// cache must be large enough for two columns
 	lru_head.next = lru_head.prev = &lru_head;
+	max_size = size;
+	peak_used = 0;
+	hits = 0;
+	misses = 0;
+	evaluations = 0;
 }
 
 Cache::~Cache()
@@ -160,13 +171,28 @@ int32_t Cache::get_data(const int32_t index, Qfloat **data, int32_t len)
 		h->data = SG_REALLOC(Qfloat, h->data, h->len, len);
 		size -= more;
 		CMath::swap(h->len,len);
+
+		misses++;
+		evaluations += more;
+		peak_used = CMath::max(peak_used, max_size-size);
 	}
+	else
+		hits++;
 
 	lru_insert(h);
 	*data = h->data;
 	return len;
 }
 
+void Cache::add_statistics(svm_cache_stats* stats) const
+{
+	stats->hits += hits;
+	stats->misses += misses;
+	stats->evaluations += evaluations;
+	stats->peak_memory = CMath::max(stats->peak_memory,
+			(int64_t) (peak_used*sizeof(Qfloat)));
+}
+
 void Cache::swap_index(int32_t i, int32_t j)
 {
 	if(i==j) return;
@@ -210,6 +236,7 @@ public:
 	virtual Qfloat *get_Q(int32_t column, int32_t len) const = 0;
 	virtual Qfloat *get_QD() const = 0;
 	virtual void swap_index(int32_t i, int32_t j) const = 0;
+	virtual void add_cache_statistics(svm_cache_stats* stats) const {}
 	virtual ~QMatrix() {}
 
 	float64_t max_train_time;
@@ -217,17 +244,6 @@ public:
 
 class LibSVMKernel;
 
-// helper struct for threaded processing
-struct Q_THREAD_PARAM
-{
-	int32_t i;
-	int32_t start;
-	int32_t end;
-	Qfloat* data;
-	float64_t* y;
-	const LibSVMKernel* q;
-};
-
 extern Parallel* sg_parallel;
 
 class LibSVMKernel: public QMatrix {
@@ -243,93 +259,33 @@ public:
 		if(x_square) CMath::swap(x_square[i],x_square[j]);
 	}
 
-	static void* compute_Q_parallel_helper(void* p)
-	{
-		Q_THREAD_PARAM* params= (Q_THREAD_PARAM*) p;
-		int32_t i=params->i;
-		int32_t start=params->start;
-		int32_t end=params->end;
-		float64_t* y=params->y;
-		Qfloat* data=params->data;
-		const LibSVMKernel* q=params->q;
-
-		if (y) // two class
-		{
-			for(int32_t j=start;j<end;j++)
-				data[j] = (Qfloat) y[i]*y[j]*q->kernel_function(i,j);
-		}
-		else // one class, eps svr
-		{
-			for(int32_t j=start;j<end;j++)
-				data[j] = (Qfloat) q->kernel_function(i,j);
-		}
-
-		return NULL;
-	}
-
+	// fills data[start,len) of column i, the column is split into blocks
+	// of Q_BLOCK_SIZE entries that are distributed over the threads
 	void compute_Q_parallel(Qfloat* data, float64_t* lab, int32_t i, int32_t start, int32_t len) const
 	{
 		int32_t num_threads=sg_parallel->get_num_threads();
-		if (num_threads < 2)
-		{
-			Q_THREAD_PARAM params;
-			params.i=i;
-			params.start=start;
-			params.end=len;
-			params.y=lab;
-			params.data=data;
-			params.q=this;
-			compute_Q_parallel_helper((void*) &params);
-		}
-		else
-		{
-#ifdef HAVE_PTHREAD
-			int32_t total_num=(len-start);
-			pthread_t* threads = SG_MALLOC(pthread_t, num_threads-1);
-			Q_THREAD_PARAM* params = SG_MALLOC(Q_THREAD_PARAM, num_threads);
-			int32_t step= total_num/num_threads;
-
-			int32_t t;
+		if (len-start < 2*Q_BLOCK_SIZE)
+			num_threads=1;
 
-			num_threads--;
-			for (t=0; t<num_threads; t++)
-			{
-				params[t].i=i;
-				params[t].start=t*step;
-				params[t].end=(t+1)*step;
-				params[t].y=lab;
-				params[t].data=data;
-				params[t].q=this;
+		int32_t first_block=start/Q_BLOCK_SIZE;
+		int32_t num_blocks=(len+Q_BLOCK_SIZE-1)/Q_BLOCK_SIZE-first_block;
 
-				int code=pthread_create(&threads[t], NULL,
-						compute_Q_parallel_helper, (void*)&params[t]);
+		#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+		for (int32_t b=0; b<num_blocks; b++)
+		{
+			int32_t block_start=CMath::max(start, (first_block+b)*Q_BLOCK_SIZE);
+			int32_t block_end=CMath::min(len, (first_block+b+1)*Q_BLOCK_SIZE);
 
-				if (code != 0)
-				{
-					SG_SWARNING("Thread creation failed (thread %d of %d) "
-							"with error:'%s'\n",t, num_threads, strerror(code));
-					num_threads=t;
-					break;
-				}
+			if (lab) // two class
+			{
+				for(int32_t j=block_start;j<block_end;j++)
+					data[j] = (Qfloat) lab[i]*lab[j]*kernel_function(i,j);
 			}
-
-			params[t].i=i;
-			params[t].start=t*step;
-			params[t].end=len;
-			params[t].y=lab;
-			params[t].data=data;
-			params[t].q=this;
-			compute_Q_parallel_helper(&params[t]);
-
-			for (t=0; t<num_threads; t++)
+			else // one class, eps svr
 			{
-				if (pthread_join(threads[t], NULL) != 0)
-					SG_SWARNING("pthread_join of thread %d/%d failed\n", t, num_threads)
+				for(int32_t j=block_start;j<block_end;j++)
+					data[j] = (Qfloat) kernel_function(i,j);
 			}
-
-			SG_FREE(params);
-			SG_FREE(threads);
-#endif /* HAVE_PTHREAD */
 		}
 	}
 
@@ -387,6 +343,7 @@ public:
 		float64_t upper_bound_p;
 		float64_t upper_bound_n;
 		float64_t r;	// for Solver_NU
+		svm_cache_stats cache_stats;
 	};
 
 	void Solve(
@@ -788,6 +745,9 @@ void Solver::Solve(
 	p_si->upper_bound_p = Cp;
 	p_si->upper_bound_n = Cn;
 
+	memset(&p_si->cache_stats, 0, sizeof(svm_cache_stats));
+	Q->add_cache_statistics(&p_si->cache_stats);
+
 	SG_SINFO("\noptimization finished, #iter = %d\n",iter)
 
 	SG_FREE(p);
@@ -1365,6 +1325,11 @@ public:
 		return QD;
 	}
 
+	void add_cache_statistics(svm_cache_stats* stats) const
+	{
+		cache->add_statistics(stats);
+	}
+
 	void swap_index(int32_t i, int32_t j) const
 	{
 		cache->swap_index(i,j);
@@ -1726,6 +1691,11 @@ public:
 		return QD;
 	}
 
+	void add_cache_statistics(svm_cache_stats* stats) const
+	{
+		cache->add_statistics(stats);
+	}
+
 	void swap_index(int32_t i, int32_t j) const
 	{
 		cache->swap_index(i,j);
@@ -1774,6 +1744,11 @@ public:
 		return QD;
 	}
 
+	void add_cache_statistics(svm_cache_stats* stats) const
+	{
+		cache->add_statistics(stats);
+	}
+
 	void swap_index(int32_t i, int32_t j) const
 	{
 		cache->swap_index(i,j);
@@ -1844,6 +1819,11 @@ public:
 		return QD;
 	}
 
+	void add_cache_statistics(svm_cache_stats* stats) const
+	{
+		cache->add_statistics(stats);
+	}
+
 	~SVR_Q()
 	{
 		delete cache;
@@ -2057,6 +2037,7 @@ static void solve_nu_multiclass_svc(const svm_problem *prob,
 		model->rho[i]=0;
 
 	model->objective = si->obj;
+	model->cache_stats = si->cache_stats;
 
 	if (param->use_bias)
 	{
@@ -2204,6 +2185,7 @@ struct decision_function
 	float64_t *alpha;
 	float64_t rho;
 	float64_t objective;
+	svm_cache_stats cache_stats;
 };
 
 decision_function svm_train_one(
@@ -2262,6 +2244,7 @@ decision_function svm_train_one(
 	f.alpha = alpha;
 	f.rho = si.rho;
 	f.objective=si.obj;
+	f.cache_stats=si.cache_stats;
 	return f;
 }
 
@@ -2352,6 +2335,7 @@ svm_model *svm_train(const svm_problem *prob, const svm_parameter *param)
 		model->rho = SG_MALLOC(float64_t, 1);
 		model->rho[0] = f.rho;
 		model->objective = f.objective;
+		model->cache_stats = f.cache_stats;
 
 		int32_t nSV = 0;
 		int32_t i;
@@ -2487,6 +2471,16 @@ svm_model *svm_train(const svm_problem *prob, const svm_parameter *param)
 		model->objective = f[0].objective;
 		model->nr_class = nr_class;
 
+		memset(&model->cache_stats, 0, sizeof(svm_cache_stats));
+		for(i=0;i<nr_class*(nr_class-1)/2;i++)
+		{
+			model->cache_stats.hits += f[i].cache_stats.hits;
+			model->cache_stats.misses += f[i].cache_stats.misses;
+			model->cache_stats.evaluations += f[i].cache_stats.evaluations;
+			model->cache_stats.peak_memory = CMath::max(
+					model->cache_stats.peak_memory, f[i].cache_stats.peak_memory);
+		}
+
 		model->label = SG_MALLOC(int32_t, nr_class);
 		for(i=0;i<nr_class;i++)
 			model->label[i] = label[i];
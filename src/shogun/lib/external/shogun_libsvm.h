@@ -124,6 +124,19 @@ struct svm_parameter
 	bool use_bias;
 };
 
+/** statistics of the kernel column cache */
+struct svm_cache_stats
+{
+	/** number of columns found in the cache */
+	int64_t hits;
+	/** number of columns that were (partially) computed */
+	int64_t misses;
+	/** number of kernel evaluations to fill missing columns */
+	int64_t evaluations;
+	/** largest memory used by the cached columns in bytes */
+	int64_t peak_memory;
+};
+
 /** svm_model */
 struct svm_model
 {
@@ -157,6 +170,8 @@ struct svm_model
 	int32_t free_sv;
 	/** objective */
 	float64_t objective;
+	/** kernel cache statistics, summed over all subproblems */
+	svm_cache_stats cache_stats;
 };
 
 
@@ -102,7 +102,7 @@ namespace tapkee
 			 * - @ref tapkee::KernelPCA
 			 * - @ref tapkee::PCA
 			 *
-			 * Default value is @ref tapkee::Arpack if available, @ref tapkee::Dense otherwise.
+			 * Default value is @ref tapkee::Arpack if available, @ref tapkee::Lanczos otherwise.
 			 *
 			 * The corresponding value should have type
 			 * @ref tapkee::EigenMethod.
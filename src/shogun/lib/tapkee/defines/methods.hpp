@@ -129,12 +129,17 @@ namespace tapkee
 		Randomized,
 		//! Eigen library dense method (could be useful for debugging). Computes
 		//! all eigenvectors thus can be very slow doing large-scale.
-		Dense
+		Dense,
+		//! Matrix-free Lanczos method with full reorthogonalization. Needs
+		//! no external libraries and only products (or solves) with the
+		//! matrix. Generalized eigenproblems are supported for diagonal
+		//! right-hand side matrices, others fall back to Dense.
+		Lanczos
 	};
 #ifdef TAPKEE_WITH_ARPACK
 	static EigenMethod default_eigen_method = Arpack;
 #else
-	static EigenMethod default_eigen_method = Dense;
+	static EigenMethod default_eigen_method = Lanczos;
 #endif
 
 }
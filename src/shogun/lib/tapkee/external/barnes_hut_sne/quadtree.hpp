@@ -69,9 +69,6 @@ class QuadTree
 	static const int QT_NO_DIMS = 2;
 	static const int QT_NODE_CAPACITY = 1;
 
-	// A buffer we use when doing force computations
-	double buff[QT_NO_DIMS];
-
 	// Properties of this node in the tree
 	QuadTree* parent;
 	bool is_leaf;
@@ -311,9 +308,11 @@ public:
 		                             southEast->getDepth()));
 	}
 
-	// Compute non-edge forces using Barnes-Hut algorithm
-	void computeNonEdgeForces(int point_index, double theta, double neg_f[], double* sum_Q)
+	// Compute non-edge forces using Barnes-Hut algorithm (may be called
+	// concurrently for different points)
+	void computeNonEdgeForces(int point_index, double theta, double neg_f[], double* sum_Q) const
 	{
+		double buff[QT_NO_DIMS];
 
 		// Make sure that we spend no time on empty nodes or self-interactions
 		if(cum_size == 0 || (is_leaf && size == 1 && index[0] == point_index)) return;
@@ -345,12 +344,14 @@ public:
 	}
 
 	// Computes edge forces
-	void computeEdgeForces(int* row_P, int* col_P, double* val_P, int N, double* pos_f)
+	void computeEdgeForces(int* row_P, int* col_P, double* val_P, int N, double* pos_f) const
 	{
-		// Loop over all edges in the graph
-		int ind1, ind2;
-		double D;
+		// Loop over all edges in the graph, rows are independent
+#pragma omp parallel for
 		for(int n = 0; n < N; n++) {
+			double buff[QT_NO_DIMS];
+			int ind1, ind2;
+			double D;
 			ind1 = n * QT_NO_DIMS;
 			for(int i = row_P[n]; i < row_P[n + 1]; i++) {
 
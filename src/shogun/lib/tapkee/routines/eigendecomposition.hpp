@@ -139,6 +139,126 @@ EigendecompositionResult eigendecomposition_impl_randomized(const MatrixType& wm
 	return EigendecompositionResult();
 }
 
+//! Lanczos implementation of eigendecomposition-based embedding.
+//! Only products with MatrixOperationType are needed (which are solves
+//! when smallest eigenvalues are requested), so neither ARPACK nor a
+//! dense copy of the matrix is required. The Krylov subspace is extended
+//! (with full reorthogonalization) until all wanted Ritz pairs converged.
+template <class MatrixType, class MatrixOperationType>
+EigendecompositionResult eigendecomposition_impl_lanczos(const MatrixType& wm, IndexType target_dimension, unsigned int skip)
+{
+	timed_context context("Lanczos eigendecomposition");
+
+	const IndexType N = wm.rows();
+	const IndexType n_wanted = target_dimension+skip;
+	const ScalarType tolerance = 1e-10;
+	const IndexType check_every = 5;
+	MatrixOperationType operation(wm);
+
+	if (n_wanted > N)
+		throw eigendecomposition_error("eigendecomposition failed: too many eigenvectors requested");
+
+	IndexType capacity = std::min(N, std::max(2*n_wanted+1, static_cast<IndexType>(20)));
+	DenseMatrix V(N,capacity);
+	DenseVector alpha(capacity);
+	DenseVector beta(capacity);
+
+	DenseVector v(N);
+	for (IndexType i=0; i<N; i++)
+		v(i) = tapkee::gaussian_random();
+	V.col(0) = v/v.norm();
+
+	DenseSelfAdjointEigenSolver ritz;
+	IndexType m = 0;
+	bool converged = false;
+	while (!converged)
+	{
+		DenseMatrix w = operation(V.col(m));
+		alpha(m) = V.col(m).dot(w.col(0));
+		// full reorthogonalization against the whole basis, applied twice
+		// to keep the basis orthogonal in floating point
+		for (int pass=0; pass<2; pass++)
+			w -= V.leftCols(m+1)*(V.leftCols(m+1).transpose()*w);
+		beta(m) = w.norm();
+		m++;
+
+		const bool invariant = beta(m-1) <= tolerance*std::max(ScalarType(1.0),std::abs(alpha(m-1)));
+		if (m>=n_wanted && (m%check_every==0 || m==N || invariant))
+		{
+			DenseMatrix T = DenseMatrix::Zero(m,m);
+			T.diagonal() = alpha.head(m);
+			T.diagonal(1) = beta.head(m-1);
+			T.diagonal(-1) = beta.head(m-1);
+			ritz.compute(T);
+			if (ritz.info() != Eigen::Success)
+				throw eigendecomposition_error("eigendecomposition failed");
+
+			// residual norm of Ritz pair i is |beta_m * (last component of s_i)|
+			const ScalarType largest_value = ritz.eigenvalues().cwiseAbs().maxCoeff();
+			converged = true;
+			for (IndexType i=m-n_wanted; i<m && converged; i++)
+			{
+				if (std::abs(beta(m-1)*ritz.eigenvectors()(m-1,i)) > tolerance*std::max(ScalarType(1.0),largest_value))
+					converged = false;
+			}
+			if (m==N)
+				converged = true;
+		}
+		if (converged)
+			break;
+
+		if (m==capacity)
+		{
+			capacity = std::min(N,2*capacity);
+			V.conservativeResize(N,capacity);
+			alpha.conservativeResize(capacity);
+			beta.conservativeResize(capacity);
+		}
+
+		if (invariant)
+		{
+			// found an invariant subspace, continue with a random vector
+			// orthogonal to it
+			for (IndexType i=0; i<N; i++)
+				w(i,0) = tapkee::gaussian_random();
+			for (int pass=0; pass<2; pass++)
+				w -= V.leftCols(m)*(V.leftCols(m).transpose()*w);
+			beta(m-1) = 0.0;
+			V.col(m) = w.col(0)/w.norm();
+		}
+		else
+		{
+			V.col(m) = w.col(0)/beta(m-1);
+		}
+	}
+
+	std::stringstream ss;
+	ss << "Took " << m << " iterations.";
+	LoggingSingleton::instance().message_info(ss.str());
+
+	// Ritz values are sorted ascending, wanted ones are the largest
+	DenseMatrix ritz_vectors = V.leftCols(m)*ritz.eigenvectors().rightCols(n_wanted);
+	DenseVector ritz_values = ritz.eigenvalues().tail(n_wanted);
+	if (MatrixOperationType::largest)
+	{
+		assert(skip==0);
+		return EigendecompositionResult(ritz_vectors,ritz_values);
+	}
+	else
+	{
+		// largest eigenvalues of the inverse are the inverted smallest
+		// ones of the matrix, sort them ascending and skip the smallest
+		DenseMatrix selected_eigenvectors(N,target_dimension);
+		DenseVector selected_eigenvalues(target_dimension);
+		for (IndexType i=0; i<target_dimension; i++)
+		{
+			selected_eigenvectors.col(i) = ritz_vectors.col(target_dimension-1-i);
+			selected_eigenvalues(i) = 1.0/ritz_values(target_dimension-1-i);
+		}
+		return EigendecompositionResult(selected_eigenvectors,selected_eigenvalues);
+	}
+}
+
 //! Multiple implementation handler method for various eigendecomposition methods.
 //!
 //! Has three template parameters:
@@ -153,12 +273,13 @@ EigendecompositionResult eigendecomposition_impl_randomized(const MatrixType& wm
 //! implementation of operator()(DenseMatrix) which solves linear system with
 //! given right-hand side part.
 //!
-//! Currently supports three methods:
+//! Currently supports four methods:
 //!
 //! <ul>
 //! <li> Arpack
 //! <li> Randomized
 //! <li> Dense
+//! <li> Lanczos
 //! </ul>
 //!
 //! @param method one of supported eigendecomposition methods
@@ -182,6 +303,8 @@ EigendecompositionResult eigendecomposition(EigenMethod method, const MatrixType
 			return eigendecomposition_impl_randomized<MatrixType, MatrixOperationType>(m, target_dimension, skip);
 		case Dense:
 			return eigendecomposition_impl_dense<MatrixType, MatrixOperationType>(m, target_dimension, skip);
+		case Lanczos:
+			return eigendecomposition_impl_lanczos<MatrixType, MatrixOperationType>(m, target_dimension, skip);
 		default: break;
 	}
 	return EigendecompositionResult();
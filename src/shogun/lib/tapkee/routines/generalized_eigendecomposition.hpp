@@ -11,6 +11,7 @@
 	#include <shogun/lib/tapkee/utils/arpack_wrapper.hpp>
 #endif
 #include <shogun/lib/tapkee/routines/matrix_operations.hpp>
+#include <shogun/lib/tapkee/routines/eigendecomposition.hpp>
 /* End of Tapkee includes */
 
 namespace tapkee
@@ -77,6 +78,40 @@ EigendecompositionResult generalized_eigendecomposition_impl_dense(const LMatrix
 	return EigendecompositionResult();
 }
 
+//! Lanczos implementation of generalized eigendecomposition. Only
+//! diagonal right-hand side matrices can be reduced to a standard
+//! eigenproblem (see the specialization below), all other generalized
+//! eigenproblems (e.g. NPE, LPP, LLTSA) are solved by the dense method.
+template <class LMatrixType, class RMatrixType, class MatrixOperationType>
+struct generalized_eigendecomposition_impl_lanczos
+{
+	EigendecompositionResult operator()(const LMatrixType& lhs, const RMatrixType& rhs,
+			IndexType target_dimension, unsigned int skip)
+	{
+		return generalized_eigendecomposition_impl_dense<LMatrixType, RMatrixType, MatrixOperationType>(
+				lhs, rhs, target_dimension, skip);
+	}
+};
+
+//! Lanczos implementation of generalized eigendecomposition with a
+//! diagonal right-hand side matrix D (e.g. Laplacian eigenmaps). Solves
+//! the standard eigenproblem of \f$ D^{-1/2} L D^{-1/2} \f$ and maps the
+//! eigenvectors back with \f$ D^{-1/2} \f$.
+template <class MatrixOperationType>
+struct generalized_eigendecomposition_impl_lanczos<SparseWeightMatrix,DenseDiagonalMatrix,MatrixOperationType>
+{
+	EigendecompositionResult operator()(const SparseWeightMatrix& lhs, const DenseDiagonalMatrix& rhs,
+			IndexType target_dimension, unsigned int skip)
+	{
+		DenseVector inv_sqrt_rhs = rhs.diagonal().array().sqrt().inverse();
+		SparseWeightMatrix normalized_lhs = inv_sqrt_rhs.asDiagonal()*lhs*inv_sqrt_rhs.asDiagonal();
+		EigendecompositionResult result =
+			eigendecomposition_impl_lanczos<SparseWeightMatrix,MatrixOperationType>(normalized_lhs,target_dimension,skip);
+		result.first = inv_sqrt_rhs.asDiagonal()*result.first;
+		return result;
+	}
+};
+
 template <class LMatrixType, class RMatrixType, class MatrixOperationType>
 EigendecompositionResult generalized_eigendecomposition(EigenMethod method, const LMatrixType& lhs,
                                                         const RMatrixType& rhs,
@@ -94,6 +129,8 @@ EigendecompositionResult generalized_eigendecomposition(EigenMethod method, cons
 		case Randomized:
 			throw unsupported_method_error("Randomized method is not supported for generalized eigenproblems");
 			return EigendecompositionResult();
+		case Lanczos:
+			return generalized_eigendecomposition_impl_lanczos<LMatrixType, RMatrixType, MatrixOperationType>()(lhs, rhs, target_dimension, skip);
 		default: break;
 	}
 	return EigendecompositionResult();
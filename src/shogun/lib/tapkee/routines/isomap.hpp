@@ -13,6 +13,7 @@
 #include <shogun/lib/tapkee/utils/time.hpp>
 /* End of Tapkee includes */
 
+#include <algorithm>
 #include <limits>
 
 namespace tapkee
@@ -32,8 +33,10 @@ struct HeapElementComparator
 };
 #endif
 
-//! Computes shortest distances (so-called geodesic distances)
-//! using Dijkstra algorithm.
+//! Computes lengths of all edges of the neighborhood graph, stored
+//! contiguously per vector (one column per vector) so that the
+//! callback is called once per edge instead of once per edge and
+//! source vector of Dijkstra's algorithm.
 //!
 //! @param begin begin data iterator
 //! @param end end data iterator
@@ -41,105 +44,158 @@ struct HeapElementComparator
 //! @param callback distance callback
 //!
 template <class RandomAccessIterator, class DistanceCallback>
-DenseSymmetricMatrix compute_shortest_distances_matrix(const RandomAccessIterator& begin, const RandomAccessIterator& end,
+DenseMatrix compute_edge_distances(const RandomAccessIterator& begin, const RandomAccessIterator& end,
 		const Neighbors& neighbors, DistanceCallback callback)
 {
-	timed_context context("Distances shortest path relaxing");
 	const IndexType n_neighbors = neighbors[0].size();
 	const IndexType N = (end-begin);
 
-	DenseSymmetricMatrix shortest_distances(N,N);
+	DenseMatrix edge_distances(n_neighbors,N);
 
-#pragma omp parallel shared(shortest_distances,neighbors,begin,callback) default(none)
+#pragma omp parallel shared(edge_distances,neighbors,begin,callback)
 	{
-		bool* f = new bool[N];
-		bool* s = new bool[N];
-		IndexType k;
-
-#ifdef TAPKEE_USE_PRIORITY_QUEUE
-		reservable_priority_queue<HeapElement,HeapElementComparator> heap(N);
-#else
-		fibonacci_heap heap(N);
-#endif
-
+		IndexType i;
 #pragma omp for nowait
-		for (k=0; k<N; k++)
+		for (i=0; i<N; i++)
 		{
-			// fill s and f with false, fill shortest_D with infinity
-			for (IndexType j=0; j<N; j++)
-			{
-				shortest_distances(k,j) = std::numeric_limits<DenseMatrix::Scalar>::max();
-				s[j] = false;
-				f[j] = false;
-			}
-			// set distance from k to k as zero
-			shortest_distances(k,k) = 0.0;
+			for (IndexType j=0; j<n_neighbors; j++)
+				edge_distances(j,i) = callback.distance(begin[i],begin[neighbors[i][j]]);
+		}
+	}
+	return edge_distances;
+}
+
+//! Dijkstra algorithm from a single source vector.
+//!
+//! @param source index of the source vector
+//! @param neighbors neighbors of each vector
+//! @param edge_distances lengths of edges as computed by @ref compute_edge_distances
+//! @param distances (contiguous) vector to store shortest distances to
+//! @param s solution state buffer of size N
+//! @param f frontier state buffer of size N
+//! @param heap heap to use
+//!
+template <class Heap>
+void compute_shortest_distances_from(IndexType source, const Neighbors& neighbors,
+		const DenseMatrix& edge_distances, DenseVector& distances, bool* s, bool* f, Heap& heap)
+{
+	const IndexType n_neighbors = edge_distances.rows();
+	const IndexType N = distances.size();
+
+	// fill s and f with false, fill distances with infinity
+	distances.setConstant(std::numeric_limits<ScalarType>::max());
+	std::fill(s,s+N,false);
+	std::fill(f,f+N,false);
 
-			// insert kth object to heap with zero distance and set f[k] true
+	// set distance from source to source as zero
+	distances(source) = 0.0;
+
+	// insert source to heap with zero distance and set f[source] true
 #ifdef TAPKEE_USE_PRIORITY_QUEUE
-			HeapElement heap_element_of_self(k,0.0);
-			heap.push(heap_element_of_self);
+	HeapElement heap_element_of_self(source,0.0);
+	heap.push(heap_element_of_self);
 #else
-			heap.insert(k,0.0);
+	heap.insert(source,0.0);
 #endif
-			f[k] = true;
+	f[source] = true;
 
-			// while heap is not empty
-			while (!heap.empty())
-			{
-				// extract min and set (s)olution state as true and (f)rontier as false
+	// while heap is not empty
+	while (!heap.empty())
+	{
+		// extract min and set (s)olution state as true and (f)rontier as false
 #ifdef TAPKEE_USE_PRIORITY_QUEUE
-				int min_item = heap.top().first;
-				ScalarType min_item_d = heap.top().second;
-				heap.pop();
-				if (min_item_d > shortest_distances(k,min_item))
-					continue;
+		int min_item = heap.top().first;
+		ScalarType min_item_d = heap.top().second;
+		heap.pop();
+		if (min_item_d > distances(min_item))
+			continue;
 #else
-				ScalarType tmp;
-				int min_item = heap.extract_min(tmp);
+		ScalarType tmp;
+		int min_item = heap.extract_min(tmp);
 #endif
 
-				s[min_item] = true;
-				f[min_item] = false;
+		s[min_item] = true;
+		f[min_item] = false;
 
-				// for-each edge (min_item->w)
-				for (IndexType i=0; i<n_neighbors; i++)
+		const LocalNeighbors& current_neighbors = neighbors[min_item];
+		const ScalarType* current_edges = edge_distances.data() + min_item*n_neighbors;
+
+		// for-each edge (min_item->w)
+		for (IndexType i=0; i<n_neighbors; i++)
+		{
+			// get w idx
+			int w = current_neighbors[i];
+			// if w is not in solution yet
+			if (s[w] == false)
+			{
+				// get distance from source to w through min_item
+				ScalarType dist = distances(min_item) + current_edges[i];
+				// if distance can be relaxed
+				if (dist < distances(w))
 				{
-					// get w idx
-					int w = neighbors[min_item][i];
-					// if w is not in solution yet
-					if (s[w] == false)
-					{
-						// get distance from k to i through min_item
-						ScalarType dist = shortest_distances(k,min_item) + callback.distance(begin[min_item],begin[w]);
-						// if distance can be relaxed
-						if (dist < shortest_distances(k,w))
-						{
-							// relax distance
-							shortest_distances(k,w) = dist;
+					// relax distance
+					distances(w) = dist;
 #ifdef TAPKEE_USE_PRIORITY_QUEUE
-							HeapElement relaxed_heap_element(w,dist);
-							heap.push(relaxed_heap_element);
-							f[w] = true;
+					HeapElement relaxed_heap_element(w,dist);
+					heap.push(relaxed_heap_element);
+					f[w] = true;
 #else
-							// if w is in (f)rontier
-							if (f[w])
-							{
-								// decrease distance in heap
-								heap.decrease_key(w, dist);
-							}
-							else
-							{
-								// insert w to heap and set (f)rontier as true
-								heap.insert(w, dist);
-								f[w] = true;
-							}
-#endif
-						}
+					// if w is in (f)rontier
+					if (f[w])
+					{
+						// decrease distance in heap
+						heap.decrease_key(w, dist);
 					}
+					else
+					{
+						// insert w to heap and set (f)rontier as true
+						heap.insert(w, dist);
+						f[w] = true;
+					}
+#endif
 				}
 			}
-			heap.clear();
+		}
+	}
+	heap.clear();
+}
+
+//! Computes shortest distances (so-called geodesic distances)
+//! using Dijkstra algorithm.
+//!
+//! @param begin begin data iterator
+//! @param end end data iterator
+//! @param neighbors neighbors of each vector
+//! @param callback distance callback
+//!
+template <class RandomAccessIterator, class DistanceCallback>
+DenseSymmetricMatrix compute_shortest_distances_matrix(const RandomAccessIterator& begin, const RandomAccessIterator& end,
+		const Neighbors& neighbors, DistanceCallback callback)
+{
+	timed_context context("Distances shortest path relaxing");
+	const IndexType N = (end-begin);
+
+	const DenseMatrix edge_distances = compute_edge_distances(begin,end,neighbors,callback);
+	DenseSymmetricMatrix shortest_distances(N,N);
+
+#pragma omp parallel shared(shortest_distances,neighbors,edge_distances)
+	{
+		bool* f = new bool[N];
+		bool* s = new bool[N];
+		DenseVector distances(N);
+		IndexType k;
+
+#ifdef TAPKEE_USE_PRIORITY_QUEUE
+		reservable_priority_queue<HeapElement,HeapElementComparator> heap(N);
+#else
+		fibonacci_heap heap(N);
+#endif
+
+#pragma omp for schedule(dynamic) nowait
+		for (k=0; k<N; k++)
+		{
+			compute_shortest_distances_from(k,neighbors,edge_distances,distances,s,f,heap);
+			shortest_distances.row(k) = distances.transpose();
 		}
 
 		delete[] s;
@@ -149,7 +205,9 @@ DenseSymmetricMatrix compute_shortest_distances_matrix(const RandomAccessIterato
 }
 
 //! Computes shortest distances (so-called geodesic distances)
-//! using Dijkstra algorithm with landmarks.
+//! using Dijkstra algorithm with landmarks. Landmarks are
+//! processed concurrently, each thread working on its own
+//! contiguous distances buffer and heap.
 //!
 //! @param begin begin data iterator
 //! @param end end data iterator
@@ -162,16 +220,17 @@ DenseMatrix compute_shortest_distances_matrix(const RandomAccessIterator& begin,
 		const Landmarks& landmarks, const Neighbors& neighbors, DistanceCallback callback)
 {
 	timed_context context("Distances shortest path relaxing");
-	const IndexType n_neighbors = neighbors[0].size();
 	const IndexType N = end-begin;
 	const IndexType N_landmarks = landmarks.size();
 
+	const DenseMatrix edge_distances = compute_edge_distances(begin,end,neighbors,callback);
 	DenseMatrix shortest_distances(landmarks.size(),N);
 
-#pragma omp parallel shared(shortest_distances,begin,landmarks,neighbors,callback) default(none)
+#pragma omp parallel shared(shortest_distances,landmarks,neighbors,edge_distances)
 	{
 		bool* f = new bool[N];
 		bool* s = new bool[N];
+		DenseVector distances(N);
 		IndexType k;
 
 #ifdef TAPKEE_USE_PRIORITY_QUEUE
@@ -180,84 +239,11 @@ DenseMatrix compute_shortest_distances_matrix(const RandomAccessIterator& begin,
 		fibonacci_heap heap(N);
 #endif
 
-#pragma omp for nowait
+#pragma omp for schedule(dynamic) nowait
 		for (k=0; k<N_landmarks; k++)
 		{
-			// fill s and f with false, fill shortest_D with infinity
-			for (IndexType j=0; j<N; j++)
-			{
-				shortest_distances(k,j) = std::numeric_limits<DenseMatrix::Scalar>::max();
-				s[j] = false;
-				f[j] = false;
-			}
-			// set distance from k to k as zero
-			shortest_distances(k,landmarks[k]) = 0.0;
-
-			// insert kth object to heap with zero distance and set f[k] true
-#ifdef TAPKEE_USE_PRIORITY_QUEUE
-			HeapElement heap_element_of_self(landmarks[k],0.0);
-			heap.push(heap_element_of_self);
-#else
-			heap.insert(landmarks[k],0.0);
-#endif
-			f[k] = true;
-
-			// while heap is not empty
-			while (!heap.empty())
-			{
-				// extract min and set (s)olution state as true and (f)rontier as false
-#ifdef TAPKEE_USE_PRIORITY_QUEUE
-				int min_item = heap.top().first;
-				ScalarType min_item_d = heap.top().second;
-				heap.pop();
-				if (min_item_d > shortest_distances(k,min_item))
-					continue;
-#else
-				ScalarType tmp;
-				int min_item = heap.extract_min(tmp);
-#endif
-
-				s[min_item] = true;
-				f[min_item] = false;
-
-				// for-each edge (min_item->w)
-				for (IndexType i=0; i<n_neighbors; i++)
-				{
-					// get w idx
-					int w = neighbors[min_item][i];
-					// if w is not in solution yet
-					if (s[w] == false)
-					{
-						// get distance from k to i through min_item
-						ScalarType dist = shortest_distances(k,min_item) + callback.distance(begin[min_item],begin[w]);
-						// if distance can be relaxed
-						if (dist < shortest_distances(k,w))
-						{
-							// relax distance
-							shortest_distances(k,w) = dist;
-#ifdef TAPKEE_USE_PRIORITY_QUEUE
-							HeapElement relaxed_heap_element(w,dist);
-							heap.push(relaxed_heap_element);
-							f[w] = true;
-#else
-							// if w is in (f)rontier
-							if (f[w])
-							{
-								// decrease distance in heap
-								heap.decrease_key(w, dist);
-							}
-							else
-							{
-								// insert w to heap and set (f)rontier as true
-								heap.insert(w, dist);
-								f[w] = true;
-							}
-#endif
-						}
-					}
-				}
-			}
-			heap.clear();
+			compute_shortest_distances_from(landmarks[k],neighbors,edge_distances,distances,s,f,heap);
+			shortest_distances.row(k) = distances.transpose();
 		}
 
 		delete[] s;
@@ -83,7 +83,7 @@ CDenseFeatures<float64_t>* shogun::tapkee_embed(const shogun::TAPKEE_PARAMETERS_
 #ifdef HAVE_ARPACK
 	tapkee::EigenMethod eigen_method = tapkee::Arpack;
 #else
-	tapkee::EigenMethod eigen_method = tapkee::Dense;
+	tapkee::EigenMethod eigen_method = tapkee::Lanczos;
 #endif
 	tapkee::NeighborsMethod neighbors_method = tapkee::CoverTree;
 	size_t N = 0;
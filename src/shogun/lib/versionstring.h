@@ -0,0 +1,11 @@
+#define MAINVERSION "3.1.1"
+
+#define VERSION_EXTRA ""
+#define VERSION_REVISION 0xe15cce1
+#define VERSION_RELEASE "git_e15cce1_2026-10-18_23:34"
+#define VERSION_YEAR 2026
+#define VERSION_MONTH 10
+#define VERSION_DAY 18
+#define VERSION_HOUR 23
+#define VERSION_MINUTE 34
+#define VERSION_PARAMETER 1
@@ -10,6 +10,9 @@
 
 #include <shogun/machine/BaggingMachine.h>
 #include <shogun/base/Parameter.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/Random.h>
+#include <shogun/base/init.h>
 
 using namespace shogun;
 
@@ -38,7 +41,6 @@ CBaggingMachine::~CBaggingMachine()
 	SG_UNREF(m_features);
 	SG_UNREF(m_combination_rule);
 	SG_UNREF(m_bags);
-	SG_UNREF(m_oob_indices);
 }
 
 CBinaryLabels* CBaggingMachine::apply_binary(CFeatures* data)
@@ -118,21 +120,56 @@ bool CBaggingMachine::train_machine(CFeatures* data)
 	m_all_oob_idx = SGVector<bool>(m_features->get_num_vectors());
 	m_all_oob_idx.zero();
 
-	SG_UNREF(m_oob_indices);
-	m_oob_indices = new CDynamicObjectArray();
+	/* every bag is drawn from its own random stream, such that bags can be
+	 * drawn in parallel and regenerated independently later on */
+	m_bag_seeds = SGVector<uint32_t>(m_num_bags);
+	for (int32_t i = 0; i < m_num_bags; ++i)
+		m_bag_seeds[i] = (uint32_t) CMath::random();
 
-	/*
-	  TODO: enable multi-threaded learning. This requires views support
-		on CFeatures
-	#pragma omp parallel for num_threads(parallel->get_num_threads())
-	*/
+	/* the machines draw from CMath, which uses a generator of its own for
+	 * every bag, so the trained bags do not depend on the thread schedule */
+	CRandom** rngs = SG_MALLOC(CRandom*, m_num_bags);
 	for (int32_t i = 0; i < m_num_bags; ++i)
 	{
-		CMachine* c = dynamic_cast<CMachine*>(m_machine->clone());
+		rngs[i] = new CRandom((uint32_t) CMath::random());
+		SG_REF(rngs[i]);
+	}
+
+	/* bags are trained in parallel, each on its own view of the training
+	 * data that shares the feature matrix and the labels and has the bag
+	 * as subset. Labels that cannot be viewed are trained on one bag after
+	 * the other */
+	CDenseLabels* dense_labels = dynamic_cast<CDenseLabels*>(m_labels);
+	int32_t num_threads = 1;
+	if (dense_labels && (m_labels->get_label_type() == LT_BINARY ||
+			m_labels->get_label_type() == LT_MULTICLASS ||
+			m_labels->get_label_type() == LT_REGRESSION))
+		num_threads = parallel->get_num_threads();
+
+	CMachine** machines = SG_MALLOC(CMachine*, m_num_bags);
+
+	#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+	for (int32_t i = 0; i < m_num_bags; ++i)
+	{
+		CMachine* c = NULL;
+		#pragma omp critical
+		c = dynamic_cast<CMachine*>(m_machine->clone());
 		ASSERT(c != NULL);
-		SGVector<index_t> idx(m_bag_size);
-		idx.random(0, m_features->get_num_vectors()-1);
-		m_labels->add_subset(idx);
+
+		SGVector<index_t> counts = get_bag_counts(i);
+		SGVector<index_t> idx = get_bag_indices(counts);
+
+		CFeatures* features = m_features;
+		CLabels* labels = m_labels;
+		if (num_threads > 1)
+		{
+			features = m_features->duplicate();
+			labels = get_label_view(dense_labels);
+			SG_REF(features);
+			SG_REF(labels);
+		}
+
+		labels->add_subset(idx);
 		/* TODO:
 		   if it's a binary labeling ensure that
 		   there's always samples of both classes
@@ -149,23 +186,68 @@ bool CBaggingMachine::train_machine(CFeatures* data)
 			}
 		}
 		*/
-		m_features->add_subset(idx);
-		c->set_labels(m_labels);
-		c->train(m_features);
-		m_features->remove_subset();
-		m_labels->remove_subset();
+		features->add_subset(idx);
+		c->set_labels(labels);
+		set_thread_rand(rngs[i]);
+		c->train(features);
+		set_thread_rand(NULL);
+		features->remove_subset();
+		labels->remove_subset();
+
+		if (num_threads > 1)
+		{
+			SG_UNREF(features);
+			SG_UNREF(labels);
+		}
+
+		machines[i] = c;
+	}
 
-		// get out of bag indexes
-		CDynamicArray<index_t>* oob = get_oob_indices(idx);
-		m_oob_indices->push_back(oob);
+	for (int32_t i = 0; i < m_num_bags; ++i)
+	{
+		// mark the vectors that are out of this bag
+		SGVector<index_t> counts = get_bag_counts(i);
+		for (index_t j = 0; j < counts.vlen; j++)
+		{
+			if (counts[j] == 0)
+				m_all_oob_idx[j] = true;
+		}
 
 		// add trained machine to bag array
-		m_bags->append_element(c);
+		m_bags->append_element(machines[i]);
+		SG_UNREF(rngs[i]);
 	}
+	SG_FREE(machines);
+	SG_FREE(rngs);
 
 	return true;
 }
 
+CDenseLabels* CBaggingMachine::get_label_view(CDenseLabels* labels) const
+{
+	CDenseLabels* view = NULL;
+	switch (labels->get_label_type())
+	{
+		case LT_BINARY:
+			view = new CBinaryLabels();
+			break;
+
+		case LT_MULTICLASS:
+			view = new CMulticlassLabels();
+			break;
+
+		case LT_REGRESSION:
+			view = new CRegressionLabels();
+			break;
+
+		default:
+			return NULL;
+	}
+
+	view->set_labels(labels->get_labels());
+	return view;
+}
+
 void CBaggingMachine::register_parameters()
 {
 	SG_ADD((CSGObject**)&m_features, "features", "Train features for bagging",
@@ -177,8 +259,8 @@ void CBaggingMachine::register_parameters()
 		"Combination rule to use for aggregating", MS_AVAILABLE);
 	SG_ADD(&m_all_oob_idx, "all_oob_idx", "Indices of all oob vectors",
 			MS_NOT_AVAILABLE);
-	SG_ADD((CSGObject**)&m_oob_indices, "oob_indices",
-			"OOB indices for each machine", MS_NOT_AVAILABLE);
+	SG_ADD(&m_bag_seeds, "bag_seeds",
+			"Seeds the bags of each machine are drawn from", MS_NOT_AVAILABLE);
 }
 
 void CBaggingMachine::set_num_bags(int32_t num_bags)
@@ -224,7 +306,7 @@ void CBaggingMachine::init()
 	m_num_bags = 0;
 	m_bag_size = 0;
 	m_all_oob_idx = SGVector<bool>();
-	m_oob_indices = NULL;
+	m_bag_seeds = SGVector<uint32_t>();
 }
 
 void CBaggingMachine::set_combination_rule(CCombinationRule* rule)
@@ -245,46 +327,46 @@ float64_t CBaggingMachine::get_oob_error(CEvaluation* eval) const
 	REQUIRE(m_combination_rule != NULL, "Combination rule is not set!");
 	REQUIRE(m_bags->get_num_elements() > 0, "BaggingMachine is not trained!");
 
-	SGMatrix<float64_t> output(m_features->get_num_vectors(), m_bags->get_num_elements());
+	// indices of all vectors that are out of bag for at least one machine
+	DynArray<index_t> idx;
+	for (index_t i = 0; i < m_features->get_num_vectors(); i++)
+	{
+		if (m_all_oob_idx[i])
+			idx.push_back(i);
+	}
+
+	int32_t num_bags = m_bags->get_num_elements();
+	SGMatrix<float64_t> output(idx.get_num_elements(), num_bags);
 	if (m_labels->get_label_type() == LT_REGRESSION)
 		output.zero();
 	else
 		output.set_const(NAN);
 
-	/* TODO: add parallel support of applying the OOBs
-	  only possible when add_subset is thread-safe
-	#pragma omp parallel for num_threads(parallel->get_num_threads())
-	*/
-	for (index_t i = 0; i < m_bags->get_num_elements(); i++)
+	/* all machines are applied in parallel to the same subset of the
+	 * features, which is only read. Each bag keeps the outputs of its out of
+	 * bag vectors in its own column of the output */
+	m_features->add_subset(SGVector<index_t>(idx.get_array(), idx.get_num_elements(), false));
+
+	#pragma omp parallel for num_threads(parallel->get_num_threads()) schedule(dynamic)
+	for (index_t i = 0; i < num_bags; i++)
 	{
 		CMachine* m = dynamic_cast<CMachine*>(m_bags->get_element(i));
-		CDynamicArray<index_t>* current_oob
-			= dynamic_cast<CDynamicArray<index_t>*>(m_oob_indices->get_element(i));
-
-		SGVector<index_t> oob(current_oob->get_array(), current_oob->get_num_elements(), false);
-		oob.display_vector();
-		m_features->add_subset(oob);
-
 		CLabels* l = m->apply(m_features);
 		SGVector<float64_t> lv = l->get_values();
+		SGVector<index_t> counts = get_bag_counts(i);
 
 		// assign the values in the matrix (NAN) that are in-bag!
-		for (index_t j = 0; j < oob.vlen; j++)
-			output(oob[j], i) = lv[j];
+		for (index_t j = 0; j < lv.vlen; j++)
+		{
+			if (counts[idx[j]] == 0)
+				output(j, i) = lv[j];
+		}
 
-		m_features->remove_subset();
-		SG_UNREF(current_oob);
-		SG_UNREF(m);
 		SG_UNREF(l);
+		SG_UNREF(m);
 	}
-	output.display_matrix();
 
-	DynArray<index_t> idx;
-	for (index_t i = 0; i < m_features->get_num_vectors(); i++)
-	{
-		if (m_all_oob_idx[i])
-			idx.push_back(i);
-	}
+	m_features->remove_subset();
 
 	SGVector<float64_t> combined = m_combination_rule->combine(output);
 	CLabels* predicted = NULL;
@@ -309,37 +391,33 @@ float64_t CBaggingMachine::get_oob_error(CEvaluation* eval) const
 	m_labels->add_subset(SGVector<index_t>(idx.get_array(), idx.get_num_elements(), false));
 	float64_t res = eval->evaluate(predicted, m_labels);
 	m_labels->remove_subset();
+	SG_UNREF(predicted);
 
 	return res;
 }
 
-CDynamicArray<index_t>* CBaggingMachine::get_oob_indices(const SGVector<index_t>& in_bag)
+SGVector<index_t> CBaggingMachine::get_bag_counts(int32_t bag) const
 {
-	SGVector<bool> out_of_bag(m_features->get_num_vectors());
-	out_of_bag.set_const(true);
+	index_t num_vectors = m_features->get_num_vectors();
+	SGVector<index_t> counts(num_vectors);
+	counts.zero();
 
-	// mark the ones that are in_bag
-	index_t oob_count = m_features->get_num_vectors();
-	for (index_t i = 0; i < in_bag.vlen; i++)
-	{
-		if (out_of_bag[in_bag[i]])
-		{
-			out_of_bag[in_bag[i]] = false;
-			oob_count--;
-		}
-	}
+	CRandom rng(m_bag_seeds[bag]);
+	for (index_t i = 0; i < m_bag_size; i++)
+		counts[rng.random(0, num_vectors-1)]++;
+
+	return counts;
+}
 
-	CDynamicArray<index_t>* oob = new CDynamicArray<index_t>();
-	// store the indicies of vectors that are out of the bag
-	for (index_t i = 0; i < out_of_bag.vlen; i++)
+SGVector<index_t> CBaggingMachine::get_bag_indices(const SGVector<index_t>& counts) const
+{
+	SGVector<index_t> in_bag(m_bag_size);
+	index_t k = 0;
+	for (index_t i = 0; i < counts.vlen; i++)
 	{
-		if (out_of_bag[i])
-		{
-			oob->push_back(i);
-			m_all_oob_idx[i] = true;
-		}
+		for (index_t j = 0; j < counts[i]; j++)
+			in_bag[k++] = i;
 	}
 
-	return oob;
+	return in_bag;
 }
-
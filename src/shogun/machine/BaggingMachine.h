@@ -20,6 +20,12 @@ namespace shogun
 	/**
 	 * @brief: Bagging algorithm
 	 * i.e. bootstrap aggregating
+	 *
+	 * Bags are not stored as index sets. Each bag is drawn from its own
+	 * seeded random stream and represented by the number of times each
+	 * vector is in the bag, which is regenerated from the seed whenever the
+	 * bag or its out-of-bag vectors are needed. The machines are trained and
+	 * the out-of-bag predictions are computed in parallel over the bags.
      */
 	class CBaggingMachine : public CMachine
 	{
@@ -133,15 +139,31 @@ namespace shogun
 			void init();
 
 			/**
-			 * get the vector of indices for feature vectors that are out of bag
+			 * draw the bag of a machine from its seed, i.e. sample bag size
+			 * vectors with replacement
 			 *
-			 * @param in_bag vector of indices that are in bag.
-			 * NOTE: in_bag is a randomly generated with replacement
-			 * @return
+			 * @param bag index of the bag
+			 * @return number of times each feature vector is in the bag
 			 */
-			CDynamicArray<index_t>* get_oob_indices(const SGVector<index_t>& in_bag);
+			SGVector<index_t> get_bag_counts(int32_t bag) const;
 
-			void clear_oob_indicies();
+			/**
+			 * get the (sorted) indices of the feature vectors that are in bag
+			 *
+			 * @param counts bag counts, see get_bag_counts
+			 * @return indices of vectors in bag, repeated as often as drawn
+			 */
+			SGVector<index_t> get_bag_indices(const SGVector<index_t>& counts) const;
+
+			/**
+			 * create labels of the same type that share the given labels,
+			 * such that a subset can be set on them independently
+			 *
+			 * @param labels labels to view
+			 * @return new labels sharing the label vector, NULL if the
+			 * label type is not supported
+			 */
+			CDenseLabels* get_label_view(CDenseLabels* labels) const;
 
 		private:
 			/** bags array */
@@ -165,8 +187,10 @@ namespace shogun
 			/** indices of all feature vectors that are out of bag */
 			SGVector<bool> m_all_oob_idx;
 
-			/** array of oob indices */
-			CDynamicObjectArray* m_oob_indices;
+			/** seeds of the random streams the bags are drawn from.
+			 * Bags (and their out-of-bag vectors) are not stored but
+			 * regenerated from these seeds when needed */
+			SGVector<uint32_t> m_bag_seeds;
 	};
 }
 
@@ -11,26 +11,15 @@
 
 #include <shogun/machine/KernelMachine.h>
 #include <shogun/lib/Signal.h>
+#include <shogun/mathematics/Math.h>
 #include <shogun/labels/RegressionLabels.h>
 #include <shogun/base/Parameter.h>
 #include <shogun/base/ParameterMap.h>
 
 using namespace shogun;
 
-#ifndef DOXYGEN_SHOULD_SKIP_THIS
-struct S_THREAD_PARAM_KERNEL_MACHINE
-{
-	CKernelMachine* kernel_machine;
-	float64_t* result;
-	int32_t start;
-	int32_t end;
-
-	/* if non-null, start and end correspond to indices in this vector */
-	index_t* indices;
-	index_t indices_len;
-	bool verbose;
-};
-#endif // DOXYGEN_SHOULD_SKIP_THIS
+/* number of test vectors for which the expansion is computed at once */
+#define APPLY_BLOCK_SIZE 64
 
 CKernelMachine::CKernelMachine() : CMachine()
 {
@@ -329,61 +318,7 @@ SGVector<float64_t> CKernelMachine::apply_get_outputs(CFeatures* data)
 
 		}
 		else
-		{
-			int32_t num_threads=parallel->get_num_threads();
-			ASSERT(num_threads>0)
-
-			if (num_threads < 2)
-			{
-				S_THREAD_PARAM_KERNEL_MACHINE params;
-				params.kernel_machine=this;
-				params.result = output.vector;
-				params.start=0;
-				params.end=num_vectors;
-				params.verbose=true;
-				params.indices = NULL;
-				params.indices_len = 0;
-				apply_helper((void*) &params);
-			}
-#ifdef HAVE_PTHREAD
-			else
-			{
-				pthread_t* threads = SG_MALLOC(pthread_t, num_threads-1);
-				S_THREAD_PARAM_KERNEL_MACHINE* params = SG_MALLOC(S_THREAD_PARAM_KERNEL_MACHINE, num_threads);
-				int32_t step= num_vectors/num_threads;
-
-				int32_t t;
-
-				for (t=0; t<num_threads-1; t++)
-				{
-					params[t].kernel_machine = this;
-					params[t].result = output.vector;
-					params[t].start = t*step;
-					params[t].end = (t+1)*step;
-					params[t].verbose = false;
-					params[t].indices = NULL;
-					params[t].indices_len = 0;
-					pthread_create(&threads[t], NULL,
-							CKernelMachine::apply_helper, (void*)&params[t]);
-				}
-
-				params[t].kernel_machine = this;
-				params[t].result = output.vector;
-				params[t].start = t*step;
-				params[t].end = num_vectors;
-				params[t].verbose = true;
-				params[t].indices = NULL;
-				params[t].indices_len = 0;
-				apply_helper((void*) &params[t]);
-
-				for (t=0; t<num_threads-1; t++)
-					pthread_join(threads[t], NULL);
-
-				SG_FREE(params);
-				SG_FREE(threads);
-			}
-#endif
-		}
+			apply_blocks(output.vector, num_vectors, NULL);
 
 #ifndef WIN32
 		if ( CSignal::cancel_computations() )
@@ -418,33 +353,218 @@ float64_t CKernelMachine::apply_one(int32_t num)
 	}
 }
 
-void* CKernelMachine::apply_helper(void* p)
+void CKernelMachine::apply_blocks(float64_t* output, int32_t num_vectors,
+		index_t* indices)
 {
-	S_THREAD_PARAM_KERNEL_MACHINE* params = (S_THREAD_PARAM_KERNEL_MACHINE*) p;
-	float64_t* result = params->result;
-	CKernelMachine* kernel_machine = params->kernel_machine;
+	int32_t num_threads=parallel->get_num_threads();
+	ASSERT(num_threads>0)
 
-#ifdef WIN32
-	for (int32_t vec=params->start; vec<params->end; vec++)
-#else
-	for (int32_t vec=params->start; vec<params->end &&
-			!CSignal::cancel_computations(); vec++)
+	/* without linadd the expansion is evaluated here instead of in apply_one,
+	 * support vector by support vector for a whole block of test vectors,
+	 * such that every support vector is touched once per block. Director
+	 * machines may override apply_one and always go through it. */
+	bool expand=!(kernel->has_property(KP_LINADD) && kernel->get_is_initialized())
+		&& get_classifier_type()!=CT_DIRECTORKERNEL;
+	int32_t num_svs=get_num_support_vectors();
+
+	/* blocks are distributed in rounds, progress and cancellation are
+	 * handled between the rounds */
+	int32_t round=APPLY_BLOCK_SIZE*num_threads*4;
+	for (int32_t round_start=0; round_start<num_vectors; round_start+=round)
+	{
+#ifndef WIN32
+		if (CSignal::cancel_computations())
+			break;
 #endif
+		int32_t round_end=CMath::min(round_start+round, num_vectors);
+		int32_t num_blocks=(round_end-round_start+APPLY_BLOCK_SIZE-1)/APPLY_BLOCK_SIZE;
+
+		#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+		for (int32_t b=0; b<num_blocks; b++)
+		{
+			int32_t start=round_start+b*APPLY_BLOCK_SIZE;
+			int32_t end=CMath::min(start+APPLY_BLOCK_SIZE, round_end);
+
+			if (!expand)
+			{
+				/* eventually use index mapping if exists */
+				for (int32_t vec=start; vec<end; vec++)
+					output[vec]=apply_one(indices ? indices[vec] : vec);
+				continue;
+			}
+
+			for (int32_t vec=start; vec<end; vec++)
+				output[vec]=0;
+
+			for (int32_t i=0; i<num_svs; i++)
+			{
+				int32_t sv=m_svs.vector[i];
+				float64_t alpha=m_alpha.vector[i];
+				for (int32_t vec=start; vec<end; vec++)
+					output[vec]+=kernel->kernel(sv, indices ? indices[vec] : vec)*alpha;
+			}
+
+			for (int32_t vec=start; vec<end; vec++)
+				output[vec]+=m_bias;
+		}
+
+		SG_PROGRESS(round_end, 0, num_vectors)
+	}
+}
+
+float64_t CKernelMachine::compress_support_vectors(float64_t max_error,
+		int32_t max_num_svs)
+{
+	REQUIRE(kernel, "%s::compress_support_vectors(): No kernel assigned!\n",
+			get_name())
+	REQUIRE(!is_data_locked(), "%s::compress_support_vectors(): Machine is "
+			"locked, call data_unlock() before!\n", get_name())
+	REQUIRE(max_error>=0, "%s::compress_support_vectors(): Error bound (%f) "
+			"has to be non-negative\n", get_name(), max_error)
+
+	int32_t num_svs=get_num_support_vectors();
+	if (max_num_svs<=0 || max_num_svs>num_svs)
+		max_num_svs=num_svs;
+
+	if (!num_svs)
+		return 0;
+
+	CFeatures* lhs=kernel->get_lhs();
+	CFeatures* rhs=kernel->get_rhs();
+	REQUIRE(lhs, "%s::compress_support_vectors(): No left hand side "
+			"specified\n", get_name())
+
+	/* kernel between support vectors */
+	kernel->init(lhs, lhs);
+	int32_t num_threads=parallel->get_num_threads();
+
+	/* c_i=<r,phi(x_i)> of the residual r=w-P(w) of the normal vector after
+	 * projection onto the span of the selected support vectors and d_i the
+	 * squared norm of phi(x_i)-P(phi(x_i)). Initially r=w, i.e. c=K*alpha */
+	SGVector<float64_t> c(num_svs);
+	SGVector<float64_t> d(num_svs);
+	#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+	for (int32_t i=0; i<num_svs; i++)
+	{
+		float64_t sum=0;
+		for (int32_t j=0; j<num_svs; j++)
+			sum+=kernel->kernel(m_svs.vector[i], m_svs.vector[j])*m_alpha.vector[j];
+
+		c[i]=sum;
+		d[i]=kernel->kernel(m_svs.vector[i], m_svs.vector[i]);
+	}
+
+	float64_t norm=0;
+	float64_t max_diag=0;
+	for (int32_t i=0; i<num_svs; i++)
+	{
+		norm+=m_alpha[i]*c[i];
+		max_diag=CMath::max(max_diag, d[i]);
+	}
+
+	/* orthogonal matching pursuit in feature space: greedily add the support
+	 * vector that reduces ||r||^2 the most, which is c_i^2/d_i. The projection
+	 * is maintained by a pivoted Cholesky factorisation G of the kernel
+	 * matrix, with gamma the coefficients of w in its orthonormal basis */
+	int32_t capacity=CMath::min(max_num_svs, 64);
+	float64_t* G=SG_MALLOC(float64_t, int64_t(num_svs)*capacity);
+	SGVector<int32_t> pivots(max_num_svs);
+	SGVector<float64_t> gamma(max_num_svs);
+	float64_t residual=norm;
+	int32_t num_selected=0;
+
+	float64_t error=norm>0 ? 1.0 : 0.0;
+
+	while (num_selected<max_num_svs && error>max_error)
 	{
-		if (params->verbose)
+		int32_t p=-1;
+		float64_t best=0;
+		for (int32_t i=0; i<num_svs; i++)
 		{
-			int32_t num_vectors=params->end - params->start;
-			int32_t v=vec-params->start;
-			if ( (v% (num_vectors/100+1))== 0)
-				SG_SPROGRESS(v, 0.0, num_vectors-1)
+			if (d[i]>1e-12*max_diag && c[i]*c[i]/d[i]>best)
+			{
+				best=c[i]*c[i]/d[i];
+				p=i;
+			}
 		}
 
-		/* eventually use index mapping if exists */
-		index_t idx=params->indices ? params->indices[vec] : vec;
-		result[vec] = kernel_machine->apply_one(idx);
+		if (p<0)
+			break;
+
+		if (num_selected==capacity)
+		{
+			int32_t new_capacity=CMath::min(2*capacity, max_num_svs);
+			G=SG_REALLOC(float64_t, G, int64_t(num_svs)*capacity,
+					int64_t(num_svs)*new_capacity);
+			capacity=new_capacity;
+		}
+
+		float64_t* col=G+int64_t(num_svs)*num_selected;
+		float64_t scale=1.0/CMath::sqrt(d[p]);
+		float64_t g=0;
+
+		#pragma omp parallel for num_threads(num_threads) reduction(+:g)
+		for (int32_t i=0; i<num_svs; i++)
+		{
+			float64_t v=kernel->kernel(m_svs.vector[i], m_svs.vector[p]);
+			for (int32_t k=0; k<num_selected; k++)
+				v-=G[int64_t(num_svs)*k+i]*G[int64_t(num_svs)*k+p];
+
+			col[i]=v*scale;
+			g+=m_alpha.vector[i]*col[i];
+		}
+
+		for (int32_t i=0; i<num_svs; i++)
+		{
+			c[i]-=g*col[i];
+			d[i]-=col[i]*col[i];
+		}
+		d[p]=0;
+
+		pivots[num_selected]=p;
+		gamma[num_selected]=g;
+		residual-=g*g;
+		num_selected++;
+		error=CMath::sqrt(CMath::max(residual, 0.0)/norm);
+	}
+
+	/* the selected support vectors span the basis through the triangular
+	 * rows of G at the pivots, solve G_Z^T beta=gamma for their weights */
+	SGVector<float64_t> beta(num_selected);
+	SGVector<int32_t> svs(num_selected);
+	for (int32_t j=num_selected-1; j>=0; j--)
+	{
+		float64_t sum=gamma[j];
+		for (int32_t k=j+1; k<num_selected; k++)
+			sum-=G[int64_t(num_svs)*j+pivots[k]]*beta[k];
+
+		beta[j]=sum/G[int64_t(num_svs)*j+pivots[j]];
+		svs[j]=m_svs[pivots[j]];
+	}
+	SG_FREE(G);
+
+	SG_INFO("Compressed %d support vectors to %d, relative error %f\n",
+			num_svs, num_selected, error)
+
+	set_alphas(beta);
+	set_support_vectors(svs);
+
+	/* restore previous right hand side */
+	if (rhs)
+		kernel->init(lhs, rhs);
+	else
+		kernel->remove_rhs();
+
+	SG_UNREF(lhs);
+	SG_UNREF(rhs);
+
+	if (kernel->get_is_initialized())
+	{
+		kernel->delete_optimization();
+		init_kernel_optimization();
 	}
 
-	return NULL;
+	return error;
 }
 
 void CKernelMachine::store_model_features()
@@ -545,67 +665,7 @@ SGVector<float64_t> CKernelMachine::apply_locked_get_output(
 		io->disable_progress();
 
 	/* custom kernel never has batch evaluation property so dont do this here */
-	int32_t num_threads=parallel->get_num_threads();
-	ASSERT(num_threads>0)
-
-	if (num_threads<2)
-	{
-		S_THREAD_PARAM_KERNEL_MACHINE params;
-		params.kernel_machine=this;
-		params.result=output.vector;
-
-		/* use the parameter index vector */
-		params.start=0;
-		params.end=num_inds;
-		params.indices=indices.vector;
-		params.indices_len=indices.vlen;
-
-		params.verbose=true;
-		apply_helper((void*) &params);
-	}
-#ifdef HAVE_PTHREAD
-	else
-	{
-		pthread_t* threads = SG_MALLOC(pthread_t, num_threads-1);
-		S_THREAD_PARAM_KERNEL_MACHINE* params=SG_MALLOC(S_THREAD_PARAM_KERNEL_MACHINE, num_threads);
-		int32_t step= num_inds/num_threads;
-
-		int32_t t;
-		for (t=0; t<num_threads-1; t++)
-		{
-			params[t].kernel_machine=this;
-			params[t].result=output.vector;
-
-			/* use the parameter index vector */
-			params[t].start=t*step;
-			params[t].end=(t+1)*step;
-			params[t].indices=indices.vector;
-			params[t].indices_len=indices.vlen;
-
-			params[t].verbose=false;
-			pthread_create(&threads[t], NULL, CKernelMachine::apply_helper,
-					(void*)&params[t]);
-		}
-
-		params[t].kernel_machine=this;
-		params[t].result=output.vector;
-
-		/* use the parameter index vector */
-		params[t].start=t*step;
-		params[t].end=num_inds;
-		params[t].indices=indices.vector;
-		params[t].indices_len=indices.vlen;
-
-		params[t].verbose=true;
-		apply_helper((void*) &params[t]);
-
-		for (t=0; t<num_threads-1; t++)
-			pthread_join(threads[t], NULL);
-
-		SG_FREE(params);
-		SG_FREE(threads);
-	}
-#endif
+	apply_blocks(output.vector, num_inds, indices.vector);
 
 #ifndef WIN32
 	if ( CSignal::cancel_computations() )
@@ -227,12 +227,25 @@ class CKernelMachine : public CMachine
 		 */
 		virtual float64_t apply_one(int32_t num);
 
-		/** apply example helper, used in threads
-		 *
-		 * @param p params of the thread
-		 * @return nothing really
-		 */
-		static void* apply_helper(void* p);
+		/** Compresses the kernel expansion after training by a reduced set of
+		 * the support vectors with re-fitted coefficients.
+		 *
+		 * Support vectors are selected greedily (orthogonal matching pursuit
+		 * in feature space) until the normal vector \f$w'\f$ of the reduced
+		 * expansion is close to the original \f$w\f$, i.e.
+		 * \f$\|w-w'\|\le\epsilon\|w\|\f$. Outputs then change by at most
+		 * \f$\epsilon\|w\|\sqrt{k({\bf x},{\bf x})}\f$, which for RBF
+		 * kernels is a uniform bound. Costs \f$O(N^2)\f$ kernel evaluations
+		 * for the \f$N\f$ support vectors and \f$O(NM)\f$ memory for the
+		 * \f$M\f$ selected ones. The bias is kept.
+		 *
+		 * @param max_error relative error bound \f$\epsilon\f$
+		 * @param max_num_svs maximum number of support vectors to keep, 0
+		 * for no limit
+		 * @return relative error of the compressed expansion
+		 */
+		float64_t compress_support_vectors(float64_t max_error,
+				int32_t max_num_svs=0);
 
 		/** Trains a locked machine on a set of indices. Error if machine is
 		 * not locked
@@ -293,6 +306,15 @@ class CKernelMachine : public CMachine
 		 */
 		SGVector<float64_t> apply_get_outputs(CFeatures* data);
 
+		/** computes outputs for blocks of vectors in parallel
+		 *
+		 * @param output array to store the outputs in
+		 * @param num_vectors number of vectors to compute outputs for
+		 * @param indices optional index mapping of the vectors, may be NULL
+		 */
+		void apply_blocks(float64_t* output, int32_t num_vectors,
+				index_t* indices);
+
 		/** Stores feature data of the SV indices and sets it to the lhs of the
 		 * underlying kernel. Then, all SV indices are set to identity.
 		 *
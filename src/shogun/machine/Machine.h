@@ -87,7 +87,8 @@ enum EMachineType
 	CT_GAUSSIANPROCESSBINARY = 530,
 	CT_GAUSSIANPROCESSMULTICLASS = 540,
 	CT_STOCHASTICSOSVM = 550,
-	CT_BAGGING
+	CT_BAGGING,
+	CT_HISTOGRAMTREEENSEMBLE
 };
 
 /** solver type */
@@ -143,22 +143,35 @@ CMulticlassLabels* CMulticlassMachine::apply_multiclass(CFeatures* data)
 				outputs[i]->scores_to_probabilities(0,0);
 		}
 
-		SGVector<float64_t> output_for_i(num_machines);
-		SGVector<float64_t> r_output_for_i(num_machines);
-		if (heuris!=PROB_HEURIS_NONE)
-			r_output_for_i.resize_vector(num_classes);
-
-		for (int32_t i=0; i<num_vectors; i++)
+		if (heuris==PROB_HEURIS_NONE)
 		{
+			/* outputs are used as they are, so that the strategy may
+			 * decide on all vectors at once */
+			SGMatrix<float64_t> all_outputs(num_machines, num_vectors);
 			for (int32_t j=0; j<num_machines; j++)
-				output_for_i[j] = outputs[j]->get_value(i);
+			{
+				for (int32_t i=0; i<num_vectors; i++)
+					all_outputs(j,i) = outputs[j]->get_value(i);
+			}
 
-			if (heuris==PROB_HEURIS_NONE)
+			SGVector<int32_t> labels=m_multiclass_strategy->decide_labels(all_outputs);
+			for (int32_t i=0; i<num_vectors; i++)
 			{
-				r_output_for_i = output_for_i;
+				result->set_label(i, labels[i]);
+				result->set_multiclass_confidences(i, SGVector<float64_t>(
+						all_outputs.get_column_vector(i), num_machines, false));
 			}
-			else
+		}
+		else
+		{
+			SGVector<float64_t> output_for_i(num_machines);
+			SGVector<float64_t> r_output_for_i(num_classes);
+
+			for (int32_t i=0; i<num_vectors; i++)
 			{
+				for (int32_t j=0; j<num_machines; j++)
+					output_for_i[j] = outputs[j]->get_value(i);
+
 				if (heuris==OVA_SOFTMAX)
 					m_multiclass_strategy->rescale_outputs(output_for_i,As,Bs);
 				else
@@ -170,11 +183,11 @@ CMulticlassLabels* CMulticlassMachine::apply_multiclass(CFeatures* data)
 
 				SG_DEBUG("%s::apply_multiclass(): sum(r_output_for_i) = %f\n",
 					get_name(), SGVector<float64_t>::sum(r_output_for_i.vector,num_classes));
-			}
 
-			// use rescaled outputs for label decision
-			result->set_label(i, m_multiclass_strategy->decide_label(r_output_for_i));
-			result->set_multiclass_confidences(i, r_output_for_i);
+				// use rescaled outputs for label decision
+				result->set_label(i, m_multiclass_strategy->decide_label(r_output_for_i));
+				result->set_multiclass_confidences(i, r_output_for_i);
+			}
 		}
 
 		for (int32_t i=0; i < num_machines; ++i)
@@ -77,10 +77,7 @@ SGVector<float64_t> CProbitLikelihood::get_log_probability_f(const CLabels* lab,
 	// compute log pobability: log(normal_cdf(f.*y))
 	eigen_r=eigen_y.cwiseProduct(eigen_f);
 
-	for (index_t i=0; i<eigen_r.size(); i++)
-		eigen_r[i]=CStatistics::lnormal_cdf(eigen_r[i]);
-
-	return r;
+	return CStatistics::lnormal_cdf(r);
 }
 
 SGVector<float64_t> CProbitLikelihood::get_log_probability_derivative_f(
@@ -103,10 +100,9 @@ SGVector<float64_t> CProbitLikelihood::get_log_probability_derivative_f(
 	Map<VectorXd> eigen_r(r.vector, r.vlen);
 
 	// compute ncdf=normal_cdf(y.*f)
-	VectorXd eigen_ncdf=eigen_y.cwiseProduct(eigen_f);
-
-	for (index_t j=0; j<eigen_ncdf.size(); j++)
-		eigen_ncdf[j]=CStatistics::normal_cdf(eigen_ncdf[j]);
+	eigen_r=eigen_y.cwiseProduct(eigen_f);
+	SGVector<float64_t> ncdf=CStatistics::normal_cdf(r);
+	Map<VectorXd> eigen_ncdf(ncdf.vector, ncdf.vlen);
 
 	// compute npdf=normal_pdf(f)=(1/sqrt(2*pi))*exp(-f.^2/2)
 	VectorXd eigen_npdf=(1.0/CMath::sqrt(2.0*CMath::PI))*
@@ -177,10 +173,7 @@ SGVector<float64_t> CProbitLikelihood::get_log_zeroth_moments(
 	// compute: lp=log(normal_cdf((mu.*y)./sqrt(1+sigma^2)))
 	eigen_r=eigen_mu.array()*eigen_y.array()/((1.0+eigen_s2.array()).sqrt());
 
-	for (index_t i=0; i<eigen_r.size(); i++)
-		eigen_r[i]=CStatistics::lnormal_cdf(eigen_r[i]);
-
-	return r;
+	return CStatistics::lnormal_cdf(r);
 }
 
 float64_t CProbitLikelihood::get_first_moment(SGVector<float64_t> mu,
@@ -132,6 +132,9 @@ namespace shogun
 {
 	/** random number generator */
 	extern CRandom* sg_rand;
+	/** random number generator of the calling thread, see set_thread_rand() */
+	extern CRandom* sg_thread_rand;
+#pragma omp threadprivate(sg_thread_rand)
 	class CSGObject;
 /** @brief Class which collects generic mathematical functions
  */
@@ -525,44 +528,51 @@ class CMath : public CSGObject
 			sg_rand->set_seed(seed);
 		}
 
+		/** @return random number generator of the calling thread if one
+		 * is set, the global one otherwise */
+		static inline CRandom* get_rand()
+		{
+			return sg_thread_rand ? sg_thread_rand : sg_rand;
+		}
+
 		static inline uint64_t random()
 		{
-			return sg_rand->random_64();
+			return get_rand()->random_64();
 		}
 
 		static inline uint64_t random(uint64_t min_value, uint64_t max_value)
 		{
-			return sg_rand->random(min_value, max_value);
+			return get_rand()->random(min_value, max_value);
 		}
 
 		static inline int64_t random(int64_t min_value, int64_t max_value)
 		{
-			return sg_rand->random(min_value, max_value);
+			return get_rand()->random(min_value, max_value);
 		}
 
 		static inline uint32_t random(uint32_t min_value, uint32_t max_value)
 		{
-			return sg_rand->random(min_value, max_value);
+			return get_rand()->random(min_value, max_value);
 		}
 
 		static inline int32_t random(int32_t min_value, int32_t max_value)
 		{
-			return sg_rand->random(min_value, max_value);
+			return get_rand()->random(min_value, max_value);
 		}
 
 		static inline float32_t random(float32_t min_value, float32_t max_value)
 		{
-			return sg_rand->random(min_value, max_value);
+			return get_rand()->random(min_value, max_value);
 		}
 
 		static inline float64_t random(float64_t min_value, float64_t max_value)
 		{
-			return sg_rand->random(min_value, max_value);
+			return get_rand()->random(min_value, max_value);
 		}
 
 		static inline floatmax_t random(floatmax_t min_value, floatmax_t max_value)
 		{
-			return sg_rand->random(min_value, max_value);
+			return get_rand()->random(min_value, max_value);
 		}
 
 		/// Returns a Gaussian or Normal random number.
@@ -593,7 +603,7 @@ class CMath : public CSGObject
 		/// http://en.wikipedia.org/wiki/Box%E2%80%93Muller_transform#Polar_form
 		static inline float64_t normal_random(float64_t mean, float64_t std_dev)
 		{
-			return sg_rand->normal_distrib(mean, std_dev);
+			return get_rand()->normal_distrib(mean, std_dev);
 		}
 
 		/// Convenience method for generating Standard Normal random numbers
@@ -607,7 +617,7 @@ class CMath : public CSGObject
 		/// Double: Mean = 0 and Standard Deviation = 1
 		static inline float64_t randn_double()
 		{
-			return sg_rand->std_normal_distrib();
+			return get_rand()->std_normal_distrib();
 		}
 
 		template <class T>
@@ -24,6 +24,9 @@
 #include <shogun/mathematics/lapack.h>
 #endif //HAVE_LAPACK
 
+#include <shogun/base/init.h>
+#include <shogun/base/Parallel.h>
+
 #ifdef HAVE_EIGEN3
 #include <shogun/mathematics/eigen3.h>
 using namespace Eigen;
@@ -2353,3 +2356,209 @@ CStatistics::SigmoidParamters CStatistics::fit_sigmoid(SGVector<float64_t> score
 	SG_SDEBUG("leaving CStatistics::fit_sigmoid()\n")
 	return result;
 }
+
+/* vectors shorter than this are evaluated by a single thread */
+#define STATISTICS_PARALLEL_MIN_LEN 16384
+
+/* number of threads for evaluating a vector of given length */
+static int32_t batch_num_threads(index_t len)
+{
+	if (len<STATISTICS_PARALLEL_MIN_LEN)
+		return 1;
+
+	Parallel* parallel=get_global_parallel();
+	int32_t num_threads=parallel->get_num_threads();
+	SG_UNREF(parallel);
+
+	return num_threads;
+}
+
+/* number of threads for evaluating a function that calls lgamma, which is
+ * only thread safe as lgamma_r */
+static int32_t lgamma_batch_num_threads(index_t len)
+{
+#ifdef HAVE_LGAMMA_R
+	return batch_num_threads(len);
+#else
+	return 1;
+#endif // HAVE_LGAMMA_R
+}
+
+/* error_function() for 0<=x<0.5 */
+static inline float64_t erf_small(float64_t x)
+{
+	float64_t xsq=x*x;
+	float64_t p=0.007547728033418631287834;
+	p=0.288805137207594084924010+xsq*p;
+	p=14.3383842191748205576712+xsq*p;
+	p=38.0140318123903008244444+xsq*p;
+	p=3017.82788536507577809226+xsq*p;
+	p=7404.07142710151470082064+xsq*p;
+	p=80437.3630960840172832162+xsq*p;
+	float64_t q=0.0;
+	q=1.00000000000000000000000+xsq*q;
+	q=38.0190713951939403753468+xsq*q;
+	q=658.070155459240506326937+xsq*q;
+	q=6379.60017324428279487120+xsq*q;
+	q=34216.5257924628539769006+xsq*q;
+	q=80437.3630960840172826266+xsq*q;
+	return 1.1283791670955125738961589031*x*p/q;
+}
+
+/* error_function_complement() for 0.5<=x<10 */
+static inline float64_t erfc_large(float64_t x)
+{
+	float64_t p=0.0;
+	p=0.5641877825507397413087057563+x*p;
+	p=9.675807882987265400604202961+x*p;
+	p=77.08161730368428609781633646+x*p;
+	p=368.5196154710010637133875746+x*p;
+	p=1143.262070703886173606073338+x*p;
+	p=2320.439590251635247384768711+x*p;
+	p=2898.0293292167655611275846+x*p;
+	p=1826.3348842295112592168999+x*p;
+	float64_t q=1.0;
+	q=17.14980943627607849376131193+x*q;
+	q=137.1255960500622202878443578+x*q;
+	q=661.7361207107653469211984771+x*q;
+	q=2094.384367789539593790281779+x*q;
+	q=4429.612803883682726711528526+x*q;
+	q=6089.5424232724435504633068+x*q;
+	q=4958.82756472114071495438422+x*q;
+	q=1826.3348842295112595576438+x*q;
+	return CMath::exp(-x*x)*p/q;
+}
+
+/* error_function() without branches, all cases are computed */
+static inline float64_t erf_select(float64_t x)
+{
+	float64_t ax=CMath::abs(x);
+	float64_t s=CMath::sign(x);
+	float64_t small=s*erf_small(ax);
+	float64_t large=s*(1-erfc_large(ax));
+
+	return ax<0.5 ? small : (ax>=10 ? s : large);
+}
+
+/* error_function_complement() without branches */
+static inline float64_t erfc_select(float64_t x)
+{
+	float64_t ax=CMath::abs(x);
+	float64_t small=1.0-erf_small(ax);
+	float64_t large=erfc_large(ax);
+	float64_t result=ax<0.5 ? small : (ax>=10 ? 0.0 : large);
+
+	return x<0 ? 2-result : result;
+}
+
+SGVector<float64_t> CStatistics::error_function(SGVector<float64_t> x)
+{
+	SGVector<float64_t> result(x.vlen);
+
+	#pragma omp parallel for num_threads(batch_num_threads(x.vlen))
+	for (index_t i=0; i<x.vlen; i++)
+		result[i]=erf_select(x[i]);
+
+	return result;
+}
+
+SGVector<float64_t> CStatistics::error_function_complement(
+		SGVector<float64_t> x)
+{
+	SGVector<float64_t> result(x.vlen);
+
+	#pragma omp parallel for num_threads(batch_num_threads(x.vlen))
+	for (index_t i=0; i<x.vlen; i++)
+		result[i]=erfc_select(x[i]);
+
+	return result;
+}
+
+SGVector<float64_t> CStatistics::normal_cdf(SGVector<float64_t> x,
+		float64_t std_dev)
+{
+	SGVector<float64_t> result(x.vlen);
+
+	#pragma omp parallel for num_threads(batch_num_threads(x.vlen))
+	for (index_t i=0; i<x.vlen; i++)
+		result[i]=0.5*(erf_select(x[i]/std_dev/1.41421356237309504880)+1);
+
+	return result;
+}
+
+SGVector<float64_t> CStatistics::lnormal_cdf(SGVector<float64_t> x)
+{
+	SGVector<float64_t> result(x.vlen);
+	const float64_t log_sqrt_2pi=0.5*CMath::log(2*CMath::PI);
+
+	#pragma omp parallel for num_threads(batch_num_threads(x.vlen))
+	for (index_t i=0; i<x.vlen; i++)
+	{
+		// asymptotic expansion for x<-10, see scalar version
+		float64_t x2=x[i]*x[i];
+		float64_t s=1.0-1.0/x2*(1.0-3.0/x2*(1.0-5.0/x2*(1.0-7.0/x2)));
+		float64_t tail=-log_sqrt_2pi-x2*0.5-CMath::log(-x[i])+CMath::log(s);
+		float64_t body=CMath::log(0.5*(erf_select(x[i]/1.41421356237309504880)+1));
+
+		result[i]=x[i]<-10.0 ? tail : body;
+	}
+
+	return result;
+}
+
+SGVector<float64_t> CStatistics::inverse_normal_cdf(SGVector<float64_t> y0,
+		float64_t mean, float64_t std_dev)
+{
+	SGVector<float64_t> result(y0.vlen);
+
+	#pragma omp parallel for num_threads(batch_num_threads(y0.vlen))
+	for (index_t i=0; i<y0.vlen; i++)
+		result[i]=inverse_normal_cdf(y0[i])*std_dev+mean;
+
+	return result;
+}
+
+SGVector<float64_t> CStatistics::lgamma(SGVector<float64_t> x)
+{
+	SGVector<float64_t> result(x.vlen);
+
+	#pragma omp parallel for num_threads(lgamma_batch_num_threads(x.vlen))
+	for (index_t i=0; i<x.vlen; i++)
+		result[i]=lgamma(x[i]);
+
+	return result;
+}
+
+SGVector<float64_t> CStatistics::incomplete_gamma(float64_t a,
+		SGVector<float64_t> x)
+{
+	SGVector<float64_t> result(x.vlen);
+
+	#pragma omp parallel for num_threads(lgamma_batch_num_threads(x.vlen))
+	for (index_t i=0; i<x.vlen; i++)
+		result[i]=incomplete_gamma(a, x[i]);
+
+	return result;
+}
+
+SGVector<float64_t> CStatistics::incomplete_beta(float64_t a, float64_t b,
+		SGVector<float64_t> x)
+{
+	// check the domain here, errors cannot be raised in parallel
+	if (!(greater(a, 0) && greater(b, 0)))
+		SG_SERROR("CStatistics::incomplete_beta(): Domain error\n");
+
+	for (index_t i=0; i<x.vlen; i++)
+	{
+		if (!(greater_equal(x[i], 0) && less_equal(x[i], 1)))
+			SG_SERROR("CStatistics::incomplete_beta(): Domain error\n");
+	}
+
+	SGVector<float64_t> result(x.vlen);
+
+	#pragma omp parallel for num_threads(lgamma_batch_num_threads(x.vlen))
+	for (index_t i=0; i<x.vlen; i++)
+		result[i]=incomplete_beta(a, b, x[i]);
+
+	return result;
+}
@@ -22,6 +22,7 @@
 
 namespace shogun
 {
+template<class T> class SGVector;
 template<class T> class SGMatrix;
 template<class T> class SGSparseMatrix;
 
@@ -239,6 +240,17 @@ public:
 	 */
 	static float64_t incomplete_beta(float64_t a, float64_t b, float64_t x);
 
+	/** incomplete_beta() of a vector of values, evaluated in parallel for
+	 * long vectors if lgamma_r is available
+	 *
+	 * @param a parameter \f$a>0\f$
+	 * @param b parameter \f$b>0\f$
+	 * @param x values in \f$[0,1]\f$
+	 * @return incomplete beta integral of each value
+	 */
+	static SGVector<float64_t> incomplete_beta(float64_t a, float64_t b,
+			SGVector<float64_t> x);
+
 	/** Inverse of Normal distribution function
 	 *
 	 * Returns the argument, \f$x\f$, for which the area under the
@@ -261,12 +273,36 @@ public:
 	static float64_t inverse_normal_cdf(float64_t y0, float64_t mean,
 				float64_t std_dev);
 
+	/** inverse_normal_cdf() of a vector of values, evaluated in parallel
+	 * for long vectors
+	 *
+	 * @param y0 probabilities
+	 * @param mean mean of the normal distribution
+	 * @param std_dev standard deviation of the normal distribution
+	 * @return inverse normal cdf of each value
+	 */
+	static SGVector<float64_t> inverse_normal_cdf(SGVector<float64_t> y0,
+			float64_t mean=0, float64_t std_dev=1);
+
 	/** @return natural logarithm of the gamma function of input */
 	static inline float64_t lgamma(float64_t x)
 	{
+#ifdef HAVE_LGAMMA_R
+		int sign;
+		return ::lgamma_r((double) x, &sign);
+#else
 		return ::lgamma((double) x);
+#endif // HAVE_LGAMMA_R
 	}
 
+	/** lgamma() of a vector of values. Evaluated sequentially if lgamma_r
+	 * is not available, since lgamma sets the global signgam.
+	 *
+	 * @param x values
+	 * @return natural logarithm of the gamma function of each value
+	 */
+	static SGVector<float64_t> lgamma(SGVector<float64_t> x);
+
 	/** @return natural logarithm of the gamma function of input for large
 	 * numbers */
 	static inline floatmax_t lgammal(floatmax_t x)
@@ -302,6 +338,16 @@ public:
 	 */
 	static float64_t incomplete_gamma(float64_t a, float64_t x);
 
+	/** incomplete_gamma() of a vector of values, evaluated in parallel for
+	 * long vectors if lgamma_r is available
+	 *
+	 * @param a parameter \f$a>0\f$
+	 * @param x values \f$x>0\f$
+	 * @return incomplete gamma integral of each value
+	 */
+	static SGVector<float64_t> incomplete_gamma(float64_t a,
+			SGVector<float64_t> x);
+
 	/** Complemented incomplete gamma integral
 	 *
 	 * The function is defined by
@@ -377,6 +423,16 @@ public:
 	 */
 	static float64_t normal_cdf(float64_t x, float64_t std_dev=1);
 
+	/** normal_cdf() of a vector of values, see error_function() of a
+	 * vector for how it is evaluated
+	 *
+	 * @param x values
+	 * @param std_dev standard deviation
+	 * @return normal cdf of each value
+	 */
+	static SGVector<float64_t> normal_cdf(SGVector<float64_t> x,
+			float64_t std_dev=1);
+
 	/** returns logarithm of the cumulative distribution function
 	 * (CDF) of Gaussian distribution \f$N(0, 1)\f$:
 	 *
@@ -394,6 +450,14 @@ public:
 	 */
 	static float64_t lnormal_cdf(float64_t x);
 
+	/** lnormal_cdf() of a vector of values, see error_function() of a
+	 * vector for how it is evaluated
+	 *
+	 * @param x values
+	 * @return logarithm of the normal cdf of each value
+	 */
+	static SGVector<float64_t> lnormal_cdf(SGVector<float64_t> x);
+
 	/** Error function
 	 *
 	 * The integral is
@@ -411,6 +475,19 @@ public:
 	 */
 	static float64_t error_function(float64_t x);
 
+	/** error_function() of a vector of values
+	 *
+	 * Uses the same rational approximations as the scalar version, so
+	 * results are identical, with a relative error below \f$10^{-15}\f$.
+	 * All branches are evaluated and the result is selected, so that the
+	 * loop over a block of values has no branches and can be vectorized.
+	 * Long vectors are split into blocks that are evaluated in parallel.
+	 *
+	 * @param x values
+	 * @return error function of each value
+	 */
+	static SGVector<float64_t> error_function(SGVector<float64_t> x);
+
 	/** Complementary error function
 	 *
 	 * \f[
@@ -427,6 +504,15 @@ public:
 	 */
 	static float64_t error_function_complement(float64_t x);
 
+	/** error_function_complement() of a vector of values, see
+	 * error_function() of a vector for how it is evaluated
+	 *
+	 * @param x values
+	 * @return complementary error function of each value
+	 */
+	static SGVector<float64_t> error_function_complement(
+			SGVector<float64_t> x);
+
 	/** @return mutual information of \f$p\f$ which is given in logspace
 	 * where \f$p,q\f$ are given in logspace */
 	static float64_t mutual_info(float64_t* p1, float64_t* p2, int32_t len);
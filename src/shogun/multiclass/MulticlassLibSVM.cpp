@@ -197,6 +197,9 @@ bool CMulticlassLibSVM::train_machine(CFeatures* data)
 		}
 
 		set_objective(model->objective);
+		svm_proto()->set_cache_statistics(model->cache_stats.hits,
+				model->cache_stats.misses, model->cache_stats.evaluations,
+				model->cache_stats.peak_memory);
 
 		SG_FREE(offsets);
 		SG_FREE(problem.x);
@@ -126,6 +126,26 @@ class CMulticlassSVM : public CKernelMulticlassMachine
 		 * @return objective of base SVM
 		 */
 		float64_t get_objective() { return svm_proto()->get_objective(); }
+		/** get kernel cache hit rate of the last training
+		 * @return cache hit rate of base SVM
+		 */
+		float64_t get_cache_hit_rate() { return svm_proto()->get_cache_hit_rate(); }
+		/** get number of kernel columns found in the cache during the last training
+		 * @return cache hits of base SVM
+		 */
+		int64_t get_cache_hits() { return svm_proto()->get_cache_hits(); }
+		/** get number of kernel columns computed during the last training
+		 * @return cache misses of base SVM
+		 */
+		int64_t get_cache_misses() { return svm_proto()->get_cache_misses(); }
+		/** get number of kernel evaluations of the last training
+		 * @return kernel evaluations of base SVM
+		 */
+		int64_t get_cache_evaluations() { return svm_proto()->get_cache_evaluations(); }
+		/** get peak memory of the kernel cache of the last training
+		 * @return cache memory of base SVM in bytes
+		 */
+		int64_t get_cache_memory() { return svm_proto()->get_cache_memory(); }
 
 		// TODO remove if unnecessary here
 		/** get bias enabled options of base SVM
@@ -110,6 +110,12 @@ public:
 	 */
 	virtual int32_t decide_label(SGVector<float64_t> outputs)=0;
 
+	/** decide the final labels of many examples at once.
+	 * @param outputs outputs of each machine (rows) for each example (columns)
+	 * @return labels of the examples
+	 */
+	virtual SGVector<int32_t> decide_labels(SGMatrix<float64_t> outputs);
+
 	/** decide the final label.
 	 * @param outputs a vector of output from each machine (in that order)
 	 * @param n_outputs number of outputs
@@ -27,3 +27,13 @@ SGVector<float64_t> CECOCDecoder::binarize(const SGVector<float64_t> query)
     return bquery;
 }
 
+SGVector<int32_t> CECOCDecoder::decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook)
+{
+    SGVector<int32_t> labels(outputs.num_cols);
+    for (int32_t i=0; i < outputs.num_cols; ++i)
+        labels[i] = decide_label(SGVector<float64_t>(outputs.get_column_vector(i),
+                    outputs.num_rows, false), codebook);
+
+    return labels;
+}
+
@@ -64,6 +64,26 @@ SGMatrix<int32_t> CECOCDiscriminantEncoder::create_codebook(int32_t num_classes)
         SG_ERROR("Need features and labels to learn the codebook")
 
     m_feats = m_features->get_feature_matrix();
+
+    // value range of every feature, used for the histograms
+    m_feats_min = SGVector<float64_t>(m_feats.num_rows);
+    m_feats_max = SGVector<float64_t>(m_feats.num_rows);
+    for (int32_t i=0; i < m_feats.num_rows; ++i)
+    {
+        float64_t max_val = m_feats(i, 0);
+        float64_t min_val = m_feats(i, 0);
+        for (int32_t j=1; j < m_feats.num_cols; ++j)
+        {
+            max_val = max(max_val, m_feats(i, j));
+            min_val = min(min_val, m_feats(i, j));
+        }
+
+        if (max_val - min_val < 1e-10)
+            max_val = min_val + 1; // avoid divide by zero error
+
+        m_feats_min[i] = min_val;
+        m_feats_max[i] = max_val;
+    }
     m_codebook = SGMatrix<int32_t>(m_num_trees * (num_classes-1), num_classes);
     m_codebook.zero();
     m_code_idx = 0;
@@ -78,6 +98,8 @@ SGMatrix<int32_t> CECOCDiscriminantEncoder::create_codebook(int32_t num_classes)
     }
 
     m_feats = SGMatrix<float64_t>(); // release memory
+    m_feats_min = SGVector<float64_t>();
+    m_feats_max = SGVector<float64_t>();
     return m_codebook;
 }
 
@@ -175,45 +197,43 @@ float64_t CECOCDiscriminantEncoder::sffs_iteration(float64_t MI, vector<int32_t>
 
 float64_t CECOCDiscriminantEncoder::compute_MI(const set<int32_t>& idata1, const set<int32_t>& idata2)
 {
-    float64_t MI = 0;
+    vector<int32_t> data1(idata1.begin(), idata1.end());
+    vector<int32_t> data2(idata2.begin(), idata2.end());
 
-    int32_t hist1[10];
-    int32_t hist2[10];
+    // features are independent, they are summed up in order afterwards
+    SGVector<float64_t> MI_feats(m_feats.num_rows);
 
+    #pragma omp parallel for num_threads(parallel->get_num_threads())
     for (int32_t i=0; i < m_feats.num_rows; ++i)
     {
-        float64_t max_val = m_feats(i, 0);
-        float64_t min_val = m_feats(i, 0);
-        for (int32_t j=1; j < m_feats.num_cols; ++j)
-        {
-            max_val = max(max_val, m_feats(i, j));
-            min_val = min(min_val, m_feats(i, j));
-        }
-
-        if (max_val - min_val < 1e-10)
-            max_val = min_val + 1; // avoid divide by zero error
+        int32_t hist1[10];
+        int32_t hist2[10];
 
-        compute_hist(i, max_val, min_val, idata1, hist1);
-        compute_hist(i, max_val, min_val, idata2, hist2);
+        compute_hist(i, m_feats_max[i], m_feats_min[i], data1, hist1);
+        compute_hist(i, m_feats_max[i], m_feats_min[i], data2, hist2);
 
         float64_t MI_i = 0;
         for (int j=0; j < 10; ++j)
             MI_i += (hist1[j]-hist2[j])*(hist1[j]-hist2[j]);
-        MI += CMath::sqrt(MI_i);
+        MI_feats[i] = CMath::sqrt(MI_i);
     }
 
+    float64_t MI = 0;
+    for (int32_t i=0; i < m_feats.num_rows; ++i)
+        MI += MI_feats[i];
+
     return MI;
 }
 
 void CECOCDiscriminantEncoder::compute_hist(int32_t i, float64_t max_val, float64_t min_val,
-        const set<int32_t>& idata, int32_t *hist)
+        const vector<int32_t>& idata, int32_t *hist)
 {
     // hist of 0:0.1:1
     fill(hist, hist+10, 0);
 
-    for (set<int32_t>::const_iterator it = idata.begin(); it != idata.end(); ++it)
+    for (size_t k=0; k < idata.size(); ++k)
     {
-        float64_t val = (m_feats(i, *it) - min_val) / (max_val - min_val);
+        float64_t val = (m_feats(i, idata[k]) - min_val) / (max_val - min_val);
         int32_t pos = min(9, static_cast<int32_t>(val*10));
         hist[pos]++;
     }
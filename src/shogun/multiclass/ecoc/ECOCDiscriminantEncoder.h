@@ -73,7 +73,7 @@ protected:
             std::vector<int32_t>& part2, std::set<int32_t>& idata2);
     float64_t compute_MI(const std::set<int32_t>& idata1, const std::set<int32_t>& idata2);
     void compute_hist(int32_t i, float64_t max_val, float64_t min_val,
-            const std::set<int32_t>& idata, int32_t *hist);
+            const std::vector<int32_t>& idata, int32_t *hist);
 
     int32_t m_iterations;
     int32_t m_num_trees;
@@ -83,6 +83,8 @@ protected:
     CLabels *m_labels;
     CDenseFeatures<float64_t> *m_features;
     SGMatrix<float64_t> m_feats;
+    SGVector<float64_t> m_feats_min;
+    SGVector<float64_t> m_feats_max;
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 };
 
@@ -0,0 +1,51 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/multiclass/ecoc/ECOCHDDecoder.h>
+
+using namespace shogun;
+
+SGVector<int32_t> CECOCHDDecoder::decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook)
+{
+    REQUIRE(outputs.num_rows == codebook.num_rows,
+            "Number of outputs (%d) does not match code length (%d)\n",
+            outputs.num_rows, codebook.num_rows);
+
+    SGMatrix<uint64_t> packed = CECOCUtil::pack_codebook(codebook);
+    int32_t words = CECOCUtil::get_packed_length(codebook.num_rows);
+    SGVector<int32_t> labels(outputs.num_cols);
+
+    #pragma omp parallel num_threads(parallel->get_num_threads())
+    {
+        SGVector<uint64_t> query(2*words);
+
+        #pragma omp for
+        for (int32_t i=0; i < outputs.num_cols; ++i)
+        {
+            CECOCUtil::pack_signs(outputs.get_column_vector(i), outputs.num_rows, query.vector);
+
+            // first code of minimum distance, like arg_min
+            int32_t best = 0;
+            int32_t best_dist = std::numeric_limits<int32_t>::max();
+            for (int32_t j=0; j < codebook.num_cols; ++j)
+            {
+                int32_t dist = CECOCUtil::packed_hamming_distance(query.vector,
+                        packed.get_column_vector(j), words);
+                if (dist < best_dist)
+                {
+                    best = j;
+                    best_dist = dist;
+                }
+            }
+            labels[i] = best;
+        }
+    }
+
+    return labels;
+}
@@ -33,6 +33,16 @@ public:
         return "ECOCHDDecoder";
     }
 
+    /** decide labels of many examples at once. The codebook and the signs
+     * of the outputs are packed into bit masks, such that the distances
+     * are computed with a few word operations per 64 machines.
+     *
+     * @param outputs outputs by classifiers, one column per example
+     * @param codebook ECOC codebook
+     * @return labels
+     */
+    virtual SGVector<int32_t> decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook);
+
 protected:
     /** whether to turn the output into binary before decoding */
     virtual bool binary_decoding()
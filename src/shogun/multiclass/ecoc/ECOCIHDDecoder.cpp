@@ -37,6 +37,38 @@ int32_t CECOCIHDDecoder::decide_label(const SGVector<float64_t> outputs, const S
     return SGVector<float64_t>::arg_max(res.vector, 1, res.vlen);
 }
 
+SGVector<int32_t> CECOCIHDDecoder::decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook)
+{
+    update_delta_cache(codebook);
+
+    SGMatrix<uint64_t> packed = CECOCUtil::pack_codebook(codebook);
+    int32_t words = CECOCUtil::get_packed_length(codebook.num_rows);
+    SGVector<int32_t> labels(outputs.num_cols);
+
+    #pragma omp parallel num_threads(parallel->get_num_threads())
+    {
+        SGVector<uint64_t> query(2*words);
+        SGVector<float64_t> L(codebook.num_cols);
+        SGVector<float64_t> res(codebook.num_cols);
+
+        #pragma omp for
+        for (int32_t i=0; i < outputs.num_cols; ++i)
+        {
+            CECOCUtil::pack_signs(outputs.get_column_vector(i), outputs.num_rows, query.vector);
+            for (int32_t j=0; j < codebook.num_cols; ++j)
+                L[j] = CECOCUtil::packed_hamming_distance(query.vector, packed.get_column_vector(j), words);
+
+            // same product as decide_label, such that ties are broken alike
+            res.zero();
+            cblas_dgemv(CblasColMajor, CblasNoTrans, m_delta.num_cols, m_delta.num_cols,
+                    1, m_delta.matrix, m_delta.num_cols, L.vector, 1, 1, res.vector, 1);
+            labels[i] = SGVector<float64_t>::arg_max(res.vector, 1, res.vlen);
+        }
+    }
+
+    return labels;
+}
+
 void CECOCIHDDecoder::update_delta_cache(const SGMatrix<int32_t> codebook)
 {
     if (codebook.matrix == m_codebook.matrix)
@@ -56,12 +88,14 @@ void CECOCIHDDecoder::update_delta_cache(const SGMatrix<int32_t> codebook)
     m_codebook = codebook; // operator=
     m_delta = SGMatrix<float64_t>(codebook.num_cols, codebook.num_cols);
     m_delta.zero();
+    SGMatrix<uint64_t> packed = CECOCUtil::pack_codebook(codebook);
+    int32_t words = CECOCUtil::get_packed_length(codebook.num_rows);
     for (int32_t i=0; i < codebook.num_cols; ++i)
     {
         for (int32_t j=i+1; j < codebook.num_cols; ++j)
         {
-            m_delta(i, j) = m_delta(j, i) =
-                CECOCUtil::hamming_distance(codebook.get_column_vector(i), codebook.get_column_vector(j), codebook.num_rows);
+            m_delta(i, j) = m_delta(j, i) = CECOCUtil::packed_hamming_distance(
+                    packed.get_column_vector(i), packed.get_column_vector(j), words);
         }
     }
 
@@ -49,6 +49,14 @@ public:
      */
     virtual int32_t decide_label(const SGVector<float64_t> outputs, const SGMatrix<int32_t> codebook);
 
+    /** decide labels of many examples at once, the inverse of delta is
+     * computed once and the examples are decoded in parallel.
+     * @param outputs outputs by classifiers, one column per example
+     * @param codebook ECOC codebook
+     * @return labels
+     */
+    virtual SGVector<int32_t> decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook);
+
 protected:
     /** update delta cache */
     void update_delta_cache(const SGMatrix<int32_t> codebook);
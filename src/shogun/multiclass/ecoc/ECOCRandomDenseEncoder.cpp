@@ -9,7 +9,6 @@
  */
 
 #include <algorithm>
-#include <limits>
 
 #include <shogun/multiclass/ecoc/ECOCRandomDenseEncoder.h>
 #include <shogun/multiclass/ecoc/ECOCUtil.h>
@@ -88,18 +87,11 @@ SGMatrix<int32_t> CECOCRandomDenseEncoder::create_codebook(int32_t num_classes)
         if (valid)
         {
             // see if this is a better codebook
-            // compute the minimum pairwise code distance
-            int32_t min_dist = std::numeric_limits<int32_t>::max();
-            for (int32_t i=0; i < num_classes; ++i)
-            {
-                for (int32_t j=i+1; j < num_classes; ++j)
-                {
-                    int32_t dist = CECOCUtil::hamming_distance(codebook.get_column_vector(i),
-                            codebook.get_column_vector(j), codelen);
-                    if (dist < min_dist)
-                        min_dist = dist;
-                }
-            }
+            // compute the minimum pairwise code distance, trials that
+            // cannot improve on the best one are abandoned early
+            int32_t min_dist = CECOCUtil::min_packed_distance(
+                    CECOCUtil::pack_codebook(codebook), best_dist,
+                    parallel->get_num_threads());
 
             if (min_dist > best_dist)
             {
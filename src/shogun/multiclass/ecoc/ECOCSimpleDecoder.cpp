@@ -26,3 +26,16 @@ int32_t CECOCSimpleDecoder::decide_label(const SGVector<float64_t> outputs, cons
     int32_t result = SGVector<float64_t>::arg_min(distances.vector, 1, distances.vlen);
     return result;
 }
+
+SGVector<int32_t> CECOCSimpleDecoder::decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook)
+{
+    SGVector<int32_t> labels(outputs.num_cols);
+
+    // distances only depend on the outputs of one example
+    #pragma omp parallel for num_threads(parallel->get_num_threads())
+    for (int32_t i=0; i < outputs.num_cols; ++i)
+        labels[i] = decide_label(SGVector<float64_t>(outputs.get_column_vector(i),
+                    outputs.num_rows, false), codebook);
+
+    return labels;
+}
@@ -39,6 +39,13 @@ public:
      */
     virtual int32_t decide_label(const SGVector<float64_t> outputs, const SGMatrix<int32_t> codebook);
 
+    /** decide labels of many examples at once, in parallel.
+     * @param outputs outputs by classifiers, one column per example
+     * @param codebook ECOC codebook
+     * @return labels
+     */
+    virtual SGVector<int32_t> decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook);
+
 protected:
     /** whether to turn the output into binary before decoding */
     virtual bool binary_decoding()=0;
@@ -53,6 +53,12 @@ public:
      */
     virtual int32_t decide_label(SGVector<float64_t> outputs);
 
+    /** decide the final labels of many examples at once.
+     * @param outputs outputs of each machine (rows) for each example (columns)
+     * @return labels of the examples
+     */
+    virtual SGVector<int32_t> decide_labels(SGMatrix<float64_t> outputs);
+
     /** get number of machines used in this strategy.
      */
     virtual int32_t get_num_machines();
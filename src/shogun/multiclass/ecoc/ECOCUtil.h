@@ -12,6 +12,9 @@
 #define ECOCUTIL_H__
 
 #include <shogun/mathematics/Math.h>
+#include <shogun/lib/SGMatrix.h>
+
+#include <limits>
 
 namespace shogun
 {
@@ -33,6 +36,149 @@ public:
                 dist += static_cast<int32_t>(CMath::abs((c1[i]-c2[i])));
             return dist/2;
         }
+
+    /** number of 64 bit words of one mask of a bit-packed code
+     *
+     * @param len code length
+     */
+    static int32_t get_packed_length(int32_t len)
+    {
+        return (len+63)/64;
+    }
+
+    /** pack a ternary code into bit masks: the first get_packed_length(len)
+     * words mark the nonzero positions, the following ones the positive
+     * positions.
+     *
+     * @param code code of elements -1, 0 or +1
+     * @param len code length
+     * @param packed 2*get_packed_length(len) words
+     */
+    template<typename T>
+        static void pack_code(const T *code, int32_t len, uint64_t *packed)
+        {
+            int32_t words = get_packed_length(len);
+            for (int32_t w=0; w < 2*words; ++w)
+                packed[w] = 0;
+
+            for (int32_t i=0; i < len; ++i)
+            {
+                uint64_t bit = uint64_t(1) << (i%64);
+                if (code[i] != 0)
+                    packed[i/64] |= bit;
+                if (code[i] > 0)
+                    packed[words+i/64] |= bit;
+            }
+        }
+
+    /** pack the signs of outputs like CECOCDecoder::binarize, i.e.
+     * non-negative outputs are +1, negative ones -1
+     *
+     * @param outputs outputs of the binary machines
+     * @param len number of outputs
+     * @param packed 2*get_packed_length(len) words
+     */
+    static void pack_signs(const float64_t *outputs, int32_t len, uint64_t *packed)
+    {
+        int32_t words = get_packed_length(len);
+        for (int32_t w=0; w < 2*words; ++w)
+            packed[w] = 0;
+
+        for (int32_t i=0; i < len; ++i)
+        {
+            uint64_t bit = uint64_t(1) << (i%64);
+            packed[i/64] |= bit;
+            if (outputs[i] >= 0)
+                packed[words+i/64] |= bit;
+        }
+    }
+
+    /** pack all codes (columns) of a codebook
+     *
+     * @param codebook codebook, one code per column
+     * @return packed codes, one per column
+     */
+    static SGMatrix<uint64_t> pack_codebook(const SGMatrix<int32_t> codebook)
+    {
+        SGMatrix<uint64_t> packed(2*get_packed_length(codebook.num_rows),
+                codebook.num_cols);
+        for (int32_t j=0; j < codebook.num_cols; ++j)
+            pack_code(codebook.get_column_vector(j), codebook.num_rows,
+                    packed.get_column_vector(j));
+
+        return packed;
+    }
+
+    /** number of set bits */
+    static int32_t popcount(uint64_t x)
+    {
+#ifdef __GNUC__
+        return __builtin_popcountll(x);
+#else
+        x = x - ((x >> 1) & 0x5555555555555555ULL);
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return static_cast<int32_t>((x * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    /** hamming distance of packed codes, same as hamming_distance() of the
+     * unpacked codes
+     *
+     * @param c1 first packed code
+     * @param c2 second packed code
+     * @param words get_packed_length() of the codes
+     */
+    static int32_t packed_hamming_distance(const uint64_t *c1, const uint64_t *c2,
+            int32_t words)
+    {
+        // positions where one code is zero count once, opposite signs twice
+        int32_t dist = 0;
+        for (int32_t w=0; w < words; ++w)
+        {
+            uint64_t opposite = c1[w] & c2[w] & (c1[words+w] ^ c2[words+w]);
+            dist += 2*popcount(opposite) + popcount(c1[w] ^ c2[w]);
+        }
+        return dist/2;
+    }
+
+    /** minimum pairwise hamming distance of packed codes, computed in
+     * parallel. As soon as it is known to be not larger than bound, any
+     * value not larger than bound is returned.
+     *
+     * @param packed packed codes, one per column
+     * @param bound distance that needs to be exceeded
+     * @param num_threads number of threads
+     * @return minimum distance, or maximum int32_t for less than two codes
+     */
+    static int32_t min_packed_distance(const SGMatrix<uint64_t> packed,
+            int32_t bound, int32_t num_threads)
+    {
+        int32_t words = packed.num_rows/2;
+        int32_t min_dist = std::numeric_limits<int32_t>::max();
+
+        #pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+        for (int32_t i=0; i < packed.num_cols; ++i)
+        {
+            int32_t current;
+            #pragma omp critical (ecoc_min_packed_distance)
+            current = min_dist;
+
+            // the pairs of this code cannot change the outcome anymore
+            if (current <= bound)
+                continue;
+
+            const uint64_t *ci = packed.get_column_vector(i);
+            for (int32_t j=i+1; j < packed.num_cols && current > bound; ++j)
+                current = CMath::min(current, packed_hamming_distance(ci,
+                            packed.get_column_vector(j), words));
+
+            #pragma omp critical (ecoc_min_packed_distance)
+            min_dist = CMath::min(min_dist, current);
+        }
+
+        return min_dist;
+    }
 };
 
 } /* shogun */
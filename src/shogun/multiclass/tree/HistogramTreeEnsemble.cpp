@@ -0,0 +1,969 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/multiclass/tree/HistogramTreeEnsemble.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/Random.h>
+#include <shogun/base/Parameter.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace shogun;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace shogun
+{
+
+/** quantized training data */
+struct BinnedData
+{
+	/** number of vectors */
+	int32_t num_vectors;
+	/** number of features */
+	int32_t num_features;
+	/** num_vectors x num_features bin indices, the bins of one feature are
+	 * contiguous */
+	SGMatrix<uint8_t> bins;
+	/** upper boundaries of the bins of each feature, a value v is in bin b
+	 * iff cuts[b-1] < v <= cuts[b] */
+	std::vector<std::vector<float64_t> > cuts;
+
+	/** @return bins of feature f */
+	inline const uint8_t* column(int32_t f) const
+	{
+		return bins.matrix+int64_t(f)*num_vectors;
+	}
+};
+
+/** computes bin boundaries from the (unsorted) values of a feature */
+static void compute_cuts(std::vector<float64_t>& values, int32_t max_bins,
+		std::vector<float64_t>& cuts)
+{
+	int32_t n=values.size();
+	std::sort(values.begin(), values.end());
+	cuts.clear();
+
+	int32_t num_distinct=n>0 ? 1 : 0;
+	for (int32_t i=1; i<n; i++)
+	{
+		if (values[i]!=values[i-1])
+			num_distinct++;
+	}
+
+	/* few distinct values: one bin per value */
+	if (num_distinct<=max_bins)
+	{
+		for (int32_t i=1; i<n; i++)
+		{
+			if (values[i]!=values[i-1])
+				cuts.push_back(0.5*(values[i-1]+values[i]));
+		}
+		return;
+	}
+
+	/* otherwise bins of (roughly) equal mass */
+	for (int32_t b=1; b<max_bins; b++)
+	{
+		int32_t pos=int64_t(b)*n/max_bins;
+		while (pos<n && values[pos]==values[pos-1])
+			pos++;
+
+		if (pos>=n)
+			break;
+
+		float64_t cut=0.5*(values[pos-1]+values[pos]);
+		if (cuts.empty() || cut>cuts.back())
+			cuts.push_back(cut);
+	}
+}
+
+/** quantizes dense or sparse real valued features column by column */
+static void bin_features(CFeatures* data, int32_t max_bins,
+		int32_t num_threads, BinnedData& binned)
+{
+	int32_t n=data->get_num_vectors();
+	int32_t d=0;
+
+	SGMatrix<float64_t> dense;
+	/* transposed sparse matrix in compressed column form */
+	std::vector<int32_t> col_start;
+	std::vector<int32_t> col_rows;
+	std::vector<float64_t> col_values;
+
+	if (data->get_feature_class()==C_DENSE)
+	{
+		dense=((CDenseFeatures<float64_t>*) data)->get_feature_matrix();
+		d=dense.num_rows;
+	}
+	else
+	{
+		CSparseFeatures<float64_t>* sparse=(CSparseFeatures<float64_t>*) data;
+		d=sparse->get_num_features();
+		col_start.assign(d+1, 0);
+
+		for (int32_t i=0; i<n; i++)
+		{
+			SGSparseVector<float64_t> v=sparse->get_sparse_feature_vector(i);
+			for (int32_t j=0; j<v.num_feat_entries; j++)
+				col_start[v.features[j].feat_index+1]++;
+			sparse->free_sparse_feature_vector(i);
+		}
+
+		for (int32_t f=0; f<d; f++)
+			col_start[f+1]+=col_start[f];
+
+		col_rows.resize(col_start[d]);
+		col_values.resize(col_start[d]);
+		std::vector<int32_t> pos(col_start.begin(), col_start.end()-1);
+		for (int32_t i=0; i<n; i++)
+		{
+			SGSparseVector<float64_t> v=sparse->get_sparse_feature_vector(i);
+			for (int32_t j=0; j<v.num_feat_entries; j++)
+			{
+				int32_t p=pos[v.features[j].feat_index]++;
+				col_rows[p]=i;
+				col_values[p]=v.features[j].entry;
+			}
+			sparse->free_sparse_feature_vector(i);
+		}
+	}
+
+	binned.num_vectors=n;
+	binned.num_features=d;
+	binned.bins=SGMatrix<uint8_t>(n, d);
+	binned.cuts.resize(d);
+
+	#pragma omp parallel num_threads(num_threads)
+	{
+		std::vector<float64_t> column(n);
+		std::vector<float64_t> sorted(n);
+
+		#pragma omp for schedule(dynamic)
+		for (int32_t f=0; f<d; f++)
+		{
+			if (dense.matrix)
+			{
+				for (int32_t i=0; i<n; i++)
+					column[i]=dense.matrix[int64_t(i)*d+f];
+			}
+			else
+			{
+				std::fill(column.begin(), column.end(), 0.0);
+				for (int32_t p=col_start[f]; p<col_start[f+1]; p++)
+					column[col_rows[p]]=col_values[p];
+			}
+
+			sorted=column;
+			std::vector<float64_t>& cuts=binned.cuts[f];
+			compute_cuts(sorted, max_bins, cuts);
+
+			uint8_t* bins=binned.bins.matrix+int64_t(f)*n;
+			for (int32_t i=0; i<n; i++)
+			{
+				bins[i]=std::lower_bound(cuts.begin(), cuts.end(), column[i])-
+					cuts.begin();
+			}
+		}
+	}
+}
+
+/** grows a single tree on gradient statistics of the binned data */
+struct HistogramTreeBuilder
+{
+	/** binned training data */
+	const BinnedData* data;
+	/** number of outputs */
+	int32_t num_outputs;
+	/** histogram width (bins) */
+	int32_t num_bins;
+	/** weighted first order statistics, num_vectors x num_outputs */
+	const float64_t* grad;
+	/** weighted second order statistics, num_vectors x num_outputs */
+	const float64_t* hess;
+	/** weight (number of draws) of each vector */
+	const float64_t* weight;
+	/** maximum depth */
+	int32_t max_depth;
+	/** minimum weight of a leaf */
+	float64_t min_samples_leaf;
+	/** number of features considered per split */
+	int32_t num_split_features;
+	/** L2 regularization of leaf values */
+	float64_t lambda;
+	/** factor applied to all leaf values */
+	float64_t scale;
+	/** random stream for feature sampling */
+	CRandom* rng;
+	/** number of threads */
+	int32_t num_threads;
+
+	/** indices of the vectors of each node (nodes are ranges) */
+	std::vector<int32_t> rows;
+	/** all features, shuffled for feature sampling */
+	std::vector<int32_t> feature_pool;
+
+	/** grown tree, node 0 is the root */
+	std::vector<int32_t> feature;
+	std::vector<int32_t> split_bin;
+	std::vector<float64_t> threshold;
+	std::vector<int32_t> left;
+	std::vector<int32_t> right;
+	std::vector<float64_t> values;
+
+	/** entries per histogram bin: gradients, hessians and weight */
+	inline int32_t stride() const { return 2*num_outputs+1; }
+
+	/** @return size of a histogram over all features */
+	inline int64_t hist_size() const
+	{
+		return int64_t(data->num_features)*num_bins*stride();
+	}
+
+	void build_histogram(int32_t begin, int32_t end, float64_t* hist)
+	{
+		int32_t s=stride();
+		int32_t k_max=num_outputs;
+		std::fill(hist, hist+hist_size(), 0.0);
+
+		#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+		for (int32_t f=0; f<data->num_features; f++)
+		{
+			const uint8_t* bins=data->column(f);
+			float64_t* hf=hist+int64_t(f)*num_bins*s;
+
+			for (int32_t p=begin; p<end; p++)
+			{
+				int32_t r=rows[p];
+				float64_t* h=hf+bins[r]*s;
+				for (int32_t k=0; k<k_max; k++)
+				{
+					h[k]+=grad[int64_t(r)*k_max+k];
+					h[k_max+k]+=hess[int64_t(r)*k_max+k];
+				}
+				h[2*k_max]+=weight[r];
+			}
+		}
+	}
+
+	inline float64_t score(const float64_t* stats) const
+	{
+		float64_t result=0;
+		for (int32_t k=0; k<num_outputs; k++)
+		{
+			float64_t denom=stats[num_outputs+k]+lambda;
+			if (denom>0)
+				result+=stats[k]*stats[k]/denom;
+		}
+		return result;
+	}
+
+	/** finds the best split among a random subset of the features
+	 * @return gain of the best split, 0 if there is none */
+	float64_t find_split(const float64_t* hist, const float64_t* total,
+			int32_t& best_feature, int32_t& best_bin)
+	{
+		int32_t s=stride();
+		int32_t num_candidates=data->num_features;
+		if (num_split_features<num_candidates)
+		{
+			num_candidates=num_split_features;
+			for (int32_t i=0; i<num_candidates; i++)
+			{
+				int32_t j=rng->random(i, data->num_features-1);
+				std::swap(feature_pool[i], feature_pool[j]);
+			}
+		}
+
+		float64_t parent_score=score(total);
+		std::vector<float64_t> gains(num_candidates, 0.0);
+		std::vector<int32_t> bins(num_candidates, -1);
+
+		#pragma omp parallel num_threads(num_threads)
+		{
+			std::vector<float64_t> left_stats(s);
+			std::vector<float64_t> right_stats(s);
+
+			#pragma omp for schedule(dynamic)
+			for (int32_t c=0; c<num_candidates; c++)
+			{
+				int32_t f=feature_pool[c];
+				const float64_t* hf=hist+int64_t(f)*num_bins*s;
+				int32_t last_bin=data->cuts[f].size();
+				std::fill(left_stats.begin(), left_stats.end(), 0.0);
+
+				for (int32_t b=0; b<last_bin; b++)
+				{
+					for (int32_t i=0; i<s; i++)
+					{
+						left_stats[i]+=hf[b*s+i];
+						right_stats[i]=total[i]-left_stats[i];
+					}
+
+					if (left_stats[s-1]<min_samples_leaf)
+						continue;
+					if (right_stats[s-1]<min_samples_leaf)
+						break;
+
+					float64_t gain=score(&left_stats[0])+score(&right_stats[0])-
+						parent_score;
+					if (gain>gains[c])
+					{
+						gains[c]=gain;
+						bins[c]=b;
+					}
+				}
+			}
+		}
+
+		/* reduce in a fixed order to be independent of the thread count */
+		float64_t best_gain=0;
+		best_feature=-1;
+		best_bin=-1;
+		for (int32_t c=0; c<num_candidates; c++)
+		{
+			if (bins[c]>=0 && (gains[c]>best_gain ||
+					(gains[c]==best_gain && feature_pool[c]<best_feature)))
+			{
+				best_gain=gains[c];
+				best_feature=feature_pool[c];
+				best_bin=bins[c];
+			}
+		}
+
+		return best_gain;
+	}
+
+	/** grows the subtree of the vectors rows[begin..end) whose histogram is
+	 * given (and consumed)
+	 * @return index of the subtree's root */
+	int32_t grow(int32_t begin, int32_t end, int32_t depth,
+			std::vector<float64_t>& hist)
+	{
+		int32_t s=stride();
+		int32_t node=feature.size();
+		feature.push_back(-1);
+		split_bin.push_back(-1);
+		threshold.push_back(0);
+		left.push_back(-1);
+		right.push_back(-1);
+
+		/* every vector is in exactly one bin of feature 0 */
+		std::vector<float64_t> total(s, 0.0);
+		for (int32_t b=0; b<num_bins; b++)
+		{
+			for (int32_t i=0; i<s; i++)
+				total[i]+=hist[b*s+i];
+		}
+
+		for (int32_t k=0; k<num_outputs; k++)
+		{
+			float64_t denom=total[num_outputs+k]+lambda;
+			values.push_back(denom>0 ? -total[k]/denom*scale : 0);
+		}
+
+		if (depth>=max_depth || total[s-1]<2*min_samples_leaf)
+			return node;
+
+		int32_t f=-1;
+		int32_t b=-1;
+		float64_t gain=find_split(&hist[0], &total[0], f, b);
+		if (f<0 || gain<=1e-12*CMath::max(1.0, CMath::abs(score(&total[0]))))
+			return node;
+
+		const uint8_t* bins=data->column(f);
+		int32_t mid=std::stable_partition(rows.begin()+begin, rows.begin()+end,
+				BinBelow(bins, b))-rows.begin();
+
+		feature[node]=f;
+		split_bin[node]=b;
+		threshold[node]=data->cuts[f][b];
+
+		/* build the histogram of the smaller child, the larger one is the
+		 * difference to the parent */
+		std::vector<float64_t> small_hist(hist_size());
+		bool left_is_small=(mid-begin)<=(end-mid);
+		if (left_is_small)
+			build_histogram(begin, mid, &small_hist[0]);
+		else
+			build_histogram(mid, end, &small_hist[0]);
+
+		for (int64_t i=0; i<hist_size(); i++)
+			hist[i]-=small_hist[i];
+
+		int32_t l, r;
+		if (left_is_small)
+		{
+			l=grow(begin, mid, depth+1, small_hist);
+			std::vector<float64_t>().swap(small_hist);
+			r=grow(mid, end, depth+1, hist);
+		}
+		else
+		{
+			l=grow(begin, mid, depth+1, hist);
+			r=grow(mid, end, depth+1, small_hist);
+		}
+
+		left[node]=l;
+		right[node]=r;
+		return node;
+	}
+
+	/** predicate for partitioning vectors by bin */
+	struct BinBelow
+	{
+		BinBelow(const uint8_t* b, int32_t t) : bins(b), bin(t) {}
+		bool operator()(int32_t r) const { return bins[r]<=bin; }
+		const uint8_t* bins;
+		int32_t bin;
+	};
+
+	/** grows a tree on all vectors with non-zero weight */
+	void build()
+	{
+		feature.clear(); split_bin.clear(); threshold.clear();
+		left.clear(); right.clear(); values.clear();
+
+		rows.clear();
+		for (int32_t i=0; i<data->num_vectors; i++)
+		{
+			if (weight[i]>0)
+				rows.push_back(i);
+		}
+
+		feature_pool.resize(data->num_features);
+		for (int32_t f=0; f<data->num_features; f++)
+			feature_pool[f]=f;
+
+		std::vector<float64_t> hist(hist_size());
+		build_histogram(0, rows.size(), &hist[0]);
+		grow(0, rows.size(), 0, hist);
+	}
+
+	/** @return leaf of the grown tree the binned vector r falls into */
+	inline int32_t get_leaf(int32_t r) const
+	{
+		int32_t node=0;
+		while (feature[node]>=0)
+		{
+			if (data->column(feature[node])[r]<=split_bin[node])
+				node=left[node];
+			else
+				node=right[node];
+		}
+		return node;
+	}
+};
+
+}
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+CHistogramTreeEnsemble::CHistogramTreeEnsemble()
+	: CMachine()
+{
+	init();
+	register_parameters();
+}
+
+CHistogramTreeEnsemble::CHistogramTreeEnsemble(ETreeEnsembleType type,
+		int32_t num_trees, int32_t max_depth)
+	: CMachine()
+{
+	init();
+	register_parameters();
+
+	m_ensemble_type=type;
+	m_num_trees=num_trees;
+	m_max_depth=max_depth;
+}
+
+CHistogramTreeEnsemble::~CHistogramTreeEnsemble()
+{
+}
+
+void CHistogramTreeEnsemble::init()
+{
+	m_ensemble_type=TE_RANDOM_FOREST;
+	m_num_trees=100;
+	m_max_depth=6;
+	m_min_samples_leaf=1;
+	m_max_bins=256;
+	m_learning_rate=0.1;
+	m_lambda=1.0;
+	m_subsample=1.0;
+	m_num_split_features=0;
+	m_problem_type=PT_BINARY;
+	m_num_features=0;
+	m_num_outputs=0;
+}
+
+void CHistogramTreeEnsemble::register_parameters()
+{
+	SG_ADD((machine_int_t*) &m_ensemble_type, "ensemble_type",
+			"Random forest or gradient boosting", MS_NOT_AVAILABLE);
+	SG_ADD(&m_num_trees, "num_trees", "Number of trees", MS_AVAILABLE);
+	SG_ADD(&m_max_depth, "max_depth", "Maximum depth of a tree",
+			MS_AVAILABLE);
+	SG_ADD(&m_min_samples_leaf, "min_samples_leaf",
+			"Minimum number of vectors in a leaf", MS_AVAILABLE);
+	SG_ADD(&m_max_bins, "max_bins", "Number of histogram bins per feature",
+			MS_AVAILABLE);
+	SG_ADD(&m_learning_rate, "learning_rate", "Shrinkage of boosting rounds",
+			MS_AVAILABLE);
+	SG_ADD(&m_lambda, "lambda", "L2 regularization of leaf values",
+			MS_AVAILABLE);
+	SG_ADD(&m_subsample, "subsample", "Fraction of vectors per tree",
+			MS_AVAILABLE);
+	SG_ADD(&m_num_split_features, "num_split_features",
+			"Number of features considered per split", MS_AVAILABLE);
+	SG_ADD((machine_int_t*) &m_problem_type, "problem_type",
+			"Problem type of the trained model", MS_NOT_AVAILABLE);
+	SG_ADD(&m_num_features, "num_features", "Dimension of the features",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_num_outputs, "num_outputs", "Number of outputs per leaf",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_base_score, "base_score", "Initial prediction",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_tree_roots, "tree_roots", "Root node of each tree",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_node_feature, "node_feature", "Split feature of each node",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_node_threshold, "node_threshold",
+			"Split threshold of each node", MS_NOT_AVAILABLE);
+	SG_ADD(&m_node_left, "node_left", "Left child of each node",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_node_right, "node_right", "Right child of each node",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_node_values, "node_values", "Output values of each node",
+			MS_NOT_AVAILABLE);
+}
+
+EProblemType CHistogramTreeEnsemble::get_machine_problem_type() const
+{
+	if (m_tree_roots.vlen==0 && m_labels)
+	{
+		switch (m_labels->get_label_type())
+		{
+			case LT_REGRESSION:
+				return PT_REGRESSION;
+			case LT_MULTICLASS:
+				return PT_MULTICLASS;
+			default:
+				return PT_BINARY;
+		}
+	}
+
+	return m_problem_type;
+}
+
+bool CHistogramTreeEnsemble::is_label_valid(CLabels* lab) const
+{
+	ELabelType type=lab->get_label_type();
+	return type==LT_BINARY || type==LT_REGRESSION || type==LT_MULTICLASS;
+}
+
+bool CHistogramTreeEnsemble::train_machine(CFeatures* data)
+{
+	REQUIRE(data, "Features are required to train %s\n", get_name());
+	REQUIRE(data->get_feature_type()==F_DREAL &&
+			(data->get_feature_class()==C_DENSE ||
+			data->get_feature_class()==C_SPARSE),
+			"%s requires real valued dense or sparse features\n", get_name());
+	REQUIRE(m_labels->get_num_labels()==data->get_num_vectors(),
+			"Number of labels (%d) does not match number of vectors (%d)\n",
+			m_labels->get_num_labels(), data->get_num_vectors());
+	REQUIRE(m_max_bins>=2 && m_max_bins<=256,
+			"Number of bins has to be in [2, 256], is %d\n", m_max_bins);
+	REQUIRE(m_num_trees>0, "Number of trees has to be positive\n");
+	REQUIRE(m_subsample>0, "Subsample fraction has to be positive\n");
+
+	int32_t num_threads=parallel->get_num_threads();
+	int32_t n=data->get_num_vectors();
+
+	BinnedData binned;
+	bin_features(data, m_max_bins, num_threads, binned);
+	int32_t d=binned.num_features;
+	REQUIRE(d>0, "Features have no dimensions\n");
+
+	m_num_features=d;
+	m_problem_type=get_machine_problem_type();
+	m_num_outputs=1;
+
+	/* targets: regression values, +1/-1 or class indices */
+	SGVector<float64_t> y=((CDenseLabels*) m_labels)->get_labels();
+	if (m_problem_type==PT_MULTICLASS)
+		m_num_outputs=((CMulticlassLabels*) m_labels)->get_num_classes();
+	int32_t k_max=m_num_outputs;
+
+	bool boosting=m_ensemble_type==TE_GRADIENT_BOOSTING;
+	int32_t num_split_features=m_num_split_features;
+	if (num_split_features<=0 || num_split_features>d)
+	{
+		if (boosting)
+			num_split_features=d;
+		else if (m_problem_type==PT_REGRESSION)
+			num_split_features=CMath::max(1, d/3);
+		else
+			num_split_features=CMath::max(1, (int32_t) CMath::sqrt((float64_t) d));
+	}
+
+	/* initial prediction */
+	m_base_score=SGVector<float64_t>(k_max);
+	m_base_score.zero();
+	if (boosting)
+	{
+		if (m_problem_type==PT_MULTICLASS)
+		{
+			for (int32_t i=0; i<n; i++)
+				m_base_score[(int32_t) y[i]]+=1.0/n;
+			for (int32_t k=0; k<k_max; k++)
+				m_base_score[k]=CMath::log(CMath::max(m_base_score[k], 1e-6));
+		}
+		else
+		{
+			float64_t mean=0;
+			for (int32_t i=0; i<n; i++)
+				mean+=m_problem_type==PT_BINARY ? (y[i]>0 ? 1.0 : 0.0) : y[i];
+			mean/=n;
+
+			if (m_problem_type==PT_BINARY)
+			{
+				mean=CMath::clamp(mean, 1e-6, 1-1e-6);
+				m_base_score[0]=CMath::log(mean/(1-mean));
+			}
+			else
+				m_base_score[0]=mean;
+		}
+	}
+
+	/* current ensemble outputs on the training data (boosting only) */
+	SGMatrix<float64_t> outputs;
+	if (boosting)
+	{
+		outputs=SGMatrix<float64_t>(k_max, n);
+		for (int32_t i=0; i<n; i++)
+			memcpy(outputs.get_column_vector(i), m_base_score.vector,
+					sizeof(float64_t)*k_max);
+	}
+
+	SGVector<float64_t> grad(int64_t(n)*k_max);
+	SGVector<float64_t> hess(int64_t(n)*k_max);
+	SGVector<float64_t> weight(n);
+
+	HistogramTreeBuilder builder;
+	builder.data=&binned;
+	builder.num_outputs=k_max;
+	builder.num_bins=m_max_bins;
+	builder.grad=grad.vector;
+	builder.hess=hess.vector;
+	builder.weight=weight.vector;
+	builder.max_depth=m_max_depth;
+	builder.min_samples_leaf=CMath::max(1, m_min_samples_leaf);
+	builder.num_split_features=num_split_features;
+	builder.lambda=boosting ? m_lambda : 0.0;
+	builder.scale=boosting ? m_learning_rate : 1.0/m_num_trees;
+	builder.num_threads=num_threads;
+
+	/* one random stream per tree, seeded from the global one */
+	SGVector<uint32_t> seeds(m_num_trees);
+	for (int32_t t=0; t<m_num_trees; t++)
+		seeds[t]=(uint32_t) CMath::random();
+
+	int32_t sample_size=CMath::max(1, (int32_t) CMath::round(m_subsample*n));
+	std::vector<int32_t> roots;
+	std::vector<int32_t> node_feature;
+	std::vector<float64_t> node_threshold;
+	std::vector<int32_t> node_left;
+	std::vector<int32_t> node_right;
+	std::vector<float64_t> node_values;
+	SGVector<index_t> perm;
+	if (boosting && sample_size<n)
+		perm=SGVector<index_t>(n);
+
+	for (int32_t t=0; t<m_num_trees; t++)
+	{
+		CRandom rng(seeds[t]);
+		builder.rng=&rng;
+
+		/* draw the vectors this tree is grown on */
+		if (!boosting)
+		{
+			weight.zero();
+			for (int32_t i=0; i<sample_size; i++)
+				weight[rng.random(0, n-1)]+=1.0;
+		}
+		else if (sample_size<n)
+		{
+			weight.zero();
+			perm.range_fill();
+			for (int32_t i=0; i<sample_size; i++)
+			{
+				int32_t j=rng.random(i, n-1);
+				CMath::swap(perm[i], perm[j]);
+				weight[perm[i]]=1.0;
+			}
+		}
+		else
+			weight.set_const(1.0);
+
+		/* first and second order statistics of the loss */
+		#pragma omp parallel for num_threads(num_threads)
+		for (int32_t i=0; i<n; i++)
+		{
+			float64_t* g=grad.vector+int64_t(i)*k_max;
+			float64_t* h=hess.vector+int64_t(i)*k_max;
+			float64_t w=weight[i];
+
+			if (!boosting)
+			{
+				/* squared loss around zero: the leaf value is the mean */
+				if (m_problem_type==PT_MULTICLASS)
+				{
+					for (int32_t k=0; k<k_max; k++)
+						g[k]=k==(int32_t) y[i] ? -w : 0;
+				}
+				else
+					g[0]=-w*y[i];
+
+				for (int32_t k=0; k<k_max; k++)
+					h[k]=w;
+			}
+			else if (m_problem_type==PT_REGRESSION)
+			{
+				g[0]=w*(outputs(0, i)-y[i]);
+				h[0]=w;
+			}
+			else if (m_problem_type==PT_BINARY)
+			{
+				float64_t p=1.0/(1.0+CMath::exp(-outputs(0, i)));
+				g[0]=w*(p-(y[i]>0 ? 1.0 : 0.0));
+				h[0]=w*CMath::max(p*(1-p), 1e-16);
+			}
+			else
+			{
+				float64_t* f=outputs.get_column_vector(i);
+				float64_t max_f=SGVector<float64_t>::max(f, k_max);
+				float64_t sum=0;
+				for (int32_t k=0; k<k_max; k++)
+				{
+					g[k]=CMath::exp(f[k]-max_f);
+					sum+=g[k];
+				}
+				for (int32_t k=0; k<k_max; k++)
+				{
+					float64_t p=g[k]/sum;
+					g[k]=w*(p-(k==(int32_t) y[i] ? 1.0 : 0.0));
+					h[k]=w*CMath::max(p*(1-p), 1e-16);
+				}
+			}
+		}
+
+		builder.build();
+
+		if (boosting)
+		{
+			#pragma omp parallel for num_threads(num_threads)
+			for (int32_t i=0; i<n; i++)
+			{
+				int32_t leaf=builder.get_leaf(i);
+				for (int32_t k=0; k<k_max; k++)
+					outputs(k, i)+=builder.values[leaf*k_max+k];
+			}
+		}
+
+		/* append the tree to the flat model */
+		int32_t offset=node_feature.size();
+		roots.push_back(offset);
+		for (size_t j=0; j<builder.feature.size(); j++)
+		{
+			node_feature.push_back(builder.feature[j]);
+			node_threshold.push_back(builder.threshold[j]);
+			node_left.push_back(builder.left[j]>=0 ? builder.left[j]+offset : -1);
+			node_right.push_back(builder.right[j]>=0 ? builder.right[j]+offset : -1);
+		}
+		node_values.insert(node_values.end(), builder.values.begin(),
+				builder.values.end());
+
+		SG_PROGRESS(t+1, 0, m_num_trees)
+	}
+
+	int32_t num_nodes=node_feature.size();
+	m_tree_roots=SGVector<int32_t>(roots.size());
+	std::copy(roots.begin(), roots.end(), m_tree_roots.vector);
+	m_node_feature=SGVector<int32_t>(num_nodes);
+	std::copy(node_feature.begin(), node_feature.end(), m_node_feature.vector);
+	m_node_threshold=SGVector<float64_t>(num_nodes);
+	std::copy(node_threshold.begin(), node_threshold.end(),
+			m_node_threshold.vector);
+	m_node_left=SGVector<int32_t>(num_nodes);
+	std::copy(node_left.begin(), node_left.end(), m_node_left.vector);
+	m_node_right=SGVector<int32_t>(num_nodes);
+	std::copy(node_right.begin(), node_right.end(), m_node_right.vector);
+	m_node_values=SGVector<float64_t>(node_values.size());
+	std::copy(node_values.begin(), node_values.end(), m_node_values.vector);
+
+	return true;
+}
+
+int32_t CHistogramTreeEnsemble::get_leaf(int32_t tree, const float64_t* x) const
+{
+	int32_t node=m_tree_roots[tree];
+	while (m_node_feature[node]>=0)
+	{
+		if (x[m_node_feature[node]]<=m_node_threshold[node])
+			node=m_node_left[node];
+		else
+			node=m_node_right[node];
+	}
+	return node;
+}
+
+SGMatrix<float64_t> CHistogramTreeEnsemble::apply_get_outputs(CFeatures* data)
+{
+	REQUIRE(data, "No features given\n");
+	REQUIRE(m_tree_roots.vlen>0, "%s is not trained\n", get_name());
+	REQUIRE(data->get_feature_type()==F_DREAL &&
+			(data->get_feature_class()==C_DENSE ||
+			data->get_feature_class()==C_SPARSE),
+			"%s requires real valued dense or sparse features\n", get_name());
+
+	int32_t n=data->get_num_vectors();
+	int32_t k_max=m_num_outputs;
+	SGMatrix<float64_t> outputs(k_max, n);
+
+	SGMatrix<float64_t> dense;
+	CSparseFeatures<float64_t>* sparse=NULL;
+	if (data->get_feature_class()==C_DENSE)
+	{
+		dense=((CDenseFeatures<float64_t>*) data)->get_feature_matrix();
+		REQUIRE(dense.num_rows==m_num_features, "Dimension of features (%d) "
+				"does not match the trained model (%d)\n", dense.num_rows,
+				m_num_features);
+	}
+	else
+		sparse=(CSparseFeatures<float64_t>*) data;
+
+	#pragma omp parallel num_threads(parallel->get_num_threads())
+	{
+		std::vector<float64_t> buffer(sparse ? m_num_features : 0, 0.0);
+
+		#pragma omp for schedule(static)
+		for (int32_t i=0; i<n; i++)
+		{
+			const float64_t* x=NULL;
+			SGSparseVector<float64_t> sv;
+			if (sparse)
+			{
+				sv=sparse->get_sparse_feature_vector(i);
+				for (int32_t j=0; j<sv.num_feat_entries; j++)
+				{
+					if (sv.features[j].feat_index<m_num_features)
+						buffer[sv.features[j].feat_index]=sv.features[j].entry;
+				}
+				x=&buffer[0];
+			}
+			else
+				x=dense.get_column_vector(i);
+
+			float64_t* out=outputs.get_column_vector(i);
+			memcpy(out, m_base_score.vector, sizeof(float64_t)*k_max);
+			for (int32_t t=0; t<m_tree_roots.vlen; t++)
+			{
+				const float64_t* v=m_node_values.vector+
+					int64_t(get_leaf(t, x))*k_max;
+				for (int32_t k=0; k<k_max; k++)
+					out[k]+=v[k];
+			}
+
+			if (sparse)
+			{
+				for (int32_t j=0; j<sv.num_feat_entries; j++)
+				{
+					if (sv.features[j].feat_index<m_num_features)
+						buffer[sv.features[j].feat_index]=0;
+				}
+				sparse->free_sparse_feature_vector(i);
+			}
+		}
+	}
+
+	return outputs;
+}
+
+CBinaryLabels* CHistogramTreeEnsemble::apply_binary(CFeatures* data)
+{
+	REQUIRE(m_problem_type==PT_BINARY, "%s was not trained on binary labels\n",
+			get_name());
+
+	SGMatrix<float64_t> outputs=apply_get_outputs(data);
+	SGVector<float64_t> values(outputs.num_cols);
+	memcpy(values.vector, outputs.matrix, sizeof(float64_t)*values.vlen);
+
+	return new CBinaryLabels(values);
+}
+
+CRegressionLabels* CHistogramTreeEnsemble::apply_regression(CFeatures* data)
+{
+	REQUIRE(m_problem_type==PT_REGRESSION, "%s was not trained on regression "
+			"labels\n", get_name());
+
+	SGMatrix<float64_t> outputs=apply_get_outputs(data);
+	SGVector<float64_t> values(outputs.num_cols);
+	memcpy(values.vector, outputs.matrix, sizeof(float64_t)*values.vlen);
+
+	return new CRegressionLabels(values);
+}
+
+CMulticlassLabels* CHistogramTreeEnsemble::apply_multiclass(CFeatures* data)
+{
+	REQUIRE(m_problem_type==PT_MULTICLASS, "%s was not trained on multiclass "
+			"labels\n", get_name());
+
+	SGMatrix<float64_t> outputs=apply_get_outputs(data);
+	int32_t k_max=m_num_outputs;
+	bool boosting=m_ensemble_type==TE_GRADIENT_BOOSTING;
+
+	SGVector<float64_t> classes(outputs.num_cols);
+	for (int32_t i=0; i<outputs.num_cols; i++)
+	{
+		float64_t* f=outputs.get_column_vector(i);
+		classes[i]=SGVector<float64_t>::arg_max(f, 1, k_max);
+
+		/* boosting outputs are logits */
+		if (boosting)
+		{
+			float64_t max_f=f[(int32_t) classes[i]];
+			float64_t sum=0;
+			for (int32_t k=0; k<k_max; k++)
+			{
+				f[k]=CMath::exp(f[k]-max_f);
+				sum+=f[k];
+			}
+			for (int32_t k=0; k<k_max; k++)
+				f[k]/=sum;
+		}
+	}
+
+	CMulticlassLabels* result=new CMulticlassLabels(classes);
+	result->allocate_confidences_for(k_max);
+	for (int32_t i=0; i<outputs.num_cols; i++)
+	{
+		SGVector<float64_t> confidences(k_max);
+		memcpy(confidences.vector, outputs.get_column_vector(i),
+				sizeof(float64_t)*k_max);
+		result->set_multiclass_confidences(i, confidences);
+	}
+
+	return result;
+}
@@ -0,0 +1,266 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#ifndef HISTOGRAMTREEENSEMBLE_H__
+#define HISTOGRAMTREEENSEMBLE_H__
+
+#include <shogun/lib/config.h>
+#include <shogun/machine/Machine.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/SGMatrix.h>
+
+namespace shogun
+{
+
+/** type of the tree ensemble */
+enum ETreeEnsembleType
+{
+	/** bootstrapped trees with random feature subsets, predictions are
+	 * averaged */
+	TE_RANDOM_FOREST = 0,
+	/** trees fitted stagewise to the gradient of the loss, predictions are
+	 * summed */
+	TE_GRADIENT_BOOSTING = 1
+};
+
+/** @brief Ensemble of CART-style decision trees (random forest or gradient
+ * boosted trees) using histogram based split finding.
+ *
+ * Before training, every feature is quantized into at most max_bins bins
+ * whose boundaries are quantiles of the feature values. The bin indices are
+ * stored column-wise as one byte per entry, such that the bins of one
+ * feature are contiguous in memory. Split finding then only needs to
+ * accumulate gradient statistics into per-feature histograms, which is done
+ * in parallel over the features. The histogram of the larger child of a
+ * node is obtained by subtracting the histogram of the smaller child from
+ * the parent's histogram.
+ *
+ * Trees are grown on the first and second order statistics of a loss:
+ * - regression: squared loss
+ * - binary classification: logistic loss (random forest: squared loss on
+ *   the +1/-1 labels)
+ * - multiclass classification: softmax loss (random forest: squared loss on
+ *   one-hot encoded labels, which is equivalent to the Gini criterion)
+ *
+ * Each tree stores one value per output in every leaf, multiclass problems
+ * therefore need a single tree per boosting round. The trained trees are
+ * stored in flat arrays and use the raw feature thresholds, so applying the
+ * model does not need the binning.
+ *
+ * Supported features are CDenseFeatures<float64_t> and
+ * CSparseFeatures<float64_t>. The problem type is determined by the type of
+ * the training labels (CRegressionLabels, CBinaryLabels or
+ * CMulticlassLabels).
+ */
+class CHistogramTreeEnsemble : public CMachine
+{
+public:
+	/** default constructor */
+	CHistogramTreeEnsemble();
+
+	/** constructor
+	 *
+	 * @param type ensemble type
+	 * @param num_trees number of trees (boosting rounds)
+	 * @param max_depth maximum depth of each tree
+	 */
+	CHistogramTreeEnsemble(ETreeEnsembleType type, int32_t num_trees=100,
+			int32_t max_depth=6);
+
+	/** destructor */
+	virtual ~CHistogramTreeEnsemble();
+
+	/** apply machine to data in means of binary classification problem.
+	 * Values are the averaged tree outputs for random forests and the
+	 * log-odds for gradient boosting.
+	 *
+	 * @param data features to apply the machine to
+	 * @return binary labels
+	 */
+	virtual CBinaryLabels* apply_binary(CFeatures* data=NULL);
+
+	/** apply machine to data in means of regression problem
+	 *
+	 * @param data features to apply the machine to
+	 * @return regression labels
+	 */
+	virtual CRegressionLabels* apply_regression(CFeatures* data=NULL);
+
+	/** apply machine to data in means of multiclass classification problem.
+	 * The class probabilities are stored as multiclass confidences.
+	 *
+	 * @param data features to apply the machine to
+	 * @return multiclass labels
+	 */
+	virtual CMulticlassLabels* apply_multiclass(CFeatures* data=NULL);
+
+	/** @return problem type of the trained model (or of the set labels) */
+	virtual EProblemType get_machine_problem_type() const;
+
+	/** @return machine type CT_HISTOGRAMTREEENSEMBLE */
+	virtual EMachineType get_classifier_type()
+	{
+		return CT_HISTOGRAMTREEENSEMBLE;
+	}
+
+	/** @param type ensemble type */
+	void set_ensemble_type(ETreeEnsembleType type) { m_ensemble_type=type; }
+
+	/** @return ensemble type */
+	ETreeEnsembleType get_ensemble_type() const { return m_ensemble_type; }
+
+	/** @param num_trees number of trees (boosting rounds) */
+	void set_num_trees(int32_t num_trees) { m_num_trees=num_trees; }
+
+	/** @return number of trees (boosting rounds) */
+	int32_t get_num_trees() const { return m_num_trees; }
+
+	/** @param max_depth maximum depth of each tree */
+	void set_max_depth(int32_t max_depth) { m_max_depth=max_depth; }
+
+	/** @return maximum depth of each tree */
+	int32_t get_max_depth() const { return m_max_depth; }
+
+	/** @param min_samples_leaf minimum number of (bootstrapped) training
+	 * vectors in a leaf */
+	void set_min_samples_leaf(int32_t min_samples_leaf)
+	{
+		m_min_samples_leaf=min_samples_leaf;
+	}
+
+	/** @return minimum number of training vectors in a leaf */
+	int32_t get_min_samples_leaf() const { return m_min_samples_leaf; }
+
+	/** @param max_bins number of histogram bins per feature, at most 256 */
+	void set_max_bins(int32_t max_bins) { m_max_bins=max_bins; }
+
+	/** @return number of histogram bins per feature */
+	int32_t get_max_bins() const { return m_max_bins; }
+
+	/** @param learning_rate shrinkage of every boosting round */
+	void set_learning_rate(float64_t learning_rate)
+	{
+		m_learning_rate=learning_rate;
+	}
+
+	/** @return shrinkage of every boosting round */
+	float64_t get_learning_rate() const { return m_learning_rate; }
+
+	/** @param lambda L2 regularization of the leaf values (boosting only) */
+	void set_lambda(float64_t lambda) { m_lambda=lambda; }
+
+	/** @return L2 regularization of the leaf values */
+	float64_t get_lambda() const { return m_lambda; }
+
+	/** @param subsample fraction of the training vectors each tree is grown
+	 * on. Random forests draw this many vectors with replacement, boosting
+	 * without replacement. */
+	void set_subsample(float64_t subsample) { m_subsample=subsample; }
+
+	/** @return fraction of training vectors each tree is grown on */
+	float64_t get_subsample() const { return m_subsample; }
+
+	/** @param num_split_features number of randomly chosen features that
+	 * are considered for every split, 0 selects sqrt(D) for random forest
+	 * classification, D/3 for random forest regression and D for boosting */
+	void set_num_split_features(int32_t num_split_features)
+	{
+		m_num_split_features=num_split_features;
+	}
+
+	/** @return number of features considered for every split */
+	int32_t get_num_split_features() const { return m_num_split_features; }
+
+	/** @return number of trees of the trained model */
+	int32_t get_num_trained_trees() const { return m_tree_roots.vlen; }
+
+	/** @return number of nodes of all trained trees */
+	int32_t get_num_nodes() const { return m_node_feature.vlen; }
+
+	/** @return object name */
+	virtual const char* get_name() const { return "HistogramTreeEnsemble"; }
+
+protected:
+	/** train the ensemble
+	 *
+	 * @param data training features, CDenseFeatures<float64_t> or
+	 * CSparseFeatures<float64_t>
+	 * @return whether training was successful
+	 */
+	virtual bool train_machine(CFeatures* data=NULL);
+
+	/** check whether labels are binary, regression or multiclass labels
+	 *
+	 * @param lab labels to check
+	 * @return whether labels are valid
+	 */
+	virtual bool is_label_valid(CLabels* lab) const;
+
+	/** computes the raw outputs of the ensemble
+	 *
+	 * @param data features to apply the ensemble to
+	 * @return num_outputs x num_vectors matrix of outputs
+	 */
+	SGMatrix<float64_t> apply_get_outputs(CFeatures* data);
+
+	/** follow a tree down to its leaf
+	 *
+	 * @param tree index of the tree
+	 * @param x dense feature vector
+	 * @return index of the leaf node
+	 */
+	int32_t get_leaf(int32_t tree, const float64_t* x) const;
+
+private:
+	void init();
+	void register_parameters();
+
+protected:
+	/** ensemble type */
+	ETreeEnsembleType m_ensemble_type;
+	/** number of trees */
+	int32_t m_num_trees;
+	/** maximum depth of a tree */
+	int32_t m_max_depth;
+	/** minimum number of training vectors in a leaf */
+	int32_t m_min_samples_leaf;
+	/** number of histogram bins per feature */
+	int32_t m_max_bins;
+	/** shrinkage of every boosting round */
+	float64_t m_learning_rate;
+	/** L2 regularization of leaf values */
+	float64_t m_lambda;
+	/** fraction of the training vectors each tree is grown on */
+	float64_t m_subsample;
+	/** number of features considered per split, 0 for default */
+	int32_t m_num_split_features;
+
+	/** problem type of the trained model */
+	EProblemType m_problem_type;
+	/** dimension of the feature space of the trained model */
+	int32_t m_num_features;
+	/** number of outputs per leaf (number of classes for multiclass) */
+	int32_t m_num_outputs;
+	/** initial prediction the tree outputs are added to */
+	SGVector<float64_t> m_base_score;
+	/** index of the root node of each tree */
+	SGVector<int32_t> m_tree_roots;
+	/** split feature of each node, -1 for leaves */
+	SGVector<int32_t> m_node_feature;
+	/** split threshold of each node, feature values <= threshold go left */
+	SGVector<float64_t> m_node_threshold;
+	/** index of the left child of each node */
+	SGVector<int32_t> m_node_left;
+	/** index of the right child of each node */
+	SGVector<int32_t> m_node_right;
+	/** num_outputs values of each node */
+	SGVector<float64_t> m_node_values;
+};
+}
+#endif /* HISTOGRAMTREEENSEMBLE_H__ */
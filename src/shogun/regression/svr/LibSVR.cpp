@@ -140,6 +140,9 @@ bool CLibSVR::train_machine(CFeatures* data)
 		create_new_model(num_sv);
 
 		CSVM::set_objective(model->objective);
+		CSVM::set_cache_statistics(model->cache_stats.hits,
+				model->cache_stats.misses, model->cache_stats.evaluations,
+				model->cache_stats.peak_memory);
 
 		set_bias(-model->rho[0]);
 
@@ -12,6 +12,7 @@
 #include <shogun/mathematics/Statistics.h>
 #include <shogun/kernel/Kernel.h>
 #include <shogun/kernel/CustomKernel.h>
+#include <shogun/base/Parallel.h>
 
 using namespace shogun;
 
@@ -291,39 +292,105 @@ SGVector<float64_t> CHSIC::bootstrap_null()
 {
 	SG_DEBUG("entering CHSIC::bootstrap_null()\n")
 
-	/* replace current kernel via precomputed custom kernel and call superclass
-	 * method */
-
-	/* backup references to old kernels */
-	CKernel* kernel_p=m_kernel_p;
-	CKernel* kernel_q=m_kernel_q;
-
-	/* init kernels before to be sure that everything is fine */
-	m_kernel_p->init(m_p_and_q, m_p_and_q);
-	m_kernel_q->init(m_p_and_q, m_p_and_q);
+	REQUIRE(m_kernel_p && m_kernel_q, "%s::bootstrap_null(): No or only one "
+			"kernel specified!\n", get_name());
 
-	/* precompute kernel matrices */
-	CCustomKernel* precomputed_p=new CCustomKernel(m_kernel_p);
-	CCustomKernel* precomputed_q=new CCustomKernel(m_kernel_q);
-	SG_REF(precomputed_p);
-	SG_REF(precomputed_q);
+	REQUIRE(m_p_and_q, "%s::bootstrap_null: features needed!\n", get_name())
 
-	/* temporarily replace own kernels */
-	m_kernel_p=precomputed_p;
-	m_kernel_q=precomputed_q;
+	/* precompute kernel matrices on all samples once, permutations are only
+	 * applied as index mappings on them */
+	SGMatrix<float64_t> kernel_matrix_p;
+	SGMatrix<float64_t> kernel_matrix_q;
+	if (m_kernel_p->get_kernel_type()!=K_CUSTOM)
+		m_kernel_p->init(m_p_and_q, m_p_and_q);
+	if (m_kernel_q->get_kernel_type()!=K_CUSTOM)
+		m_kernel_q->init(m_p_and_q, m_p_and_q);
+	kernel_matrix_p=m_kernel_p->get_kernel_matrix();
+	kernel_matrix_q=m_kernel_q->get_kernel_matrix();
 
-	/* use superclass bootstrapping which permutes custom kernels */
-	SGVector<float64_t> null_samples=
-			CKernelIndependenceTestStatistic::bootstrap_null();
+	index_t num_data=m_p_and_q->get_num_vectors();
+	REQUIRE(kernel_matrix_p.num_rows==num_data &&
+			kernel_matrix_q.num_rows==num_data, "%s::bootstrap_null(): Kernel "
+			"matrices (%d, %d) do not match number of samples (%d)!\n",
+			get_name(), kernel_matrix_p.num_rows, kernel_matrix_q.num_rows,
+			num_data);
 
-	/* restore kernels */
-	m_kernel_p=kernel_p;
-	m_kernel_q=kernel_q;
+	SGVector<float64_t> null_samples(m_bootstrap_iterations);
 
-	SG_UNREF(precomputed_p);
-	SG_UNREF(precomputed_q);
+	/* one seed for all permutation streams, see create_bootstrap_batch() */
+	uint32_t seed=sg_rand->random_32();
+	index_t num_batches=get_num_bootstrap_batches();
 
+	#pragma omp parallel for schedule(dynamic) num_threads(parallel->get_num_threads())
+	for (index_t batch=0; batch<num_batches; ++batch)
+	{
+		SGMatrix<index_t> permutations=create_bootstrap_batch(seed, batch,
+				num_data);
+		compute_bootstrap_batch(kernel_matrix_p, kernel_matrix_q, permutations,
+				null_samples.vector+batch*get_bootstrap_batch_size());
+	}
 
 	SG_DEBUG("leaving CHSIC::bootstrap_null()\n")
 	return null_samples;
 }
+
+void CHSIC::compute_bootstrap_batch(SGMatrix<float64_t> kernel_matrix_p,
+		SGMatrix<float64_t> kernel_matrix_q, SGMatrix<index_t> permutations,
+		float64_t* results)
+{
+	index_t m=m_m;
+	index_t num_data=kernel_matrix_p.num_rows;
+
+	/* row and column sums of K and L of the current permutation */
+	SGVector<float64_t> row_sums_K(m);
+	SGVector<float64_t> col_sums_K(m);
+	SGVector<float64_t> row_sums_L(m);
+	SGVector<float64_t> col_sums_L(m);
+
+	for (index_t t=0; t<permutations.num_cols; ++t)
+	{
+		/* K is on the first m permuted samples, L on the following m */
+		const index_t* ind_K=permutations.get_column_vector(t);
+		const index_t* ind_L=ind_K+m;
+
+		row_sums_K.zero();
+		col_sums_K.zero();
+		row_sums_L.zero();
+		col_sums_L.zero();
+
+		/* MATLAB: sum(sum(K' .* L)) along with the sums for centering */
+		float64_t cross=0;
+		for (index_t i=0; i<m; ++i)
+		{
+			const float64_t* col_K=kernel_matrix_p.matrix+
+					int64_t(ind_K[i])*num_data;
+			const float64_t* row_L=kernel_matrix_q.matrix+ind_L[i];
+
+			for (index_t j=0; j<m; ++j)
+			{
+				float64_t k=col_K[ind_K[j]];
+				float64_t l=row_L[int64_t(ind_L[j])*num_data];
+
+				cross+=k*l;
+				row_sums_K[j]+=k;
+				col_sums_K[i]+=k;
+				row_sums_L[i]+=l;
+				col_sums_L[j]+=l;
+			}
+		}
+
+		/* centering K=H*K*H expressed in terms of the sums, see
+		 * SGMatrix::center() */
+		float64_t sum_K=SGVector<float64_t>::sum(row_sums_K);
+		float64_t sum_L=SGVector<float64_t>::sum(row_sums_L);
+		float64_t result=cross+sum_K*sum_L/m/m;
+		for (index_t i=0; i<m; ++i)
+		{
+			result-=row_sums_K[i]*col_sums_L[i]/m;
+			result-=col_sums_K[i]*row_sums_L[i]/m;
+		}
+
+		/* return m times statistic */
+		results[t]=result/m;
+	}
+}
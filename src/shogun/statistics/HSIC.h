@@ -52,7 +52,8 @@ template<class T> class SGMatrix;
  *
  * BOOTSTRAPPING: For permuting available samples to sample null-distribution.
  * Bootstrapping is done on precomputed kernel matrices, since they have to
- * be stored anyway when the statistic is computed.
+ * be stored anyway when the statistic is computed. Permutations are applied
+ * as index mappings on them and are evaluated in parallel.
  *
  * A very basic method for kernel selection when using CGaussianKernel is to
  * use the median distance of the underlying data. See examples how to do that.
@@ -165,7 +166,8 @@ public:
 	/** merges both sets of samples and computes the test statistic
 	 * m_bootstrap_iteration times. This version precomputes the kenrel matrix
 	 * once by hand, then performs bootstrapping on this one. The matrix has
-	 * to be stored anyway when statistic is computed.
+	 * to be stored anyway when statistic is computed. Batches of
+	 * permutations are evaluated in parallel without copying the matrices.
 	 *
 	 * @return vector of all statistics
 	 */
@@ -178,6 +180,18 @@ protected:
 	/** @return kernel matrix on samples from q. Distinguishes CustomKernels */
 	SGMatrix<float64_t> get_kernel_matrix_L();
 
+	/** helper method to compute the statistic for a batch of permutations of
+	 * precomputed kernel matrices on all samples
+	 *
+	 * @param kernel_matrix_p kernel matrix of kernel for p on all samples
+	 * @param kernel_matrix_q kernel matrix of kernel for q on all samples
+	 * @param permutations permutations of samples, one per column
+	 * @param results the statistics of all permutations are written here
+	 */
+	void compute_bootstrap_batch(SGMatrix<float64_t> kernel_matrix_p,
+			SGMatrix<float64_t> kernel_matrix_q, SGMatrix<index_t> permutations,
+			float64_t* results);
+
 private:
 	void init();
 
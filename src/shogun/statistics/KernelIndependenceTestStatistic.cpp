@@ -11,6 +11,7 @@
 #include <shogun/features/Features.h>
 #include <shogun/kernel/Kernel.h>
 #include <shogun/kernel/CustomKernel.h>
+#include <shogun/mathematics/Math.h>
 
 using namespace shogun;
 
@@ -77,36 +78,44 @@ SGVector<float64_t> CKernelIndependenceTestStatistic::bootstrap_null()
 		/* allocate memory */
 		results=SGVector<float64_t>(m_bootstrap_iterations);
 
-		/* memory for index permutations, (would slow down loop) */
-		SGVector<index_t> ind_permutation(m_p_and_q->get_num_vectors());
-		ind_permutation.range_fill();
+		index_t num_data=m_p_and_q->get_num_vectors();
 
 		/* check if kernel is a custom kernel. In that case, changing features is
 		 * not what we want but just subsetting the kernel itself */
 		CCustomKernel* custom_kernel_p=(CCustomKernel*)m_kernel_p;
 		CCustomKernel* custom_kernel_q=(CCustomKernel*)m_kernel_q;
 
-		for (index_t i=0; i<m_bootstrap_iterations; ++i)
+		/* one seed for all permutation streams, see create_bootstrap_batch() */
+		uint32_t seed=sg_rand->random_32();
+
+		for (index_t batch=0; batch<get_num_bootstrap_batches(); ++batch)
 		{
-			/* idea: merge features of p and q, shuffle, and compute statistic.
-			 * This is done using subsets here. add to custom kernel since
-			 * it has no features to subset. CustomKernel has not to be
-			 * re-initialised after each subset setting */
-			SGVector<int32_t>::permute_vector(ind_permutation);
-
-			custom_kernel_p->add_row_subset(ind_permutation);
-			custom_kernel_p->add_col_subset(ind_permutation);
-			custom_kernel_q->add_row_subset(ind_permutation);
-			custom_kernel_q->add_col_subset(ind_permutation);
-
-			/* compute statistic for this permutation of mixed samples */
-			results[i]=compute_statistic();
-
-			/* remove subsets */
-			custom_kernel_p->remove_row_subset();
-			custom_kernel_p->remove_col_subset();
-			custom_kernel_q->remove_row_subset();
-			custom_kernel_q->remove_col_subset();
+			SGMatrix<index_t> permutations=create_bootstrap_batch(seed, batch,
+					num_data);
+
+			for (index_t i=0; i<permutations.num_cols; ++i)
+			{
+				/* idea: merge features of p and q, shuffle, and compute
+				 * statistic. This is done using subsets here. add to custom
+				 * kernel since it has no features to subset. CustomKernel has
+				 * not to be re-initialised after each subset setting */
+				SGVector<index_t> ind_permutation(
+						permutations.get_column_vector(i), num_data, false);
+
+				custom_kernel_p->add_row_subset(ind_permutation);
+				custom_kernel_p->add_col_subset(ind_permutation);
+				custom_kernel_q->add_row_subset(ind_permutation);
+				custom_kernel_q->add_col_subset(ind_permutation);
+
+				/* compute statistic for this permutation of mixed samples */
+				results[batch*get_bootstrap_batch_size()+i]=compute_statistic();
+
+				/* remove subsets */
+				custom_kernel_p->remove_row_subset();
+				custom_kernel_p->remove_col_subset();
+				custom_kernel_q->remove_row_subset();
+				custom_kernel_q->remove_col_subset();
+			}
 		}
 	}
 	else
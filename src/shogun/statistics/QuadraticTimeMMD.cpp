@@ -13,6 +13,7 @@
 #include <shogun/kernel/Kernel.h>
 #include <shogun/kernel/CombinedKernel.h>
 #include <shogun/kernel/CustomKernel.h>
+#include <shogun/base/Parallel.h>
 
 using namespace shogun;
 
@@ -253,6 +254,120 @@ SGVector<float64_t> CQuadraticTimeMMD::compute_statistic(
 	return mmds;
 }
 
+SGVector<float64_t> CQuadraticTimeMMD::bootstrap_null()
+{
+	REQUIRE(m_kernel, "%s::bootstrap_null(): No kernel set!\n", get_name());
+	REQUIRE(m_kernel->get_kernel_type()==K_CUSTOM || m_p_and_q,
+			"%s::bootstrap_null(): No features and no custom kernel set!\n",
+			get_name());
+
+	/* compute the kernel matrix once, permutations are only applied as index
+	 * mappings on it. In case of custom kernel, there are no features */
+	index_t num_data;
+	SGMatrix<float64_t> kernel_matrix;
+	if (m_kernel->get_kernel_type()==K_CUSTOM)
+	{
+		num_data=m_kernel->get_num_vec_lhs();
+		kernel_matrix=m_kernel->get_kernel_matrix();
+	}
+	else
+	{
+		num_data=2*m_m;
+		m_kernel->init(m_p_and_q, m_p_and_q);
+		kernel_matrix=m_kernel->get_kernel_matrix();
+	}
+
+	REQUIRE(kernel_matrix.num_rows>=num_data && kernel_matrix.num_cols>=num_data,
+			"%s::bootstrap_null(): Kernel matrix (%dx%d) is too small for %d "
+			"samples!\n", get_name(), kernel_matrix.num_rows,
+			kernel_matrix.num_cols, num_data);
+
+	SGVector<float64_t> results(m_bootstrap_iterations);
+
+	/* one seed for all permutation streams, see create_bootstrap_batch() */
+	uint32_t seed=sg_rand->random_32();
+	index_t num_batches=get_num_bootstrap_batches();
+
+	#pragma omp parallel for schedule(dynamic) num_threads(parallel->get_num_threads())
+	for (index_t batch=0; batch<num_batches; ++batch)
+	{
+		SGMatrix<index_t> permutations=create_bootstrap_batch(seed, batch,
+				num_data);
+		compute_bootstrap_batch(kernel_matrix, permutations,
+				results.vector+batch*get_bootstrap_batch_size());
+	}
+
+	return results;
+}
+
+void CQuadraticTimeMMD::compute_bootstrap_batch(
+		SGMatrix<float64_t> kernel_matrix, SGMatrix<index_t> permutations,
+		float64_t* results)
+{
+	index_t m=m_m;
+	index_t num_data=permutations.num_rows;
+	index_t num_permutations=permutations.num_cols;
+
+	/* sample a is in block groups[a*num_permutations+t] in permutation t,
+	 * where 0 is p, 1 is q and 2 means that the sample is not used */
+	SGVector<uint8_t> groups(num_data*num_permutations);
+	for (index_t t=0; t<num_permutations; ++t)
+	{
+		for (index_t pos=0; pos<num_data; ++pos)
+		{
+			index_t a=permutations(pos, t);
+			groups[a*num_permutations+t]=pos<m ? 0 : (pos<2*m ? 1 : 2);
+		}
+	}
+
+	/* sums of kernel values per pair of blocks (3x3) and of the diagonal per
+	 * block, for all permutations of the batch */
+	SGVector<float64_t> sums(9*num_permutations);
+	SGVector<float64_t> diag(3*num_permutations);
+	sums.zero();
+	diag.zero();
+
+	/* single pass over the kernel matrix for the whole batch */
+	for (index_t b=0; b<num_data; ++b)
+	{
+		const float64_t* col=kernel_matrix.get_column_vector(b);
+		const uint8_t* group_b=groups.vector+b*num_permutations;
+
+		for (index_t a=0; a<num_data; ++a)
+		{
+			const float64_t k=col[a];
+			const uint8_t* group_a=groups.vector+a*num_permutations;
+
+			for (index_t t=0; t<num_permutations; ++t)
+				sums[9*t+3*group_a[t]+group_b[t]]+=k;
+		}
+
+		for (index_t t=0; t<num_permutations; ++t)
+			diag[3*t+group_b[t]]+=col[b];
+	}
+
+	/* combine to the three terms of the statistic, see compute_statistic() */
+	for (index_t t=0; t<num_permutations; ++t)
+	{
+		float64_t first=sums[9*t];
+		float64_t second=sums[9*t+4];
+		float64_t third=sums[9*t+1]*2.0/m;
+
+		if (m_statistic_type==UNBIASED)
+		{
+			first=(first-diag[3*t])/(m-1);
+			second=(second-diag[3*t+1])/(m-1);
+		}
+		else
+		{
+			first/=m;
+			second/=m;
+		}
+
+		results[t]=first+second-third;
+	}
+}
+
 float64_t CQuadraticTimeMMD::compute_threshold(float64_t alpha)
 {
 	float64_t result=0;
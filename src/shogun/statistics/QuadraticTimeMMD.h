@@ -59,6 +59,8 @@ enum EQuadraticMMDType
  * Along with the statistic comes a method to compute a p-value based on
  * different methods. Bootstrapping, is also possible. If unsure which one to
  * use, bootstrapping with 250 iterations always is correct (but slow).
+ * Bootstrapping computes the kernel matrix once and evaluates batches of
+ * permutations in parallel, see bootstrap_null().
  *
  * To choose, use set_null_approximation_method() and choose from.
  *
@@ -143,6 +145,16 @@ class CQuadraticTimeMMD : public CKernelTwoSampleTestStatistic
 		 */
 		virtual SGVector<float64_t> compute_statistic(bool multiple_kernels);
 
+		/** merges both sets of samples and computes the test statistic
+		 * m_bootstrap_iteration times. The kernel matrix is computed once (or
+		 * taken from a custom kernel) and permutations are only applied as
+		 * index mappings to it. A batch of permutations is evaluated in a
+		 * single pass over the kernel matrix, batches run in parallel.
+		 *
+		 * @return vector of all statistics
+		 */
+		virtual SGVector<float64_t> bootstrap_null();
+
 		/** computes a p-value based on current method for approximating the
 		 * null-distribution. The p-value is the 1-p quantile of the null-
 		 * distribution where the given statistic lies in.
@@ -254,6 +266,16 @@ class CQuadraticTimeMMD : public CKernelTwoSampleTestStatistic
 		/** helper method to compute m*biased squared quadratic time MMD */
 		virtual float64_t compute_biased_statistic();
 
+		/** helper method to compute the statistic for a batch of permutations
+		 * in a single pass over the kernel matrix
+		 *
+		 * @param kernel_matrix kernel matrix on all samples
+		 * @param permutations permutations of samples, one per column
+		 * @param results the statistics of all permutations are written here
+		 */
+		void compute_bootstrap_batch(SGMatrix<float64_t> kernel_matrix,
+				SGMatrix<index_t> permutations, float64_t* results);
+
 	private:
 		void init();
 
@@ -0,0 +1,592 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/statistics/StreamingBlockMMD.h>
+#include <shogun/features/Features.h>
+#include <shogun/features/streaming/StreamingFeatures.h>
+#include <shogun/kernel/CombinedKernel.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/base/Parallel.h>
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+using namespace shogun;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+struct FETCH_BURST_THREAD_PARAM
+{
+	/** instance that streams */
+	CStreamingBlockMMD* mmd;
+	/** number of samples from each distribution */
+	index_t num_samples;
+	/** streamed samples of p */
+	CFeatures* p;
+	/** streamed samples of q */
+	CFeatures* q;
+};
+#endif
+
+/* sums kernel values of all pairs i!=j within each block of block_size
+ * consecutive samples. If both sides are the same samples, the kernel is
+ * assumed to be symmetric and only half of the pairs are evaluated */
+static void sum_blocks(CKernel* kernel, index_t block_size, index_t num_blocks,
+		bool same_samples, int32_t num_threads, float64_t* sums)
+{
+	#pragma omp parallel for num_threads(num_threads)
+	for (index_t b=0; b<num_blocks; ++b)
+	{
+		index_t offset=b*block_size;
+		float64_t sum=0;
+		for (index_t i=0; i<block_size; ++i)
+		{
+			for (index_t j=same_samples ? i+1 : 0; j<block_size; ++j)
+			{
+				if (i!=j)
+					sum+=kernel->kernel(offset+i, offset+j);
+			}
+		}
+		sums[b]=same_samples ? 2*sum : sum;
+	}
+}
+
+/* merges mean and comoment of terms b into a, see Chan et al. (1979) */
+static void merge_moments(index_t& num_a, float64_t* mean_a,
+		float64_t* comoment_a, index_t num_b, const float64_t* mean_b,
+		const float64_t* comoment_b, index_t num_kernels)
+{
+	if (!num_b)
+		return;
+
+	index_t num=num_a+num_b;
+	SGVector<float64_t> delta(num_kernels);
+	for (index_t k=0; k<num_kernels; ++k)
+		delta[k]=mean_b[k]-mean_a[k];
+
+	float64_t factor=float64_t(num_a)*num_b/num;
+	for (index_t k=0; k<num_kernels; ++k)
+	{
+		for (index_t l=0; l<num_kernels; ++l)
+		{
+			comoment_a[l*num_kernels+k]+=comoment_b[l*num_kernels+k]+
+					delta[k]*delta[l]*factor;
+		}
+		mean_a[k]+=delta[k]*num_b/num;
+	}
+
+	num_a=num;
+}
+
+CStreamingBlockMMD::CStreamingBlockMMD() : CLinearTimeMMD()
+{
+	init();
+}
+
+CStreamingBlockMMD::CStreamingBlockMMD(CKernel* kernel, CStreamingFeatures* p,
+		CStreamingFeatures* q, index_t m, index_t blocksize,
+		index_t mmd_block_size, index_t window_size) :
+		CLinearTimeMMD(kernel, p, q, m, blocksize)
+{
+	init();
+
+	REQUIRE(mmd_block_size>=2, "%s: MMD block size has to be at least 2, "
+			"%d given\n", get_name(), mmd_block_size);
+	REQUIRE(window_size>=1, "%s: Window size has to be positive, %d given\n",
+			get_name(), window_size);
+
+	m_mmd_block_size=mmd_block_size;
+	m_window_size=window_size;
+	reset_statistics();
+}
+
+CStreamingBlockMMD::~CStreamingBlockMMD()
+{
+}
+
+void CStreamingBlockMMD::init()
+{
+	SG_ADD(&m_mmd_block_size, "mmd_block_size", "Number of samples per term",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_window_size, "window_size", "Number of bursts in sliding window",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_prefetch, "prefetch", "Whether to stream in the background",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_num_terms, "num_terms", "Number of terms since reset",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_mean, "mean", "Mean of terms since reset", MS_NOT_AVAILABLE);
+	SG_ADD(&m_comoment, "comoment", "Comoment of terms since reset",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_window_num_terms, "window_num_terms",
+			"Number of terms of bursts in window", MS_NOT_AVAILABLE);
+	SG_ADD(&m_window_means, "window_means", "Means of bursts in window",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_window_comoments, "window_comoments",
+			"Comoments of bursts in window", MS_NOT_AVAILABLE);
+	SG_ADD(&m_window_pos, "window_pos", "Position of next burst in window",
+			MS_NOT_AVAILABLE);
+
+	m_mmd_block_size=2;
+	m_window_size=10;
+	m_prefetch=true;
+	m_num_terms=0;
+	m_window_pos=0;
+}
+
+index_t CStreamingBlockMMD::get_num_kernels() const
+{
+	REQUIRE(m_kernel, "%s: No kernel set!\n", get_name());
+
+	if (m_kernel->get_kernel_type()==K_COMBINED)
+		return ((CCombinedKernel*)m_kernel)->get_num_subkernels();
+
+	return 1;
+}
+
+void CStreamingBlockMMD::reset_statistics()
+{
+	index_t num_kernels=m_kernel ? get_num_kernels() : 0;
+
+	m_num_terms=0;
+	m_mean=SGVector<float64_t>(num_kernels);
+	m_mean.zero();
+	m_comoment=SGMatrix<float64_t>(num_kernels, num_kernels);
+	m_comoment.zero();
+
+	m_window_num_terms=SGVector<index_t>(m_window_size);
+	m_window_num_terms.zero();
+	m_window_means=SGMatrix<float64_t>(num_kernels, m_window_size);
+	m_window_means.zero();
+	m_window_comoments=SGMatrix<float64_t>(num_kernels*num_kernels,
+			m_window_size);
+	m_window_comoments.zero();
+	m_window_pos=0;
+}
+
+void CStreamingBlockMMD::set_mmd_block_size(index_t mmd_block_size)
+{
+	REQUIRE(mmd_block_size>=2, "%s::set_mmd_block_size(): MMD block size has "
+			"to be at least 2, %d given\n", get_name(), mmd_block_size);
+
+	m_mmd_block_size=mmd_block_size;
+	reset_statistics();
+}
+
+void CStreamingBlockMMD::set_window_size(index_t window_size)
+{
+	REQUIRE(window_size>=1, "%s::set_window_size(): Window size has to be "
+			"positive, %d given\n", get_name(), window_size);
+
+	m_window_size=window_size;
+	reset_statistics();
+}
+
+index_t CStreamingBlockMMD::get_num_window_terms() const
+{
+	index_t num_terms=0;
+	for (index_t i=0; i<m_window_num_terms.vlen; ++i)
+		num_terms+=m_window_num_terms[i];
+
+	return num_terms;
+}
+
+void CStreamingBlockMMD::fetch_burst(index_t num_samples, CFeatures*& p,
+		CFeatures*& q)
+{
+	p=m_streaming_p->get_streamed_features(num_samples);
+	q=m_streaming_q->get_streamed_features(num_samples);
+
+	/* check whether h0 should be simulated and permute if so */
+	if (m_simulate_h0)
+	{
+		CFeatures* merged=p->create_merged_copy(q);
+		SG_UNREF(p);
+		SG_UNREF(q);
+
+		SGVector<index_t> inds(merged->get_num_vectors());
+		inds.range_fill();
+		inds.permute();
+		merged->add_subset(inds);
+
+		/* copy back, note that copy_subset does a SG_REF */
+		SGVector<index_t> copy(num_samples);
+		copy.range_fill();
+		p=merged->copy_subset(copy);
+		copy.add(num_samples);
+		q=merged->copy_subset(copy);
+
+		SG_UNREF(merged);
+	}
+	else
+	{
+		SG_REF(p);
+		SG_REF(q);
+	}
+}
+
+#ifdef HAVE_PTHREAD
+void* CStreamingBlockMMD::fetch_burst_helper(void* params)
+{
+	FETCH_BURST_THREAD_PARAM* param=(FETCH_BURST_THREAD_PARAM*)params;
+	param->mmd->fetch_burst(param->num_samples, param->p, param->q);
+	return NULL;
+}
+#endif
+
+SGMatrix<float64_t> CStreamingBlockMMD::compute_terms(CFeatures* p,
+		CFeatures* q)
+{
+	index_t num_blocks=p->get_num_vectors()/m_mmd_block_size;
+	index_t num_kernels=get_num_kernels();
+	int32_t num_threads=parallel->get_num_threads();
+
+	SGMatrix<float64_t> terms(num_kernels, num_blocks);
+	SGVector<float64_t> pp(num_blocks);
+	SGVector<float64_t> qq(num_blocks);
+	SGVector<float64_t> pq(num_blocks);
+	float64_t normalization=m_mmd_block_size*(m_mmd_block_size-1);
+
+	for (index_t k=0; k<num_kernels; ++k)
+	{
+		CKernel* kernel=m_kernel;
+		if (m_kernel->get_kernel_type()==K_COMBINED)
+			kernel=((CCombinedKernel*)m_kernel)->get_kernel(k);
+		else
+			SG_REF(kernel);
+
+		kernel->init(p, p);
+		sum_blocks(kernel, m_mmd_block_size, num_blocks, true, num_threads,
+				pp.vector);
+		kernel->init(q, q);
+		sum_blocks(kernel, m_mmd_block_size, num_blocks, true, num_threads,
+				qq.vector);
+		kernel->init(p, q);
+		sum_blocks(kernel, m_mmd_block_size, num_blocks, false, num_threads,
+				pq.vector);
+
+		for (index_t b=0; b<num_blocks; ++b)
+			terms(k, b)=(pp[b]+qq[b]-2*pq[b])/normalization;
+
+		SG_UNREF(kernel);
+	}
+
+	return terms;
+}
+
+void CStreamingBlockMMD::add_terms(SGMatrix<float64_t> terms)
+{
+	index_t num_kernels=terms.num_rows;
+	index_t num_terms=terms.num_cols;
+
+	/* mean and comoment of this burst, Welford's online algorithm */
+	SGVector<float64_t> mean(num_kernels);
+	SGMatrix<float64_t> comoment(num_kernels, num_kernels);
+	SGVector<float64_t> delta(num_kernels);
+	mean.zero();
+	comoment.zero();
+	for (index_t t=0; t<num_terms; ++t)
+	{
+		for (index_t k=0; k<num_kernels; ++k)
+		{
+			delta[k]=terms(k, t)-mean[k];
+			mean[k]+=delta[k]/(t+1);
+		}
+
+		for (index_t l=0; l<num_kernels; ++l)
+		{
+			for (index_t k=0; k<num_kernels; ++k)
+				comoment(k, l)+=delta[k]*(terms(l, t)-mean[l]);
+		}
+	}
+
+	/* update estimates on all data */
+	merge_moments(m_num_terms, m_mean.vector, m_comoment.matrix, num_terms,
+			mean.vector, comoment.matrix, num_kernels);
+
+	/* replace oldest burst of the window */
+	m_window_num_terms[m_window_pos]=num_terms;
+	memcpy(m_window_means.get_column_vector(m_window_pos), mean.vector,
+			sizeof(float64_t)*num_kernels);
+	memcpy(m_window_comoments.get_column_vector(m_window_pos),
+			comoment.matrix, sizeof(float64_t)*num_kernels*num_kernels);
+	m_window_pos=(m_window_pos+1)%m_window_size;
+}
+
+void CStreamingBlockMMD::update(index_t num_samples)
+{
+	REQUIRE(m_streaming_p, "%s::update(): streaming features p required!\n",
+			get_name());
+	REQUIRE(m_streaming_q, "%s::update(): streaming features q required!\n",
+			get_name());
+
+	if (m_mean.vlen!=get_num_kernels())
+	{
+		REQUIRE(!m_num_terms, "%s::update(): Number of kernels changed, call "
+				"reset_statistics() first!\n", get_name());
+		reset_statistics();
+	}
+
+	/* bursts consist of complete blocks */
+	index_t burst_size=CMath::max(m_blocksize/m_mmd_block_size, 1)*
+			m_mmd_block_size;
+	index_t num_left=num_samples/m_mmd_block_size*m_mmd_block_size;
+	if (num_left<=0)
+		return;
+
+	CFeatures* p=NULL;
+	CFeatures* q=NULL;
+	index_t num_this_run=CMath::min(burst_size, num_left);
+	fetch_burst(num_this_run, p, q);
+	num_left-=num_this_run;
+
+	while (p)
+	{
+		CFeatures* next_p=NULL;
+		CFeatures* next_q=NULL;
+		index_t num_next_run=CMath::min(burst_size, num_left);
+		num_left-=num_next_run;
+
+		SG_DEBUG("processing burst of %d samples, %d samples left\n",
+				p->get_num_vectors(), num_left+num_next_run);
+
+		/* stream next burst while this one is evaluated */
+		bool prefetching=false;
+#ifdef HAVE_PTHREAD
+		pthread_t thread;
+		FETCH_BURST_THREAD_PARAM params;
+		if (m_prefetch && num_next_run>0)
+		{
+			params.mmd=this;
+			params.num_samples=num_next_run;
+			params.p=NULL;
+			params.q=NULL;
+			prefetching=!pthread_create(&thread, NULL,
+					CStreamingBlockMMD::fetch_burst_helper, (void*)&params);
+		}
+#endif
+
+		SGMatrix<float64_t> terms=compute_terms(p, q);
+
+#ifdef HAVE_PTHREAD
+		if (prefetching)
+		{
+			pthread_join(thread, NULL);
+			next_p=params.p;
+			next_q=params.q;
+		}
+#endif
+		if (!prefetching && num_next_run>0)
+			fetch_burst(num_next_run, next_p, next_q);
+
+		add_terms(terms);
+
+		SG_UNREF(p);
+		SG_UNREF(q);
+		p=next_p;
+		q=next_q;
+	}
+}
+
+void CStreamingBlockMMD::ensure_data()
+{
+	if (!m_num_terms)
+		update(m_m);
+}
+
+void CStreamingBlockMMD::merge_window(index_t& num_terms,
+		SGVector<float64_t>& mean, SGMatrix<float64_t>& comoment)
+{
+	index_t num_kernels=m_mean.vlen;
+
+	num_terms=0;
+	mean=SGVector<float64_t>(num_kernels);
+	comoment=SGMatrix<float64_t>(num_kernels, num_kernels);
+	mean.zero();
+	comoment.zero();
+
+	for (index_t i=0; i<m_window_size; ++i)
+	{
+		merge_moments(num_terms, mean.vector, comoment.matrix,
+				m_window_num_terms[i], m_window_means.get_column_vector(i),
+				m_window_comoments.get_column_vector(i), num_kernels);
+	}
+}
+
+void CStreamingBlockMMD::get_statistic_and_variance(index_t num_terms,
+		SGVector<float64_t> mean, SGMatrix<float64_t> comoment,
+		SGVector<float64_t>& statistic, SGVector<float64_t>& variance,
+		bool multiple_kernels)
+{
+	/* make sure multiple_kernels flag is used only with a combined kernel */
+	REQUIRE(!multiple_kernels || m_kernel->get_kernel_type()==K_COMBINED,
+			"%s::compute_statistic_and_variance: multiple kernels specified,"
+			"but underlying kernel is not of type K_COMBINED\n", get_name());
+
+	REQUIRE(num_terms>1, "%s::compute_statistic_and_variance: At least two "
+			"terms are needed, %d processed\n", get_name(), num_terms);
+
+	index_t num_kernels=mean.vlen;
+	index_t num_results=multiple_kernels ? num_kernels : 1;
+
+	/* allocate memory for results if vectors are empty */
+	if (!statistic.vector)
+		statistic=SGVector<float64_t>(num_results);
+
+	if (!variance.vector)
+		variance=SGVector<float64_t>(num_results);
+
+	/* ensure right dimensions */
+	REQUIRE(statistic.vlen==num_results, "%s::compute_statistic_and_variance: "
+			"statistic vector size (%d) does not match number of kernels (%d)\n",
+			 get_name(), statistic.vlen, num_results);
+
+	REQUIRE(variance.vlen==num_results, "%s::compute_statistic_and_variance: "
+			"variance vector size (%d) does not match number of kernels (%d)\n",
+			 get_name(), variance.vlen, num_results);
+
+	/* variance of terms divided by number of terms gives variance of mean */
+	float64_t normalization=float64_t(num_terms-1)*num_terms;
+
+	if (multiple_kernels || num_kernels==1)
+	{
+		for (index_t k=0; k<num_results; ++k)
+		{
+			statistic[k]=mean[k];
+			variance[k]=comoment(k, k)/normalization;
+		}
+	}
+	else
+	{
+		/* terms are linear in the kernel, so a combination of kernels has
+		 * mean w'*mean and variance w'*C*w */
+		SGVector<float64_t> weights=
+				((CCombinedKernel*)m_kernel)->get_subkernel_weights();
+
+		statistic[0]=0;
+		variance[0]=0;
+		for (index_t k=0; k<num_kernels; ++k)
+		{
+			statistic[0]+=weights[k]*mean[k];
+			for (index_t l=0; l<num_kernels; ++l)
+				variance[0]+=weights[k]*comoment(k, l)*weights[l];
+		}
+		variance[0]/=normalization;
+	}
+}
+
+void CStreamingBlockMMD::compute_statistic_and_variance(
+		SGVector<float64_t>& statistic, SGVector<float64_t>& variance,
+		bool multiple_kernels)
+{
+	ensure_data();
+
+	index_t num_terms;
+	SGVector<float64_t> mean;
+	SGMatrix<float64_t> comoment;
+	merge_window(num_terms, mean, comoment);
+
+	get_statistic_and_variance(num_terms, mean, comoment, statistic, variance,
+			multiple_kernels);
+}
+
+void CStreamingBlockMMD::get_total_statistic_and_variance(
+		SGVector<float64_t>& statistic, SGVector<float64_t>& variance,
+		bool multiple_kernels)
+{
+	ensure_data();
+
+	get_statistic_and_variance(m_num_terms, m_mean, m_comoment, statistic,
+			variance, multiple_kernels);
+}
+
+void CStreamingBlockMMD::compute_statistic_and_Q(
+		SGVector<float64_t>& statistic, SGMatrix<float64_t>& Q)
+{
+	REQUIRE(m_kernel && m_kernel->get_kernel_type()==K_COMBINED,
+			"%s::compute_statistic_and_Q: underlying kernel is not of "
+			"type K_COMBINED\n", get_name());
+
+	ensure_data();
+
+	index_t num_terms;
+	SGVector<float64_t> mean;
+	SGMatrix<float64_t> comoment;
+	merge_window(num_terms, mean, comoment);
+
+	REQUIRE(num_terms>1, "%s::compute_statistic_and_Q: At least two terms are "
+			"needed, %d processed\n", get_name(), num_terms);
+
+	index_t num_kernels=mean.vlen;
+
+	/* allocate memory for results if vectors are empty */
+	if (!statistic.vector)
+		statistic=SGVector<float64_t>(num_kernels);
+
+	if (!Q.matrix)
+		Q=SGMatrix<float64_t>(num_kernels, num_kernels);
+
+	/* ensure right dimensions */
+	REQUIRE(statistic.vlen==num_kernels, "%s::compute_statistic_and_Q: "
+			"statistic vector size (%d) does not match number of kernels (%d)\n",
+			 get_name(), statistic.vlen, num_kernels);
+
+	REQUIRE(Q.num_rows==num_kernels && Q.num_cols==num_kernels,
+			"%s::compute_statistic_and_Q: Q size (%dx%d) does not match number "
+			"of kernels (%d)\n", get_name(), Q.num_rows, Q.num_cols,
+			num_kernels);
+
+	/* Q is the expectation of the product of differences of two independent
+	 * terms, i.e. twice their covariance (expression 7 of NIPS paper) */
+	for (index_t k=0; k<num_kernels; ++k)
+	{
+		statistic[k]=mean[k];
+		for (index_t l=0; l<num_kernels; ++l)
+			Q(k, l)=2*comoment(k, l)/(num_terms-1);
+	}
+}
+
+SGVector<float64_t> CStreamingBlockMMD::bootstrap_null()
+{
+	SGVector<float64_t> samples(m_bootstrap_iterations);
+
+	/* back up online estimates, they are used for the null samples */
+	index_t num_terms=m_num_terms;
+	SGVector<float64_t> mean=m_mean.clone();
+	SGMatrix<float64_t> comoment=m_comoment.clone();
+	SGVector<index_t> window_num_terms=m_window_num_terms.clone();
+	SGMatrix<float64_t> window_means=m_window_means.clone();
+	SGMatrix<float64_t> window_comoments=m_window_comoments.clone();
+	index_t window_pos=m_window_pos;
+
+	/* instead of permutating samples, just stream new mixed data */
+	bool old=m_simulate_h0;
+	set_simulate_h0(true);
+	for (index_t i=0; i<m_bootstrap_iterations; ++i)
+	{
+		reset_statistics();
+		update(m_m);
+
+		SGVector<float64_t> statistic;
+		SGVector<float64_t> variance;
+		get_statistic_and_variance(m_num_terms, m_mean, m_comoment, statistic,
+				variance, false);
+		samples[i]=statistic[0];
+	}
+	set_simulate_h0(old);
+
+	m_num_terms=num_terms;
+	m_mean=mean;
+	m_comoment=comoment;
+	m_window_num_terms=window_num_terms;
+	m_window_means=window_means;
+	m_window_comoments=window_comoments;
+	m_window_pos=window_pos;
+
+	return samples;
+}
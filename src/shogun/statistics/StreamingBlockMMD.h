@@ -0,0 +1,249 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#ifndef __STREAMINGBLOCKMMD_H_
+#define __STREAMINGBLOCKMMD_H_
+
+#include <shogun/lib/config.h>
+#include <shogun/statistics/LinearTimeMMD.h>
+
+namespace shogun
+{
+
+class CStreamingFeatures;
+class CFeatures;
+
+/** @brief Streaming block MMD for continuous monitoring at constant memory.
+ *
+ * Data from both distributions is consumed incrementally by update(). The
+ * samples are split into blocks of \f$B\f$ samples from p and q, and every
+ * block gives one term of the statistic
+ * \f[
+ * h_b=\frac{1}{B(B-1)}\sum_{i\neq j}k(x_i,x_j)+k(y_i,y_j)-k(x_i,y_j)-k(x_j,y_i)
+ * \f]
+ * For \f$B=2\f$ this is the term of the linear time MMD (see CLinearTimeMMD),
+ * larger blocks give the block MMD, which has a lower variance at the price of
+ * \f$B\f$ times more kernel evaluations.
+ *
+ * Mean and covariance of the terms are updated online for all sub-kernels if
+ * the kernel is a CCombinedKernel. The statistics of a combination of kernels
+ * are derived from them with the current sub-kernel weights. They are kept
+ * both for all data seen so far and for a sliding window over the last
+ * bursts of data (of m_blocksize samples each). All methods of
+ * CLinearTimeMMD that compute statistics, variances or the Q matrix report the
+ * estimates on the current window instead of streaming new data. Only if no
+ * data has been processed yet, m samples are streamed first. Therefore, kernel
+ * selection (CMMDKernelSelectionOpt, CMMDKernelSelectionCombMaxL2, ...) works
+ * on the sliding window when used with this class.
+ *
+ * While a burst is evaluated (in parallel over its blocks), the next burst is
+ * fetched from the streaming features in the background.
+ */
+class CStreamingBlockMMD: public CLinearTimeMMD
+{
+public:
+	/** default constructor */
+	CStreamingBlockMMD();
+
+	/** constructor
+	 *
+	 * @param kernel kernel to use, if combined all sub-kernels are monitored
+	 * @param p streaming features p to use
+	 * @param q streaming features q to use
+	 * @param m number of samples to stream from each distribution if a
+	 * statistic is requested before any data was processed
+	 * @param blocksize number of samples from each distribution that are
+	 * streamed at once (one burst)
+	 * @param mmd_block_size number of samples per term of the statistic
+	 * (2 gives the linear time MMD)
+	 * @param window_size number of bursts in the sliding window
+	 */
+	CStreamingBlockMMD(CKernel* kernel, CStreamingFeatures* p,
+			CStreamingFeatures* q, index_t m, index_t blocksize=10000,
+			index_t mmd_block_size=2, index_t window_size=10);
+
+	/** destructor */
+	virtual ~CStreamingBlockMMD();
+
+	/** streams new samples from both distributions and updates all online
+	 * estimates. The number of samples is rounded down to a multiple of the
+	 * MMD block size.
+	 *
+	 * Note that the underlying streaming feature parsers have to be started
+	 * before this is called.
+	 *
+	 * @param num_samples number of samples to stream from each distribution
+	 */
+	void update(index_t num_samples);
+
+	/** removes all online estimates, needs to be called when the kernel (not
+	 * its weights) is changed */
+	void reset_statistics();
+
+	/** estimates on the sliding window, see class description
+	 *
+	 * @param statistic return parameter for statistic, one entry per kernel
+	 * @param variance return parameter for the variance of the statistic
+	 * @param multiple_kernels whether each sub-kernel is reported separately
+	 */
+	virtual void compute_statistic_and_variance(
+			SGVector<float64_t>& statistic, SGVector<float64_t>& variance,
+			bool multiple_kernels=false);
+
+	/** estimates of the statistic and of the Q matrix (twice the covariance
+	 * of the terms) for all sub-kernels on the sliding window
+	 *
+	 * @param statistic return parameter for statistic of all sub-kernels
+	 * @param Q return parameter for Q matrix
+	 */
+	virtual void compute_statistic_and_Q(
+			SGVector<float64_t>& statistic, SGMatrix<float64_t>& Q);
+
+	/** same as compute_statistic_and_variance() for all data processed since
+	 * the last reset
+	 *
+	 * @param statistic return parameter for statistic, one entry per kernel
+	 * @param variance return parameter for the variance of the statistic
+	 * @param multiple_kernels whether each sub-kernel is reported separately
+	 */
+	void get_total_statistic_and_variance(SGVector<float64_t>& statistic,
+			SGVector<float64_t>& variance, bool multiple_kernels=false);
+
+	/** samples the null distribution on newly streamed and mixed data. The
+	 * online estimates are not changed.
+	 *
+	 * @return vector of all statistics
+	 */
+	virtual SGVector<float64_t> bootstrap_null();
+
+	/** @param mmd_block_size number of samples per term, at least 2 */
+	void set_mmd_block_size(index_t mmd_block_size);
+
+	/** @return number of samples per term */
+	index_t get_mmd_block_size() const { return m_mmd_block_size; }
+
+	/** @param window_size number of bursts in the sliding window */
+	void set_window_size(index_t window_size);
+
+	/** @return number of bursts in the sliding window */
+	index_t get_window_size() const { return m_window_size; }
+
+	/** @param prefetch whether the next burst is streamed in the background */
+	void set_prefetch(bool prefetch) { m_prefetch=prefetch; }
+
+	/** @return whether the next burst is streamed in the background */
+	bool get_prefetch() const { return m_prefetch; }
+
+	/** @return number of terms processed since the last reset */
+	index_t get_num_terms() const { return m_num_terms; }
+
+	/** @return number of terms in the sliding window */
+	index_t get_num_window_terms() const;
+
+	virtual const char* get_name() const
+	{
+		return "StreamingBlockMMD";
+	}
+
+protected:
+	/** streams a burst of samples from both distributions, mixes them if h0
+	 * is simulated. Both returned features are SG_REF'ed.
+	 *
+	 * @param num_samples number of samples from each distribution
+	 * @param p streamed samples of p
+	 * @param q streamed samples of q
+	 */
+	void fetch_burst(index_t num_samples, CFeatures*& p, CFeatures*& q);
+
+	/** computes the terms of all blocks of a burst for all kernels
+	 *
+	 * @param p samples of p
+	 * @param q samples of q
+	 * @return terms, one column per block and one row per kernel
+	 */
+	SGMatrix<float64_t> compute_terms(CFeatures* p, CFeatures* q);
+
+	/** adds the terms of a burst to the online estimates
+	 *
+	 * @param terms terms, one column per block and one row per kernel
+	 */
+	void add_terms(SGMatrix<float64_t> terms);
+
+	/** merges the estimates of the sliding window
+	 *
+	 * @param num_terms number of terms in the window
+	 * @param mean mean of the terms
+	 * @param comoment sum of outer products of the centered terms
+	 */
+	void merge_window(index_t& num_terms, SGVector<float64_t>& mean,
+			SGMatrix<float64_t>& comoment);
+
+	/** reports statistic and variance from mean and comoment of the terms
+	 *
+	 * @param num_terms number of terms
+	 * @param mean mean of the terms
+	 * @param comoment sum of outer products of the centered terms
+	 * @param statistic return parameter for statistic
+	 * @param variance return parameter for variance of statistic
+	 * @param multiple_kernels whether each sub-kernel is reported separately
+	 */
+	void get_statistic_and_variance(index_t num_terms,
+			SGVector<float64_t> mean, SGMatrix<float64_t> comoment,
+			SGVector<float64_t>& statistic, SGVector<float64_t>& variance,
+			bool multiple_kernels);
+
+	/** streams m samples if nothing was processed yet */
+	void ensure_data();
+
+	/** @return number of monitored kernels (sub-kernels if combined) */
+	index_t get_num_kernels() const;
+
+#ifdef HAVE_PTHREAD
+	/** thread function for fetching a burst in the background */
+	static void* fetch_burst_helper(void* params);
+#endif
+
+private:
+	void init();
+
+protected:
+	/** number of samples per term */
+	index_t m_mmd_block_size;
+
+	/** number of bursts in the sliding window */
+	index_t m_window_size;
+
+	/** whether next burst is streamed in the background */
+	bool m_prefetch;
+
+	/** number of terms since last reset */
+	index_t m_num_terms;
+
+	/** mean of terms since last reset, one entry per kernel */
+	SGVector<float64_t> m_mean;
+
+	/** sum of outer products of centered terms since last reset */
+	SGMatrix<float64_t> m_comoment;
+
+	/** number of terms of the bursts in the window */
+	SGVector<index_t> m_window_num_terms;
+
+	/** means of the bursts in the window, one column per burst */
+	SGMatrix<float64_t> m_window_means;
+
+	/** comoments of the bursts in the window, one column per burst */
+	SGMatrix<float64_t> m_window_comoments;
+
+	/** position in the window where the next burst is stored */
+	index_t m_window_pos;
+};
+
+}
+
+#endif /* __STREAMINGBLOCKMMD_H_ */
@@ -9,6 +9,8 @@
 
 #include <shogun/statistics/TwoDistributionsTestStatistic.h>
 #include <shogun/features/Features.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/Random.h>
 
 using namespace shogun;
 
@@ -68,30 +70,67 @@ SGVector<float64_t> CTwoDistributionsTestStatistic::bootstrap_null()
 	/* compute bootstrap statistics for null distribution */
 	SGVector<float64_t> results(m_bootstrap_iterations);
 
-	/* memory for index permutations. Adding of subset has to happen
-	 * inside the loop since it may be copied if there already is one set */
-	SGVector<index_t> ind_permutation(2*m_m);
-	ind_permutation.range_fill();
+	/* one seed for all permutation streams, taken from the global generator */
+	uint32_t seed=sg_rand->random_32();
 
-	for (index_t i=0; i<m_bootstrap_iterations; ++i)
+	for (index_t batch=0; batch<get_num_bootstrap_batches(); ++batch)
 	{
 		/* idea: merge features of p and q, shuffle, and compute statistic.
-		 * This is done using subsets here */
-
-		/* create index permutation and add as subset. This will mix samples
-		 * from p and q */
-		SGVector<int32_t>::permute_vector(ind_permutation);
-
-		/* compute statistic for this permutation of mixed samples */
-		m_p_and_q->add_subset(ind_permutation);
-		results[i]=compute_statistic();
-		m_p_and_q->remove_subset();
+		 * This is done using subsets here. Adding of subset has to happen
+		 * inside the loop since it may be copied if there already is one set */
+		SGMatrix<index_t> permutations=create_bootstrap_batch(seed, batch,
+				2*m_m);
+
+		for (index_t i=0; i<permutations.num_cols; ++i)
+		{
+			/* create index permutation and add as subset. This will mix
+			 * samples from p and q */
+			SGVector<index_t> ind_permutation(permutations.get_column_vector(i),
+					permutations.num_rows, false);
+
+			/* compute statistic for this permutation of mixed samples */
+			m_p_and_q->add_subset(ind_permutation);
+			results[batch*get_bootstrap_batch_size()+i]=compute_statistic();
+			m_p_and_q->remove_subset();
+		}
 	}
 
 	SG_DEBUG("leaving CTwoDistributionsTestStatistic::bootstrap_null()\n")
 	return results;
 }
 
+index_t CTwoDistributionsTestStatistic::get_num_bootstrap_batches() const
+{
+	return (m_bootstrap_iterations+get_bootstrap_batch_size()-1)/
+			get_bootstrap_batch_size();
+}
+
+SGMatrix<index_t> CTwoDistributionsTestStatistic::create_bootstrap_batch(
+		uint32_t seed, index_t batch, index_t num_data) const
+{
+	index_t first=batch*get_bootstrap_batch_size();
+	index_t num_permutations=CMath::min(get_bootstrap_batch_size(),
+			m_bootstrap_iterations-first);
+
+	SGMatrix<index_t> permutations(num_data, num_permutations);
+
+	/* permutations of a batch are drawn consecutively from its own stream */
+	CRandom* random=new CRandom(seed+batch);
+	SG_REF(random);
+
+	SGVector<index_t> ind_permutation(num_data);
+	ind_permutation.range_fill();
+	for (index_t i=0; i<num_permutations; ++i)
+	{
+		SGVector<index_t>::permute(ind_permutation.vector, num_data, random);
+		memcpy(permutations.get_column_vector(i), ind_permutation.vector,
+				sizeof(index_t)*num_data);
+	}
+
+	SG_UNREF(random);
+	return permutations;
+}
+
 float64_t CTwoDistributionsTestStatistic::compute_p_value(
 		float64_t statistic)
 {
@@ -11,6 +11,7 @@
 #define __TwoDistributionsTestStatistic_H_
 
 #include <shogun/statistics/TestStatistic.h>
+#include <shogun/lib/SGMatrix.h>
 
 namespace shogun
 {
@@ -26,6 +27,10 @@ class CFeatures;
  * the null distribution via bootstrapping, i.e. repeatedly merging both samples
  * and them compute the test statistic on them.
  *
+ * The permutations that are used for bootstrapping are drawn in batches.
+ * Every batch has its own random stream whose seed is derived from one number
+ * drawn from the global random generator, so the null samples only depend on
+ * the global seed, even if subclasses evaluate batches in parallel.
  */
 class CTwoDistributionsTestStatistic : public CTestStatistic
 {
@@ -99,6 +104,26 @@ class CTwoDistributionsTestStatistic : public CTestStatistic
 
 		virtual const char* get_name() const=0;
 
+	protected:
+		/** @return number of batches of permutations for bootstrapping */
+		index_t get_num_bootstrap_batches() const;
+
+		/** creates a batch of permutations for bootstrapping. Permutations of
+		 * batch i are used for the null samples starting at
+		 * i*get_bootstrap_batch_size().
+		 *
+		 * @param seed seed of the permutation streams, the random stream of a
+		 * batch is seeded with seed+batch
+		 * @param batch index of the batch
+		 * @param num_data number of indices to permute
+		 * @return permutations of 0,...,num_data-1, one per column
+		 */
+		SGMatrix<index_t> create_bootstrap_batch(uint32_t seed, index_t batch,
+				index_t num_data) const;
+
+		/** @return number of permutations per batch */
+		static index_t get_bootstrap_batch_size() { return 16; }
+
 	private:
 		void init();
 
@@ -11,10 +11,13 @@
 #include <shogun/structure/BeliefPropagation.h>
 #include <shogun/lib/DynamicObjectArray.h>
 #include <shogun/io/SGIO.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/mathematics/Math.h>
 #include <numeric>
 #include <algorithm>
 #include <functional>
 #include <stack>
+#include <queue>
 
 using namespace shogun;
 
@@ -555,3 +558,360 @@ void CTreeMaxProduct::top_down_pass()
 	SG_DEBUG("***leave top_down_pass().\n");
 }
 
+
+// -----------------------------------------------------------------
+
+CLoopyMaxProduct::CLoopyMaxProduct()
+	: CBeliefPropagation()
+{
+	SG_UNSTABLE("CLoopyMaxProduct::CLoopyMaxProduct()", "\n");
+
+	init();
+}
+
+CLoopyMaxProduct::CLoopyMaxProduct(CFactorGraph* fg)
+	: CBeliefPropagation(fg)
+{
+	ASSERT(m_fg != NULL);
+
+	init();
+
+	m_cards = m_fg->get_cardinalities();
+	int32_t num_vars = m_cards.size();
+	int32_t num_edges = m_fg->get_num_edges();
+	CDynamicObjectArray* facs = m_fg->get_factors();
+	int32_t num_facs = facs->get_num_elements();
+
+	m_fac_edges = SGVector<int32_t>(num_facs+1);
+	m_energy_offsets = SGVector<int32_t>(num_facs+1);
+	m_edge_fac = SGVector<int32_t>(num_edges);
+	m_edge_var = SGVector<int32_t>(num_edges);
+	m_edge_stride = SGVector<int32_t>(num_edges);
+	m_msg_offsets = SGVector<int32_t>(num_edges+1);
+	m_var_edge_ptr = SGVector<int32_t>(num_vars+1);
+	m_var_edge_ptr.zero();
+
+	// number edges by factors, the variables of a factor are consecutive
+	int32_t ei = 0;
+	m_fac_edges[0] = 0;
+	m_energy_offsets[0] = 0;
+	m_msg_offsets[0] = 0;
+	for (int32_t fi = 0; fi < num_facs; fi++)
+	{
+		CFactor* fac = dynamic_cast<CFactor*>(facs->get_element(fi));
+		SGVector<int32_t> vars = fac->get_variables();
+		SG_UNREF(fac);
+
+		int32_t stride = 1;
+		for (int32_t vi = 0; vi < vars.size(); vi++, ei++)
+		{
+			ASSERT(ei < num_edges);
+			m_edge_fac[ei] = fi;
+			m_edge_var[ei] = vars[vi];
+			m_edge_stride[ei] = stride;
+			m_msg_offsets[ei+1] = m_msg_offsets[ei] + m_cards[vars[vi]];
+			m_var_edge_ptr[vars[vi]+1]++;
+			stride *= m_cards[vars[vi]];
+		}
+
+		m_fac_edges[fi+1] = ei;
+		m_energy_offsets[fi+1] = m_energy_offsets[fi] + stride;
+	}
+	ASSERT(ei == num_edges);
+	SG_UNREF(facs);
+
+	// edges of each variable
+	for (int32_t vi = 0; vi < num_vars; vi++)
+		m_var_edge_ptr[vi+1] += m_var_edge_ptr[vi];
+
+	m_var_edges = SGVector<int32_t>(num_edges);
+	SGVector<int32_t> pos = m_var_edge_ptr.clone();
+	for (ei = 0; ei < num_edges; ei++)
+		m_var_edges[pos[m_edge_var[ei]]++] = ei;
+
+	int32_t num_msgs = m_msg_offsets[num_edges];
+	m_energies = SGVector<float64_t>(m_energy_offsets[num_facs]);
+	m_v2f_msgs = SGVector<float64_t>(num_msgs);
+	m_f2v_msgs = SGVector<float64_t>(num_msgs);
+	m_f2v_new = SGVector<float64_t>(num_msgs);
+	m_residuals = SGVector<float64_t>(num_edges);
+}
+
+CLoopyMaxProduct::~CLoopyMaxProduct()
+{
+}
+
+void CLoopyMaxProduct::init()
+{
+	SG_ADD((machine_int_t*) &m_schedule, "schedule",
+		"Order of message updates", MS_NOT_AVAILABLE);
+	SG_ADD(&m_max_iter, "max_iter", "Maximum number of iterations", MS_NOT_AVAILABLE);
+	SG_ADD(&m_tolerance, "tolerance", "Convergence tolerance", MS_NOT_AVAILABLE);
+	SG_ADD(&m_damping, "damping", "Damping of message updates", MS_NOT_AVAILABLE);
+
+	m_schedule = RESIDUAL_SCHEDULE;
+	m_max_iter = 100;
+	m_tolerance = 1e-8;
+	m_damping = 0;
+	m_num_iter = 0;
+	m_converged = false;
+}
+
+void CLoopyMaxProduct::set_max_iter(int32_t max_iter)
+{
+	REQUIRE(max_iter > 0, "%s::set_max_iter(): max_iter must be positive!\n", get_name());
+	m_max_iter = max_iter;
+}
+
+void CLoopyMaxProduct::set_tolerance(float64_t tolerance)
+{
+	REQUIRE(tolerance >= 0, "%s::set_tolerance(): tolerance must be non-negative!\n", get_name());
+	m_tolerance = tolerance;
+}
+
+void CLoopyMaxProduct::set_damping(float64_t damping)
+{
+	REQUIRE(damping >= 0 && damping < 1,
+		"%s::set_damping(): damping must be in [0,1)!\n", get_name());
+	m_damping = damping;
+}
+
+void CLoopyMaxProduct::copy_energies()
+{
+	CDynamicObjectArray* facs = m_fg->get_factors();
+	int32_t num_facs = facs->get_num_elements();
+	ASSERT(num_facs == m_fac_edges.size()-1);
+
+	for (int32_t fi = 0; fi < num_facs; fi++)
+	{
+		CFactor* fac = dynamic_cast<CFactor*>(facs->get_element(fi));
+		SGVector<float64_t> fenrgs = fac->get_energies();
+		SG_UNREF(fac);
+
+		ASSERT(fenrgs.size() == m_energy_offsets[fi+1] - m_energy_offsets[fi]);
+		memcpy(m_energies.vector + m_energy_offsets[fi], fenrgs.vector,
+			sizeof(float64_t)*fenrgs.size());
+	}
+
+	SG_UNREF(facs);
+}
+
+float64_t CLoopyMaxProduct::inference(SGVector<int32_t> assignment)
+{
+	REQUIRE(assignment.size() == m_cards.size(),
+		"%s::inference(): the output assignment should be prepared as"
+		"the same size as variables!\n", get_name());
+
+	// energies may have changed since construction, e.g. by loss augmentation
+	copy_energies();
+	m_v2f_msgs.zero();
+	m_f2v_msgs.zero();
+	m_num_iter = 0;
+	m_converged = false;
+
+	if (m_schedule == SYNCHRONOUS_SCHEDULE)
+		synchronous_updates();
+	else
+		residual_updates();
+
+	// decode from beliefs b_v = sum_f r_f2v
+	for (int32_t vi = 0; vi < m_cards.size(); vi++)
+	{
+		float64_t best = CMath::INFTY;
+		assignment[vi] = 0;
+		for (int32_t si = 0; si < m_cards[vi]; si++)
+		{
+			float64_t belief = 0;
+			for (int32_t k = m_var_edge_ptr[vi]; k < m_var_edge_ptr[vi+1]; k++)
+				belief += m_f2v_msgs[m_msg_offsets[m_var_edges[k]] + si];
+
+			if (belief < best)
+			{
+				best = belief;
+				assignment[vi] = si;
+			}
+		}
+	}
+
+	float64_t energy = m_fg->evaluate_energy(assignment);
+	m_map_energy = -energy;
+
+	SG_DEBUG("%s::inference(): %d iterations, converged: %d, energy = %f\n",
+		get_name(), m_num_iter, m_converged, energy);
+
+	return energy;
+}
+
+void CLoopyMaxProduct::update_var_to_fac(int32_t ei)
+{
+	// q_v2f = sum_{f'!=f} r_f'2v, normalized to min 0
+	int32_t vi = m_edge_var[ei];
+	float64_t* msg = m_v2f_msgs.vector + m_msg_offsets[ei];
+	std::fill(msg, msg + m_cards[vi], 0.0);
+
+	for (int32_t k = m_var_edge_ptr[vi]; k < m_var_edge_ptr[vi+1]; k++)
+	{
+		int32_t ej = m_var_edges[k];
+		if (ej == ei)
+			continue;
+
+		const float64_t* in = m_f2v_msgs.vector + m_msg_offsets[ej];
+		for (int32_t si = 0; si < m_cards[vi]; si++)
+			msg[si] += in[si];
+	}
+
+	float64_t min_msg = *std::min_element(msg, msg + m_cards[vi]);
+	if (min_msg > -CMath::INFTY && min_msg < CMath::INFTY)
+	{
+		for (int32_t si = 0; si < m_cards[vi]; si++)
+			msg[si] -= min_msg;
+	}
+}
+
+float64_t CLoopyMaxProduct::compute_fac_to_var(int32_t ei)
+{
+	// r_f2v = min(E_f + sum_{v'!=v} q_v'2f), normalized to min 0
+	int32_t fi = m_edge_fac[ei];
+	int32_t card = m_cards[m_edge_var[ei]];
+	int32_t stride = m_edge_stride[ei];
+	float64_t* msg = m_f2v_new.vector + m_msg_offsets[ei];
+	const float64_t* fenrgs = m_energies.vector + m_energy_offsets[fi];
+	int32_t num_assignments = m_energy_offsets[fi+1] - m_energy_offsets[fi];
+
+	std::fill(msg, msg + card, CMath::INFTY);
+	for (int32_t ai = 0; ai < num_assignments; ai++)
+	{
+		float64_t val = fenrgs[ai];
+		for (int32_t ej = m_fac_edges[fi]; ej < m_fac_edges[fi+1]; ej++)
+		{
+			if (ej == ei)
+				continue;
+
+			int32_t sj = (ai / m_edge_stride[ej]) % m_cards[m_edge_var[ej]];
+			val += m_v2f_msgs[m_msg_offsets[ej] + sj];
+		}
+
+		int32_t si = (ai / stride) % card;
+		if (val < msg[si])
+			msg[si] = val;
+	}
+
+	float64_t min_msg = *std::min_element(msg, msg + card);
+	if (min_msg > -CMath::INFTY && min_msg < CMath::INFTY)
+	{
+		for (int32_t si = 0; si < card; si++)
+			msg[si] -= min_msg;
+	}
+
+	const float64_t* old_msg = m_f2v_msgs.vector + m_msg_offsets[ei];
+	float64_t residual = 0;
+	for (int32_t si = 0; si < card; si++)
+	{
+		if (m_damping > 0 && CMath::abs(old_msg[si]) < CMath::INFTY)
+			msg[si] = (1-m_damping)*msg[si] + m_damping*old_msg[si];
+
+		if (msg[si] != old_msg[si])
+			residual = CMath::max(residual, CMath::abs(msg[si] - old_msg[si]));
+	}
+
+	return residual;
+}
+
+void CLoopyMaxProduct::synchronous_updates()
+{
+	int32_t num_edges = m_edge_var.size();
+
+	for (m_num_iter = 1; m_num_iter <= m_max_iter; m_num_iter++)
+	{
+		// every message of a phase only reads messages of the other direction
+		#pragma omp parallel for num_threads(parallel->get_num_threads())
+		for (int32_t ei = 0; ei < num_edges; ei++)
+			update_var_to_fac(ei);
+
+		#pragma omp parallel for num_threads(parallel->get_num_threads())
+		for (int32_t ei = 0; ei < num_edges; ei++)
+			m_residuals[ei] = compute_fac_to_var(ei);
+
+		std::swap(m_f2v_msgs, m_f2v_new);
+
+		float64_t max_residual = num_edges > 0 ? SGVector<float64_t>::max(m_residuals.vector, num_edges) : 0;
+		if (max_residual <= m_tolerance)
+		{
+			m_converged = true;
+			break;
+		}
+	}
+
+	m_num_iter = CMath::min(m_num_iter, m_max_iter);
+}
+
+void CLoopyMaxProduct::residual_updates()
+{
+	typedef std::pair<float64_t, int32_t> residual_type;
+	int32_t num_edges = m_edge_var.size();
+
+	// all incoming messages are zero, so are the outgoing ones
+	m_v2f_msgs.zero();
+
+	#pragma omp parallel for num_threads(parallel->get_num_threads())
+	for (int32_t ei = 0; ei < num_edges; ei++)
+		m_residuals[ei] = compute_fac_to_var(ei);
+
+	// stale entries are skipped by comparing with the current residual
+	std::priority_queue<residual_type> queue;
+	for (int32_t ei = 0; ei < num_edges; ei++)
+		queue.push(residual_type(m_residuals[ei], ei));
+
+	int64_t num_updates = 0;
+	int64_t max_updates = int64_t(m_max_iter) * CMath::max(num_edges, 1);
+	m_converged = true;
+	while (!queue.empty())
+	{
+		residual_type top = queue.top();
+		queue.pop();
+
+		int32_t ei = top.second;
+		if (top.first != m_residuals[ei])
+			continue;
+
+		if (top.first <= m_tolerance)
+			break;
+
+		if (num_updates++ >= max_updates)
+		{
+			m_converged = false;
+			break;
+		}
+
+		// send the message
+		int32_t card = m_cards[m_edge_var[ei]];
+		memcpy(m_f2v_msgs.vector + m_msg_offsets[ei],
+			m_f2v_new.vector + m_msg_offsets[ei], sizeof(float64_t)*card);
+		m_residuals[ei] = 0;
+
+		// the other factors of the variable receive a new message and
+		// change their messages to their other variables
+		int32_t vi = m_edge_var[ei];
+		for (int32_t k = m_var_edge_ptr[vi]; k < m_var_edge_ptr[vi+1]; k++)
+		{
+			int32_t ej = m_var_edges[k];
+			if (ej == ei)
+				continue;
+
+			update_var_to_fac(ej);
+
+			int32_t fj = m_edge_fac[ej];
+			for (int32_t el = m_fac_edges[fj]; el < m_fac_edges[fj+1]; el++)
+			{
+				if (el == ej)
+					continue;
+
+				m_residuals[el] = compute_fac_to_var(el);
+				queue.push(residual_type(m_residuals[el], el));
+			}
+		}
+	}
+
+	int32_t denom = CMath::max(num_edges, 1);
+	m_num_iter = (int32_t) ((num_updates + denom - 1) / denom);
+}
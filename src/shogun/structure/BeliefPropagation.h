@@ -144,6 +144,150 @@ private:
 	msgset_map_type m_msgset_map_var;
 };
 
+/** order in which loopy max-product updates the messages */
+enum ELoopySchedule
+{
+	/** all messages are updated in every iteration, in parallel */
+	SYNCHRONOUS_SCHEDULE = 0,
+	/** the factor-to-variable message that would change most is updated
+	 * first, see [2] */
+	RESIDUAL_SCHEDULE = 1
+};
+
+/** max-product algorithm for graphs with cycles, run as min-sum on the
+ * energies. The messages of both directions are stored in flat arrays
+ * indexed by the edges of the factor graph, where the edges of factor
+ * fi are numbered consecutively in the order of the factors and of the
+ * variables within each factor. The MAP assignment is decoded from the
+ * beliefs of the variables, its energy is returned. On a tree the
+ * assignment is exact.
+ *
+ * [2] Gal Elidan, Ian McGraw and Daphne Koller,
+ * Residual Belief Propagation: Informed Scheduling for Asynchronous
+ * Message Passing, UAI 2006.
+ */
+IGNORE_IN_CLASSLIST class CLoopyMaxProduct : public CBeliefPropagation
+{
+public:
+	CLoopyMaxProduct();
+	CLoopyMaxProduct(CFactorGraph* fg);
+
+	virtual ~CLoopyMaxProduct();
+
+	/** @return class name */
+	virtual const char* get_name() const { return "LoopyMaxProduct"; }
+
+	virtual float64_t inference(SGVector<int32_t> assignment);
+
+	/** @param schedule order of message updates, residual by default */
+	void set_schedule(ELoopySchedule schedule) { m_schedule = schedule; }
+
+	/** @return order of message updates */
+	ELoopySchedule get_schedule() const { return m_schedule; }
+
+	/** @param max_iter maximum number of iterations, the residual
+	 * schedule may update as many messages as there are edges per
+	 * iteration
+	 */
+	void set_max_iter(int32_t max_iter);
+
+	/** @return maximum number of iterations */
+	int32_t get_max_iter() const { return m_max_iter; }
+
+	/** @param tolerance messages have converged if no message changes
+	 * by more than this
+	 */
+	void set_tolerance(float64_t tolerance);
+
+	/** @return convergence tolerance */
+	float64_t get_tolerance() const { return m_tolerance; }
+
+	/** @param damping weight of the old message in an update, in [0,1) */
+	void set_damping(float64_t damping);
+
+	/** @return damping of message updates */
+	float64_t get_damping() const { return m_damping; }
+
+	/** @return number of iterations of the last inference */
+	int32_t get_num_iter() const { return m_num_iter; }
+
+	/** @return whether the messages converged in the last inference */
+	bool get_converged() const { return m_converged; }
+
+protected:
+	/** update all messages in parallel until convergence */
+	void synchronous_updates();
+
+	/** update the message with the largest residual until convergence */
+	void residual_updates();
+
+	/** recompute the variable-to-factor message of an edge
+	 *
+	 * @param ei edge index
+	 */
+	void update_var_to_fac(int32_t ei);
+
+	/** compute the new factor-to-variable message of an edge into
+	 * m_f2v_new, damped with the current message
+	 *
+	 * @param ei edge index
+	 * @return residual, i.e. max change to the current message
+	 */
+	float64_t compute_fac_to_var(int32_t ei);
+
+	/** copy the energy tables of all factors */
+	void copy_energies();
+
+private:
+	void init();
+
+private:
+	/** order of message updates */
+	ELoopySchedule m_schedule;
+	/** maximum number of iterations */
+	int32_t m_max_iter;
+	/** convergence tolerance */
+	float64_t m_tolerance;
+	/** damping of message updates */
+	float64_t m_damping;
+	/** iterations of the last inference */
+	int32_t m_num_iter;
+	/** whether the last inference converged */
+	bool m_converged;
+
+	/** cardinalities of the variables */
+	SGVector<int32_t> m_cards;
+	/** edges of factor fi are m_fac_edges[fi] to m_fac_edges[fi+1]-1 */
+	SGVector<int32_t> m_fac_edges;
+	/** factor of each edge */
+	SGVector<int32_t> m_edge_fac;
+	/** variable of each edge */
+	SGVector<int32_t> m_edge_var;
+	/** stride of the variable of each edge in its factor's energy table */
+	SGVector<int32_t> m_edge_stride;
+	/** edges of variable vi are m_var_edges[m_var_edge_ptr[vi]] to
+	 * m_var_edges[m_var_edge_ptr[vi+1]-1]
+	 */
+	SGVector<int32_t> m_var_edge_ptr;
+	/** edges sorted by variable */
+	SGVector<int32_t> m_var_edges;
+	/** offset of the messages of each edge, the last entry is the total */
+	SGVector<int32_t> m_msg_offsets;
+	/** offset of the energy table of each factor, the last entry is the total */
+	SGVector<int32_t> m_energy_offsets;
+
+	/** energy tables of all factors */
+	SGVector<float64_t> m_energies;
+	/** variable-to-factor messages */
+	SGVector<float64_t> m_v2f_msgs;
+	/** factor-to-variable messages */
+	SGVector<float64_t> m_f2v_msgs;
+	/** new factor-to-variable messages, not yet sent */
+	SGVector<float64_t> m_f2v_new;
+	/** residuals of the new factor-to-variable messages */
+	SGVector<float64_t> m_residuals;
+};
+
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
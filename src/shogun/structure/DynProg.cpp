@@ -29,6 +29,19 @@ using namespace shogun;
 //#define USE_TMP_ARRAYCLASS
 //#define DYNPROG_DEBUG
 
+// maximal segment length up to which transition penalties are tabulated
+#define DYNPROG_MAX_PLIF_TABLE_LEN 100000
+
+// length dependent part of a transition penalty, from the table if possible
+static inline float64_t lookup_value_penalty(const CPlifBase* penalty,
+		const float64_t* table, int32_t table_len, int32_t len)
+{
+	if (len>=0 && len<table_len)
+		return table[len] ;
+
+	return penalty->lookup_value_penalty(len) ;
+}
+
 int32_t CDynProg::word_degree_default[4]={3,4,5,6} ;
 int32_t CDynProg::cum_num_words_default[5]={0,64,320,1344,5440} ;
 int32_t CDynProg::frame_plifs[3]={4,5,6};
@@ -97,7 +110,8 @@ CDynProg::CDynProg(int32_t num_svms /*= 8 */)
 	  m_num_raw_data(0),
 
 	  m_long_transitions(true),
-	  m_long_transition_threshold(1000)
+	  m_long_transition_threshold(1000),
+	  m_beam_width(CMath::INFTY)
 {
 	trans_list_forward = NULL ;
 	trans_list_forward_cnt = NULL ;
@@ -1172,9 +1186,11 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 		long_transition_content_end_position.set_const(0) ;
 #endif
 
-		svm_value = SG_MALLOC(float64_t , m_num_lin_feat_plifs_cum[m_num_raw_data]+m_num_intron_plifs);
+		// one buffer of svm values per state, the states are processed in parallel
+		const int32_t num_svm_values = m_num_lin_feat_plifs_cum[m_num_raw_data]+m_num_intron_plifs ;
+		svm_value = SG_MALLOC(float64_t , m_N*num_svm_values);
 		{ // initialize svm_svalue
-			for (int32_t s=0; s<m_num_lin_feat_plifs_cum[m_num_raw_data]+m_num_intron_plifs; s++)
+			for (int32_t s=0; s<m_N*num_svm_values; s++)
 				svm_value[s]=0 ;
 		}
 
@@ -1316,10 +1332,11 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 		ktable_end.set_array_name("ktable_end");
 		//ktable_end.set_const(0) ;
 
-		float64_t * fixedtempvv=SG_MALLOC(float64_t, look_back_buflen);
-		memset(fixedtempvv, 0, look_back_buflen*sizeof(float64_t)) ;
-		int32_t * fixedtempii=SG_MALLOC(int32_t, look_back_buflen);
-		memset(fixedtempii, 0, look_back_buflen*sizeof(int32_t)) ;
+		// list of the nbest predecessors, one per state
+		float64_t * fixedtempvv=SG_MALLOC(float64_t, m_N*nbest);
+		memset(fixedtempvv, 0, m_N*nbest*sizeof(float64_t)) ;
+		int32_t * fixedtempii=SG_MALLOC(int32_t, m_N*nbest);
+		memset(fixedtempii, 0, m_N*nbest*sizeof(int32_t)) ;
 
 		CDynamicArray<float64_t> oldtempvv(look_back_buflen) ;
 		oldtempvv.set_array_name("oldtempvv");
@@ -1476,6 +1493,56 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 			}
 		}
 
+		// the parts of the transition penalties that only depend on the
+		// segment length are tabulated for all lengths up to the look-back
+		// of the transition, in one contiguous table
+		CDynamicArray<int32_t> plif_table_offset(m_N,m_N) ; // 2d
+		plif_table_offset.set_array_name("plif_table_offset");
+		plif_table_offset.set_const(0) ;
+		CDynamicArray<int32_t> plif_table_len(m_N,m_N) ; // 2d
+		plif_table_len.set_array_name("plif_table_len");
+		plif_table_len.set_const(0) ;
+		float64_t* plif_table = NULL ;
+		{
+			const int32_t max_len = CMath::min(CMath::max(m_pos[m_seq_len-1]-m_pos[0], 0), DYNPROG_MAX_PLIF_TABLE_LEN) ;
+			int32_t table_size = 0 ;
+			for (int32_t j=0; j<m_N; j++)
+			{
+				for (int32_t i=0; i<trans_list_forward_cnt[j]; i++)
+				{
+					T_STATES ii = trans_list_forward[j][i] ;
+					if (PEN.element(j,ii)==NULL)
+						continue ;
+
+					int32_t len = CMath::min(look_back.element(j, ii), max_len)+1 ;
+					plif_table_offset.set_element(table_size, j, ii) ;
+					plif_table_len.set_element(len, j, ii) ;
+					table_size += len ;
+				}
+			}
+
+			plif_table = SG_MALLOC(float64_t, table_size) ;
+			#pragma omp parallel for num_threads(parallel->get_num_threads())
+			for (int32_t j=0; j<m_N; j++)
+			{
+				for (int32_t i=0; i<trans_list_forward_cnt[j]; i++)
+				{
+					T_STATES ii = trans_list_forward[j][i] ;
+					const CPlifBase* penalty = (CPlifBase*) PEN.element(j,ii) ;
+					if (penalty==NULL)
+						continue ;
+
+					float64_t* table = &plif_table[plif_table_offset.element(j, ii)] ;
+					for (int32_t len=0; len<plif_table_len.element(j, ii); len++)
+						table[len] = penalty->lookup_value_penalty(len) ;
+				}
+			}
+		}
+
+		// pruned states are not extended; with nbest==1, states that cannot
+		// be reached are skipped as well, which does not change the result
+		const bool skip_unreachable = (nbest==1) || (m_beam_width<CMath::INFTY) ;
+
 		SG_DEBUG("START_RECURSION \n\n")
 
 		// recursion
@@ -1485,6 +1552,8 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 			//	SG_PROGRESS(t, 0, m_seq_len)
 			//SG_PRINT("%i\n", t)
 
+			// the states only depend on previous positions
+			#pragma omp parallel for num_threads(parallel->get_num_threads()) schedule(dynamic)
 			for (T_STATES j=0; j<m_N; j++)
 			{
 				if (seq.element(j,t)<=-1e20)
@@ -1505,6 +1574,10 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 					const float64_t *elem_val      = trans_list_forward_val[j] ;
 					const int32_t *elem_id      = trans_list_forward_id[j] ;
 
+					float64_t* state_svm_value = &svm_value[j*num_svm_values] ;
+					float64_t* tempvv = &fixedtempvv[j*nbest] ;
+					int32_t* tempii = &fixedtempii[j*nbest] ;
+
 					int32_t fixed_list_len = 0 ;
 					float64_t fixedtempvv_ = CMath::INFTY ;
 					int32_t fixedtempii_ = 0 ;
@@ -1528,6 +1601,9 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 						  } */
 
 						int32_t look_back_ = look_back.element(j, ii) ;
+						const float64_t* table = &plif_table[plif_table_offset.element(j, ii)] ;
+						const int32_t table_len = plif_table_len.element(j, ii) ;
+						const bool uses_svm = penalty && penalty->uses_svm_values() ;
 
 						int32_t orf_from = m_orf_info.element(ii,0) ;
 						int32_t orf_to   = m_orf_info.element(j,1) ;
@@ -1552,6 +1628,9 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 
 						for (int32_t ts=t-1; ts>=0 && m_pos[t]-m_pos[ts]<=look_back_; ts--)
 						{
+							if (skip_unreachable && delta.element(delta_array, ts, ii, 0, m_seq_len, m_N)==-CMath::INFTY)
+								continue ;
+
 							bool ok ;
 							//int32_t plen=t-ts;
 
@@ -1583,16 +1662,21 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 								// BEST_PATH_TRANS
 								////////////////////////////////////////////////////////
 
-								int32_t frame = orf_from;//m_orf_info.element(ii,0);
-								lookup_content_svm_values(ts, t, m_pos[ts], m_pos[t], svm_value, frame);
-
 								float64_t pen_val = 0.0 ;
 								if (penalty)
 								{
 #ifdef DYNPROG_TIMING_DETAIL
 									MyTime.start() ;
 #endif
-									pen_val = penalty->lookup_penalty(m_pos[t]-m_pos[ts], svm_value) ;
+									pen_val = lookup_value_penalty(penalty, table, table_len, m_pos[t]-m_pos[ts]) ;
+
+									// the svm values are only needed for a feasible length
+									if (uses_svm && pen_val>-CMath::INFTY)
+									{
+										int32_t frame = orf_from;//m_orf_info.element(ii,0);
+										lookup_content_svm_values(ts, t, m_pos[ts], m_pos[t], state_svm_value, frame);
+										pen_val += penalty->lookup_svm_penalty(state_svm_value) ;
+									}
 
 #ifdef DYNPROG_TIMING_DETAIL
 									MyTime.stop() ;
@@ -1632,33 +1716,33 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 
 										float64_t mval = -(val + delta.element(delta_array, ts, ii, diff, m_seq_len, m_N)) ;
 
-										/* only place -val in fixedtempvv if it is one of the nbest lowest values in there */
-										/* fixedtempvv[i], i=0:nbest-1, is sorted so that fixedtempvv[0] <= fixedtempvv[1] <= ...*/
-										/* fixed_list_len has the number of elements in fixedtempvv */
+										/* only place -val in tempvv if it is one of the nbest lowest values in there */
+										/* tempvv[i], i=0:nbest-1, is sorted so that tempvv[0] <= tempvv[1] <= ...*/
+										/* fixed_list_len has the number of elements in tempvv */
 
-										if ((fixed_list_len < nbest) || ((0==fixed_list_len) || (mval < fixedtempvv[fixed_list_len-1])))
+										if ((fixed_list_len < nbest) || ((0==fixed_list_len) || (mval < tempvv[fixed_list_len-1])))
 										{
-											if ( (fixed_list_len<nbest) && ((0==fixed_list_len) || (mval>fixedtempvv[fixed_list_len-1])) )
+											if ( (fixed_list_len<nbest) && ((0==fixed_list_len) || (mval>tempvv[fixed_list_len-1])) )
 											{
-												fixedtempvv[fixed_list_len] = mval ;
-												fixedtempii[fixed_list_len] = ii + diff*m_N + ts*m_N*nbest;
+												tempvv[fixed_list_len] = mval ;
+												tempii[fixed_list_len] = ii + diff*m_N + ts*m_N*nbest;
 												fixed_list_len++ ;
 											}
-											else  // must have mval < fixedtempvv[fixed_list_len-1]
+											else  // must have mval < tempvv[fixed_list_len-1]
 											{
 												int32_t addhere = fixed_list_len;
-												while ((addhere > 0) && (mval < fixedtempvv[addhere-1]))
+												while ((addhere > 0) && (mval < tempvv[addhere-1]))
 													addhere--;
 
 												// move everything from addhere+1 one forward
 												for (int32_t jj=fixed_list_len-1; jj>addhere; jj--)
 												{
-													fixedtempvv[jj] = fixedtempvv[jj-1];
-													fixedtempii[jj] = fixedtempii[jj-1];
+													tempvv[jj] = tempvv[jj-1];
+													tempii[jj] = tempii[jj-1];
 												}
 
-												fixedtempvv[addhere] = mval;
-												fixedtempii[addhere] = ii + diff*m_N + ts*m_N*nbest;
+												tempvv[addhere] = mval;
+												tempii[addhere] = ii + diff*m_N + ts*m_N*nbest;
 
 												if (fixed_list_len < nbest)
 													fixed_list_len++;
@@ -1751,8 +1835,8 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 								if (penalty)
 								{
 									int32_t frame = m_orf_info.element(ii,0);
-									lookup_content_svm_values(start_5p_part, end_5p_part, m_pos[start_5p_part], m_pos[end_5p_part], svm_value, frame); // * t -> end_5p_part
-									pen_val = penalty->lookup_penalty(m_pos[end_5p_part]-m_pos[start_5p_part], svm_value) ;
+									lookup_content_svm_values(start_5p_part, end_5p_part, m_pos[start_5p_part], m_pos[end_5p_part], state_svm_value, frame); // * t -> end_5p_part
+									pen_val = penalty->lookup_penalty(m_pos[end_5p_part]-m_pos[start_5p_part], state_svm_value) ;
 								}
 
 								/*if (m_pos[start_5p_part]==1003)
@@ -1847,8 +1931,8 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 								if (penalty)
 								{
 									int32_t frame = orf_from ; //m_orf_info.element(ii, 0);
-									lookup_content_svm_values(ts, t, m_pos[ts], m_pos[t], svm_value, frame);
-									pen_val_3p = penalty->lookup_penalty(m_pos[t]-m_pos[ts], svm_value) ;
+									lookup_content_svm_values(ts, t, m_pos[ts], m_pos[t], state_svm_value, frame);
+									pen_val_3p = penalty->lookup_penalty(m_pos[t]-m_pos[ts], state_svm_value) ;
 								}
 
 								float64_t mval = -(long_transition_content_scores.get_element(ii, j) + pen_val_3p*0.5) ;
@@ -1948,8 +2032,8 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 							}
 							else
 							{
-								minusscore = fixedtempvv[k];
-								fromtjk = fixedtempii[k];
+								minusscore = tempvv[k];
+								fromtjk = tempii[k];
 							}
 
 							delta.element(delta_array, t, j, k, m_seq_len, m_N)    = -minusscore + seq.element(j,t);
@@ -1969,6 +2053,22 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 					}
 				}
 			}
+
+			if (m_beam_width<CMath::INFTY)
+			{ // beam pruning: discard states far below the best state at t
+				float64_t best = -CMath::INFTY ;
+				for (T_STATES j=0; j<m_N; j++)
+					best = CMath::max(best, delta.element(delta_array, t, j, 0, m_seq_len, m_N)) ;
+
+				for (T_STATES j=0; j<m_N; j++)
+				{
+					if (delta.element(delta_array, t, j, 0, m_seq_len, m_N) < best-m_beam_width)
+					{
+						for (int16_t k=0; k<nbest; k++)
+							delta.element(delta_array, t, j, k, m_seq_len, m_N) = -CMath::INFTY ;
+					}
+				}
+			}
 		}
 		{ //termination
 			int32_t list_len = 0 ;
@@ -2045,8 +2145,34 @@ void CDynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 
 		SG_FREE(fixedtempvv);
 		SG_FREE(fixedtempii);
+		SG_FREE(svm_value);
+		SG_FREE(plif_table);
 	}
 
+void CDynProg::compute_nbest_paths(CDynamicObjectArray* dyn_progs,
+		int32_t max_num_signals, bool use_orf, int16_t nbest, bool with_loss)
+{
+	if (!dyn_progs)
+		SG_SERROR("No dynamic programs given\n")
+
+	const int32_t num_seqs = dyn_progs->get_num_elements() ;
+	if (num_seqs==0)
+		return ;
+
+	CDynProg** dps = SG_MALLOC(CDynProg*, num_seqs) ;
+	for (int32_t i=0; i<num_seqs; i++)
+		dps[i] = (CDynProg*) dyn_progs->get_element(i) ;
+
+	// every sequence has its own dynamic program, the plifs are only read
+	#pragma omp parallel for num_threads(dps[0]->parallel->get_num_threads()) schedule(dynamic)
+	for (int32_t i=0; i<num_seqs; i++)
+		dps[i]->compute_nbest_paths(max_num_signals, use_orf, nbest, with_loss, false) ;
+
+	for (int32_t i=0; i<num_seqs; i++)
+		SG_UNREF(dps[i]) ;
+	SG_FREE(dps) ;
+}
+
 
 void CDynProg::best_path_trans_deriv(
 	int32_t *my_state_seq, int32_t *my_pos_seq,
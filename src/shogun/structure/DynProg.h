@@ -274,6 +274,19 @@ public:
 	void compute_nbest_paths(int32_t max_num_signals,
 						 bool use_orf, int16_t nbest, bool with_loss, bool with_multiple_sequences);
 
+	/** run compute_nbest_paths on several independent sequences in
+	 *  parallel, one thread per sequence
+	 *
+	 * @param dyn_progs array of CDynProg, one per sequence, each set up
+	 *        like for a single call of compute_nbest_paths
+	 * @param max_num_signals maximal number of signals for a single state
+	 * @param use_orf whether orf shall be used
+	 * @param nbest number of best paths (n)
+	 * @param with_loss use loss
+	 */
+	static void compute_nbest_paths(CDynamicObjectArray* dyn_progs,
+			int32_t max_num_signals, bool use_orf, int16_t nbest, bool with_loss);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 	/** given a path though the state model and the corresponding
@@ -485,6 +498,27 @@ public:
 		//m_long_transition_max = max_len;
 	}
 
+	/** set the beam width for pruning: after each position, all states
+	 *  whose best score is more than beam_width below the best state at
+	 *  this position are discarded and not extended any further
+	 *
+	 *  @param beam_width beam width, CMath::INFTY disables pruning
+	 */
+	void set_beam_width(float64_t beam_width)
+	{
+		REQUIRE(beam_width>=0, "Beam width (%f) has to be non-negative\n", beam_width)
+		m_beam_width = beam_width;
+	}
+
+	/** get the beam width for pruning
+	 *
+	 *  @return beam width, CMath::INFTY if pruning is disabled
+	 */
+	float64_t get_beam_width() const
+	{
+		return m_beam_width;
+	}
+
 protected:
 
 	/* helper functions */
@@ -762,6 +796,9 @@ protected:
 	 */
 	//int32_t m_long_transition_max ;
 
+	/** beam width for pruning states, CMath::INFTY if disabled */
+	float64_t m_beam_width;
+
 	/**default values defining the k-mer degrees
 	 * used for content type prediction
 	 */
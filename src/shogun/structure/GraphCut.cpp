@@ -0,0 +1,277 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/structure/GraphCut.h>
+#include <shogun/lib/DynamicObjectArray.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/io/SGIO.h>
+
+using namespace shogun;
+
+// capacities below are treated as saturated
+#define GRAPH_CUT_EPS 1e-12
+
+CGraphCut::CGraphCut()
+	: CMAPInferImpl()
+{
+	SG_UNSTABLE("CGraphCut::CGraphCut()", "\n");
+
+	init();
+}
+
+CGraphCut::CGraphCut(CFactorGraph* fg)
+	: CMAPInferImpl(fg)
+{
+	ASSERT(m_fg != NULL);
+
+	init();
+
+	SGVector<int32_t> cards = m_fg->get_cardinalities();
+	for (int32_t vi = 0; vi < cards.size(); vi++)
+	{
+		REQUIRE(cards[vi] == 2, "%s::CGraphCut(): only binary variables are supported, "
+			"variable %d has %d states!\n", get_name(), vi, cards[vi]);
+	}
+
+	CDynamicObjectArray* facs = m_fg->get_factors();
+	for (int32_t fi = 0; fi < facs->get_num_elements(); fi++)
+	{
+		CFactor* fac = dynamic_cast<CFactor*>(facs->get_element(fi));
+		SGVector<int32_t> vars = fac->get_variables();
+		SG_UNREF(fac);
+
+		REQUIRE(vars.size() <= 2, "%s::CGraphCut(): only unary and pairwise factors "
+			"are supported, factor %d has %d variables!\n", get_name(), fi, vars.size());
+		REQUIRE(vars.size() < 2 || vars[0] != vars[1], "%s::CGraphCut(): factor %d "
+			"connects variable %d with itself!\n", get_name(), fi, vars[0]);
+	}
+	SG_UNREF(facs);
+
+	// source and sink are the last two nodes
+	m_num_nodes = cards.size() + 2;
+	m_first = SGVector<int32_t>(m_num_nodes);
+	m_level = SGVector<int32_t>(m_num_nodes);
+	m_current = SGVector<int32_t>(m_num_nodes);
+	m_path = SGVector<int32_t>(m_num_nodes);
+
+	// at most one arc pair per factor and one to a terminal per variable
+	int32_t max_arcs = 2*(m_fg->get_num_factors() + cards.size());
+	m_next = SGVector<int32_t>(max_arcs);
+	m_head = SGVector<int32_t>(max_arcs);
+	m_cap = SGVector<float64_t>(max_arcs);
+}
+
+CGraphCut::~CGraphCut()
+{
+}
+
+void CGraphCut::init()
+{
+	m_num_nodes = 0;
+	m_num_arcs = 0;
+	m_const_energy = 0;
+}
+
+void CGraphCut::add_arc(int32_t from, int32_t to, float64_t cap, float64_t rev_cap)
+{
+	ASSERT(m_num_arcs + 2 <= m_head.size());
+
+	m_head[m_num_arcs] = to;
+	m_cap[m_num_arcs] = cap;
+	m_next[m_num_arcs] = m_first[from];
+	m_first[from] = m_num_arcs++;
+
+	m_head[m_num_arcs] = from;
+	m_cap[m_num_arcs] = rev_cap;
+	m_next[m_num_arcs] = m_first[to];
+	m_first[to] = m_num_arcs++;
+}
+
+void CGraphCut::build_graph()
+{
+	int32_t num_vars = m_num_nodes - 2;
+	int32_t source = num_vars;
+	int32_t sink = num_vars + 1;
+
+	m_first.set_const(-1);
+	m_num_arcs = 0;
+	m_const_energy = 0;
+
+	// E = const + sum_i u_i x_i + sum_ij w_ij (1-x_i) x_j, with w_ij >= 0
+	SGVector<float64_t> unary(num_vars);
+	unary.zero();
+
+	CDynamicObjectArray* facs = m_fg->get_factors();
+	for (int32_t fi = 0; fi < facs->get_num_elements(); fi++)
+	{
+		CFactor* fac = dynamic_cast<CFactor*>(facs->get_element(fi));
+		SGVector<int32_t> vars = fac->get_variables();
+		SGVector<float64_t> fenrgs = fac->get_energies();
+		SG_UNREF(fac);
+
+		if (vars.size() == 0)
+		{
+			m_const_energy += fenrgs[0];
+		}
+		else if (vars.size() == 1)
+		{
+			m_const_energy += fenrgs[0];
+			unary[vars[0]] += fenrgs[1] - fenrgs[0];
+		}
+		else
+		{
+			// the first variable changes fastest in the energy table
+			float64_t e00 = fenrgs[0];
+			float64_t e10 = fenrgs[1];
+			float64_t e01 = fenrgs[2];
+			float64_t e11 = fenrgs[3];
+			float64_t w = e01 + e10 - e00 - e11;
+
+			if (w < -GRAPH_CUT_EPS)
+			{
+				SG_UNREF(facs);
+				SG_ERROR("%s::inference(): factor %d is not submodular!\n", get_name(), fi);
+			}
+
+			m_const_energy += e00;
+			unary[vars[0]] += e10 - e00;
+			unary[vars[1]] += e11 - e10;
+			if (w > 0)
+				add_arc(vars[0], vars[1], w, 0);
+		}
+	}
+	SG_UNREF(facs);
+
+	// x_i = 1 iff node i is on the sink side of the cut
+	for (int32_t vi = 0; vi < num_vars; vi++)
+	{
+		if (unary[vi] > 0)
+		{
+			add_arc(source, vi, unary[vi], 0);
+		}
+		else if (unary[vi] < 0)
+		{
+			m_const_energy += unary[vi];
+			add_arc(vi, sink, -unary[vi], 0);
+		}
+	}
+}
+
+bool CGraphCut::bfs_levels()
+{
+	int32_t source = m_num_nodes - 2;
+	int32_t sink = m_num_nodes - 1;
+
+	// m_path serves as the queue
+	m_level.set_const(-1);
+	m_level[source] = 0;
+	m_path[0] = source;
+	int32_t queue_begin = 0;
+	int32_t queue_end = 1;
+
+	while (queue_begin < queue_end)
+	{
+		int32_t node = m_path[queue_begin++];
+		for (int32_t a = m_first[node]; a != -1; a = m_next[a])
+		{
+			int32_t head = m_head[a];
+			if (m_cap[a] > GRAPH_CUT_EPS && m_level[head] < 0)
+			{
+				m_level[head] = m_level[node] + 1;
+				m_path[queue_end++] = head;
+			}
+		}
+	}
+
+	return m_level[sink] >= 0;
+}
+
+float64_t CGraphCut::augment()
+{
+	int32_t source = m_num_nodes - 2;
+	int32_t sink = m_num_nodes - 1;
+	int32_t path_len = 0;
+	int32_t node = source;
+
+	while (node != sink)
+	{
+		// advance along the current arc of the level graph
+		int32_t& a = m_current[node];
+		while (a != -1 && (m_cap[a] <= GRAPH_CUT_EPS ||
+			m_level[m_head[a]] != m_level[node] + 1))
+		{
+			a = m_next[a];
+		}
+
+		if (a != -1)
+		{
+			m_path[path_len++] = a;
+			node = m_head[a];
+			continue;
+		}
+
+		// dead end, retreat and skip the arc leading here
+		if (node == source)
+			return 0;
+
+		m_level[node] = -1;
+		path_len--;
+		node = m_head[m_path[path_len]^1];
+		m_current[node] = m_next[m_current[node]];
+	}
+
+	float64_t flow = CMath::INFTY;
+	for (int32_t pi = 0; pi < path_len; pi++)
+		flow = CMath::min(flow, m_cap[m_path[pi]]);
+
+	for (int32_t pi = 0; pi < path_len; pi++)
+	{
+		m_cap[m_path[pi]] -= flow;
+		m_cap[m_path[pi]^1] += flow;
+	}
+
+	return flow;
+}
+
+float64_t CGraphCut::max_flow()
+{
+	float64_t flow = 0;
+	while (bfs_levels())
+	{
+		for (int32_t ni = 0; ni < m_num_nodes; ni++)
+			m_current[ni] = m_first[ni];
+
+		float64_t pushed;
+		while ((pushed = augment()) > 0)
+			flow += pushed;
+	}
+
+	return flow;
+}
+
+float64_t CGraphCut::inference(SGVector<int32_t> assignment)
+{
+	REQUIRE(assignment.size() == m_num_nodes - 2,
+		"%s::inference(): the output assignment should be prepared as"
+		"the same size as variables!\n", get_name());
+
+	// energies may have changed since construction, e.g. by loss augmentation
+	build_graph();
+	float64_t flow = max_flow();
+
+	// the last search of max_flow() marked the source side of the minimum cut
+	for (int32_t vi = 0; vi < assignment.size(); vi++)
+		assignment[vi] = m_level[vi] < 0 ? 1 : 0;
+
+	float64_t energy = m_fg->evaluate_energy(assignment);
+	SG_DEBUG("%s::inference(): cut = %f, energy = %f\n", get_name(),
+		m_const_energy + flow, energy);
+
+	return energy;
+}
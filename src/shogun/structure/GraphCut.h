@@ -0,0 +1,105 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#ifndef __GRAPH_CUT_H__
+#define __GRAPH_CUT_H__
+
+#include <shogun/lib/SGVector.h>
+#include <shogun/structure/FactorGraph.h>
+#include <shogun/structure/MAPInference.h>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+namespace shogun
+{
+#define IGNORE_IN_CLASSLIST
+
+/** exact MAP inference for binary factor graphs with unary and submodular
+ * pairwise factors, i.e. E(0,0) + E(1,1) <= E(0,1) + E(1,0), by a minimum
+ * s-t cut [1]. The cut is found with Dinic's maximum flow algorithm on a
+ * graph held in flat arrays.
+ *
+ * [1] Vladimir Kolmogorov and Ramin Zabih, What Energy Functions can be
+ * Minimized via Graph Cuts?, IEEE TPAMI 26(2), 2004.
+ */
+IGNORE_IN_CLASSLIST class CGraphCut : public CMAPInferImpl
+{
+public:
+	CGraphCut();
+	CGraphCut(CFactorGraph* fg);
+
+	virtual ~CGraphCut();
+
+	/** @return class name */
+	virtual const char* get_name() const { return "GraphCut"; }
+
+	virtual float64_t inference(SGVector<int32_t> assignment);
+
+protected:
+	/** build the s-t graph from the energies of the factors */
+	void build_graph();
+
+	/** add a pair of opposite arcs
+	 *
+	 * @param from tail of the arc
+	 * @param to head of the arc
+	 * @param cap capacity of the arc
+	 * @param rev_cap capacity of the opposite arc
+	 */
+	void add_arc(int32_t from, int32_t to, float64_t cap, float64_t rev_cap);
+
+	/** compute the maximum flow from the source to the sink
+	 *
+	 * @return value of the flow
+	 */
+	float64_t max_flow();
+
+	/** label the nodes by distance from the source in the residual graph
+	 *
+	 * @return whether the sink is reachable
+	 */
+	bool bfs_levels();
+
+	/** push flow along one path of the level graph
+	 *
+	 * @return flow pushed, 0 if the sink cannot be reached anymore
+	 */
+	float64_t augment();
+
+private:
+	void init();
+
+private:
+	/** number of nodes including source and sink */
+	int32_t m_num_nodes;
+	/** number of arcs */
+	int32_t m_num_arcs;
+	/** first arc of each node, -1 if none */
+	SGVector<int32_t> m_first;
+	/** next arc of the same tail, -1 if none */
+	SGVector<int32_t> m_next;
+	/** head of each arc, the opposite of arc a is a^1 */
+	SGVector<int32_t> m_head;
+	/** residual capacity of each arc */
+	SGVector<float64_t> m_cap;
+	/** distance of each node from the source */
+	SGVector<int32_t> m_level;
+	/** current arc of each node in augment() */
+	SGVector<int32_t> m_current;
+	/** arcs of the current augmenting path */
+	SGVector<int32_t> m_path;
+	/** constant part of the energy */
+	float64_t m_const_energy;
+};
+
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+#endif
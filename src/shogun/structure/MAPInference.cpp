@@ -10,6 +10,8 @@
 
 #include <shogun/structure/MAPInference.h>
 #include <shogun/structure/BeliefPropagation.h>
+#include <shogun/structure/GraphCut.h>
+#include <shogun/structure/TRWSMaxProduct.h>
 #include <shogun/labels/FactorGraphLabels.h>
 
 using namespace shogun;
@@ -35,16 +37,14 @@ CMAPInference::CMAPInference(CFactorGraph* fg, EMAPInferType inference_method)
 			m_infer_impl = new CTreeMaxProduct(fg);
 			break;
 		case LOOPY_MAX_PROD:
-			SG_ERROR("%s::CMAPInference(): LoopyMaxProduct has not been implemented!\n",
-				get_name());
+			m_infer_impl = new CLoopyMaxProduct(fg);
 			break;
 		case LP_RELAXATION:
 			SG_ERROR("%s::CMAPInference(): LPRelaxation has not been implemented!\n",
 				get_name());
 			break;
 		case TRWS_MAX_PROD:
-			SG_ERROR("%s::CMAPInference(): TRW-S has not been implemented!\n",
-				get_name());
+			m_infer_impl = new CTRWSMaxProduct(fg);
 			break;
 		case ITER_COND_MODE:
 			SG_ERROR("%s::CMAPInference(): ICM has not been implemented!\n",
@@ -58,6 +58,9 @@ CMAPInference::CMAPInference(CFactorGraph* fg, EMAPInferType inference_method)
 			SG_ERROR("%s::CMAPInference(): StructMeanField has not been implemented!\n",
 				get_name());
 			break;
+		case GRAPH_CUT:
+			m_infer_impl = new CGraphCut(fg);
+			break;
 		default:
 			SG_ERROR("%s::CMAPInference(): unsupported inference method!\n",
 				get_name());
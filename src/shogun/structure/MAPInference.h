@@ -23,7 +23,8 @@ namespace shogun
  * Tree Max Product, Loopy Max Product, LP Relaxation,
  * Sequential Tree Reweighted Max Product (TRW-S),
  * Iterated Conditional Mode (ICM), Naive Mean Field,
- * Structured Mean Field.
+ * Structured Mean Field, Graph Cut (binary variables with
+ * submodular pairwise factors only).
  */
 enum EMAPInferType
 {
@@ -34,6 +35,7 @@ enum EMAPInferType
 	ITER_COND_MODE = 4,
 	NAIVE_MEAN_FIELD = 5,
 	STRUCT_MEAN_FIELD = 6,
+	GRAPH_CUT = 7,
 };
 
 class CMAPInferImpl;
@@ -202,6 +202,22 @@ float64_t CPlif::lookup_penalty(int32_t p_value, float64_t* svm_values) const
 	return lookup_penalty((float64_t) p_value, svm_values) ;
 }
 
+float64_t CPlif::lookup_value_penalty(int32_t p_value) const
+{
+	if (use_svm)
+		return 0.0 ;
+
+	return lookup_penalty(p_value, NULL) ;
+}
+
+float64_t CPlif::lookup_svm_penalty(float64_t* svm_values) const
+{
+	if (!use_svm)
+		return 0.0 ;
+
+	return lookup_penalty_svm(0.0, svm_values) ;
+}
+
 float64_t CPlif::lookup_penalty(float64_t p_value, float64_t* svm_values) const
 {
 	if (use_svm)
@@ -74,6 +74,20 @@ class CPlif: public CPlifBase
 		 */
 		float64_t lookup_penalty(int32_t p_value, float64_t* svm_values) const;
 
+		/** lookup the penalty if the plif does not use SVM values
+		 *
+		 * @param p_value value
+		 * @return the penalty, 0 if SVM values are used
+		 */
+		float64_t lookup_value_penalty(int32_t p_value) const;
+
+		/** lookup the penalty if the plif uses SVM values
+		 *
+		 * @param svm_values SVM values
+		 * @return the penalty, 0 if SVM values are not used
+		 */
+		float64_t lookup_svm_penalty(float64_t* svm_values) const;
+
 		/** lookup
 		 *
 		 * @param p_value value
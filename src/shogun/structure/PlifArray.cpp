@@ -101,6 +101,25 @@ float64_t CPlifArray::lookup_penalty(
 	return ret ;
 }
 
+float64_t CPlifArray::lookup_value_penalty(int32_t p_value) const
+{
+	if (p_value<min_value || p_value>max_value)
+		return -CMath::INFTY ;
+
+	float64_t ret = 0.0 ;
+	for (int32_t i=0; i<m_array.get_num_elements(); i++)
+		ret += m_array[i]->lookup_value_penalty(p_value) ;
+	return ret ;
+}
+
+float64_t CPlifArray::lookup_svm_penalty(float64_t* svm_values) const
+{
+	float64_t ret = 0.0 ;
+	for (int32_t i=0; i<m_array.get_num_elements(); i++)
+		ret += m_array[i]->lookup_svm_penalty(svm_values) ;
+	return ret ;
+}
+
 void CPlifArray::penalty_clear_derivative()
 {
 	for (int32_t i=0; i<m_array.get_num_elements(); i++)
@@ -61,6 +61,18 @@ class CPlifArray: public CPlifBase
 		virtual float64_t lookup_penalty(
 			int32_t p_value, float64_t* svm_values) const;
 
+		/** lookup the summed penalty of all plifs not using SVM values
+		 *
+		 * @param p_value value
+		 */
+		virtual float64_t lookup_value_penalty(int32_t p_value) const;
+
+		/** lookup the summed penalty of all plifs using SVM values
+		 *
+		 * @param svm_values SVM values
+		 */
+		virtual float64_t lookup_svm_penalty(float64_t* svm_values) const;
+
 		/** penalty clear derivative */
 		virtual void penalty_clear_derivative();
 
@@ -47,6 +47,26 @@ class CPlifBase : public CSGObject
 		virtual float64_t lookup_penalty(
 			int32_t p_value, float64_t* svm_values) const =0;
 
+		/** lookup the part of the penalty that only depends on the value,
+		 * i.e. the penalty of all plifs that do not use SVM values
+		 *
+		 * abstract base method
+		 *
+		 * @param p_value value
+		 * @return penalty
+		 */
+		virtual float64_t lookup_value_penalty(int32_t p_value) const =0;
+
+		/** lookup the part of the penalty that only depends on the SVM
+		 * values; lookup_penalty() is the sum of both parts
+		 *
+		 * abstract base method
+		 *
+		 * @param svm_values SVM values
+		 * @return penalty
+		 */
+		virtual float64_t lookup_svm_penalty(float64_t* svm_values) const =0;
+
 		/** penalty clear derivative
 		 *
 		 * abstrace base method
@@ -0,0 +1,350 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/structure/TRWSMaxProduct.h>
+#include <shogun/lib/DynamicObjectArray.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/io/SGIO.h>
+
+using namespace shogun;
+
+CTRWSMaxProduct::CTRWSMaxProduct()
+	: CMAPInferImpl()
+{
+	SG_UNSTABLE("CTRWSMaxProduct::CTRWSMaxProduct()", "\n");
+
+	init();
+}
+
+CTRWSMaxProduct::CTRWSMaxProduct(CFactorGraph* fg)
+	: CMAPInferImpl(fg)
+{
+	ASSERT(m_fg != NULL);
+
+	init();
+
+	m_cards = m_fg->get_cardinalities();
+	int32_t num_vars = m_cards.size();
+	CDynamicObjectArray* facs = m_fg->get_factors();
+	int32_t num_facs = facs->get_num_elements();
+
+	m_unary_offsets = SGVector<int32_t>(num_vars+1);
+	m_unary_offsets[0] = 0;
+	for (int32_t vi = 0; vi < num_vars; vi++)
+		m_unary_offsets[vi+1] = m_unary_offsets[vi] + m_cards[vi];
+
+	// one edge per pairwise factor, from the lower to the higher variable
+	m_fac_edge = SGVector<int32_t>(num_facs);
+	m_fac_edge.set_const(-1);
+	int32_t num_edges = 0;
+	for (int32_t fi = 0; fi < num_facs; fi++)
+	{
+		CFactor* fac = dynamic_cast<CFactor*>(facs->get_element(fi));
+		SGVector<int32_t> vars = fac->get_variables();
+		SG_UNREF(fac);
+
+		REQUIRE(vars.size() <= 2, "%s::CTRWSMaxProduct(): only unary and pairwise "
+			"factors are supported, factor %d has %d variables!\n",
+			get_name(), fi, vars.size());
+		REQUIRE(vars.size() < 2 || vars[0] != vars[1], "%s::CTRWSMaxProduct(): "
+			"factor %d connects variable %d with itself!\n", get_name(), fi, vars[0]);
+
+		if (vars.size() == 2)
+			m_fac_edge[fi] = num_edges++;
+	}
+
+	m_edge_first = SGVector<int32_t>(num_edges);
+	m_edge_second = SGVector<int32_t>(num_edges);
+	m_edge_swapped = SGVector<bool>(num_edges);
+	m_pair_offsets = SGVector<int32_t>(num_edges+1);
+	m_msg_first_offsets = SGVector<int32_t>(num_edges);
+	m_msg_second_offsets = SGVector<int32_t>(num_edges);
+	m_var_edge_ptr = SGVector<int32_t>(num_vars+1);
+	m_var_edge_ptr.zero();
+	m_pair_offsets[0] = 0;
+
+	int32_t num_msgs = 0;
+	for (int32_t fi = 0; fi < num_facs; fi++)
+	{
+		int32_t ei = m_fac_edge[fi];
+		if (ei < 0)
+			continue;
+
+		CFactor* fac = dynamic_cast<CFactor*>(facs->get_element(fi));
+		SGVector<int32_t> vars = fac->get_variables();
+		SG_UNREF(fac);
+
+		m_edge_swapped[ei] = vars[0] > vars[1];
+		m_edge_first[ei] = CMath::min(vars[0], vars[1]);
+		m_edge_second[ei] = CMath::max(vars[0], vars[1]);
+
+		int32_t card_first = m_cards[m_edge_first[ei]];
+		int32_t card_second = m_cards[m_edge_second[ei]];
+		m_pair_offsets[ei+1] = m_pair_offsets[ei] + card_first*card_second;
+		m_msg_first_offsets[ei] = num_msgs;
+		m_msg_second_offsets[ei] = num_msgs + card_first;
+		num_msgs += card_first + card_second;
+
+		m_var_edge_ptr[m_edge_first[ei]+1]++;
+		m_var_edge_ptr[m_edge_second[ei]+1]++;
+	}
+	SG_UNREF(facs);
+
+	// edges of each variable
+	for (int32_t vi = 0; vi < num_vars; vi++)
+		m_var_edge_ptr[vi+1] += m_var_edge_ptr[vi];
+
+	m_var_edges = SGVector<int32_t>(2*num_edges);
+	SGVector<int32_t> pos = m_var_edge_ptr.clone();
+	for (int32_t ei = 0; ei < num_edges; ei++)
+	{
+		m_var_edges[pos[m_edge_first[ei]]++] = ei;
+		m_var_edges[pos[m_edge_second[ei]]++] = ei;
+	}
+
+	// a variable is in as many monotonic chains as it has earlier or
+	// later neighbours, whichever is more
+	m_gammas = SGVector<float64_t>(num_vars);
+	for (int32_t vi = 0; vi < num_vars; vi++)
+	{
+		int32_t num_later = 0;
+		for (int32_t k = m_var_edge_ptr[vi]; k < m_var_edge_ptr[vi+1]; k++)
+			num_later += m_edge_first[m_var_edges[k]] == vi;
+
+		int32_t num_earlier = m_var_edge_ptr[vi+1] - m_var_edge_ptr[vi] - num_later;
+		m_gammas[vi] = 1.0 / CMath::max(CMath::max(num_earlier, num_later), 1);
+	}
+
+	m_unaries = SGVector<float64_t>(m_unary_offsets[num_vars]);
+	m_pairs = SGVector<float64_t>(m_pair_offsets[num_edges]);
+	m_msgs = SGVector<float64_t>(num_msgs);
+}
+
+CTRWSMaxProduct::~CTRWSMaxProduct()
+{
+}
+
+void CTRWSMaxProduct::init()
+{
+	SG_ADD(&m_max_iter, "max_iter", "Maximum number of iterations", MS_NOT_AVAILABLE);
+	SG_ADD(&m_tolerance, "tolerance", "Convergence tolerance", MS_NOT_AVAILABLE);
+
+	m_max_iter = 100;
+	m_tolerance = 1e-8;
+	m_num_iter = 0;
+}
+
+void CTRWSMaxProduct::set_max_iter(int32_t max_iter)
+{
+	REQUIRE(max_iter > 0, "%s::set_max_iter(): max_iter must be positive!\n", get_name());
+	m_max_iter = max_iter;
+}
+
+void CTRWSMaxProduct::set_tolerance(float64_t tolerance)
+{
+	REQUIRE(tolerance >= 0, "%s::set_tolerance(): tolerance must be non-negative!\n", get_name());
+	m_tolerance = tolerance;
+}
+
+void CTRWSMaxProduct::copy_energies()
+{
+	m_unaries.zero();
+
+	CDynamicObjectArray* facs = m_fg->get_factors();
+	for (int32_t fi = 0; fi < facs->get_num_elements(); fi++)
+	{
+		CFactor* fac = dynamic_cast<CFactor*>(facs->get_element(fi));
+		SGVector<int32_t> vars = fac->get_variables();
+		SGVector<float64_t> fenrgs = fac->get_energies();
+		SG_UNREF(fac);
+
+		if (vars.size() == 1)
+		{
+			float64_t* unary = m_unaries.vector + m_unary_offsets[vars[0]];
+			for (int32_t si = 0; si < fenrgs.size(); si++)
+				unary[si] += fenrgs[si];
+		}
+		else if (vars.size() == 2)
+		{
+			// the first variable of the factor changes fastest in its table
+			int32_t ei = m_fac_edge[fi];
+			int32_t card0 = m_cards[vars[0]];
+			int32_t card1 = m_cards[vars[1]];
+			float64_t* pair = m_pairs.vector + m_pair_offsets[ei];
+			for (int32_t s0 = 0; s0 < card0; s0++)
+			{
+				for (int32_t s1 = 0; s1 < card1; s1++)
+				{
+					float64_t energy = fenrgs[s0 + card0*s1];
+					if (m_edge_swapped[ei])
+						pair[s1*card0 + s0] = energy;
+					else
+						pair[s0*card1 + s1] = energy;
+				}
+			}
+		}
+	}
+	SG_UNREF(facs);
+}
+
+float64_t CTRWSMaxProduct::pass(bool forward)
+{
+	int32_t num_vars = m_cards.size();
+	int32_t max_card = num_vars > 0 ? SGVector<int32_t>::max(m_cards.vector, num_vars) : 0;
+	SGVector<float64_t> theta(max_card);
+	SGVector<float64_t> new_msg(max_card);
+	float64_t max_change = 0;
+
+	for (int32_t i = 0; i < num_vars; i++)
+	{
+		int32_t vi = forward ? i : num_vars - 1 - i;
+		int32_t card = m_cards[vi];
+
+		// theta = theta_v + sum of all incoming messages
+		const float64_t* unary = m_unaries.vector + m_unary_offsets[vi];
+		for (int32_t si = 0; si < card; si++)
+			theta[si] = unary[si];
+
+		for (int32_t k = m_var_edge_ptr[vi]; k < m_var_edge_ptr[vi+1]; k++)
+		{
+			int32_t ei = m_var_edges[k];
+			const float64_t* msg_in = m_msgs.vector + (m_edge_first[ei] == vi ?
+				m_msg_first_offsets[ei] : m_msg_second_offsets[ei]);
+
+			for (int32_t si = 0; si < card; si++)
+				theta[si] += msg_in[si];
+		}
+
+		// M_vw(x_w) = min_{x_v} gamma_v theta(x_v) - M_wv(x_v) + theta_vw(x_v, x_w)
+		for (int32_t k = m_var_edge_ptr[vi]; k < m_var_edge_ptr[vi+1]; k++)
+		{
+			int32_t ei = m_var_edges[k];
+			bool is_first = m_edge_first[ei] == vi;
+			if (is_first != forward)
+				continue;
+
+			int32_t wi = is_first ? m_edge_second[ei] : m_edge_first[ei];
+			int32_t card_w = m_cards[wi];
+			const float64_t* pair = m_pairs.vector + m_pair_offsets[ei];
+			const float64_t* msg_in = m_msgs.vector + (is_first ?
+				m_msg_first_offsets[ei] : m_msg_second_offsets[ei]);
+			float64_t* msg_out = m_msgs.vector + (is_first ?
+				m_msg_second_offsets[ei] : m_msg_first_offsets[ei]);
+
+			float64_t min_msg = CMath::INFTY;
+			for (int32_t sw = 0; sw < card_w; sw++)
+			{
+				float64_t best = CMath::INFTY;
+				for (int32_t sv = 0; sv < card; sv++)
+				{
+					float64_t val = m_gammas[vi]*theta[sv] - msg_in[sv] +
+						(is_first ? pair[sv*card_w + sw] : pair[sw*card + sv]);
+					best = CMath::min(best, val);
+				}
+
+				new_msg[sw] = best;
+				min_msg = CMath::min(min_msg, best);
+			}
+
+			// normalize to min 0
+			for (int32_t sw = 0; sw < card_w; sw++)
+			{
+				float64_t val = new_msg[sw] - min_msg;
+				if (val != msg_out[sw])
+					max_change = CMath::max(max_change, CMath::abs(val - msg_out[sw]));
+
+				msg_out[sw] = val;
+			}
+		}
+	}
+
+	return max_change;
+}
+
+float64_t CTRWSMaxProduct::decode(SGVector<int32_t> labeling)
+{
+	float64_t energy = 0;
+	for (int32_t vi = 0; vi < m_cards.size(); vi++)
+	{
+		// condition on the labels of earlier neighbours, use the messages
+		// of later ones
+		const float64_t* unary = m_unaries.vector + m_unary_offsets[vi];
+		float64_t best = CMath::INFTY;
+		float64_t best_energy = 0;
+		labeling[vi] = 0;
+		for (int32_t si = 0; si < m_cards[vi]; si++)
+		{
+			float64_t val = unary[si];
+			float64_t local_energy = unary[si];
+			for (int32_t k = m_var_edge_ptr[vi]; k < m_var_edge_ptr[vi+1]; k++)
+			{
+				int32_t ei = m_var_edges[k];
+				if (m_edge_first[ei] == vi)
+				{
+					val += m_msgs[m_msg_first_offsets[ei] + si];
+				}
+				else
+				{
+					int32_t card = m_cards[vi];
+					float64_t pair = m_pairs[m_pair_offsets[ei] +
+						labeling[m_edge_first[ei]]*card + si];
+					val += pair;
+					local_energy += pair;
+				}
+			}
+
+			if (val < best)
+			{
+				best = val;
+				best_energy = local_energy;
+				labeling[vi] = si;
+			}
+		}
+
+		energy += best_energy;
+	}
+
+	return energy;
+}
+
+float64_t CTRWSMaxProduct::inference(SGVector<int32_t> assignment)
+{
+	REQUIRE(assignment.size() == m_cards.size(),
+		"%s::inference(): the output assignment should be prepared as"
+		"the same size as variables!\n", get_name());
+
+	// energies may have changed since construction, e.g. by loss augmentation
+	copy_energies();
+	m_msgs.zero();
+
+	SGVector<int32_t> labeling(m_cards.size());
+	float64_t best_energy = CMath::INFTY;
+	for (m_num_iter = 1; m_num_iter <= m_max_iter; m_num_iter++)
+	{
+		float64_t change = CMath::max(pass(true), pass(false));
+
+		float64_t energy = decode(labeling);
+		if (energy < best_energy)
+		{
+			best_energy = energy;
+			for (int32_t vi = 0; vi < labeling.size(); vi++)
+				assignment[vi] = labeling[vi];
+		}
+
+		if (change <= m_tolerance)
+			break;
+	}
+	m_num_iter = CMath::min(m_num_iter, m_max_iter);
+
+	float64_t energy = m_fg->evaluate_energy(assignment);
+	SG_DEBUG("%s::inference(): %d iterations, energy = %f\n", get_name(),
+		m_num_iter, energy);
+
+	return energy;
+}
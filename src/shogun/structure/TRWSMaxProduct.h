@@ -0,0 +1,136 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#ifndef __TRWS_MAX_PRODUCT_H__
+#define __TRWS_MAX_PRODUCT_H__
+
+#include <shogun/lib/SGVector.h>
+#include <shogun/structure/FactorGraph.h>
+#include <shogun/structure/MAPInference.h>
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+namespace shogun
+{
+#define IGNORE_IN_CLASSLIST
+
+/** sequential tree-reweighted max-product (TRW-S) for factor graphs with
+ * unary and pairwise factors, see [1]. Variables are processed in the
+ * order of their indices, alternating forward and backward passes. Every
+ * pass sends the messages of one direction along all pairwise factors,
+ * which are stored in flat arrays indexed by factor. After each backward
+ * pass a labeling is decoded sequentially, the one of lowest energy is
+ * returned.
+ *
+ * [1] Vladimir Kolmogorov, Convergent Tree-Reweighted Message Passing for
+ * Energy Minimization, IEEE TPAMI 28(10), 2006.
+ */
+IGNORE_IN_CLASSLIST class CTRWSMaxProduct : public CMAPInferImpl
+{
+public:
+	CTRWSMaxProduct();
+	CTRWSMaxProduct(CFactorGraph* fg);
+
+	virtual ~CTRWSMaxProduct();
+
+	/** @return class name */
+	virtual const char* get_name() const { return "TRWSMaxProduct"; }
+
+	virtual float64_t inference(SGVector<int32_t> assignment);
+
+	/** @param max_iter maximum number of forward and backward passes */
+	void set_max_iter(int32_t max_iter);
+
+	/** @return maximum number of forward and backward passes */
+	int32_t get_max_iter() const { return m_max_iter; }
+
+	/** @param tolerance messages have converged if no message changes
+	 * by more than this in a pass
+	 */
+	void set_tolerance(float64_t tolerance);
+
+	/** @return convergence tolerance */
+	float64_t get_tolerance() const { return m_tolerance; }
+
+	/** @return number of iterations of the last inference */
+	int32_t get_num_iter() const { return m_num_iter; }
+
+protected:
+	/** copy the energies of the factors into unary and pairwise tables */
+	void copy_energies();
+
+	/** send the messages from all variables to their neighbours that
+	 * come later in the given direction
+	 *
+	 * @param forward whether variables are visited in increasing order
+	 * @return max change of a message
+	 */
+	float64_t pass(bool forward);
+
+	/** decode a labeling in increasing order of the variables
+	 *
+	 * @param labeling output labeling
+	 * @return energy of the labeling
+	 */
+	float64_t decode(SGVector<int32_t> labeling);
+
+private:
+	void init();
+
+private:
+	/** maximum number of iterations */
+	int32_t m_max_iter;
+	/** convergence tolerance */
+	float64_t m_tolerance;
+	/** iterations of the last inference */
+	int32_t m_num_iter;
+
+	/** cardinalities of the variables */
+	SGVector<int32_t> m_cards;
+	/** offset of the unary table of each variable, the last entry is the total */
+	SGVector<int32_t> m_unary_offsets;
+	/** sum of the unary factors of each variable */
+	SGVector<float64_t> m_unaries;
+	/** weight of the unaries in messages, 1/max(#earlier, #later neighbours) */
+	SGVector<float64_t> m_gammas;
+
+	/** pairwise edge of each factor with two variables, -1 otherwise */
+	SGVector<int32_t> m_fac_edge;
+	/** variable with the lower index of each edge */
+	SGVector<int32_t> m_edge_first;
+	/** variable with the higher index of each edge */
+	SGVector<int32_t> m_edge_second;
+	/** whether the variables of the factor of the edge are in reverse order */
+	SGVector<bool> m_edge_swapped;
+	/** offset of the pairwise table of each edge, indexed by
+	 * (first state) * (cardinality of second) + (second state)
+	 */
+	SGVector<int32_t> m_pair_offsets;
+	/** pairwise tables of all edges */
+	SGVector<float64_t> m_pairs;
+	/** edges of variable vi are m_var_edges[m_var_edge_ptr[vi]] to
+	 * m_var_edges[m_var_edge_ptr[vi+1]-1]
+	 */
+	SGVector<int32_t> m_var_edge_ptr;
+	/** edges sorted by variable */
+	SGVector<int32_t> m_var_edges;
+
+	/** offset of the message of each edge to its first variable */
+	SGVector<int32_t> m_msg_first_offsets;
+	/** offset of the message of each edge to its second variable */
+	SGVector<int32_t> m_msg_second_offsets;
+	/** messages of all edges in both directions */
+	SGVector<float64_t> m_msgs;
+};
+
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+#endif
@@ -229,3 +229,78 @@ TEST(SGObject,equals_complex_equal)
 	SG_UNREF(gpr_copy);
 }
 #endif //HAVE_EIGEN3
+
+TEST(SGObject,clone_share_data)
+{
+	SGMatrix<float64_t> data(10, 20);
+	for (index_t i=0; i<data.num_rows*data.num_cols; ++i)
+		data.matrix[i]=i;
+
+	CDenseFeatures<float64_t>* feats=new CDenseFeatures<float64_t>(data);
+	SG_REF(feats);
+	int64_t matrix_bytes=int64_t(data.num_rows)*data.num_cols*sizeof(float64_t);
+
+	int64_t bytes_deep=0;
+	CDenseFeatures<float64_t>* deep=(CDenseFeatures<float64_t>*)
+			feats->clone(false, &bytes_deep);
+	EXPECT_TRUE(feats->equals(deep));
+	EXPECT_NE(deep->get_feature_matrix().matrix, data.matrix);
+	EXPECT_GE(bytes_deep, matrix_bytes);
+
+	int64_t bytes_shared=0;
+	CDenseFeatures<float64_t>* shared=(CDenseFeatures<float64_t>*)
+			feats->clone(true, &bytes_shared);
+	EXPECT_TRUE(feats->equals(shared));
+	EXPECT_EQ(shared->get_feature_matrix().matrix, data.matrix);
+	EXPECT_LT(bytes_shared, matrix_bytes);
+
+	/* buffer stays alive as long as the clone references it */
+	SG_UNREF(feats);
+	data=SGMatrix<float64_t>();
+	EXPECT_EQ(shared->get_feature_matrix()(9, 19), 199);
+
+	SG_UNREF(deep);
+	SG_UNREF(shared);
+}
+
+TEST(SGObject,clone_share_data_copy_on_write)
+{
+	SGMatrix<float64_t> data(3, 4);
+	for (index_t i=0; i<data.num_rows*data.num_cols; ++i)
+		data.matrix[i]=i;
+
+	CDenseFeatures<float64_t>* feats=new CDenseFeatures<float64_t>(data);
+	SG_REF(feats);
+	CDenseFeatures<float64_t>* shared=(CDenseFeatures<float64_t>*)
+			feats->clone(true);
+
+	/* writing into the clone does not change the original */
+	SGVector<float64_t> vec(3);
+	vec.set_const(-1);
+	shared->set_feature_vector(vec, 1);
+	EXPECT_NE(shared->get_feature_matrix().matrix, data.matrix);
+	EXPECT_EQ(shared->get_feature_matrix()(0, 1), -1);
+	EXPECT_EQ(feats->get_feature_matrix()(0, 1), 3);
+
+	/* and the other way round */
+	CDenseFeatures<float64_t>* shared2=(CDenseFeatures<float64_t>*)
+			feats->clone(true);
+	feats->set_feature_vector(vec, 2);
+	EXPECT_EQ(feats->get_feature_matrix()(0, 2), -1);
+	EXPECT_EQ(shared2->get_feature_matrix()(0, 2), 6);
+	EXPECT_EQ(shared2->get_feature_matrix().matrix, data.matrix);
+
+	CBinaryLabels* labels=new CBinaryLabels(4);
+	labels->set_to_one();
+	SG_REF(labels);
+	CBinaryLabels* shared_labels=(CBinaryLabels*)labels->clone(true);
+	shared_labels->set_label(0, -1);
+	EXPECT_EQ(labels->get_label(0), 1);
+	EXPECT_EQ(shared_labels->get_label(0), -1);
+
+	SG_UNREF(feats);
+	SG_UNREF(shared);
+	SG_UNREF(shared2);
+	SG_UNREF(labels);
+	SG_UNREF(shared_labels);
+}
@@ -0,0 +1,111 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/base/init.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/classifier/svm/LibSVM.h>
+#include <shogun/multiclass/MulticlassLibSVM.h>
+#include <shogun/features/DataGenerator.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* columns are longer than the blocks that are computed in parallel */
+static CLibSVM* train_libsvm(CDenseFeatures<float64_t>* features,
+		CBinaryLabels* labels, int32_t num_threads)
+{
+	Parallel* parallel=get_global_parallel();
+	int32_t old_threads=parallel->get_num_threads();
+	parallel->set_num_threads(num_threads);
+
+	CGaussianKernel* kernel=new CGaussianKernel(features, features, 2.0, 10);
+	CLibSVM* svm=new CLibSVM(1.0, kernel, labels);
+	SG_REF(svm);
+	svm->train();
+
+	parallel->set_num_threads(old_threads);
+	SG_UNREF(parallel);
+
+	return svm;
+}
+
+TEST(LibSVM,parallel_kernel_columns)
+{
+	index_t num_samples=400;
+	CMath::init_random(3);
+	SGMatrix<float64_t> data=CDataGenerator::generate_gaussians(num_samples, 2, 2);
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data);
+	SG_REF(features);
+
+	SGVector<float64_t> lab(data.num_cols);
+	for (index_t i=0; i<data.num_cols; i++)
+		lab[i]=(i<data.num_cols/2) ? 1.0 : -1.0;
+	CBinaryLabels* labels=new CBinaryLabels(lab);
+	SG_REF(labels);
+
+	CLibSVM* serial=train_libsvm(features, labels, 1);
+	CLibSVM* parallel=train_libsvm(features, labels, 3);
+
+	/* every entry of a column is computed the same way by any thread */
+	EXPECT_EQ(serial->get_objective(), parallel->get_objective());
+	EXPECT_EQ(serial->get_bias(), parallel->get_bias());
+	ASSERT_EQ(serial->get_num_support_vectors(), parallel->get_num_support_vectors());
+	for (index_t i=0; i<serial->get_num_support_vectors(); i++)
+	{
+		EXPECT_EQ(serial->get_support_vector(i), parallel->get_support_vector(i));
+		EXPECT_EQ(serial->get_alpha(i), parallel->get_alpha(i));
+	}
+
+	EXPECT_GT(serial->get_cache_hits(), 0);
+	EXPECT_GT(serial->get_cache_misses(), 0);
+	EXPECT_GT(serial->get_cache_hit_rate(), 0.5);
+	EXPECT_LE(serial->get_cache_hit_rate(), 1.0);
+	EXPECT_GE(serial->get_cache_evaluations(), serial->get_cache_misses());
+	EXPECT_GT(serial->get_cache_memory(), 0);
+	EXPECT_LE(serial->get_cache_memory(), 10*1024*1024);
+	EXPECT_EQ(serial->get_cache_hits(), parallel->get_cache_hits());
+	EXPECT_EQ(serial->get_cache_evaluations(), parallel->get_cache_evaluations());
+
+	SG_UNREF(serial);
+	SG_UNREF(parallel);
+	SG_UNREF(labels);
+	SG_UNREF(features);
+}
+
+TEST(LibSVM,multiclass_cache_statistics)
+{
+	index_t num_samples=100;
+	index_t num_classes=3;
+	CMath::init_random(5);
+	SGMatrix<float64_t> data=CDataGenerator::generate_gaussians(num_samples,
+			num_classes, 2);
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data);
+
+	SGVector<float64_t> lab(data.num_cols);
+	for (index_t i=0; i<data.num_cols; i++)
+		lab[i]=i/num_samples;
+	CMulticlassLabels* labels=new CMulticlassLabels(lab);
+
+	CGaussianKernel* kernel=new CGaussianKernel(features, features, 2.0, 10);
+	CMulticlassLibSVM* svm=new CMulticlassLibSVM(1.0, kernel, labels);
+	SG_REF(svm);
+	svm->train();
+
+	/* statistics are summed over the one vs one subproblems */
+	EXPECT_GT(svm->get_cache_hit_rate(), 0.0);
+	EXPECT_GE(svm->get_cache_evaluations(), 2*num_samples*num_samples);
+	EXPECT_GT(svm->get_cache_memory(), 0);
+
+	SG_UNREF(svm);
+}
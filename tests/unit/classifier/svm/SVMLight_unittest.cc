@@ -0,0 +1,136 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/lib/config.h>
+
+#ifdef USE_SVMLIGHT
+#include <shogun/base/init.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/classifier/svm/SVMLight.h>
+#include <shogun/features/DataGenerator.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/StringFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/string/WeightedDegreeStringKernel.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/lib/SGStringList.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* trains on the features and returns the objective, the outputs on the
+ * training data are stored in outputs */
+static float64_t train_svmlight(CKernel* kernel, CBinaryLabels* labels,
+		bool second_order, bool linadd, int32_t num_threads,
+		SGVector<float64_t>& outputs)
+{
+	CSVMLight* svm=new CSVMLight(1.0, kernel, labels);
+	SG_REF(svm);
+	svm->parallel->set_num_threads(num_threads);
+	svm->set_second_order_selection(second_order);
+	svm->set_linadd_enabled(linadd);
+	svm->set_batch_computation_enabled(false);
+	svm->set_shrinking_enabled(true);
+	svm->set_epsilon(1e-5);
+	svm->set_qpsize(4);
+	svm->train();
+
+	float64_t objective=svm->get_objective();
+	CBinaryLabels* pred=svm->apply_binary();
+	outputs=pred->get_values();
+	SG_UNREF(pred);
+	SG_UNREF(svm);
+
+	return objective;
+}
+
+TEST(SVMLight,second_order_selection)
+{
+	index_t num_samples=200;
+	CMath::init_random(7);
+	SGMatrix<float64_t> data=CDataGenerator::generate_gaussians(num_samples, 2, 2);
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data);
+	SG_REF(features);
+
+	SGVector<float64_t> lab(data.num_cols);
+	for (index_t i=0; i<data.num_cols; i++)
+		lab[i]=(i<data.num_cols/2) ? 1.0 : -1.0;
+	CBinaryLabels* labels=new CBinaryLabels(lab);
+	SG_REF(labels);
+
+	CGaussianKernel* kernel=new CGaussianKernel(features, features, 2.0, 10);
+	SG_REF(kernel);
+
+	SGVector<float64_t> first_out, second_out, parallel_out;
+	float64_t first=train_svmlight(kernel, labels, false, false, 1, first_out);
+	float64_t second=train_svmlight(kernel, labels, true, false, 1, second_out);
+	float64_t parallel=train_svmlight(kernel, labels, true, false, 3, parallel_out);
+
+	/* both selections solve the same problem */
+	EXPECT_NEAR(first, second, 1e-3*CMath::abs(first));
+	EXPECT_NEAR(second, parallel, 1e-6*CMath::abs(second));
+	for (index_t i=0; i<first_out.vlen; i++)
+	{
+		EXPECT_NEAR(first_out[i], second_out[i], 1e-2);
+		EXPECT_NEAR(second_out[i], parallel_out[i], 1e-4);
+	}
+
+	SG_UNREF(kernel);
+	SG_UNREF(labels);
+	SG_UNREF(features);
+}
+
+TEST(SVMLight,linadd_shrinking)
+{
+	index_t num_samples=300;
+	index_t len=20;
+	CMath::init_random(11);
+
+	/* positive strings have a motif in the middle */
+	SGStringList<char> strings(num_samples, len);
+	SGVector<float64_t> lab(num_samples);
+	for (index_t i=0; i<num_samples; i++)
+	{
+		strings.strings[i]=SGString<char>(len);
+		for (index_t j=0; j<len; j++)
+			strings.strings[i].string[j]="ACGT"[CMath::random(0, 3)];
+
+		lab[i]=(i%2) ? 1.0 : -1.0;
+		if (lab[i]>0 && CMath::random(0.0, 1.0)<0.8)
+			memcpy(strings.strings[i].string+8, "GATT", 4);
+	}
+
+	CStringFeatures<char>* features=new CStringFeatures<char>(strings, DNA);
+	SG_REF(features);
+	CBinaryLabels* labels=new CBinaryLabels(lab);
+	SG_REF(labels);
+	CWeightedDegreeStringKernel* kernel=new CWeightedDegreeStringKernel(features, features, 3);
+	SG_REF(kernel);
+
+	/* gradients of shrunk examples are reconstructed from the normal
+	 * vector with linadd and from the alpha history without */
+	SGVector<float64_t> linadd_out, vanilla_out, parallel_out;
+	float64_t linadd=train_svmlight(kernel, labels, false, true, 3, linadd_out);
+	float64_t vanilla=train_svmlight(kernel, labels, false, false, 1, vanilla_out);
+	float64_t parallel=train_svmlight(kernel, labels, true, false, 3, parallel_out);
+
+	EXPECT_NEAR(linadd, vanilla, 1e-3*CMath::abs(vanilla));
+	EXPECT_NEAR(parallel, vanilla, 1e-3*CMath::abs(vanilla));
+	for (index_t i=0; i<num_samples; i++)
+	{
+		EXPECT_NEAR(linadd_out[i], vanilla_out[i], 1e-2);
+		EXPECT_NEAR(parallel_out[i], vanilla_out[i], 1e-2);
+	}
+
+	SG_UNREF(kernel);
+	SG_UNREF(labels);
+	SG_UNREF(features);
+}
+#endif // USE_SVMLIGHT
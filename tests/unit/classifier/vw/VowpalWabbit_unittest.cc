@@ -0,0 +1,155 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/base/init.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/classifier/vw/VowpalWabbit.h>
+#include <shogun/io/streaming/StreamingVwFile.h>
+#include <shogun/features/streaming/StreamingVwFeatures.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <unistd.h>
+
+using namespace shogun;
+
+/* writes a separable problem in VW format with two namespaces */
+static void write_data(const char* fname, int32_t num_examples)
+{
+	FILE* f=fopen(fname, "w");
+	ASSERT_TRUE(f!=NULL);
+
+	CMath::init_random(17);
+	for (int32_t i=0; i<num_examples; i++)
+	{
+		int32_t label=i%2 ? 1 : -1;
+		fprintf(f, "%d |a", label);
+		for (int32_t j=0; j<10; j++)
+			fprintf(f, " u%d:%f", j, CMath::random(0.0, 1.0)+(label>0 && j<3));
+		fprintf(f, "|b");
+		for (int32_t j=0; j<5; j++)
+			fprintf(f, " v%d:%f", j, CMath::random(0.0, 1.0));
+		fprintf(f, "\n");
+	}
+	fclose(f);
+}
+
+static SGVector<float32_t> train(const char* fname, int32_t num_threads,
+		EVwThreadingMode mode, float64_t& accuracy)
+{
+	CStreamingVwFile* file=new CStreamingVwFile(fname);
+	CStreamingVwFeatures* features=new CStreamingVwFeatures(file, true, 1024);
+	SG_REF(features);
+
+	CVowpalWabbit* vw=new CVowpalWabbit(features);
+	SG_REF(vw);
+	vw->add_quadratic_pair((char*) "ab");
+	vw->set_threading_mode(mode);
+	vw->set_averaging_interval(50);
+	vw->parallel->set_num_threads(num_threads);
+	vw->train_machine();
+	file->close();
+	SGVector<float32_t> w=vw->get_w();
+
+	/* training accuracy */
+	CStreamingVwFile* test_file=new CStreamingVwFile(fname);
+	CStreamingVwFeatures* test_features=new CStreamingVwFeatures(test_file,
+			true, 1024);
+	SG_REF(test_features);
+	int32_t num_correct=0;
+	int32_t num_examples=0;
+	test_features->start_parser();
+	while (test_features->get_next_example())
+	{
+		VwExample* ex=test_features->get_example();
+		float32_t label=ex->ld->label;
+		float32_t pred=vw->predict_and_finalize(ex);
+		num_correct+=(pred>0)==(label>0);
+		num_examples++;
+		test_features->release_example();
+	}
+	test_features->end_parser();
+	test_file->close();
+	accuracy=float64_t(num_correct)/num_examples;
+
+	SG_UNREF(test_features);
+	SG_UNREF(vw);
+	SG_UNREF(features);
+	return w;
+}
+
+TEST(VowpalWabbit,shard_weights_equals_sequential)
+{
+	char fname[]="/tmp/vw_shard_weights_XXXXXX";
+	int fd=mkstemp(fname);
+	ASSERT_NE(fd, -1);
+	close(fd);
+	write_data(fname, 500);
+
+	float64_t accuracy;
+	float64_t accuracy_sharded;
+	SGVector<float32_t> w=train(fname, 1, VW_SHARD_WEIGHTS, accuracy);
+	SGVector<float32_t> w_sharded=train(fname, 4, VW_SHARD_WEIGHTS,
+			accuracy_sharded);
+
+	ASSERT_EQ(w.vlen, w_sharded.vlen);
+	for (index_t i=0; i<w.vlen; i++)
+		EXPECT_NEAR(w[i], w_sharded[i], 1E-4);
+	EXPECT_EQ(accuracy, accuracy_sharded);
+	EXPECT_GT(accuracy, 0.9);
+
+	unlink(fname);
+}
+
+TEST(VowpalWabbit,sequential_by_default)
+{
+	char fname[]="/tmp/vw_sequential_XXXXXX";
+	int fd=mkstemp(fname);
+	ASSERT_NE(fd, -1);
+	close(fd);
+	write_data(fname, 500);
+
+	CVowpalWabbit* vw=new CVowpalWabbit();
+	EXPECT_EQ(VW_SEQUENTIAL, vw->get_threading_mode());
+	SG_UNREF(vw);
+
+	/* the model does not depend on the number of threads */
+	float64_t accuracy;
+	float64_t accuracy_threads;
+	SGVector<float32_t> w=train(fname, 1, VW_SEQUENTIAL, accuracy);
+	SGVector<float32_t> w_threads=train(fname, 4, VW_SEQUENTIAL,
+			accuracy_threads);
+
+	ASSERT_EQ(w.vlen, w_threads.vlen);
+	for (index_t i=0; i<w.vlen; i++)
+		EXPECT_EQ(w[i], w_threads[i]);
+	EXPECT_EQ(accuracy, accuracy_threads);
+
+	unlink(fname);
+}
+
+TEST(VowpalWabbit,shard_examples)
+{
+	char fname[]="/tmp/vw_shard_examples_XXXXXX";
+	int fd=mkstemp(fname);
+	ASSERT_NE(fd, -1);
+	close(fd);
+	write_data(fname, 2000);
+
+	float64_t accuracy;
+	float64_t accuracy_sharded;
+	train(fname, 1, VW_SHARD_EXAMPLES, accuracy);
+	train(fname, 4, VW_SHARD_EXAMPLES, accuracy_sharded);
+
+	EXPECT_GT(accuracy, 0.9);
+	EXPECT_GT(accuracy_sharded, 0.9);
+
+	unlink(fname);
+}
@@ -0,0 +1,207 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/base/init.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/classifier/vw/VowpalWabbit.h>
+#include <shogun/classifier/vw/cache/VwNativeCacheReader.h>
+#include <shogun/classifier/vw/cache/VwBlockCacheWriter.h>
+#include <shogun/classifier/vw/cache/VwBlockCacheReader.h>
+#include <shogun/io/streaming/StreamingVwFile.h>
+#include <shogun/io/streaming/StreamingVwCacheFile.h>
+#include <shogun/features/streaming/StreamingVwFeatures.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+using namespace shogun;
+
+static void temp_name(char* fname)
+{
+	int fd=mkstemp(fname);
+	ASSERT_NE(fd, -1);
+	close(fd);
+}
+
+/* writes examples in VW format and caches them in native and block format */
+static void write_caches(const char* text, char* native, char* block,
+		int32_t num_examples)
+{
+	FILE* f=fopen(text, "w");
+	ASSERT_TRUE(f!=NULL);
+
+	CMath::init_random(5);
+	for (int32_t i=0; i<num_examples; i++)
+	{
+		int32_t label=i%2 ? 1 : -1;
+		fprintf(f, "%d ex%d|a", label, i);
+		for (int32_t j=0; j<8; j++)
+			fprintf(f, " u%d:%f", j, CMath::random(0.0, 1.0)+(label>0 && j<3));
+		fprintf(f, "|b v%d w:-1\n", i%7);
+	}
+	fclose(f);
+
+	/* native cache is written while parsing */
+	CStreamingVwFile* file=new CStreamingVwFile((char*) text);
+	file->set_cache_parameters(native, C_NATIVE);
+	CStreamingVwFeatures* features=new CStreamingVwFeatures(file, true, 1024);
+	SG_REF(features);
+	features->start_parser();
+	while (features->get_next_example())
+		features->release_example();
+	features->end_parser();
+	SG_UNREF(features);
+
+	/* converted into small blocks */
+	CVwEnvironment* env=new CVwEnvironment();
+	CVwNativeCacheReader* reader=new CVwNativeCacheReader(native, env);
+	CVwCacheWriter* writer=new CVwBlockCacheWriter(block, env,
+			CVwBlockCacheWriter::get_default_compression(), 512);
+	SG_REF(reader);
+	SG_REF(writer);
+
+	VwExample* ex=new VwExample();
+	while (reader->read_cached_example(ex))
+	{
+		writer->cache_example(ex);
+		ex->reset_members();
+	}
+
+	delete ex;
+	SG_UNREF(reader);
+	SG_UNREF(writer);
+}
+
+static void expect_equal(VwExample* a, VwExample* b)
+{
+	EXPECT_EQ(a->ld->label, b->ld->label);
+	ASSERT_EQ(a->tag.index(), b->tag.index());
+	EXPECT_EQ(memcmp(a->tag.begin, b->tag.begin, a->tag.index()), 0);
+	ASSERT_EQ(a->indices.index(), b->indices.index());
+	for (vw_size_t i=0; i<a->indices.index(); i++)
+	{
+		vw_size_t ns=a->indices[i];
+		EXPECT_EQ(ns, b->indices[i]);
+		ASSERT_EQ(a->atomics[ns].index(), b->atomics[ns].index());
+		for (vw_size_t j=0; j<a->atomics[ns].index(); j++)
+		{
+			EXPECT_EQ(a->atomics[ns][j].weight_index,
+					b->atomics[ns][j].weight_index);
+			EXPECT_EQ(a->atomics[ns][j].x, b->atomics[ns][j].x);
+		}
+	}
+}
+
+TEST(VwBlockCache,read_equals_native)
+{
+	char text[]="/tmp/vw_block_text_XXXXXX";
+	char native[]="/tmp/vw_block_native_XXXXXX";
+	char block[]="/tmp/vw_block_block_XXXXXX";
+	temp_name(text);
+	temp_name(native);
+	temp_name(block);
+	write_caches(text, native, block, 300);
+
+	CVwEnvironment* env=new CVwEnvironment();
+	CVwNativeCacheReader* native_reader=new CVwNativeCacheReader(native, env);
+	CVwBlockCacheReader* block_reader=new CVwBlockCacheReader(block, env);
+	SG_REF(native_reader);
+	SG_REF(block_reader);
+	block_reader->parallel->set_num_threads(3);
+
+	EXPECT_GT(block_reader->get_num_blocks(), 3);
+	EXPECT_EQ(block_reader->get_num_examples(), 300);
+
+	VwExample* a=new VwExample();
+	VwExample* b=new VwExample();
+	int32_t num_read=0;
+	while (native_reader->read_cached_example(a))
+	{
+		ASSERT_TRUE(block_reader->read_cached_example(b));
+		expect_equal(a, b);
+		a->reset_members();
+		b->reset_members();
+		num_read++;
+	}
+	EXPECT_EQ(num_read, 300);
+	EXPECT_FALSE(block_reader->read_cached_example(b));
+
+	/* a shuffled pass reads each block once, examples stay in order */
+	block_reader->set_shuffle(true);
+	block_reader->reset();
+	SGVector<int32_t> seen(300);
+	seen.zero();
+	while (block_reader->read_cached_example(b))
+	{
+		std::string tag(b->tag.begin, b->tag.index());
+		int32_t i=atoi(tag.c_str()+2);
+		ASSERT_TRUE(i>=0 && i<300);
+		seen[i]++;
+		b->reset_members();
+	}
+	for (index_t i=0; i<seen.vlen; i++)
+		EXPECT_EQ(seen[i], 1);
+
+	/* random access to the last block */
+	index_t last=block_reader->get_num_blocks()-1;
+	block_reader->seek_block(last);
+	num_read=0;
+	while (block_reader->read_cached_example(b))
+	{
+		b->reset_members();
+		num_read++;
+	}
+	EXPECT_EQ(num_read, block_reader->get_block_num_examples(last));
+
+	delete a;
+	delete b;
+	SG_UNREF(native_reader);
+	SG_UNREF(block_reader);
+	unlink(text);
+	unlink(native);
+	unlink(block);
+}
+
+TEST(VwBlockCache,train_from_block_cache)
+{
+	char text[]="/tmp/vw_block_text_XXXXXX";
+	char native[]="/tmp/vw_block_native_XXXXXX";
+	char block[]="/tmp/vw_block_block_XXXXXX";
+	temp_name(text);
+	temp_name(native);
+	temp_name(block);
+	write_caches(text, native, block, 500);
+
+	SGVector<float32_t> w[2];
+	for (index_t i=0; i<2; i++)
+	{
+		CStreamingVwCacheFile* file=new CStreamingVwCacheFile(
+				i ? block : native, 'r', i ? C_BLOCK : C_NATIVE);
+		CStreamingVwFeatures* features=new CStreamingVwFeatures(file, true,
+				1024);
+		CVowpalWabbit* vw=new CVowpalWabbit(features);
+		SG_REF(vw);
+		vw->set_num_passes(2);
+		vw->train_machine();
+		w[i]=vw->get_w();
+		SG_UNREF(vw);
+	}
+
+	ASSERT_EQ(w[0].vlen, w[1].vlen);
+	for (index_t i=0; i<w[0].vlen; i++)
+		EXPECT_EQ(w[0][i], w[1][i]) << i;
+
+	unlink(text);
+	unlink(native);
+	unlink(block);
+}
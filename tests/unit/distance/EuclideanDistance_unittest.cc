@@ -52,6 +52,7 @@ TEST(EuclideanDistance,distance)
 	// put features into distance object to compute squared Euclidean distances
 	CEuclideanDistance* euclidean=new CEuclideanDistance(features_lhs,features_rhs);
 	euclidean->set_disable_sqrt(true);
+	EXPECT_EQ(F_DREAL, euclidean->get_feature_type());
 
 	// check distances computed one by one
 	EXPECT_EQ(euclidean->distance(0,0), 2);
@@ -87,3 +88,42 @@ TEST(EuclideanDistance,get_distance_matrix)
 	SG_UNREF(euclidean); // the features are unref-ed here as well
 	exit_shogun();
 }
+
+TEST(EuclideanDistance,single_precision)
+{
+	SGMatrix<float32_t> feat_mat_lhs(2,2);
+	feat_mat_lhs(0,0)=0;
+	feat_mat_lhs(1,0)=0;
+	feat_mat_lhs(0,1)=0;
+	feat_mat_lhs(1,1)=-1;
+	SGMatrix<float32_t> feat_mat_rhs(2,2);
+	feat_mat_rhs(0,0)=1;
+	feat_mat_rhs(1,0)=1;
+	feat_mat_rhs(0,1)=-1;
+	feat_mat_rhs(1,1)=1;
+
+	CDenseFeatures<float32_t>* features_lhs=
+		new CDenseFeatures<float32_t>(feat_mat_lhs);
+	CDenseFeatures<float32_t>* features_rhs=
+		new CDenseFeatures<float32_t>(feat_mat_rhs);
+
+	CEuclideanDistance* euclidean=new CEuclideanDistance();
+	EXPECT_EQ(F_DREAL, euclidean->get_feature_type());
+	euclidean->init(features_lhs, features_rhs);
+	EXPECT_EQ(F_SHORTREAL, euclidean->get_feature_type());
+	euclidean->set_disable_sqrt(true);
+
+	for (index_t i=0; i<2; ++i)
+	{
+		features_lhs->set_accumulation_precision(i ? AP_NATIVE : AP_DOUBLE);
+		EXPECT_EQ(euclidean->distance(0,0), 2);
+		EXPECT_EQ(euclidean->distance(0,1), 2);
+		EXPECT_EQ(euclidean->distance(1,0), 5);
+		EXPECT_EQ(euclidean->distance(1,1), 5);
+	}
+
+	euclidean->set_disable_sqrt(false);
+	EXPECT_NEAR(euclidean->distance(1,0), CMath::sqrt(5.0), 1E-6);
+
+	SG_UNREF(euclidean);
+}
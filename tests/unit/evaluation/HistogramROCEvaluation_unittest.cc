@@ -0,0 +1,105 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/base/init.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/evaluation/ROCEvaluation.h>
+#include <shogun/evaluation/HistogramROCEvaluation.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(HistogramROCEvaluation,exact_for_binned_scores)
+{
+	index_t num_labels=1000;
+	CMath::init_random(17);
+	SGVector<float64_t> scores(num_labels);
+	SGVector<float64_t> labels(num_labels);
+	for (index_t i=0; i<num_labels; i++)
+	{
+		labels[i]=CMath::random(0, 1) ? 1 : -1;
+		/* scores are centers of bins of width 0.1 in [-1,1] */
+		int32_t bin=CMath::random(0, 18);
+		if (labels[i]>0)
+			bin++;
+		scores[i]=(bin+0.5)/10-1;
+	}
+
+	CBinaryLabels* gt=new CBinaryLabels(labels);
+	CBinaryLabels* predicted=new CBinaryLabels(scores);
+	SG_REF(gt);
+	SG_REF(predicted);
+
+	CROCEvaluation* roc=new CROCEvaluation();
+	CHistogramROCEvaluation* hist=new CHistogramROCEvaluation(20, -1, 1);
+	float64_t auc=roc->evaluate(predicted, gt);
+	EXPECT_NEAR(hist->evaluate(predicted, gt), auc, 1E-12);
+
+	/* same ROC graph, as examples in one bin have equal scores */
+	SGMatrix<float64_t> graph=roc->get_ROC();
+	SGMatrix<float64_t> hist_graph=hist->get_ROC();
+	ASSERT_EQ(graph.num_cols, hist_graph.num_cols);
+	for (index_t i=0; i<graph.num_rows*graph.num_cols; i++)
+		EXPECT_NEAR(graph.matrix[i], hist_graph.matrix[i], 1E-12);
+
+	SG_UNREF(hist);
+	SG_UNREF(roc);
+	SG_UNREF(predicted);
+	SG_UNREF(gt);
+}
+
+TEST(HistogramROCEvaluation,batches)
+{
+	index_t num_labels=1000;
+	index_t batch_size=100;
+	CMath::init_random(17);
+	SGVector<float64_t> scores(num_labels);
+	SGVector<float64_t> labels(num_labels);
+	for (index_t i=0; i<num_labels; i++)
+	{
+		labels[i]=CMath::random(0, 1) ? 1 : -1;
+		scores[i]=CMath::randn_double()+labels[i];
+	}
+
+	CBinaryLabels* gt=new CBinaryLabels(labels);
+	CBinaryLabels* predicted=new CBinaryLabels(scores);
+	SG_REF(gt);
+	SG_REF(predicted);
+
+	CROCEvaluation* roc=new CROCEvaluation();
+	float64_t auc=roc->evaluate(predicted, gt);
+
+	CHistogramROCEvaluation* hist=new CHistogramROCEvaluation(10000, -5, 5);
+	hist->set_auc_only(true);
+	for (index_t i=0; i<num_labels; i+=batch_size)
+	{
+		SGVector<float64_t> batch_scores(batch_size);
+		SGVector<float64_t> batch_labels(batch_size);
+		for (index_t j=0; j<batch_size; j++)
+		{
+			batch_scores[j]=scores[i+j];
+			batch_labels[j]=labels[i+j];
+		}
+
+		CBinaryLabels* batch_gt=new CBinaryLabels(batch_labels);
+		CBinaryLabels* batch_predicted=new CBinaryLabels(batch_scores);
+		hist->add_batch(batch_predicted, batch_gt);
+		SG_UNREF(batch_gt);
+		SG_UNREF(batch_predicted);
+	}
+
+	EXPECT_EQ(hist->get_num_positive()+hist->get_num_negative(), num_labels);
+	EXPECT_NEAR(hist->get_auROC(), auc, 1E-3);
+
+	SG_UNREF(hist);
+	SG_UNREF(roc);
+	SG_UNREF(predicted);
+	SG_UNREF(gt);
+}
@@ -0,0 +1,52 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/base/init.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/evaluation/PRCEvaluation.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(PRCEvaluation,auc_only)
+{
+	index_t num_labels=1000;
+	CMath::init_random(17);
+	SGVector<float64_t> scores(num_labels);
+	SGVector<float64_t> labels(num_labels);
+	for (index_t i=0; i<num_labels; i++)
+	{
+		labels[i]=CMath::random(0, 1) ? 1 : -1;
+		scores[i]=CMath::randn_double()+0.5*labels[i];
+	}
+
+	CBinaryLabels* gt=new CBinaryLabels(labels);
+	CBinaryLabels* predicted=new CBinaryLabels(scores);
+	SG_REF(gt);
+	SG_REF(predicted);
+
+	CPRCEvaluation* prc=new CPRCEvaluation();
+	float64_t auc=prc->evaluate(predicted, gt);
+	SGMatrix<float64_t> graph=prc->get_PRC();
+	EXPECT_NEAR(auc, CMath::area_under_curve(graph.matrix, graph.num_cols,
+			true), 1E-15);
+
+	/* thresholds are the scores in descending order */
+	SGVector<float64_t> thresholds=prc->get_thresholds();
+	for (index_t i=1; i<num_labels; i++)
+		EXPECT_GE(thresholds[i-1], thresholds[i]);
+
+	prc->set_auc_only(true);
+	EXPECT_EQ(prc->evaluate(predicted, gt), auc);
+
+	SG_UNREF(prc);
+	SG_UNREF(predicted);
+	SG_UNREF(gt);
+}
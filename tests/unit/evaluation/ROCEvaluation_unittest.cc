@@ -11,6 +11,7 @@
 #include <shogun/base/init.h>
 #include <shogun/labels/BinaryLabels.h>
 #include <shogun/evaluation/ROCEvaluation.h>
+#include <shogun/mathematics/Math.h>
 #include <gtest/gtest.h>
 
 using namespace shogun;
@@ -34,3 +35,54 @@ TEST(ROCEvaluation,one)
 	SG_UNREF(roc);
 	SG_UNREF(gt);
 }
+
+TEST(ROCEvaluation,auc_only)
+{
+	index_t num_labels=1000;
+	CMath::init_random(17);
+	SGVector<float64_t> scores(num_labels);
+	SGVector<float64_t> labels(num_labels);
+	for (index_t i=0; i<num_labels; i++)
+	{
+		labels[i]=CMath::random(0, 1) ? 1 : -1;
+		/* rounding produces ties, positives score higher on average */
+		scores[i]=CMath::round(10*(CMath::randn_double()+0.5*labels[i]))/10;
+	}
+
+	CBinaryLabels* gt=new CBinaryLabels(labels);
+	CBinaryLabels* predicted=new CBinaryLabels(scores);
+	SG_REF(gt);
+	SG_REF(predicted);
+
+	CROCEvaluation* roc=new CROCEvaluation();
+	float64_t auc=roc->evaluate(predicted, gt);
+	SGMatrix<float64_t> graph=roc->get_ROC();
+	EXPECT_NEAR(auc, CMath::area_under_curve(graph.matrix, graph.num_cols,
+			false), 1E-15);
+
+	/* probability that a positive scores higher than a negative */
+	float64_t pairs=0;
+	float64_t correct=0;
+	for (index_t i=0; i<num_labels; i++)
+	{
+		for (index_t j=0; j<num_labels; j++)
+		{
+			if (labels[i]>0 && labels[j]<0)
+			{
+				pairs++;
+				if (scores[i]>scores[j])
+					correct+=1;
+				else if (scores[i]==scores[j])
+					correct+=0.5;
+			}
+		}
+	}
+	EXPECT_NEAR(auc, correct/pairs, 1E-12);
+
+	roc->set_auc_only(true);
+	EXPECT_EQ(roc->evaluate(predicted, gt), auc);
+
+	SG_UNREF(roc);
+	SG_UNREF(predicted);
+	SG_UNREF(gt);
+}
@@ -9,6 +9,7 @@
 
 #include <shogun/base/init.h>
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/mathematics/Math.h>
 #include <gtest/gtest.h>
 
 using namespace shogun;
@@ -55,3 +56,145 @@ TEST(DenseFeaturesTest,create_merged_copy)
 	SG_UNREF(features_1);
 	SG_UNREF(features_2);
 }
+
+TEST(DenseFeaturesTest,materialize_subset)
+{
+	index_t dim=3;
+	index_t n=10;
+
+	SGMatrix<float64_t> data(dim,n);
+	for (index_t i=0; i<dim*n; ++i)
+		data.matrix[i]=i;
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data);
+	features->get_subset_stack()->set_materialize_subsets(true);
+
+	SGVector<index_t> subset_1(5);
+	for (index_t i=0; i<subset_1.vlen; ++i)
+		subset_1[i]=n-1-2*i;
+
+	SGVector<index_t> subset_2(2);
+	subset_2[0]=3;
+	subset_2[1]=1;
+
+	/* subsets are copied when added, before any access */
+	features->add_subset(subset_1);
+	EXPECT_TRUE(features->is_subset_materialized());
+	SGVector<float64_t> outer=features->get_feature_vector(1);
+	EXPECT_EQ(features->get_feature_vector(0).vector+dim, outer.vector);
+
+	features->add_subset(subset_2);
+	EXPECT_TRUE(features->is_subset_materialized());
+	for (index_t i=0; i<subset_2.vlen; ++i)
+	{
+		SGVector<float64_t> vec=features->get_feature_vector(i);
+		for (index_t j=0; j<dim; ++j)
+			EXPECT_EQ(vec[j], data(j,subset_1[subset_2[i]]));
+		features->free_feature_vector(vec, i);
+	}
+
+	SGVector<index_t> indices(3);
+	indices[0]=1;
+	indices[1]=0;
+	indices[2]=1;
+	SGMatrix<float64_t> gathered=features->gather_feature_vectors(indices);
+	for (index_t i=0; i<indices.vlen; ++i)
+	{
+		for (index_t j=0; j<dim; ++j)
+			EXPECT_EQ(gathered(j,i), data(j,subset_1[subset_2[indices[i]]]));
+	}
+
+	/* vectors set through the inner subset reach the outer copy */
+	SGVector<float64_t> ones(dim);
+	ones.set_const(1.0);
+	features->set_feature_vector(ones, 1);
+	for (index_t j=0; j<dim; ++j)
+		EXPECT_EQ(outer[j], 1.0);
+
+	/* the copy of the outer subset is kept, vectors obtained through it stay
+	 * valid */
+	features->remove_subset();
+	EXPECT_TRUE(features->is_subset_materialized());
+	EXPECT_EQ(outer.vector, features->get_feature_vector(1).vector);
+	for (index_t i=0; i<subset_1.vlen; ++i)
+		EXPECT_EQ(features->get_feature_vector(i)[0], data(0,subset_1[i]));
+
+	features->remove_subset();
+	EXPECT_FALSE(features->is_subset_materialized());
+
+	/* explicit materialization */
+	features->get_subset_stack()->set_materialize_subsets(false);
+	features->add_subset(subset_1);
+	EXPECT_FALSE(features->is_subset_materialized());
+	features->materialize_subset();
+	EXPECT_TRUE(features->is_subset_materialized());
+	SGMatrix<float64_t> submatrix=features->get_feature_matrix();
+	for (index_t i=0; i<subset_1.vlen; ++i)
+	{
+		for (index_t j=0; j<dim; ++j)
+			EXPECT_EQ(submatrix(j,i), data(j,subset_1[i]));
+	}
+
+	SG_UNREF(features);
+}
+
+TEST(DenseFeaturesTest,accumulation_precision)
+{
+	index_t dim=37;
+	index_t num_vectors=20;
+	SGMatrix<float32_t> data(dim, num_vectors);
+	SGVector<float64_t> w(dim);
+	for (index_t i=0; i<dim; ++i)
+	{
+		w[i]=CMath::randn_double();
+		for (index_t j=0; j<num_vectors; ++j)
+			data(i,j)=CMath::randn_double();
+	}
+
+	CDenseFeatures<float32_t>* features=new CDenseFeatures<float32_t>(data);
+	SG_REF(features);
+	EXPECT_EQ(features->get_accumulation_precision(), AP_NATIVE);
+
+	SGVector<float64_t> reference(num_vectors);
+	SGVector<float64_t> output(num_vectors);
+	SGVector<float64_t> output_single(num_vectors);
+	features->dense_dot_range(output.vector, 0, num_vectors, NULL, w.vector,
+			dim, 1.5);
+	features->set_accumulation_precision(AP_SINGLE);
+	features->dense_dot_range(output_single.vector, 0, num_vectors, NULL,
+			w.vector, dim, 1.5);
+
+	for (index_t j=0; j<num_vectors; ++j)
+	{
+		reference[j]=1.5;
+		for (index_t i=0; i<dim; ++i)
+			reference[j]+=(float64_t) data(i,j)*w[i];
+
+		EXPECT_NEAR(output[j], reference[j], 1E-12);
+		EXPECT_NEAR(output_single[j], reference[j], 1E-4);
+
+		float64_t dot=0;
+		for (index_t i=0; i<dim; ++i)
+			dot+=(float64_t) data(i,j)*data(i,0);
+
+		features->set_accumulation_precision(AP_DOUBLE);
+		EXPECT_NEAR(features->dot(j, features, 0), dot, 1E-12);
+		features->set_accumulation_precision(AP_NATIVE);
+		EXPECT_NEAR(features->dot(j, features, 0), dot, 1E-4);
+		EXPECT_EQ(features->dot(j, features, 0), SGVector<float32_t>::dot(
+				data.get_column_vector(j), data.get_column_vector(0), dim));
+	}
+
+	/* subsets are respected in the single precision path */
+	SGVector<index_t> subset(2);
+	subset[0]=5;
+	subset[1]=2;
+	features->add_subset(subset);
+	features->set_accumulation_precision(AP_SINGLE);
+	features->dense_dot_range(output_single.vector, 0, 2, NULL, w.vector,
+			dim, 1.5);
+	EXPECT_NEAR(output_single[0], reference[5], 1E-4);
+	EXPECT_NEAR(output_single[1], reference[2], 1E-4);
+
+	SG_UNREF(features);
+}
@@ -307,3 +307,77 @@ TEST(HashedDocDotFeaturesTest, quadratic_add_to_dense)
 	SG_UNREF(hddf);
 	SG_FREE(hashes);
 }
+
+TEST(HashedDocDotFeaturesTest, cached_hashed_documents)
+{
+	const char* docs[] = {"the quick brown fox", "jumps over the lazy dog",
+		"the dog sleeps", "a fox and a dog and a fox"};
+	int32_t num_docs = 4;
+	int32_t hash_bits = 6;
+	int32_t dimension = 64;
+
+	SGStringList<char> list(num_docs, 30);
+	for (index_t i=0; i<num_docs; i++)
+	{
+		list.strings[i] = SGString<char>(strlen(docs[i]));
+		memcpy(list.strings[i].string, docs[i], strlen(docs[i]));
+	}
+
+	CStringFeatures<char>* doc_collection = new CStringFeatures<char>(list, RAWBYTE);
+	CHashedDocDotFeatures* plain = new CHashedDocDotFeatures(hash_bits, doc_collection,
+			NULL, true, 2, 1);
+	CHashedDocDotFeatures* cached = new CHashedDocDotFeatures(hash_bits, doc_collection,
+			NULL, true, 2, 1);
+	SG_REF(plain);
+	SG_REF(cached);
+
+	EXPECT_FALSE(cached->get_cache_hashed_documents());
+	cached->set_cache_hashed_documents(true);
+	EXPECT_TRUE(cached->get_cache_hashed_documents());
+
+	SGVector<float64_t> w(dimension);
+	for (index_t i=0; i<dimension; i++)
+		w[i] = CMath::sin((float64_t) i);
+
+	SGVector<float64_t> sum_plain(dimension);
+	SGVector<float64_t> sum_cached(dimension);
+	sum_plain.zero();
+	sum_cached.zero();
+
+	for (index_t i=0; i<num_docs; i++)
+	{
+		EXPECT_NEAR(plain->dense_dot(i, w.vector, w.vlen),
+				cached->dense_dot(i, w.vector, w.vlen), 1E-12);
+
+		for (index_t j=0; j<num_docs; j++)
+			EXPECT_NEAR(plain->dot(i, plain, j), cached->dot(i, cached, j), 1E-12);
+
+		plain->add_to_dense_vec(0.5, i, sum_plain.vector, sum_plain.vlen);
+		cached->add_to_dense_vec(0.5, i, sum_cached.vector, sum_cached.vlen);
+	}
+
+	for (index_t i=0; i<dimension; i++)
+		EXPECT_NEAR(sum_plain[i], sum_cached[i], 1E-12);
+
+	cached->set_doc_collection(doc_collection);
+	EXPECT_TRUE(cached->get_cache_hashed_documents());
+
+	CHashedDocDotFeatures* late = new CHashedDocDotFeatures(hash_bits, NULL,
+			NULL, true, 2, 1);
+	SG_REF(late);
+	late->set_cache_hashed_documents(true);
+	EXPECT_TRUE(late->get_cache_hashed_documents());
+	late->set_doc_collection(doc_collection);
+	EXPECT_TRUE(late->get_cache_hashed_documents());
+
+	for (index_t i=0; i<num_docs; i++)
+	{
+		EXPECT_NEAR(plain->dense_dot(i, w.vector, w.vlen),
+				late->dense_dot(i, w.vector, w.vlen), 1E-12);
+		EXPECT_NEAR(plain->dot(i, plain, 0), late->dot(i, cached, 0), 1E-12);
+	}
+
+	SG_UNREF(plain);
+	SG_UNREF(cached);
+	SG_UNREF(late);
+}
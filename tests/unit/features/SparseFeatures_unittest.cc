@@ -392,3 +392,49 @@ TEST(SparseFeaturesTest,subset_get_full_feature_vector_smaller)
 
 	SG_UNREF(features);
 }
+
+TEST(SparseFeaturesTest,materialize_subset)
+{
+	SGMatrix<int32_t> data(3, 6);
+	data.zero();
+	for (index_t i=0; i<data.num_cols; ++i)
+	{
+		data(i%3, i)=i+1;
+		data((i+1)%3, i)=-i;
+	}
+
+	CSparseFeatures<int32_t>* features=new CSparseFeatures<int32_t>(data);
+	features->get_subset_stack()->set_materialize_subsets(true);
+
+	SGVector<index_t> subset_idx(3);
+	subset_idx[0]=5;
+	subset_idx[1]=2;
+	subset_idx[2]=4;
+	features->add_subset(subset_idx);
+	EXPECT_TRUE(features->is_subset_materialized());
+
+	for (index_t i=0; i<subset_idx.vlen; ++i)
+	{
+		SGVector<int32_t> vec=features->get_full_feature_vector(i);
+		for (index_t j=0; j<data.num_rows; ++j)
+			EXPECT_EQ(vec[j], data(j,subset_idx[i]));
+	}
+
+	/* entries of consecutive vectors are stored contiguously */
+	SGSparseVector<int32_t> first=features->get_sparse_feature_vector(0);
+	SGSparseVector<int32_t> second=features->get_sparse_feature_vector(1);
+	EXPECT_EQ(first.features+first.num_feat_entries, second.features);
+
+	/* the outer copy survives an inner subset */
+	SGVector<index_t> inner_idx(1);
+	inner_idx[0]=1;
+	features->add_subset(inner_idx);
+	EXPECT_EQ(-2, features->get_full_feature_vector(0)[0]);
+	features->remove_subset();
+	EXPECT_EQ(second.features, features->get_sparse_feature_vector(1).features);
+
+	features->remove_subset();
+	EXPECT_FALSE(features->is_subset_materialized());
+
+	SG_UNREF(features);
+}
@@ -108,3 +108,54 @@ TEST(StringFeaturesTest,copy_subset)
 	SG_UNREF(f);
 	SG_UNREF(subset_copy);
 }
+
+TEST(StringFeaturesTest,obtain_from_char_kmers)
+{
+	const char* seqs[]={"ACGTTGCAAGCT", "GGA", "TTTACGACGTAGCATGCA"};
+	SGStringList<char> list(3, 18);
+	for (index_t i=0; i<3; i++)
+	{
+		list.strings[i]=SGString<char>(strlen(seqs[i]));
+		memcpy(list.strings[i].string, seqs[i], strlen(seqs[i]));
+	}
+
+	CStringFeatures<char>* dna=new CStringFeatures<char>(list, DNA);
+	SG_REF(dna);
+	CAlphabet* alpha=dna->get_alphabet();
+
+	int32_t order=4;
+	int32_t start=order-1;
+	for (int32_t rev=0; rev<2; rev++)
+	{
+		CStringFeatures<uint16_t>* kmers=new CStringFeatures<uint16_t>(DNA);
+		kmers->obtain_from_char(dna, start, order, 0, rev==1);
+
+		for (index_t i=0; i<3; i++)
+		{
+			SGVector<uint16_t> vec=kmers->get_feature_vector(i);
+			int32_t len=strlen(seqs[i]);
+			EXPECT_EQ(vec.vlen, CMath::max(len-start, 0));
+
+			/* reference: explicit encoding of the order symbols ending at
+			 * each position */
+			for (index_t k=0; k<vec.vlen; k++)
+			{
+				uint16_t expected=0;
+				for (index_t j=k+start-order+1; j<=k+start; j++)
+				{
+					uint16_t sym=alpha->remap_to_bin(seqs[i][j]);
+					if (rev)
+						expected|=sym << (2*(j-(k+start)+order-1));
+					else
+						expected|=sym << (2*((k+start)-j));
+				}
+				EXPECT_EQ(vec[k], expected);
+			}
+			kmers->free_feature_vector(vec, i);
+		}
+		SG_UNREF(kmers);
+	}
+
+	SG_UNREF(alpha);
+	SG_UNREF(dna);
+}
@@ -0,0 +1,149 @@
+#include <shogun/io/ChunkedTextParser.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/SGSparseMatrix.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+static SGVector<char> to_text(const std::string& str)
+{
+	SGVector<char> text(str.size());
+	memcpy(text.vector, str.c_str(), str.size());
+	return text;
+}
+
+TEST(ChunkedTextParser, parse_real)
+{
+	const char* numbers[]={"0", "-0.5", "1e3", "3.14159", "1.7976931348623157e308",
+		"2.2250738585072014e-308", "0.1", "123456789012345678901234567890",
+		"-4.9e-324", "1E+22", "0.000001234", "9007199254740993", "inf"};
+
+	for (int32_t i=0; i<13; i++)
+	{
+		const char* p=numbers[i];
+		const char* end=p+strlen(p);
+		float64_t value=CChunkedTextParser::parse_real(p, end);
+		EXPECT_EQ(value, strtod(numbers[i], NULL));
+		EXPECT_EQ(p, end);
+	}
+
+	CMath::init_random(7);
+	char buf[64];
+	for (int32_t i=0; i<1000; i++)
+	{
+		float64_t x=CMath::random(-1000.0, 1000.0);
+		snprintf(buf, sizeof(buf), "%.*g", CMath::random(1, 17), x);
+		const char* p=buf;
+		EXPECT_EQ(CChunkedTextParser::parse_real(p, buf+strlen(buf)),
+				strtod(buf, NULL));
+	}
+
+	const char* p="-42 7";
+	EXPECT_EQ(CChunkedTextParser::parse_int(p, p+5), -42);
+	EXPECT_EQ(*p, ' ');
+}
+
+TEST(ChunkedTextParser, parse_dense)
+{
+	int32_t num_lines=20000;
+	int32_t num_tokens=3;
+
+	std::string str="skipped header\n";
+	char buf[128];
+	for (int32_t i=0; i<num_lines; i++)
+	{
+		snprintf(buf, sizeof(buf), "%d, %.3f,%d\r\n\n", i, i*0.5, -i);
+		str+=buf;
+	}
+
+	CChunkedTextParser* parser=new CChunkedTextParser();
+	SG_REF(parser);
+	parser->set_text(to_text(str));
+	parser->skip_lines(1);
+
+	float64_t* matrix=NULL;
+	int32_t lines=0;
+	int32_t tokens=0;
+	EXPECT_EQ(parser->parse_dense(matrix, tokens, lines, ',', false), 0);
+	EXPECT_EQ(lines, num_lines);
+	EXPECT_EQ(tokens, num_tokens);
+	for (int32_t i=0; i<num_lines; i++)
+	{
+		EXPECT_EQ(matrix[i*num_tokens], i);
+		EXPECT_EQ(matrix[i*num_tokens+1], i*0.5);
+		EXPECT_EQ(matrix[i*num_tokens+2], -i);
+	}
+	SG_FREE(matrix);
+
+	int32_t* transposed=NULL;
+	EXPECT_EQ(parser->parse_dense(transposed, tokens, lines, ',', true), 0);
+	for (int32_t i=0; i<num_lines; i++)
+	{
+		EXPECT_EQ(transposed[i], i);
+		EXPECT_EQ(transposed[i+2*num_lines], -i);
+	}
+	SG_FREE(transposed);
+	SG_UNREF(parser);
+}
+
+TEST(ChunkedTextParser, parse_dense_bad_line)
+{
+	CChunkedTextParser* parser=new CChunkedTextParser();
+	SG_REF(parser);
+	parser->set_text(to_text("1,2,3\n4,5,6\n\n7,8\n9,10,11,12\n"));
+
+	float64_t* matrix=NULL;
+	int32_t lines=0;
+	int32_t tokens=0;
+	EXPECT_EQ(parser->parse_dense(matrix, tokens, lines), 3);
+	EXPECT_EQ(tokens, 3);
+	EXPECT_TRUE(matrix==NULL);
+	SG_UNREF(parser);
+}
+
+TEST(ChunkedTextParser, parse_sparse)
+{
+	int32_t num_vec=10000;
+	std::string str;
+	char buf[128];
+	for (int32_t i=0; i<num_vec; i++)
+	{
+		snprintf(buf, sizeof(buf), "%d 1:%d %d:0.25 %d:%d\n", i%2 ? 1 : -1,
+				i, i%5+2, i%7+10, i%3);
+		str+=buf;
+	}
+
+	CChunkedTextParser* parser=new CChunkedTextParser();
+	SG_REF(parser);
+	parser->set_text(to_text(str));
+
+	SGSparseVector<float64_t>* matrix=NULL;
+	float64_t* labels=NULL;
+	int32_t num_feat=0;
+	int32_t vecs=0;
+	parser->parse_sparse(matrix, num_feat, vecs, labels, true, ':');
+	SGSparseMatrix<float64_t> sparse(matrix, num_feat, vecs);
+	SGVector<float64_t> label_vector(labels, vecs);
+	EXPECT_EQ(vecs, num_vec);
+	EXPECT_EQ(num_feat, 16);
+	for (int32_t i=0; i<num_vec; i++)
+	{
+		EXPECT_EQ(labels[i], i%2 ? 1 : -1);
+		ASSERT_EQ(matrix[i].num_feat_entries, 3);
+		EXPECT_EQ(matrix[i].features[0].feat_index, 0);
+		EXPECT_EQ(matrix[i].features[0].entry, i);
+		EXPECT_EQ(matrix[i].features[1].feat_index, i%5+1);
+		EXPECT_EQ(matrix[i].features[1].entry, 0.25);
+		EXPECT_EQ(matrix[i].features[2].feat_index, i%7+9);
+		EXPECT_EQ(matrix[i].features[2].entry, i%3);
+	}
+
+	SG_UNREF(parser);
+}
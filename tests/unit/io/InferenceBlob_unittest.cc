@@ -0,0 +1,276 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/base/init.h>
+#include <shogun/io/InferenceBlob.h>
+#include <shogun/classifier/svm/LibSVM.h>
+#include <shogun/classifier/svm/LibLinear.h>
+#include <shogun/multiclass/MulticlassLibSVM.h>
+#include <shogun/multiclass/MulticlassLibLinear.h>
+#include <shogun/multiclass/MulticlassOneVsOneStrategy.h>
+#include <shogun/machine/LinearMulticlassMachine.h>
+#include <shogun/features/DataGenerator.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/PolyKernel.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <unistd.h>
+
+using namespace shogun;
+
+#define BLOB_FILE "InferenceBlobTest.blob"
+
+static CBinaryLabels* binary_labels(int32_t num_vectors)
+{
+	SGVector<float64_t> lab(num_vectors);
+	for (index_t i=0; i<num_vectors; i++)
+		lab[i]=(i<num_vectors/2) ? 1.0 : -1.0;
+
+	return new CBinaryLabels(lab);
+}
+
+static CMulticlassLabels* multiclass_labels(int32_t num_vectors,
+		int32_t num_classes)
+{
+	SGVector<float64_t> lab(num_vectors);
+	for (index_t i=0; i<num_vectors; i++)
+		lab[i]=i/(num_vectors/num_classes);
+
+	return new CMulticlassLabels(lab);
+}
+
+TEST(InferenceBlob,kernel_machine)
+{
+	CMath::init_random(23);
+	SGMatrix<float64_t> train=CDataGenerator::generate_gaussians(100, 2, 3);
+	SGMatrix<float64_t> test=CDataGenerator::generate_gaussians(150, 2, 3);
+	CDenseFeatures<float64_t>* train_feats=new CDenseFeatures<float64_t>(train);
+	CDenseFeatures<float64_t>* test_feats=new CDenseFeatures<float64_t>(test);
+	SG_REF(train_feats);
+	SG_REF(test_feats);
+
+	CKernel* kernels[]={new CGaussianKernel(train_feats, train_feats, 2.0, 10),
+		new CPolyKernel(train_feats, train_feats, 3, true, 10)};
+
+	for (index_t k=0; k<2; k++)
+	{
+		CLibSVM* svm=new CLibSVM(1.0, kernels[k], binary_labels(train.num_cols));
+		SG_REF(svm);
+		svm->train();
+		InferenceBlob::export_machine(svm, BLOB_FILE);
+
+		CBinaryLabels* pred=svm->apply_binary(test_feats);
+		SGVector<float64_t> outputs=pred->get_values();
+
+		InferenceBlob blob(BLOB_FILE);
+		EXPECT_EQ(IB_BINARY, blob.get_strategy());
+		EXPECT_EQ(3, blob.get_dim());
+		EXPECT_EQ(1, blob.get_num_machines());
+
+		SGVector<float64_t> blob_outputs=blob.apply(test);
+		ASSERT_EQ(outputs.vlen, blob_outputs.vlen);
+		for (index_t i=0; i<outputs.vlen; i++)
+			EXPECT_NEAR(outputs[i], blob_outputs[i], 1e-10);
+
+		SG_UNREF(pred);
+		SG_UNREF(svm);
+	}
+
+	unlink(BLOB_FILE);
+	SG_UNREF(test_feats);
+	SG_UNREF(train_feats);
+}
+
+TEST(InferenceBlob,linear_machine)
+{
+	CMath::init_random(29);
+	SGMatrix<float64_t> train=CDataGenerator::generate_gaussians(100, 2, 4);
+	SGMatrix<float64_t> test=CDataGenerator::generate_gaussians(50, 2, 4);
+	CDenseFeatures<float64_t>* test_feats=new CDenseFeatures<float64_t>(test);
+	SG_REF(test_feats);
+
+	CLibLinear* svm=new CLibLinear(1.0, new CDenseFeatures<float64_t>(train),
+			binary_labels(train.num_cols));
+	SG_REF(svm);
+	svm->train();
+	InferenceBlob::export_machine(svm, BLOB_FILE);
+
+	CBinaryLabels* pred=svm->apply_binary(test_feats);
+	SGVector<float64_t> outputs=pred->get_values();
+
+	InferenceBlob blob(BLOB_FILE);
+	SGVector<float64_t> blob_outputs=blob.apply(test);
+	for (index_t i=0; i<outputs.vlen; i++)
+		EXPECT_NEAR(outputs[i], blob_outputs[i], 1e-10);
+
+	unlink(BLOB_FILE);
+	SG_UNREF(pred);
+	SG_UNREF(svm);
+	SG_UNREF(test_feats);
+}
+
+TEST(InferenceBlob,multiclass_machines)
+{
+	index_t num_classes=4;
+	CMath::init_random(31);
+	SGMatrix<float64_t> train=CDataGenerator::generate_gaussians(50, num_classes, 2);
+	SGMatrix<float64_t> test=CDataGenerator::generate_gaussians(50, num_classes, 2);
+	CDenseFeatures<float64_t>* train_feats=new CDenseFeatures<float64_t>(train);
+	CDenseFeatures<float64_t>* test_feats=new CDenseFeatures<float64_t>(test);
+	SG_REF(train_feats);
+	SG_REF(test_feats);
+
+	/* one vs one with a shared kernel and one vs rest linear machines */
+	CMulticlassMachine* machines[]={new CMulticlassLibSVM(1.0,
+			new CGaussianKernel(train_feats, train_feats, 1.0, 10),
+			multiclass_labels(train.num_cols, num_classes)),
+		new CMulticlassLibLinear(1.0, train_feats,
+			multiclass_labels(train.num_cols, num_classes))};
+	EInferenceBlobStrategy strategies[]={IB_ONE_VS_ONE, IB_ONE_VS_REST};
+
+	for (index_t m=0; m<2; m++)
+	{
+		SG_REF(machines[m]);
+		machines[m]->train();
+		InferenceBlob::export_machine(machines[m], BLOB_FILE);
+
+		CMulticlassLabels* pred=machines[m]->apply_multiclass(test_feats);
+
+		InferenceBlob blob(BLOB_FILE);
+		EXPECT_EQ(strategies[m], blob.get_strategy());
+		EXPECT_EQ(num_classes, blob.get_num_classes());
+
+		SGVector<float64_t> labels=blob.apply(test);
+		for (index_t i=0; i<labels.vlen; i++)
+			EXPECT_EQ(pred->get_label(i), labels[i]);
+
+		SG_UNREF(pred);
+		SG_UNREF(machines[m]);
+	}
+
+	unlink(BLOB_FILE);
+	SG_UNREF(test_feats);
+	SG_UNREF(train_feats);
+}
+
+TEST(InferenceBlob,one_vs_one_tie)
+{
+	index_t num_classes=4;
+	CMath::init_random(41);
+	SGMatrix<float64_t> train=CDataGenerator::generate_gaussians(20, num_classes, 2);
+	CDenseFeatures<float64_t>* train_feats=new CDenseFeatures<float64_t>(train);
+	CLinearMulticlassMachine* machine=new CLinearMulticlassMachine(
+			new CMulticlassOneVsOneStrategy(), train_feats,
+			new CLibLinear(L2R_L2LOSS_SVC),
+			multiclass_labels(train.num_cols, num_classes));
+	SG_REF(machine);
+	machine->train();
+
+	/* outputs of the machines (0,1), (0,2), (0,3), (1,2), (1,3), (2,3) for
+	 * the vector (1,0). Classes 0, 1 and 2 get two votes each. The summed
+	 * decision values 1.3 and 2.0 of classes 0 and 1 are both 1 as integers,
+	 * so class 0 wins the tie */
+	float64_t outputs[]={1.2, -0.5, 0.1, 1.9, 0.1, 0.1};
+	ASSERT_EQ(6, machine->get_num_machines());
+	for (index_t i=0; i<6; i++)
+	{
+		CLinearMachine* sub=(CLinearMachine*) machine->get_machine(i);
+		SGVector<float64_t> w(2);
+		w[0]=outputs[i];
+		w[1]=0;
+		sub->set_w(w);
+		sub->set_bias(0);
+		SG_UNREF(sub);
+	}
+
+	SGMatrix<float64_t> test(2, 1);
+	test(0,0)=1;
+	test(1,0)=0;
+	CMulticlassLabels* pred=machine->apply_multiclass(
+			new CDenseFeatures<float64_t>(test));
+	EXPECT_EQ(0, pred->get_label(0));
+
+	InferenceBlob::export_machine(machine, BLOB_FILE);
+	InferenceBlob blob(BLOB_FILE);
+	SGVector<float64_t> labels=blob.apply(test);
+	EXPECT_EQ(pred->get_label(0), labels[0]);
+
+	SG_UNREF(pred);
+	SG_UNREF(machine);
+	unlink(BLOB_FILE);
+}
+
+TEST(InferenceBlob,invalid_blob)
+{
+	CMath::init_random(37);
+	SGMatrix<float64_t> train=CDataGenerator::generate_gaussians(20, 2, 2);
+	CLibLinear* svm=new CLibLinear(1.0, new CDenseFeatures<float64_t>(train),
+			binary_labels(train.num_cols));
+	SG_REF(svm);
+	svm->train();
+	InferenceBlob::export_machine(svm, BLOB_FILE);
+	SG_UNREF(svm);
+
+	/* a truncated blob is refused */
+	FILE* f=fopen(BLOB_FILE, "r+b");
+	fseek(f, 0, SEEK_END);
+	ASSERT_EQ(0, ftruncate(fileno(f), ftell(f)-8));
+	fclose(f);
+
+	InferenceBlob blob;
+	bool refused=false;
+	try
+	{
+		blob.load(BLOB_FILE);
+	}
+	catch (ShogunException& e)
+	{
+		refused=true;
+	}
+	EXPECT_TRUE(refused);
+	EXPECT_FALSE(blob.is_loaded());
+
+	unlink(BLOB_FILE);
+}
+
+TEST(InferenceBlob,unsupported_machine)
+{
+	CMath::init_random(41);
+	SGMatrix<float64_t> train=CDataGenerator::generate_gaussians(20, 2, 2);
+	CDenseFeatures<float64_t>* train_feats=new CDenseFeatures<float64_t>(train);
+	CGaussianKernel* kernel=new CGaussianKernel(train_feats, train_feats, 2.0, 10);
+	SG_REF(kernel);
+	kernel->set_compact_enabled(true);
+	CLibSVM* svm=new CLibSVM(1.0, kernel, binary_labels(train.num_cols));
+	SG_REF(svm);
+	svm->train();
+
+	/* the kernel is released again when the machine cannot be exported */
+	int32_t kernel_refs=kernel->ref_count();
+	bool refused=false;
+	try
+	{
+		InferenceBlob::export_machine(svm, BLOB_FILE);
+	}
+	catch (ShogunException& e)
+	{
+		refused=true;
+	}
+	EXPECT_TRUE(refused);
+	EXPECT_EQ(kernel_refs, kernel->ref_count());
+
+	SG_UNREF(svm);
+	SG_UNREF(kernel);
+	unlink(BLOB_FILE);
+}
@@ -13,6 +13,7 @@
 #include <shogun/io/SerializableJsonFile.h>
 #include <shogun/io/SerializableXmlFile.h>
 #include <shogun/io/SerializableHdf5File.h>
+#include <shogun/io/SerializableBinaryFile.h>
 #include <gtest/gtest.h>
 
 using namespace shogun;
@@ -1739,3 +1740,146 @@ TEST(Serialization, Hdf5_matrix_equal_FLOAT64)
 }
 
 #endif // HAVE_HDF5
+
+TEST(Serialization, Binary_scalar_equal_FLOAT64)
+{
+	float64_t a=1.14263158;
+	float64_t b=2.0;
+
+	TSGDataType type(CT_SCALAR, ST_NONE, PT_FLOAT64);
+	TParameter* param1=new TParameter(&type, &a, "param", "");
+	TParameter* param2=new TParameter(&type, &b, "param", "");
+
+	const char* filename="float64_param.bin";
+	// save parameter to a binary file
+	CSerializableBinaryFile *file=new CSerializableBinaryFile(filename, 'w');
+	param1->save(file);
+	file->close();
+	SG_UNREF(file);
+
+	// load parameter from a binary file
+	file=new CSerializableBinaryFile(filename, 'r');
+	param2->load(file);
+	file->close();
+	SG_UNREF(file);
+
+	// check for equality
+	float64_t accuracy=0.0;
+	EXPECT_TRUE(param1->equals(param2, accuracy));
+
+	delete param1;
+	delete param2;
+}
+
+TEST(Serialization, Binary_matrix_equal_FLOAT64)
+{
+	SGMatrix<float64_t> a(2, 2);
+	SGMatrix<float64_t> b(2, 2);
+
+	a.set_const(1.14263158);
+	b.zero();
+
+	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_FLOAT64, &a.num_rows, &a.num_cols);
+	TParameter* param1=new TParameter(&type, &a.matrix, "param", "");
+	TParameter* param2=new TParameter(&type, &b.matrix, "param", "");
+
+	const char* filename="float64_sgmat_param.bin";
+	// save parameter to a binary file
+	CSerializableBinaryFile *file=new CSerializableBinaryFile(filename, 'w');
+	param1->save(file);
+	file->close();
+	SG_UNREF(file);
+
+	// load parameter from a binary file
+	file=new CSerializableBinaryFile(filename, 'r');
+	param2->load(file);
+	file->close();
+	SG_UNREF(file);
+
+	// check for equality
+	float64_t accuracy=0.0;
+	EXPECT_TRUE(param1->equals(param2, accuracy));
+
+	delete param1;
+	delete param2;
+}
+
+TEST(Serialization, Binary_sparse_equal_FLOAT64)
+{
+	SGSparseVector<float64_t> a(3);
+	SGSparseVector<float64_t> b;
+
+	for (index_t i=0; i<a.num_feat_entries; i++)
+	{
+		a.features[i].feat_index=2*i+1;
+		a.features[i].entry=i*1.14263158;
+	}
+
+	TSGDataType type(CT_SCALAR, ST_SPARSE, PT_FLOAT64);
+	TParameter* param1=new TParameter(&type, &a, "param", "");
+	TParameter* param2=new TParameter(&type, &b, "param", "");
+
+	const char* filename="float64_sparse_param.bin";
+	// save parameter to a binary file
+	CSerializableBinaryFile *file=new CSerializableBinaryFile(filename, 'w');
+	param1->save(file);
+	file->close();
+	SG_UNREF(file);
+
+	// load parameter from a binary file
+	file=new CSerializableBinaryFile(filename, 'r');
+	param2->load(file);
+	file->close();
+	SG_UNREF(file);
+
+	// check for equality
+	ASSERT_EQ(a.num_feat_entries, b.num_feat_entries);
+	for (index_t i=0; i<a.num_feat_entries; i++)
+	{
+		EXPECT_EQ(a.features[i].feat_index, b.features[i].feat_index);
+		EXPECT_EQ(a.features[i].entry, b.features[i].entry);
+	}
+
+	delete param1;
+	delete param2;
+}
+
+#ifdef USE_GZIP
+TEST(Serialization, Binary_compressed_matrix_equal_FLOAT64)
+{
+	SGMatrix<float64_t> a(100, 100);
+	SGMatrix<float64_t> b(1, 1);
+
+	for (index_t i=0; i<a.num_rows*a.num_cols; i++)
+		a.matrix[i]=i%7;
+	b.zero();
+
+	TSGDataType type(CT_SGMATRIX, ST_NONE, PT_FLOAT64, &a.num_rows, &a.num_cols);
+	TParameter* param1=new TParameter(&type, &a.matrix, "param", "");
+
+	const char* filename="float64_sgmat_param_gzip.bin";
+	// save parameter to a compressed binary file
+	CSerializableBinaryFile *file=new CSerializableBinaryFile(filename, 'w', GZIP);
+	param1->save(file);
+	file->close();
+	SG_UNREF(file);
+
+	SGMatrix<float64_t> copy=a.clone();
+	TSGDataType type2(CT_SGMATRIX, ST_NONE, PT_FLOAT64, &b.num_rows, &b.num_cols);
+	TParameter* param2=new TParameter(&type2, &b.matrix, "param", "");
+
+	// load parameter from the binary file, the reader detects compression
+	file=new CSerializableBinaryFile(filename, 'r');
+	EXPECT_TRUE(param2->load(file));
+	file->close();
+	SG_UNREF(file);
+
+	ASSERT_EQ(copy.num_rows, b.num_rows);
+	ASSERT_EQ(copy.num_cols, b.num_cols);
+	for (index_t i=0; i<copy.num_rows*copy.num_cols; i++)
+		EXPECT_EQ(copy.matrix[i], b.matrix[i]);
+
+	delete param1;
+	delete param2;
+}
+#endif // USE_GZIP
@@ -1,5 +1,6 @@
 #include <shogun/kernel/CombinedKernel.h>
 #include <shogun/kernel/GaussianKernel.h>
+#include <shogun/features/DenseFeatures.h>
 #include <shogun/io/SerializableAsciiFile.h>
 #include <gtest/gtest.h>
 
@@ -217,3 +218,54 @@ TEST(CombinedKernelTest,combination)
 	SG_UNREF(combined_list);
 	SG_UNREF(kernel_list);
 }
+
+TEST(CombinedKernelTest,subkernel_cache)
+{
+	index_t num_vectors=7;
+	SGMatrix<float64_t> data(2, num_vectors);
+	for (index_t i=0; i<data.num_rows*data.num_cols; ++i)
+		data.matrix[i]=CMath::sin(i);
+
+	CDenseFeatures<float64_t>* feats=new CDenseFeatures<float64_t>(data);
+	SG_REF(feats);
+
+	CCombinedKernel* combined=new CCombinedKernel();
+	combined->append_kernel(new CGaussianKernel(10, 0.5));
+	combined->append_kernel(new CGaussianKernel(10, 2));
+	combined->append_kernel(new CGaussianKernel(10, 8));
+	combined->init(feats, feats);
+
+	SGVector<float64_t> weights(3);
+	weights[0]=0.2;
+	weights[1]=0.3;
+	weights[2]=0.5;
+	combined->set_subkernel_weights(weights);
+	SGMatrix<float64_t> uncached=combined->get_kernel_matrix();
+
+	combined->set_subkernel_cache_enabled(true);
+	EXPECT_TRUE(combined->has_subkernel_cache());
+	SGMatrix<float64_t> cached=combined->get_kernel_matrix();
+
+	for (index_t i=0; i<num_vectors*num_vectors; ++i)
+		EXPECT_NEAR(uncached.matrix[i], cached.matrix[i], 1E-6);
+
+	/* changing weights must not invalidate the cache */
+	weights[0]=1.0;
+	weights[1]=0.0;
+	weights[2]=0.0;
+	combined->set_subkernel_weights(weights);
+	EXPECT_TRUE(combined->has_subkernel_cache());
+
+	CKernel* first=combined->get_kernel(0);
+	SGMatrix<float64_t> first_matrix=first->get_kernel_matrix();
+	cached=combined->get_kernel_matrix();
+	for (index_t i=0; i<num_vectors*num_vectors; ++i)
+		EXPECT_NEAR(first_matrix.matrix[i], cached.matrix[i], 1E-6);
+
+	combined->remove_lhs_and_rhs();
+	EXPECT_FALSE(combined->has_subkernel_cache());
+
+	SG_UNREF(first);
+	SG_UNREF(combined);
+	SG_UNREF(feats);
+}
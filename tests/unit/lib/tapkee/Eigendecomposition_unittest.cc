@@ -0,0 +1,116 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/lib/config.h>
+
+#ifdef HAVE_EIGEN3
+#include <shogun/lib/tapkee/tapkee.hpp>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace tapkee;
+using namespace tapkee::tapkee_internal;
+
+/* eigenvectors are determined up to the sign */
+static void check_same_result(const EigendecompositionResult& expected,
+		const EigendecompositionResult& result, IndexType target_dimension)
+{
+	ASSERT_EQ(expected.first.rows(), result.first.rows());
+	ASSERT_EQ(target_dimension, result.first.cols());
+	for (IndexType i=0; i<target_dimension; i++)
+	{
+		EXPECT_NEAR(expected.second(i), result.second(i), 1e-8);
+		EXPECT_NEAR(1.0, std::abs(expected.first.col(i).normalized().dot(
+				result.first.col(i).normalized())), 1e-6);
+	}
+}
+
+/* symmetric positive definite banded matrix with distinct eigenvalues */
+static SparseWeightMatrix banded_matrix(IndexType N)
+{
+	std::vector<Eigen::Triplet<ScalarType> > entries;
+	for (IndexType i=0; i<N; i++)
+	{
+		entries.push_back(Eigen::Triplet<ScalarType>(i,i,2.0+0.01*i));
+		if (i+1<N)
+		{
+			entries.push_back(Eigen::Triplet<ScalarType>(i,i+1,-1.0));
+			entries.push_back(Eigen::Triplet<ScalarType>(i+1,i,-1.0));
+		}
+	}
+	SparseWeightMatrix matrix(N,N);
+	matrix.setFromTriplets(entries.begin(),entries.end());
+	return matrix;
+}
+
+TEST(Eigendecomposition,lanczos_largest)
+{
+	IndexType N=60;
+	IndexType target_dimension=3;
+	DenseMatrix random=DenseMatrix::Random(N,N);
+	DenseMatrix matrix=random.transpose()*random;
+
+	EigendecompositionResult expected=eigendecomposition<DenseMatrix,DenseMatrixOperation>(
+			Dense,matrix,target_dimension,0);
+	EigendecompositionResult result=eigendecomposition<DenseMatrix,DenseMatrixOperation>(
+			Lanczos,matrix,target_dimension,0);
+
+	check_same_result(expected,result,target_dimension);
+}
+
+TEST(Eigendecomposition,lanczos_smallest)
+{
+	IndexType N=80;
+	IndexType target_dimension=2;
+	SparseWeightMatrix matrix=banded_matrix(N);
+
+	/* the smallest eigenvalues are found by solves with the matrix */
+	EigendecompositionResult expected=eigendecomposition<SparseWeightMatrix,SparseInverseMatrixOperation>(
+			Dense,matrix,target_dimension,1);
+	EigendecompositionResult result=eigendecomposition<SparseWeightMatrix,SparseInverseMatrixOperation>(
+			Lanczos,matrix,target_dimension,1);
+
+	check_same_result(expected,result,target_dimension);
+}
+
+TEST(Eigendecomposition,lanczos_generalized_diagonal)
+{
+	IndexType N=50;
+	IndexType target_dimension=2;
+	SparseWeightMatrix lhs=banded_matrix(N);
+	DenseDiagonalMatrix rhs(N);
+	for (IndexType i=0; i<N; i++)
+		rhs.diagonal()(i)=1.0+0.5*(i%3);
+
+	EigendecompositionResult expected=generalized_eigendecomposition<SparseWeightMatrix,
+		DenseDiagonalMatrix,SparseInverseMatrixOperation>(Dense,lhs,rhs,target_dimension,0);
+	EigendecompositionResult result=generalized_eigendecomposition<SparseWeightMatrix,
+		DenseDiagonalMatrix,SparseInverseMatrixOperation>(Lanczos,lhs,rhs,target_dimension,0);
+
+	check_same_result(expected,result,target_dimension);
+}
+
+TEST(Eigendecomposition,lanczos_generalized_dense)
+{
+	IndexType N=30;
+	IndexType target_dimension=2;
+	DenseMatrix random=DenseMatrix::Random(N,N);
+	DenseMatrix lhs=random.transpose()*random+DenseMatrix::Identity(N,N);
+	DenseMatrix rhs=DenseMatrix(banded_matrix(N));
+
+	/* as used by NPE, LPP and LLTSA, solved by the dense method */
+	EigendecompositionResult expected=generalized_eigendecomposition<DenseMatrix,
+		DenseMatrix,DenseInverseMatrixOperation>(Dense,lhs,rhs,target_dimension,0);
+	EigendecompositionResult result=generalized_eigendecomposition<DenseMatrix,
+		DenseMatrix,DenseInverseMatrixOperation>(Lanczos,lhs,rhs,target_dimension,0);
+
+	check_same_result(expected,result,target_dimension);
+}
+#endif // HAVE_EIGEN3
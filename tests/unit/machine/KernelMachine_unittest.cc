@@ -0,0 +1,111 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/base/init.h>
+#include <shogun/classifier/svm/LibSVM.h>
+#include <shogun/features/DataGenerator.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* svm on two gaussians, a small C gives many support vectors */
+static CLibSVM* train_svm(CDenseFeatures<float64_t>* features, float64_t C)
+{
+	SGVector<float64_t> lab(features->get_num_vectors());
+	for (index_t i=0; i<lab.vlen; i++)
+		lab[i]=(i<lab.vlen/2) ? 1.0 : -1.0;
+
+	CGaussianKernel* kernel=new CGaussianKernel(features, features, 2.0, 10);
+	CLibSVM* svm=new CLibSVM(C, kernel, new CBinaryLabels(lab));
+	SG_REF(svm);
+	svm->train();
+
+	return svm;
+}
+
+TEST(KernelMachine,apply_blocks)
+{
+	CMath::init_random(17);
+	SGMatrix<float64_t> train=CDataGenerator::generate_gaussians(100, 2, 2);
+	SGMatrix<float64_t> test=CDataGenerator::generate_gaussians(700, 2, 2);
+	CDenseFeatures<float64_t>* train_feats=new CDenseFeatures<float64_t>(train);
+	CDenseFeatures<float64_t>* test_feats=new CDenseFeatures<float64_t>(test);
+	SG_REF(test_feats);
+
+	CLibSVM* svm=train_svm(train_feats, 10.0);
+	svm->parallel->set_num_threads(3);
+	CBinaryLabels* pred=svm->apply_binary(test_feats);
+	SGVector<float64_t> outputs=pred->get_values();
+
+	/* the blocked expansion sums up in the same order as apply_one */
+	ASSERT_EQ(outputs.vlen, test_feats->get_num_vectors());
+	for (index_t i=0; i<outputs.vlen; i++)
+		EXPECT_EQ(svm->apply_one(i), outputs[i]);
+
+	SG_UNREF(pred);
+	SG_UNREF(svm);
+	SG_UNREF(test_feats);
+}
+
+TEST(KernelMachine,compress_support_vectors)
+{
+	CMath::init_random(19);
+	SGMatrix<float64_t> train=CDataGenerator::generate_gaussians(200, 2, 2);
+	SGMatrix<float64_t> test=CDataGenerator::generate_gaussians(100, 2, 2);
+	CDenseFeatures<float64_t>* train_feats=new CDenseFeatures<float64_t>(train);
+	CDenseFeatures<float64_t>* test_feats=new CDenseFeatures<float64_t>(test);
+	SG_REF(train_feats);
+	SG_REF(test_feats);
+
+	CLibSVM* svm=train_svm(train_feats, 0.1);
+	int32_t num_svs=svm->get_num_support_vectors();
+	CBinaryLabels* pred=svm->apply_binary(test_feats);
+	SGVector<float64_t> outputs=pred->get_values();
+	SG_UNREF(pred);
+
+	/* norm of the normal vector */
+	CKernel* kernel=svm->get_kernel();
+	kernel->init(train_feats, train_feats);
+	float64_t norm=0;
+	for (index_t i=0; i<num_svs; i++)
+	{
+		for (index_t j=0; j<num_svs; j++)
+		{
+			norm+=svm->get_alpha(i)*svm->get_alpha(j)*kernel->kernel(
+					svm->get_support_vector(i), svm->get_support_vector(j));
+		}
+	}
+	norm=CMath::sqrt(norm);
+	SG_UNREF(kernel);
+
+	/* the kernel is one on the diagonal, so that the bound is uniform */
+	float64_t error=svm->compress_support_vectors(0.05);
+	EXPECT_LE(error, 0.05);
+	EXPECT_LT(svm->get_num_support_vectors(), num_svs/2);
+
+	pred=svm->apply_binary(test_feats);
+	SGVector<float64_t> compressed=pred->get_values();
+	for (index_t i=0; i<outputs.vlen; i++)
+		EXPECT_LE(CMath::abs(outputs[i]-compressed[i]), error*norm+1e-10);
+	SG_UNREF(pred);
+
+	/* a limit on the number of support vectors takes precedence */
+	int32_t num_compressed=svm->get_num_support_vectors();
+	float64_t limited=svm->compress_support_vectors(0.0, num_compressed/2);
+	EXPECT_EQ(num_compressed/2, svm->get_num_support_vectors());
+	EXPECT_GT(limited, 0.0);
+
+	SG_UNREF(svm);
+	SG_UNREF(test_feats);
+	SG_UNREF(train_feats);
+}
@@ -330,4 +330,41 @@ TEST(Statistics, lnormal_cdf)
 	EXPECT_NEAR(lphi, 0.0, 1e-6);
 }
 
+TEST(Statistics, vectorized_special_functions)
+{
+	// long enough to be evaluated in parallel, covers all branches
+	SGVector<float64_t> x(40000);
+	for (index_t i=0; i<x.vlen; i++)
+		x[i]=-30.0+60.0*i/(x.vlen-1);
+	x[0]=0.0;
+
+	SGVector<float64_t> erf=CStatistics::error_function(x);
+	SGVector<float64_t> erfc=CStatistics::error_function_complement(x);
+	SGVector<float64_t> ncdf=CStatistics::normal_cdf(x, 2.0);
+	SGVector<float64_t> lncdf=CStatistics::lnormal_cdf(x);
+	for (index_t i=0; i<x.vlen; i++)
+	{
+		EXPECT_EQ(erf[i], CStatistics::error_function(x[i]));
+		EXPECT_EQ(erfc[i], CStatistics::error_function_complement(x[i]));
+		EXPECT_EQ(ncdf[i], CStatistics::normal_cdf(x[i], 2.0));
+		EXPECT_EQ(lncdf[i], CStatistics::lnormal_cdf(x[i]));
+	}
+
+	SGVector<float64_t> p(20000);
+	for (index_t i=0; i<p.vlen; i++)
+		p[i]=(i+0.5)/p.vlen;
+
+	SGVector<float64_t> inv=CStatistics::inverse_normal_cdf(p, 1.0, 3.0);
+	SGVector<float64_t> ibeta=CStatistics::incomplete_beta(2.0, 3.5, p);
+	SGVector<float64_t> igamma=CStatistics::incomplete_gamma(1.5, p);
+	SGVector<float64_t> lgam=CStatistics::lgamma(p);
+	for (index_t i=0; i<p.vlen; i++)
+	{
+		EXPECT_EQ(inv[i], CStatistics::inverse_normal_cdf(p[i], 1.0, 3.0));
+		EXPECT_EQ(ibeta[i], CStatistics::incomplete_beta(2.0, 3.5, p[i]));
+		EXPECT_EQ(igamma[i], CStatistics::incomplete_gamma(1.5, p[i]));
+		EXPECT_EQ(lgam[i], CStatistics::lgamma(p[i]));
+	}
+}
+
 #endif // HAVE_EIGEN3
@@ -4,6 +4,10 @@
 #include <shogun/lib/config.h>
 #include <shogun/machine/BaggingMachine.h>
 #include <shogun/ensemble/MajorityVote.h>
+#include <shogun/classifier/svm/LibLinear.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/evaluation/ContingencyTableEvaluation.h>
+#include <shogun/mathematics/Math.h>
 #include <gtest/gtest.h>
 
 #ifdef USE_REFERENCE_COUNTING
@@ -60,4 +64,49 @@ TEST(BaggingMachine, mock_train)
 
 	SG_UNREF(bm);
 }
+TEST(BaggingMachine, parallel_train)
+{
+	index_t num_vectors = 100;
+	SGMatrix<float64_t> data(2, num_vectors);
+	SGVector<float64_t> lab(num_vectors);
+	for (index_t i = 0; i < num_vectors; i++)
+	{
+		lab[i] = i%2 ? 1 : -1;
+		data(0, i) = lab[i]+CMath::randn_double();
+		data(1, i) = CMath::randn_double();
+	}
+
+	CDenseFeatures<float64_t>* features = new CDenseFeatures<float64_t>(data);
+	CBinaryLabels* labels = new CBinaryLabels(lab);
+	CBaggingMachine* bm = new CBaggingMachine(features, labels);
+	bm->set_machine(new CLibLinear(L2R_L2LOSS_SVC));
+	bm->set_bag_size(50);
+	bm->set_num_bags(10);
+	bm->set_combination_rule(new CMajorityVote());
+	CAccuracyMeasure* eval = new CAccuracyMeasure();
+	SG_REF(eval);
+
+	/* bags are seeded, so the result does not depend on the thread count */
+	SGVector<float64_t> outputs[2];
+	float64_t oob_error[2];
+	for (index_t k = 0; k < 2; k++)
+	{
+		CMath::init_random(17);
+		bm->parallel->set_num_threads(k ? 3 : 1);
+		bm->train();
+
+		CBinaryLabels* pred = bm->apply_binary(features);
+		outputs[k] = pred->get_values();
+		oob_error[k] = bm->get_oob_error(eval);
+		SG_UNREF(pred);
+	}
+
+	for (index_t i = 0; i < num_vectors; i++)
+		EXPECT_EQ(outputs[0][i], outputs[1][i]);
+	EXPECT_EQ(oob_error[0], oob_error[1]);
+	EXPECT_FALSE(features->get_subset_stack()->has_subsets());
+
+	SG_UNREF(eval);
+	SG_UNREF(bm);
+}
 #endif
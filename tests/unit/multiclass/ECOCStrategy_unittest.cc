@@ -0,0 +1,133 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/lib/config.h>
+#include <shogun/base/init.h>
+#include <shogun/multiclass/ecoc/ECOCUtil.h>
+#include <shogun/multiclass/ecoc/ECOCRandomDenseEncoder.h>
+#include <shogun/multiclass/ecoc/ECOCRandomSparseEncoder.h>
+#include <shogun/multiclass/ecoc/ECOCHDDecoder.h>
+#include <shogun/multiclass/ecoc/ECOCIHDDecoder.h>
+#include <shogun/multiclass/ecoc/ECOCLLBDecoder.h>
+#include <shogun/multiclass/ecoc/ECOCEDDecoder.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+
+using namespace shogun;
+
+/* codes are longer than one word of the packed masks */
+#define CODE_LENGTH 100
+
+static SGMatrix<float64_t> random_outputs(int32_t num_machines, int32_t num_vectors)
+{
+	SGMatrix<float64_t> outputs(num_machines, num_vectors);
+	for (index_t i=0; i<num_machines*num_vectors; i++)
+		outputs.matrix[i]=CMath::random(-1.0, 1.0);
+
+	return outputs;
+}
+
+static void check_decoder(CECOCDecoder* decoder, SGMatrix<int32_t> codebook,
+		SGMatrix<float64_t> outputs)
+{
+	SG_REF(decoder);
+	decoder->parallel->set_num_threads(3);
+
+	SGVector<int32_t> labels=decoder->decide_labels(outputs, codebook);
+	ASSERT_EQ(outputs.num_cols, labels.vlen);
+	for (index_t i=0; i<outputs.num_cols; i++)
+	{
+		SGVector<float64_t> output(outputs.get_column_vector(i), outputs.num_rows, false);
+		EXPECT_EQ(decoder->decide_label(output, codebook), labels[i]);
+	}
+
+	SG_UNREF(decoder);
+}
+
+TEST(ECOCUtil,packed_hamming_distance)
+{
+	CMath::init_random(41);
+	int32_t words=CECOCUtil::get_packed_length(CODE_LENGTH);
+	SGVector<int32_t> c1(CODE_LENGTH);
+	SGVector<int32_t> c2(CODE_LENGTH);
+	SGVector<uint64_t> p1(2*words);
+	SGVector<uint64_t> p2(2*words);
+
+	for (index_t k=0; k<20; k++)
+	{
+		for (index_t i=0; i<CODE_LENGTH; i++)
+		{
+			c1[i]=CMath::random(-1, 1);
+			c2[i]=CMath::random(-1, 1);
+		}
+
+		CECOCUtil::pack_code(c1.vector, CODE_LENGTH, p1.vector);
+		CECOCUtil::pack_code(c2.vector, CODE_LENGTH, p2.vector);
+		EXPECT_EQ(CECOCUtil::hamming_distance(c1.vector, c2.vector, CODE_LENGTH),
+				CECOCUtil::packed_hamming_distance(p1.vector, p2.vector, words));
+	}
+}
+
+TEST(ECOCStrategy,parallel_encoders)
+{
+	int32_t num_classes=10;
+	CECOCEncoder* encoders[]={
+		new CECOCRandomDenseEncoder(200, CODE_LENGTH),
+		new CECOCRandomSparseEncoder(200, CODE_LENGTH)};
+
+	for (index_t e=0; e<2; e++)
+	{
+		SG_REF(encoders[e]);
+
+		/* codes are drawn serially, so the thread count does not matter,
+		 * the sparse encoder shuffles with rand() */
+		CMath::init_random(43);
+		srand(43);
+		encoders[e]->parallel->set_num_threads(1);
+		SGMatrix<int32_t> serial=encoders[e]->create_codebook(num_classes);
+
+		CMath::init_random(43);
+		srand(43);
+		encoders[e]->parallel->set_num_threads(3);
+		SGMatrix<int32_t> parallel=encoders[e]->create_codebook(num_classes);
+
+		ASSERT_EQ(serial.num_rows, parallel.num_rows);
+		ASSERT_EQ(serial.num_cols, parallel.num_cols);
+		for (index_t i=0; i<serial.num_rows*serial.num_cols; i++)
+			EXPECT_EQ(serial.matrix[i], parallel.matrix[i]);
+
+		SG_UNREF(encoders[e]);
+	}
+}
+
+TEST(ECOCStrategy,batch_decoding)
+{
+	int32_t num_classes=10;
+	CMath::init_random(47);
+
+	CECOCRandomDenseEncoder* dense=new CECOCRandomDenseEncoder(200, CODE_LENGTH);
+	CECOCRandomSparseEncoder* sparse=new CECOCRandomSparseEncoder(200, CODE_LENGTH);
+	SG_REF(dense);
+	SG_REF(sparse);
+	SGMatrix<int32_t> dense_codebook=dense->create_codebook(num_classes);
+	SGMatrix<int32_t> sparse_codebook=sparse->create_codebook(num_classes);
+	SG_UNREF(dense);
+	SG_UNREF(sparse);
+
+	SGMatrix<float64_t> outputs=random_outputs(CODE_LENGTH, 300);
+
+	check_decoder(new CECOCHDDecoder(), sparse_codebook, outputs);
+	check_decoder(new CECOCLLBDecoder(), sparse_codebook, outputs);
+	check_decoder(new CECOCEDDecoder(), sparse_codebook, outputs);
+#ifdef HAVE_LAPACK
+	check_decoder(new CECOCIHDDecoder(), dense_codebook, outputs);
+#endif // HAVE_LAPACK
+}
@@ -0,0 +1,165 @@
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/multiclass/tree/HistogramTreeEnsemble.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(HistogramTreeEnsemble, gradient_boosting_regression)
+{
+	index_t num=100;
+	SGMatrix<float64_t> feat(1, num);
+	SGVector<float64_t> lab(num);
+	for (index_t i=0; i<num; i++)
+	{
+		feat[i]=(float64_t) i/num;
+		lab[i]=feat[i]<0.5 ? 1.0 : 3.0;
+	}
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(feat);
+	CRegressionLabels* labels=new CRegressionLabels(lab);
+
+	CHistogramTreeEnsemble* gbt=new CHistogramTreeEnsemble(TE_GRADIENT_BOOSTING, 50, 2);
+	gbt->set_learning_rate(0.3);
+	gbt->set_lambda(0.0);
+	gbt->set_labels(labels);
+	SG_REF(gbt);
+	gbt->train(features);
+
+	EXPECT_EQ(gbt->get_machine_problem_type(), PT_REGRESSION);
+	EXPECT_EQ(gbt->get_num_trained_trees(), 50);
+
+	CRegressionLabels* output=gbt->apply_regression(features);
+	for (index_t i=0; i<num; i++)
+		EXPECT_NEAR(output->get_label(i), lab[i], 1E-3);
+
+	SG_UNREF(output);
+	SG_UNREF(gbt);
+}
+
+TEST(HistogramTreeEnsemble, random_forest_binary)
+{
+	index_t num=20;
+	SGMatrix<float64_t> feat(2, num*num);
+	SGVector<float64_t> lab(num*num);
+	for (index_t i=0; i<num; i++)
+	{
+		for (index_t j=0; j<num; j++)
+		{
+			feat(0, i*num+j)=(float64_t) i/num;
+			feat(1, i*num+j)=(float64_t) j/num;
+			lab[i*num+j]=i+j<num ? -1.0 : 1.0;
+		}
+	}
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(feat);
+	CBinaryLabels* labels=new CBinaryLabels(lab);
+
+	CMath::init_random(17);
+	CHistogramTreeEnsemble* rf=new CHistogramTreeEnsemble(TE_RANDOM_FOREST, 30, 8);
+	rf->set_labels(labels);
+	SG_REF(rf);
+	rf->train(features);
+
+	CBinaryLabels* output=rf->apply_binary(features);
+	index_t correct=0;
+	for (index_t i=0; i<num*num; i++)
+	{
+		if (output->get_label(i)==lab[i])
+			correct++;
+		EXPECT_LE(CMath::abs(output->get_value(i)), 1.0+1E-10);
+	}
+	EXPECT_GE(correct, 0.95*num*num);
+
+	SG_UNREF(output);
+	SG_UNREF(rf);
+}
+
+TEST(HistogramTreeEnsemble, gradient_boosting_multiclass)
+{
+	index_t num=90;
+	SGMatrix<float64_t> feat(2, num);
+	SGVector<float64_t> lab(num);
+	for (index_t i=0; i<num; i++)
+	{
+		feat(0, i)=i;
+		feat(1, i)=i%7;
+		lab[i]=i/30;
+	}
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(feat);
+	CMulticlassLabels* labels=new CMulticlassLabels(lab);
+
+	CHistogramTreeEnsemble* gbt=new CHistogramTreeEnsemble(TE_GRADIENT_BOOSTING, 20, 3);
+	gbt->set_labels(labels);
+	SG_REF(gbt);
+	gbt->train(features);
+
+	CMulticlassLabels* output=gbt->apply_multiclass(features);
+	for (index_t i=0; i<num; i++)
+	{
+		EXPECT_EQ(output->get_label(i), lab[i]);
+
+		SGVector<float64_t> conf=output->get_multiclass_confidences(i);
+		EXPECT_EQ(conf.vlen, 3);
+		EXPECT_NEAR(SGVector<float64_t>::sum(conf), 1.0, 1E-10);
+	}
+
+	SG_UNREF(output);
+	SG_UNREF(gbt);
+}
+
+TEST(HistogramTreeEnsemble, sparse_equals_dense)
+{
+	index_t num=60;
+	SGMatrix<float64_t> feat(5, num);
+	SGVector<float64_t> lab(num);
+	feat.zero();
+	for (index_t i=0; i<num; i++)
+	{
+		feat(i%5, i)=(float64_t) (i%11);
+		feat((i+2)%5, i)=-(float64_t) (i%3);
+		lab[i]=(i%11)>5 ? 1.0 : -1.0;
+	}
+
+	CDenseFeatures<float64_t>* dense=new CDenseFeatures<float64_t>(feat);
+	CSparseFeatures<float64_t>* sparse=new CSparseFeatures<float64_t>(feat);
+	SG_REF(dense);
+	SG_REF(sparse);
+	CBinaryLabels* labels=new CBinaryLabels(lab);
+
+	CHistogramTreeEnsemble* rf_dense=new CHistogramTreeEnsemble(TE_RANDOM_FOREST, 10, 4);
+	rf_dense->set_labels(labels);
+	SG_REF(rf_dense);
+	CMath::init_random(3);
+	rf_dense->train(dense);
+
+	CHistogramTreeEnsemble* rf_sparse=new CHistogramTreeEnsemble(TE_RANDOM_FOREST, 10, 4);
+	rf_sparse->set_labels(labels);
+	SG_REF(rf_sparse);
+	CMath::init_random(3);
+	rf_sparse->train(sparse);
+
+	EXPECT_EQ(rf_dense->get_num_nodes(), rf_sparse->get_num_nodes());
+
+	CBinaryLabels* out_dense=rf_dense->apply_binary(dense);
+	CBinaryLabels* out_sparse=rf_sparse->apply_binary(sparse);
+	CBinaryLabels* out_mixed=rf_dense->apply_binary(sparse);
+	for (index_t i=0; i<num; i++)
+	{
+		EXPECT_NEAR(out_dense->get_value(i), out_sparse->get_value(i), 1E-12);
+		EXPECT_NEAR(out_dense->get_value(i), out_mixed->get_value(i), 1E-12);
+	}
+
+	SG_UNREF(out_dense);
+	SG_UNREF(out_sparse);
+	SG_UNREF(out_mixed);
+	SG_UNREF(rf_dense);
+	SG_UNREF(rf_sparse);
+	SG_UNREF(dense);
+	SG_UNREF(sparse);
+}
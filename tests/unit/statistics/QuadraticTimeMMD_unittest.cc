@@ -344,3 +344,63 @@ TEST(QuadraticTimeMMD,custom_kernel_vs_normal_kernel)
 	SG_UNREF(feat_p);
 	SG_UNREF(feat_q);
 }
+
+TEST(QuadraticTimeMMD,bootstrap_null_batched_vs_subsets)
+{
+	index_t m=13;
+	index_t d=2;
+
+	CMeanShiftDataGenerator* gen_p=new CMeanShiftDataGenerator(0, d, 0);
+	CMeanShiftDataGenerator* gen_q=new CMeanShiftDataGenerator(0.5, d, 0);
+	CFeatures* feat_p=gen_p->get_streamed_features(m);
+	CFeatures* feat_q=gen_q->get_streamed_features(m);
+	CFeatures* p_and_q=feat_p->create_merged_copy(feat_q);
+	SG_REF(p_and_q);
+
+	CGaussianKernel* kernel=new CGaussianKernel(10, 2);
+	kernel->init(p_and_q, p_and_q);
+	CCustomKernel* precomputed=new CCustomKernel(kernel);
+
+	CQuadraticTimeMMD* mmd=new CQuadraticTimeMMD(precomputed, m);
+	SG_REF(mmd);
+
+	/* number of iterations is not a multiple of the batch size */
+	mmd->set_bootstrap_iterations(37);
+
+	for (index_t type=0; type<2; ++type)
+	{
+		mmd->set_statistic_type(type==0 ? BIASED : UNBIASED);
+
+		/* batched version on the kernel matrix vs permuting the custom kernel
+		 * with subsets, both use the same permutations for the same seed */
+		sg_rand->set_seed(12345);
+		SGVector<float64_t> batched=mmd->bootstrap_null();
+		sg_rand->set_seed(12345);
+		SGVector<float64_t> subsets=
+				mmd->CKernelTwoSampleTestStatistic::bootstrap_null();
+
+		ASSERT_EQ(batched.vlen, 37);
+		for (index_t i=0; i<batched.vlen; ++i)
+			EXPECT_NEAR(batched[i], subsets[i], 1E-10);
+	}
+
+	/* the same on the underlying kernel, where the matrix is computed first */
+	CQuadraticTimeMMD* mmd2=new CQuadraticTimeMMD(kernel, p_and_q, m);
+	SG_REF(mmd2);
+	mmd2->set_bootstrap_iterations(37);
+	sg_rand->set_seed(3);
+	SGVector<float64_t> batched=mmd2->bootstrap_null();
+	sg_rand->set_seed(3);
+	SGVector<float64_t> subsets=
+			mmd2->CTwoDistributionsTestStatistic::bootstrap_null();
+	for (index_t i=0; i<batched.vlen; ++i)
+		EXPECT_NEAR(batched[i], subsets[i], 1E-10);
+
+	SG_UNREF(mmd);
+	SG_UNREF(mmd2);
+	SG_UNREF(p_and_q);
+	SG_UNREF(feat_p);
+	SG_UNREF(feat_q);
+	SG_UNREF(gen_p);
+	SG_UNREF(gen_q);
+}
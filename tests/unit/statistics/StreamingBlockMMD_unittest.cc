@@ -0,0 +1,196 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/base/init.h>
+#include <shogun/statistics/StreamingBlockMMD.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/CombinedKernel.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/Statistics.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* block MMD term of samples offset,...,offset+block_size-1 */
+static float64_t block_term(CKernel* kernel, CFeatures* p, CFeatures* q,
+		index_t offset, index_t block_size)
+{
+	float64_t result=0;
+	for (index_t i=offset; i<offset+block_size; ++i)
+	{
+		for (index_t j=offset; j<offset+block_size; ++j)
+		{
+			if (i==j)
+				continue;
+
+			kernel->init(p, p);
+			result+=kernel->kernel(i, j);
+			kernel->init(q, q);
+			result+=kernel->kernel(i, j);
+			kernel->init(p, q);
+			result-=kernel->kernel(i, j)+kernel->kernel(j, i);
+		}
+	}
+
+	return result/block_size/(block_size-1);
+}
+
+static CDenseFeatures<float64_t>* create_data(index_t d, index_t m,
+		float64_t shift)
+{
+	SGMatrix<float64_t> data(d, m);
+	for (index_t i=0; i<d*m; ++i)
+		data.matrix[i]=CMath::sin(i*0.7+shift)+shift;
+
+	return new CDenseFeatures<float64_t>(data);
+}
+
+TEST(StreamingBlockMMD,linear_terms_sliding_window)
+{
+	index_t m=12;
+	index_t d=2;
+
+	CDenseFeatures<float64_t>* features_p=create_data(d, m, 0);
+	CDenseFeatures<float64_t>* features_q=create_data(d, m, 0.5);
+	SG_REF(features_p);
+	SG_REF(features_q);
+
+	CStreamingFeatures* streaming_p=new CStreamingDenseFeatures<float64_t>(
+			features_p);
+	CStreamingFeatures* streaming_q=new CStreamingDenseFeatures<float64_t>(
+			features_q);
+
+	/* bursts of 4 samples, i.e. 2 linear time terms, window of two bursts */
+	CGaussianKernel* kernel=new CGaussianKernel(10, 2);
+	CStreamingBlockMMD* mmd=new CStreamingBlockMMD(kernel, streaming_p,
+			streaming_q, m, 4, 2, 2);
+	SG_REF(mmd);
+
+	streaming_p->start_parser();
+	streaming_q->start_parser();
+	mmd->update(m);
+	streaming_p->end_parser();
+	streaming_q->end_parser();
+
+	EXPECT_EQ(mmd->get_num_terms(), 6);
+	EXPECT_EQ(mmd->get_num_window_terms(), 4);
+
+	/* reference terms of linear time MMD */
+	CGaussianKernel* reference=new CGaussianKernel(10, 2);
+	SG_REF(reference);
+	SGVector<float64_t> terms(6);
+	for (index_t i=0; i<terms.vlen; ++i)
+		terms[i]=block_term(reference, features_p, features_q, 2*i, 2);
+
+	SGVector<float64_t> statistic;
+	SGVector<float64_t> variance;
+	mmd->get_total_statistic_and_variance(statistic, variance);
+	EXPECT_NEAR(statistic[0], CStatistics::mean(terms), 1E-12);
+	EXPECT_NEAR(variance[0], CStatistics::variance(terms)/terms.vlen, 1E-12);
+
+	/* sliding window only contains the last two bursts */
+	SGVector<float64_t> window_terms(4);
+	memcpy(window_terms.vector, terms.vector+2, sizeof(float64_t)*4);
+	EXPECT_NEAR(mmd->compute_statistic(), CStatistics::mean(window_terms),
+			1E-12);
+	EXPECT_NEAR(mmd->compute_variance_estimate(),
+			CStatistics::variance(window_terms)/window_terms.vlen, 1E-12);
+
+	SG_UNREF(reference);
+	SG_UNREF(mmd);
+	SG_UNREF(features_p);
+	SG_UNREF(features_q);
+}
+
+TEST(StreamingBlockMMD,block_terms_multiple_kernels)
+{
+	index_t m=12;
+	index_t d=2;
+	index_t block_size=3;
+
+	CDenseFeatures<float64_t>* features_p=create_data(d, m, 0);
+	CDenseFeatures<float64_t>* features_q=create_data(d, m, 1);
+	SG_REF(features_p);
+	SG_REF(features_q);
+
+	CStreamingFeatures* streaming_p=new CStreamingDenseFeatures<float64_t>(
+			features_p);
+	CStreamingFeatures* streaming_q=new CStreamingDenseFeatures<float64_t>(
+			features_q);
+
+	CCombinedKernel* kernel=new CCombinedKernel();
+	kernel->append_kernel(new CGaussianKernel(10, 1));
+	kernel->append_kernel(new CGaussianKernel(10, 4));
+
+	CStreamingBlockMMD* mmd=new CStreamingBlockMMD(kernel, streaming_p,
+			streaming_q, m, 100, block_size);
+	mmd->set_prefetch(false);
+	SG_REF(mmd);
+
+	streaming_p->start_parser();
+	streaming_q->start_parser();
+	mmd->update(m);
+	streaming_p->end_parser();
+	streaming_q->end_parser();
+
+	index_t num_terms=m/block_size;
+	EXPECT_EQ(mmd->get_num_terms(), num_terms);
+
+	/* reference block terms for both kernels */
+	SGMatrix<float64_t> terms(2, num_terms);
+	for (index_t k=0; k<2; ++k)
+	{
+		CKernel* reference=new CGaussianKernel(10, k==0 ? 1 : 4);
+		SG_REF(reference);
+		for (index_t i=0; i<num_terms; ++i)
+		{
+			terms(k, i)=block_term(reference, features_p, features_q,
+					i*block_size, block_size);
+		}
+		SG_UNREF(reference);
+	}
+
+	SGVector<float64_t> statistic;
+	SGMatrix<float64_t> Q;
+	mmd->compute_statistic_and_Q(statistic, Q);
+	SGVector<float64_t> mean(2);
+	for (index_t k=0; k<2; ++k)
+	{
+		mean[k]=0;
+		for (index_t i=0; i<num_terms; ++i)
+			mean[k]+=terms(k, i)/num_terms;
+
+		EXPECT_NEAR(statistic[k], mean[k], 1E-12);
+	}
+
+	for (index_t k=0; k<2; ++k)
+	{
+		for (index_t l=0; l<2; ++l)
+		{
+			float64_t cov=0;
+			for (index_t i=0; i<num_terms; ++i)
+				cov+=(terms(k, i)-mean[k])*(terms(l, i)-mean[l]);
+
+			EXPECT_NEAR(Q(k, l), 2*cov/(num_terms-1), 1E-12);
+		}
+	}
+
+	/* statistic of the weighted combination */
+	SGVector<float64_t> weights(2);
+	weights[0]=0.25;
+	weights[1]=0.75;
+	kernel->set_subkernel_weights(weights);
+	EXPECT_NEAR(mmd->compute_statistic(), 0.25*mean[0]+0.75*mean[1], 1E-12);
+
+	SG_UNREF(mmd);
+	SG_UNREF(features_p);
+	SG_UNREF(features_q);
+}
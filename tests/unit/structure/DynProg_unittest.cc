@@ -0,0 +1,261 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/base/init.h>
+#include <shogun/lib/DynamicObjectArray.h>
+#include <shogun/structure/DynProg.h>
+#include <shogun/structure/PlifMatrix.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+#define NUM_STATES 3
+#define SEQ_LEN 150
+
+/* plifs on the segment length combined with a plif on the first content
+ * svm for every transition, a plif on the signal for every state */
+static CPlifMatrix* create_plif_matrix()
+{
+	const int32_t num_plifs=4;
+	const int32_t num_limits=4;
+	float64_t limits[num_plifs][num_limits]={{1,10,50,200},{-1,0,1,2},{0,0.3,0.6,1},{1,5,20,60}};
+	float64_t penalties[num_plifs][num_limits]={{-2,0,-1,-5},{-1,0,1,2},{-1,0,0.5,1},{0,1,0,-3}};
+
+	CPlifMatrix* pm=new CPlifMatrix();
+	pm->create_plifs(num_plifs, num_limits);
+
+	SGVector<int32_t> ids(num_plifs);
+	ids.range_fill();
+	pm->set_plif_ids(ids);
+
+	SGVector<float64_t> min_values(num_plifs);
+	SGVector<float64_t> max_values(num_plifs);
+	min_values.set_const(-1e6);
+	max_values.set_const(1e6);
+	min_values[0]=1;
+	max_values[0]=200;
+	min_values[3]=1;
+	max_values[3]=60;
+	pm->set_plif_min_values(min_values);
+	pm->set_plif_max_values(max_values);
+
+	SGVector<bool> use_cache(num_plifs);
+	use_cache.set_const(false);
+	use_cache[3]=true;
+	pm->set_plif_use_cache(use_cache);
+
+	SGVector<int32_t> use_svm(num_plifs);
+	use_svm.zero();
+	use_svm[1]=1;
+	pm->set_plif_use_svm(use_svm);
+
+	SGMatrix<float64_t> plif_limits(num_plifs, num_limits);
+	SGMatrix<float64_t> plif_penalties(num_plifs, num_limits);
+	for (int32_t i=0; i<num_plifs; i++)
+	{
+		for (int32_t k=0; k<num_limits; k++)
+		{
+			plif_limits.matrix[i*num_limits+k]=limits[i][k];
+			plif_penalties.matrix[i*num_limits+k]=penalties[i][k];
+		}
+	}
+	pm->set_plif_limits(plif_limits);
+	pm->set_plif_penalties(plif_penalties);
+
+	/* plif ids+1 of the transitions, indexed by (to, from, k) */
+	int32_t* dims=SG_MALLOC(int32_t, 3);
+	dims[0]=NUM_STATES;
+	dims[1]=NUM_STATES;
+	dims[2]=2;
+	SGNDArray<float64_t> transitions(dims, 3);
+	for (int32_t i=0; i<NUM_STATES*NUM_STATES*2; i++)
+		transitions.array[i]=0;
+
+	int32_t from[]={0, 1, 0, 2, 1};
+	int32_t to[]={0, 0, 1, 1, 2};
+	int32_t length_plif[]={4, 4, 1, 1, 4};
+	for (int32_t i=0; i<5; i++)
+	{
+		transitions.array[to[i]+from[i]*NUM_STATES]=length_plif[i];
+		transitions.array[to[i]+from[i]*NUM_STATES+NUM_STATES*NUM_STATES]=2;
+	}
+	pm->compute_plif_matrix(transitions);
+
+	SGMatrix<int32_t> state_signals(NUM_STATES, 1);
+	state_signals.set_const(3);
+	pm->compute_signal_plifs(state_signals);
+
+	return pm;
+}
+
+/* random sequence with random signals */
+static CDynProg* create_dyn_prog(CPlifMatrix* pm, int32_t seed)
+{
+	const int32_t num_svms=8;
+	CMath::init_random(seed);
+
+	CDynProg* dp=new CDynProg(num_svms);
+	dp->set_num_states(NUM_STATES);
+
+	SGVector<int32_t> pos(SEQ_LEN);
+	for (int32_t i=0; i<SEQ_LEN; i++)
+		pos[i]=2*i;
+	dp->set_pos(pos);
+
+	SGVector<char> genestr(2*SEQ_LEN+10);
+	for (int32_t i=0; i<genestr.vlen; i++)
+		genestr[i]="acgt"[CMath::random(0, 3)];
+	dp->set_gene_string(genestr);
+	dp->create_word_string();
+	dp->precompute_stop_codons();
+
+	dp->init_content_svm_value_array(num_svms);
+	SGMatrix<float64_t> dict_weights(5440, num_svms);
+	for (int32_t i=0; i<dict_weights.num_rows*dict_weights.num_cols; i++)
+		dict_weights.matrix[i]=CMath::random(-1.0, 1.0);
+	dp->set_dict_weights(dict_weights);
+	dp->precompute_content_values();
+
+	SGMatrix<int32_t> mod_words(num_svms, 2);
+	for (int32_t i=0; i<num_svms; i++)
+	{
+		mod_words(i, 0)=1;
+		mod_words(i, 1)=0;
+	}
+	dp->init_mod_words_array(mod_words);
+
+	SGMatrix<int32_t> orf_info(NUM_STATES, 2);
+	orf_info.set_const(-1);
+	dp->set_orf_info(orf_info);
+
+	SGVector<float64_t> p(NUM_STATES);
+	SGVector<float64_t> q(NUM_STATES);
+	p[0]=0;
+	p[1]=-1;
+	p[2]=-CMath::INFTY;
+	q[0]=0;
+	q[1]=-0.5;
+	q[2]=-CMath::INFTY;
+	dp->set_p_vector(p);
+	dp->set_q_vector(q);
+
+	/* from, to, value, id; sorted by to */
+	float64_t trans[][4]={{0,0,-3,0},{1,0,-0.3,1},{0,1,-0.5,1},{2,1,0.1,1},{1,2,-0.4,2}};
+	SGMatrix<float64_t> a_trans(5, 4);
+	for (int32_t i=0; i<5; i++)
+	{
+		for (int32_t k=0; k<4; k++)
+			a_trans(i, k)=trans[i][k];
+	}
+	dp->set_a_trans_matrix(a_trans);
+	dp->check_svm_arrays();
+
+	int32_t* dims=SG_MALLOC(int32_t, 3);
+	dims[0]=NUM_STATES;
+	dims[1]=SEQ_LEN;
+	dims[2]=1;
+	SGNDArray<float64_t> observations(dims, 3);
+	for (int32_t i=0; i<NUM_STATES*SEQ_LEN; i++)
+		observations.array[i]=CMath::random(0.0, 1.0);
+	dp->set_observation_matrix(observations);
+
+	SGMatrix<float64_t> seg_path(2, SEQ_LEN);
+	seg_path.zero();
+	dp->set_content_type_array(seg_path);
+	dp->set_plif_matrices(pm);
+	dp->long_transition_settings(true, 30, 0);
+
+	return dp;
+}
+
+TEST(DynProg, beam_pruning)
+{
+	CPlifMatrix* pm=create_plif_matrix();
+	SG_REF(pm);
+
+	float64_t beam_widths[]={CMath::INFTY, 1e6, 1};
+	float64_t scores[3];
+	SGMatrix<int32_t> states[3];
+	SGMatrix<int32_t> positions[3];
+	for (int32_t i=0; i<3; i++)
+	{
+		CDynProg* dp=create_dyn_prog(pm, 3);
+		SG_REF(dp);
+		dp->set_beam_width(beam_widths[i]);
+		dp->compute_nbest_paths(1, false, 1, false, false);
+		scores[i]=dp->get_scores()[0];
+		states[i]=dp->get_states();
+		positions[i]=dp->get_positions();
+		SG_UNREF(dp);
+	}
+
+	/* viterbi path and score of the implementation before beam pruning and
+	 * tabulated transition penalties */
+	const int32_t path_len=55;
+	int32_t ref_states[path_len]={0,1,2,1,2,1,2,1,2,1,0,1,2,1,2,1,2,1,2,1,2,1,
+		2,1,2,1,2,1,2,1,0,1,2,1,2,1,0,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,0};
+	int32_t ref_positions[path_len]={0,5,7,9,11,13,14,19,21,28,29,30,32,37,38,
+		42,43,47,48,52,54,58,59,65,67,72,74,78,79,81,83,88,89,94,96,99,100,104,
+		106,113,114,119,120,124,125,126,128,130,131,136,137,140,142,147,149};
+	EXPECT_NEAR(scores[0], 49.556665367575334, 1E-10);
+	ASSERT_GT(states[0].num_cols, path_len);
+	for (int32_t i=0; i<path_len; i++)
+	{
+		EXPECT_EQ(ref_states[i], states[0](0, i));
+		EXPECT_EQ(ref_positions[i], positions[0](0, i));
+	}
+	EXPECT_EQ(-1, states[0](0, path_len));
+
+	/* a wide beam does not change the viterbi path */
+	EXPECT_EQ(scores[0], scores[1]);
+	for (int32_t i=0; i<states[0].num_cols; i++)
+		EXPECT_EQ(states[0](0, i), states[1](0, i));
+
+	/* a narrow beam can only find a worse path */
+	EXPECT_LE(scores[2], scores[0]);
+	EXPECT_GT(scores[2], -CMath::INFTY);
+
+	SG_UNREF(pm);
+}
+
+TEST(DynProg, multiple_sequences)
+{
+	CPlifMatrix* pm=create_plif_matrix();
+	SG_REF(pm);
+
+	const int32_t num_seqs=4;
+	CDynamicObjectArray* dps=new CDynamicObjectArray();
+	SG_REF(dps);
+	for (int32_t i=0; i<num_seqs; i++)
+		dps->append_element(create_dyn_prog(pm, i+1));
+
+	CDynProg::compute_nbest_paths(dps, 1, false, 1, false);
+
+	for (int32_t i=0; i<num_seqs; i++)
+	{
+		CDynProg* single=create_dyn_prog(pm, i+1);
+		SG_REF(single);
+		single->compute_nbest_paths(1, false, 1, false, false);
+
+		CDynProg* batch=(CDynProg*) dps->get_element(i);
+		EXPECT_EQ(single->get_scores()[0], batch->get_scores()[0]);
+
+		SGMatrix<int32_t> single_pos=single->get_positions();
+		SGMatrix<int32_t> batch_pos=batch->get_positions();
+		for (int32_t j=0; j<single_pos.num_rows*single_pos.num_cols; j++)
+			EXPECT_EQ(single_pos.matrix[j], batch_pos.matrix[j]);
+
+		SG_UNREF(batch);
+		SG_UNREF(single);
+	}
+
+	SG_UNREF(dps);
+	SG_UNREF(pm);
+}
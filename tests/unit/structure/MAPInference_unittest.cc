@@ -0,0 +1,206 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Copyright (C) 2014 Shogun Machine Learning Toolbox
+ */
+
+#include <shogun/base/init.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/structure/FactorGraph.h>
+#include <shogun/structure/FactorType.h>
+#include <shogun/structure/Factor.h>
+#include <shogun/structure/MAPInference.h>
+#include <shogun/structure/BeliefPropagation.h>
+#include <shogun/labels/FactorGraphLabels.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* w x h grid with random unary factors and pairwise factors between
+ * horizontal and vertical neighbours. Pairwise energies are Potts-like
+ * if submodular, random otherwise. If tree is set, only the first row
+ * and the columns are connected. Factors are data dependent, so that the
+ * energies can be loss augmented. */
+static CFactorGraph* create_grid(int32_t w, int32_t h, int32_t num_states,
+	bool submodular, bool tree, int32_t seed)
+{
+	CMath::init_random(seed);
+
+	SGVector<int32_t> vc(w*h);
+	vc.set_const(num_states);
+	CFactorGraph* fg = new CFactorGraph(vc);
+
+	// energies are the weights times a constant feature
+	SGVector<float64_t> data(1);
+	data[0] = 1.0;
+	int32_t tid = 0;
+	for (int32_t vi = 0; vi < w*h; vi++)
+	{
+		SGVector<int32_t> card(1);
+		card[0] = num_states;
+		SGVector<float64_t> energies(num_states);
+		for (int32_t si = 0; si < num_states; si++)
+			energies[si] = CMath::random(-1.0, 1.0);
+
+		SGVector<int32_t> var_index(1);
+		var_index[0] = vi;
+		CTableFactorType* ftype = new CTableFactorType(tid++, card, energies);
+		fg->add_factor(new CFactor(ftype, var_index, data));
+	}
+
+	for (int32_t y = 0; y < h; y++)
+	{
+		for (int32_t x = 0; x < w; x++)
+		{
+			for (int32_t dir = 0; dir < 2; dir++)
+			{
+				int32_t nx = x + (dir == 0);
+				int32_t ny = y + (dir == 1);
+				if (nx >= w || ny >= h || (tree && dir == 0 && y > 0))
+					continue;
+
+				SGVector<int32_t> card(2);
+				card.set_const(num_states);
+				SGVector<float64_t> energies(num_states*num_states);
+				float64_t penalty = CMath::random(0.1, 1.0);
+				for (int32_t ei = 0; ei < energies.size(); ei++)
+				{
+					if (submodular)
+						energies[ei] = (ei % num_states == ei / num_states) ? 0 : penalty;
+					else
+						energies[ei] = CMath::random(-1.0, 1.0);
+				}
+
+				SGVector<int32_t> var_index(2);
+				var_index[0] = x + w*y;
+				var_index[1] = nx + w*ny;
+				CTableFactorType* ftype = new CTableFactorType(tid++, card, energies);
+				fg->add_factor(new CFactor(ftype, var_index, data));
+			}
+		}
+	}
+
+	fg->compute_energies();
+	fg->connect_components();
+
+	return fg;
+}
+
+/* minimum energy by enumerating all assignments */
+static float64_t brute_force(CFactorGraph* fg)
+{
+	SGVector<int32_t> cards = fg->get_cardinalities();
+	SGVector<int32_t> state(cards.size());
+	state.zero();
+
+	float64_t best = CMath::INFTY;
+	while (true)
+	{
+		best = CMath::min(best, fg->evaluate_energy(state));
+
+		int32_t vi = 0;
+		while (vi < state.size() && ++state[vi] == cards[vi])
+			state[vi++] = 0;
+
+		if (vi == state.size())
+			break;
+	}
+
+	return best;
+}
+
+static float64_t map_energy(CFactorGraph* fg, EMAPInferType type)
+{
+	CMAPInference infer_met(fg, type);
+	infer_met.inference();
+
+	CFactorGraphObservation* fg_observ = infer_met.get_structured_outputs();
+	SGVector<int32_t> assignment = fg_observ->get_data();
+	EXPECT_NEAR(infer_met.get_energy(), fg->evaluate_energy(assignment), 1E-10);
+	SG_UNREF(fg_observ);
+
+	return infer_met.get_energy();
+}
+
+TEST(MAPInference, exact_on_trees)
+{
+	for (int32_t seed = 1; seed <= 5; seed++)
+	{
+		CFactorGraph* fg = create_grid(4, 2, 3, false, true, seed);
+		SG_REF(fg);
+		ASSERT_TRUE(fg->is_tree_graph());
+
+		float64_t optimum = brute_force(fg);
+		EXPECT_NEAR(optimum, map_energy(fg, TREE_MAX_PROD), 1E-10);
+		EXPECT_NEAR(optimum, map_energy(fg, LOOPY_MAX_PROD), 1E-10);
+		EXPECT_NEAR(optimum, map_energy(fg, TRWS_MAX_PROD), 1E-10);
+
+		SG_UNREF(fg);
+	}
+}
+
+TEST(MAPInference, loopy_schedules)
+{
+	CFactorGraph* fg = create_grid(4, 2, 3, false, true, 7);
+	SG_REF(fg);
+	float64_t optimum = brute_force(fg);
+
+	ELoopySchedule schedules[] = {SYNCHRONOUS_SCHEDULE, RESIDUAL_SCHEDULE};
+	for (int32_t i = 0; i < 2; i++)
+	{
+		CLoopyMaxProduct* bp = new CLoopyMaxProduct(fg);
+		SG_REF(bp);
+		bp->set_schedule(schedules[i]);
+
+		SGVector<int32_t> assignment(fg->get_num_vars());
+		EXPECT_NEAR(optimum, bp->inference(assignment), 1E-10);
+		EXPECT_TRUE(bp->get_converged());
+		EXPECT_LT(bp->get_num_iter(), bp->get_max_iter());
+
+		SG_UNREF(bp);
+	}
+
+	SG_UNREF(fg);
+}
+
+TEST(MAPInference, graph_cut_submodular)
+{
+	for (int32_t seed = 1; seed <= 5; seed++)
+	{
+		CFactorGraph* fg = create_grid(4, 3, 2, true, false, seed);
+		SG_REF(fg);
+		ASSERT_FALSE(fg->is_tree_graph());
+
+		float64_t optimum = brute_force(fg);
+		EXPECT_NEAR(optimum, map_energy(fg, GRAPH_CUT), 1E-10);
+		EXPECT_NEAR(optimum, map_energy(fg, TRWS_MAX_PROD), 1E-10);
+		EXPECT_GE(map_energy(fg, LOOPY_MAX_PROD), optimum - 1E-10);
+
+		// wrong states are penalized, the energies stay submodular
+		SGVector<int32_t> states_gt(fg->get_num_vars());
+		states_gt.zero();
+		fg->loss_augmentation(states_gt);
+		EXPECT_NEAR(brute_force(fg), map_energy(fg, GRAPH_CUT), 1E-10);
+
+		SG_UNREF(fg);
+	}
+}
+
+TEST(MAPInference, trws_loopy_graph)
+{
+	for (int32_t seed = 1; seed <= 5; seed++)
+	{
+		CFactorGraph* fg = create_grid(3, 3, 3, false, false, seed);
+		SG_REF(fg);
+
+		float64_t optimum = brute_force(fg);
+		EXPECT_GE(map_energy(fg, TRWS_MAX_PROD), optimum - 1E-10);
+		EXPECT_GE(map_energy(fg, LOOPY_MAX_PROD), optimum - 1E-10);
+
+		SG_UNREF(fg);
+	}
+}